@@ -25,6 +25,15 @@ namespace tfel::numpy {
       const boost::python::numpy::ndarray&);
 
   TFEL_NUMPY_EXPORT double* get_data(boost::python::numpy::ndarray&);
+  /*!
+   * \brief create a one dimensional array aliasing an existing buffer
+   * \param[in] p: pointer to the first element of the buffer
+   * \param[in] n: number of elements
+   * \param[in] o: owner of the buffer, kept alive as long as the array
+   * \note no copy is made: modifying the array modifies the buffer
+   */
+  TFEL_NUMPY_EXPORT boost::python::numpy::ndarray make_view(
+      double* const, const size_t, boost::python::object);
 
 }  // end of namespace tfel::numpy
 
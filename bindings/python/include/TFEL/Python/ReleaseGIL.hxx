@@ -0,0 +1,48 @@
+/*!
+ * \file   ReleaseGIL.hxx
+ * \brief This file introduces a small helper class used to release the
+ * python global interpreter lock during long computations.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_PYTHON_RELEASEGIL_HXX
+#define LIB_TFEL_PYTHON_RELEASEGIL_HXX
+
+#include <Python.h>
+
+namespace tfel::python {
+
+  /*!
+   * \brief release the global interpreter lock (GIL) in the
+   * constructor and acquire it back in the destructor.
+   *
+   * No python object can be manipulated while an instance of this
+   * class is alive. Acquiring the lock back in the destructor ensures
+   * that exceptions thrown by the computation are correctly translated
+   * into python exceptions.
+   */
+  struct ReleaseGIL {
+    //! \brief default constructor
+    ReleaseGIL() : state(PyEval_SaveThread()) {}
+    ReleaseGIL(ReleaseGIL&&) = delete;
+    ReleaseGIL(const ReleaseGIL&) = delete;
+    ReleaseGIL& operator=(ReleaseGIL&&) = delete;
+    ReleaseGIL& operator=(const ReleaseGIL&) = delete;
+    //! \brief destructor
+    ~ReleaseGIL() { PyEval_RestoreThread(this->state); }
+
+   private:
+    //! \brief state of the current thread
+    PyThreadState* const state;
+  };  // end of struct ReleaseGIL
+
+}  // end of namespace tfel::python
+
+#endif /* LIB_TFEL_PYTHON_RELEASEGIL_HXX */
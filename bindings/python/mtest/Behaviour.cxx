@@ -306,6 +306,11 @@ void declareBehaviour() {
       .def("setUnsignedIntegerParameter",
            &Behaviour::setUnsignedIntegerParameter,
            "set the given parameter' value")
+      .def("hasInstanceParameters", &Behaviour::hasInstanceParameters,
+           "return true if the values of the parameters can be changed for "
+           "this object only")
+      .def("setInstanceParameter", &Behaviour::setInstanceParameter,
+           "set the given parameter' value for this object only")
       .def("hasBounds", &Behaviour::hasBounds,
            "return true if the given variable has bounds")
       .def("hasLowerBound", &Behaviour::hasLowerBound,
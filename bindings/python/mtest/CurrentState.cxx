@@ -17,6 +17,10 @@
 #include "MTest/Behaviour.hxx"
 #include "MTest/CurrentState.hxx"
 #include "TFEL/Python/VectorConverter.hxx"
+#ifdef TFEL_NUMPY_SUPPORT
+#include <type_traits>
+#include "TFEL/Numpy/ndarray.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 
 #define TFEL_PYTHON_CURRENTSTATEGETTER(X)                     \
   static tfel::math::vector<mtest::real> CurrentState_get##X( \
@@ -72,11 +76,17 @@ static auto v_size(const tfel::math::vector<mtest::CurrentState>& v)
   return v.end() - v.begin();
 }
 
-static boost::python::object getInternalStateVariableValue(
-    const mtest::CurrentState& s, const std::string& n, const int i) {
-  auto throw_if = [](const bool b, const std::string& m) {
-    tfel::raise_if(b, "mtest::getInternalStateVariableValue: " + m);
-  };
+static void throw_if(const bool b, const std::string& m) {
+  tfel::raise_if(b, "mtest::getInternalStateVariableValue: " + m);
+}  // end of throw_if
+
+/*!
+ * \return the position and the size of an internal state variable
+ * \param[in] s: current state
+ * \param[in] n: variable name
+ */
+static std::pair<std::size_t, std::size_t> getInternalStateVariableLocation(
+    const mtest::CurrentState& s, const std::string& n) {
   throw_if(s.behaviour == nullptr, "no behaviour defined");
   const auto& ivsnames = s.behaviour->getInternalStateVariablesNames();
   throw_if(std::find(ivsnames.begin(), ivsnames.end(), n) == ivsnames.end(),
@@ -84,8 +94,7 @@ static boost::python::object getInternalStateVariableValue(
            "variable named '" +
                n + "'");
   const auto type = s.behaviour->getInternalStateVariableType(n);
-  const auto size = [&s, throw_if,
-                     type]() -> std::vector<mtest::real>::size_type {
+  const auto size = [&s, type]() -> std::size_t {
     if (type == 0) {
       return 1;
     } else if (type == 1) {
@@ -102,17 +111,30 @@ static boost::python::object getInternalStateVariableValue(
   throw_if((s.iv_1.size() < pos + size) || (s.iv0.size() < pos + size) ||
                (s.iv1.size() < pos + size),
            "invalid size for state variables (bad initialization)");
-  const auto& iv = [&s, throw_if,
-                    i]() -> const tfel::math::vector<mtest::real>& {
-    throw_if((i != 1) && (i != 0) && (i != -1), "invalid depth");
-    if (i == -1) {
-      return s.iv_1;
-    } else if (i == 0) {
-      return s.iv0;
-    }
-    return s.iv1;
-  }();
-  if (type == 0) {
+  return {pos, size};
+}  // end of getInternalStateVariableLocation
+
+/*!
+ * \return the values of the internal state variables at the given depth
+ * \param[in] s: current state
+ * \param[in] i: depth
+ */
+template <typename CurrentStateType>
+static auto& getInternalStateVariables(CurrentStateType& s, const int i) {
+  throw_if((i != 1) && (i != 0) && (i != -1), "invalid depth");
+  if (i == -1) {
+    return s.iv_1;
+  } else if (i == 0) {
+    return s.iv0;
+  }
+  return s.iv1;
+}  // end of getInternalStateVariables
+
+static boost::python::object getInternalStateVariableValue(
+    const mtest::CurrentState& s, const std::string& n, const int i) {
+  const auto [pos, size] = getInternalStateVariableLocation(s, n);
+  const auto& iv = getInternalStateVariables(s, i);
+  if (s.behaviour->getInternalStateVariableType(n) == 0) {
     return boost::python::object(iv[pos]);
   }
   return boost::python::object(
@@ -124,6 +146,49 @@ static boost::python::object getInternalStateVariableValue(
   return getInternalStateVariableValue(s, n, 1);
 }  // end of getInternalStateVariableValue
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+static_assert(std::is_same_v<mtest::real, double>,
+              "numpy views require mtest::real to be double");
+
+/*
+ * The following functions return numpy arrays aliasing the buffers of
+ * a current state. The python object wrapping the current state is the
+ * owner of those arrays, so that it is kept alive as long as the arrays
+ * are.
+ */
+
+#define TFEL_PYTHON_CURRENTSTATEVIEW(X)                                 \
+  static boost::python::numpy::ndarray CurrentState_get##X##View(       \
+      boost::python::object o) {                                        \
+    auto& s = boost::python::extract<mtest::CurrentState&>(o)();        \
+    return tfel::numpy::make_view(s.X.data(), s.X.size(), o);           \
+  }
+
+TFEL_PYTHON_CURRENTSTATEVIEW(s_1)
+TFEL_PYTHON_CURRENTSTATEVIEW(s0)
+TFEL_PYTHON_CURRENTSTATEVIEW(s1)
+TFEL_PYTHON_CURRENTSTATEVIEW(e0)
+TFEL_PYTHON_CURRENTSTATEVIEW(e1)
+TFEL_PYTHON_CURRENTSTATEVIEW(iv_1)
+TFEL_PYTHON_CURRENTSTATEVIEW(iv0)
+TFEL_PYTHON_CURRENTSTATEVIEW(iv1)
+
+static boost::python::numpy::ndarray getInternalStateVariableView(
+    boost::python::object o, const std::string& n, const int i) {
+  auto& s = boost::python::extract<mtest::CurrentState&>(o)();
+  const auto [pos, size] = getInternalStateVariableLocation(s, n);
+  auto& iv = getInternalStateVariables(s, i);
+  return tfel::numpy::make_view(iv.data() + pos, size, o);
+}  // end of getInternalStateVariableView
+
+static boost::python::numpy::ndarray getInternalStateVariableView(
+    boost::python::object o, const std::string& n) {
+  return getInternalStateVariableView(o, n, 1);
+}  // end of getInternalStateVariableView
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 void declareCurrentState();
 
 void declareCurrentState() {
@@ -146,7 +211,8 @@ void declareCurrentState() {
   object (*ptr6)(const mtest::CurrentState&, const std::string&, const int) =
       ::getInternalStateVariableValue;
 
-  class_<mtest::CurrentState>("CurrentState")
+  auto c = class_<mtest::CurrentState>("CurrentState");
+  c
       .add_property("s_1", CurrentState_gets_1)
       .add_property("s0", CurrentState_gets0)
       .add_property("s1", CurrentState_gets1)
@@ -228,6 +294,40 @@ void declareCurrentState() {
            "current time step\n"
            "- 1 means that we request the  value at the end of the current "
            "time step");
+#ifdef TFEL_NUMPY_SUPPORT
+  numpy::ndarray (*ptr7)(object, const std::string&) =
+      ::getInternalStateVariableView;
+  numpy::ndarray (*ptr8)(object, const std::string&, const int) =
+      ::getInternalStateVariableView;
+  c.add_property("s_1_view", CurrentState_gets_1View)
+      .add_property("s0_view", CurrentState_gets0View)
+      .add_property("s1_view", CurrentState_gets1View)
+      .add_property("e0_view", CurrentState_gete0View)
+      .add_property("e1_view", CurrentState_gete1View)
+      .add_property("iv_1_view", CurrentState_getiv_1View)
+      .add_property("iv0_view", CurrentState_getiv0View)
+      .add_property("iv1_view", CurrentState_getiv1View)
+      .def("getInternalStateVariableView", ptr7,
+           "return a numpy array aliasing the values of an internal state "
+           "variable at the end of the time step\n"
+           "\n"
+           "param[in]  n: variable name\n"
+           "\n"
+           "No copy is made: modifying the array modifies the current "
+           "state. The array is invalidated if the current state is "
+           "initialized again.")
+      .def("getInternalStateVariableView", ptr8,
+           "return a numpy array aliasing the values of an internal state "
+           "variable\n"
+           "\n"
+           "param[in]  n: variable name\n"
+           "param[in]  d: depth\n"
+           "\n"
+           "The depth value has the same meaning as for the "
+           "`getInternalStateVariableValue` method. No copy is made: "
+           "modifying the array modifies the current state. The array is "
+           "invalidated if the current state is initialized again.");
+#endif /* TFEL_NUMPY_SUPPORT */
 
   class_<tfel::math::vector<mtest::CurrentState>>("CurrentStateVector")
       .def("__iter__",
@@ -14,6 +14,7 @@
 #include <boost/python.hpp>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Python/ReleaseGIL.hxx"
 #include "MTest/MTest.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/Behaviour.hxx"
@@ -830,6 +831,25 @@ static void MTest_addEvent(mtest::MTest& m,
   m.addEvent(n, std::vector<mtest::real>(1u, t));
 }  // end of MTest_addEvent
 
+static tfel::tests::TestResult MTest_execute(mtest::MTest& t, const bool b) {
+  const tfel::python::ReleaseGIL gil;
+  return t.execute(b);
+}  // end of MTest_execute
+
+static tfel::tests::TestResult MTest_execute2(mtest::MTest& t) {
+  const tfel::python::ReleaseGIL gil;
+  return t.execute();
+}  // end of MTest_execute2
+
+static void MTest_execute3(mtest::MTest& t,
+                           mtest::StudyCurrentState& s,
+                           mtest::SolverWorkSpace& wk,
+                           const mtest::real ti,
+                           const mtest::real te) {
+  const tfel::python::ReleaseGIL gil;
+  t.execute(s, wk, ti, te);
+}  // end of MTest_execute3
+
 void declareMTest();
 
 void declareMTest() {
@@ -928,15 +948,10 @@ void declareMTest() {
            "- 1 means that we request the  value at the end of the current "
            "time step");
 
-  TestResult (MTest::*pm)(const bool) = &MTest::execute;
-  TestResult (MTest::*pm2)() = &MTest::execute;
-  void (MTest::*pm3)(StudyCurrentState&, SolverWorkSpace&, const real,
-                     const real) = &MTest::execute;
-
   class_<MTest, noncopyable, bases<SingleStructureScheme>>("MTest")
-      .def("execute", pm)
-      .def("execute", pm2)
-      .def("execute", pm3)
+      .def("execute", MTest_execute)
+      .def("execute", MTest_execute2)
+      .def("execute", MTest_execute3)
       .def("completeInitialisation", &MTest::completeInitialisation)
       .def("initializeCurrentState", &MTest::initializeCurrentState)
       .def("initializeWorkSpace", &MTest::initializeWorkSpace)
@@ -0,0 +1,58 @@
+/*!
+ * \file  bindings/python/mtest/MTestEnsemble.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <boost/python.hpp>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Python/ReleaseGIL.hxx"
+#include "MTest/MTestEnsemble.hxx"
+
+void declareMTestEnsemble();
+
+static std::vector<std::vector<mtest::real>> MTestEnsemble_execute(
+    mtest::MTestEnsemble& e,
+    const std::vector<std::vector<mtest::real>>& samples) {
+  const tfel::python::ReleaseGIL gil;
+  return e.execute(samples);
+}  // end of MTestEnsemble_execute
+
+static void MTestEnsemble_setOutputMode(mtest::MTestEnsemble& e,
+                                        const std::string& m) {
+  if (m == "final") {
+    e.setOutputMode(mtest::MTestEnsemble::FINALVALUES);
+  } else if (m == "history") {
+    e.setOutputMode(mtest::MTestEnsemble::HISTORY);
+  } else {
+    tfel::raise(
+        "MTestEnsemble::setOutputMode: "
+        "unknown mode '" +
+        m + "' (valid values are 'final' and 'history')");
+  }
+}  // end of MTestEnsemble_setOutputMode
+
+void declareMTestEnsemble() {
+  using namespace boost::python;
+  using namespace mtest;
+  class_<MTestEnsemble, boost::noncopyable>("MTestEnsemble",
+                                            init<std::string>())
+      .def(init<std::string, std::vector<std::string>>())
+      .def(init<std::string, std::vector<std::string>,
+                std::map<std::string, std::string>>())
+      .def("setSampledVariables", &MTestEnsemble::setSampledVariables)
+      .def("setOutputs", &MTestEnsemble::setOutputs)
+      .def("setOutputMode", MTestEnsemble_setOutputMode)
+      .def("setNumberOfThreads", &MTestEnsemble::setNumberOfThreads)
+      .def("execute", MTestEnsemble_execute,
+           "run the computations associated with the given samples "
+           "and return the outputs of each sample. The outputs of a "
+           "failed sample are empty.");
+}  // end of declareMTestEnsemble
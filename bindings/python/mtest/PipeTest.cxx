@@ -17,6 +17,7 @@
 #include <boost/python.hpp>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Python/ReleaseGIL.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/SolverWorkSpace.hxx"
@@ -160,13 +161,40 @@ static void PipeTest_setElementType(mtest::PipeTest& t, const std::string& e) {
   }
 }  // end of PipeTest_setElementType
 
+static void PipeTest_setLinearSolver(mtest::PipeTest& t,
+                                     const std::string& s) {
+  if (s == "Dense") {
+    t.setLinearSolver(mtest::PipeTest::DENSELINEARSOLVER);
+  } else if (s == "Banded") {
+    t.setLinearSolver(mtest::PipeTest::BANDEDLINEARSOLVER);
+  } else {
+    tfel::raise(
+        "PipeTest::setLinearSolver: "
+        "invalid linear solver ('" +
+        s +
+        "').\n"
+        "Valid linear solvers are 'Dense' and 'Banded'");
+  }
+}  // end of PipeTest_setLinearSolver
+
+static tfel::tests::TestResult PipeTest_execute(mtest::PipeTest& t) {
+  const tfel::python::ReleaseGIL gil;
+  return t.execute();
+}  // end of PipeTest_execute
+
+static void PipeTest_execute2(const mtest::PipeTest& t,
+                              mtest::StudyCurrentState& s,
+                              mtest::SolverWorkSpace& wk,
+                              const mtest::real ti,
+                              const mtest::real te) {
+  const tfel::python::ReleaseGIL gil;
+  t.execute(s, wk, ti, te);
+}  // end of PipeTest_execute2
+
 void declarePipeTest();
 
 void declarePipeTest() {
   using namespace mtest;
-  tfel::tests::TestResult (PipeTest::*pm)() = &PipeTest::execute;
-  void (PipeTest::*pm2)(StudyCurrentState&, SolverWorkSpace&, const real,
-                        const real) const = &PipeTest::execute;
   boost::python::enum_<mtest::PipeTest::Configuration>("PipeTestConfiguration")
       .value("INTIAL_CONFIGURATION",
              mtest::PipeTest::Configuration::INTIAL_CONFIGURATION)
@@ -196,8 +224,8 @@ void declarePipeTest() {
       .def("setNumberOfElements", &PipeTest::setNumberOfElements)
       .def("getNumberOfUnknowns", &PipeTest::getNumberOfUnknowns)
       .def("completeInitialisation", &PipeTest::completeInitialisation)
-      .def("execute", pm)
-      .def("execute", pm2)
+      .def("execute", PipeTest_execute)
+      .def("execute", PipeTest_execute2)
       .def("initializeCurrentState", &PipeTest::initializeCurrentState)
       .def("initializeWorkSpace", &PipeTest::initializeWorkSpace)
       .def("setInnerPressureEvolution", &PipeTest_setInnerPressureEvolution)
@@ -292,6 +320,13 @@ void declarePipeTest() {
            "is user-specified. See the 'setOuterRadiusEvolution' "
            "method for details.\n")
       .def("setElementType", &PipeTest_setElementType)
+      .def("setLinearSolver", &PipeTest_setLinearSolver,
+           "set the linear solver used to solve the global equilibrium. "
+           "Valid values are 'Dense' (default) and 'Banded'")
+      .def("setNumberOfThreads", &PipeTest::setNumberOfThreads,
+           "set the number of threads used to integrate the behaviour "
+           "over the elements")
+      .def("getNumberOfThreads", &PipeTest::getNumberOfThreads)
       .def("addProfile", &PipeTest::addProfile)
       .def("computeMinimumValue",
            static_cast<real (PipeTest::*)(const StudyCurrentState&,
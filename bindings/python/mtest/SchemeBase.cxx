@@ -88,6 +88,19 @@ static void setOutputFrequency(mtest::SchemeBase& s, const std::string& v) {
   }
 }
 
+static void setOutputFileFormat(mtest::SchemeBase& s, const std::string& v) {
+  if (v == "text") {
+    s.setOutputFileFormat(mtest::SchemeBase::TEXTFILEFORMAT);
+  } else if (v == "binary") {
+    s.setOutputFileFormat(mtest::SchemeBase::BINARYFILEFORMAT);
+  } else {
+    tfel::raise(
+        "SchemeBase::setOutputFileFormat: "
+        "invalid format '" +
+        v + "'");
+  }
+}
+
 static void SchemeBase_printOutput(mtest::SchemeBase& s,
                                    const mtest::real t,
                                    const mtest::StudyCurrentState& scs) {
@@ -248,6 +261,13 @@ void declareSchemeBase() {
            "This method specify the number of digits used to print "
            "the results in the output file.\n"
            "* The parameter (uint) is the number of digits wanted.")
+      .def("setOutputFileFormat", setOutputFileFormat,
+           "This method specify the format of the output file.\n"
+           "* The parameter (string) specify the choosen format. "
+           "The two allowed formats are:\n"
+           "- 'text': the results are written as text (default).\n"
+           "- 'binary': the results are written in a binary columnar "
+           "format which can be read by the TextData class.")
       .def("printOutput", &SchemeBase::printOutput)
       .def("printOutput", &SchemeBase_printOutput)
       .def("setResidualFileName", &SchemeBase::setResidualFileName,
@@ -14,6 +14,9 @@
 #include <boost/python.hpp>
 #include "MTest/RoundingMode.hxx"
 #include "MTest/SolverOptions.hxx"
+#ifdef TFEL_NUMPY_SUPPORT
+#include "TFEL/Numpy/InitNumpy.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 
 void declareMaterialProperty();
 void declareBehaviour();
@@ -22,6 +25,7 @@ void declareSingleStructureScheme();
 void declareConstraint();
 void declareMTest();
 void declareMTestParser();
+void declareMTestEnsemble();
 void declarePipeMesh();
 void declarePipeTest();
 void declareCurrentState();
@@ -32,6 +36,9 @@ void declareMFrontLogStream();
 void declareMTestFileExport();
 
 BOOST_PYTHON_MODULE(_mtest) {
+#ifdef TFEL_NUMPY_SUPPORT
+  tfel::numpy::initializeNumPy();
+#endif /* TFEL_NUMPY_SUPPORT */
   boost::python::enum_<mtest::StiffnessUpdatingPolicy>(
       "StiffnessUpdatingPolicy")
       .value("CONSTANTSTIFFNESS",
@@ -65,6 +72,7 @@ BOOST_PYTHON_MODULE(_mtest) {
   declareStudyCurrentState();
   declareSolverWorkSpace();
   declareMTestParser();
+  declareMTestEnsemble();
   declareSchemeBase();
   declareSingleStructureScheme();
   declareConstraint();
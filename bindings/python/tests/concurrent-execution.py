@@ -0,0 +1,64 @@
+import os
+import threading
+try:
+    import unittest2 as unittest
+except ImportError:
+    import unittest
+import tfel.math
+import tfel.material
+import mtest
+
+mtest.setVerboseMode(mtest.VerboseLevel.VERBOSE_QUIET)
+
+
+def run(young):
+    l = os.environ['MTEST_BEHAVIOUR_LIBRARY']
+    m = mtest.MTest()
+    m.setModellingHypothesis('Tridimensional')
+    m.setBehaviour('generic', l, 'ImplicitNorton')
+    m.setMaterialProperty('YoungModulus', young)
+    m.setMaterialProperty('PoissonRatio', 0.3)
+    m.setExternalStateVariable('Temperature', 293.15)
+    m.setImposedStrain('EXX', {0: 0, 100: 1e-2})
+    m.completeInitialisation()
+    s = mtest.StudyCurrentState()
+    wk = mtest.SolverWorkSpace()
+    m.initializeCurrentState(s)
+    m.initializeWorkSpace(wk)
+    times = [float(i) for i in range(0, 101)]
+    for ti, te in zip(times[:-1], times[1:]):
+        m.execute(s, wk, ti, te)
+    cs = s.getStructureCurrentState('').istates[0]
+    return list(cs.s1) + list(cs.iv1)
+
+
+class ConcurrentExecution(unittest.TestCase):
+    def test(self):
+        samples = [100e9 + 10e9 * i for i in range(8)]
+        sequential = [run(E) for E in samples]
+        concurrent = [None] * len(samples)
+
+        def worker(i):
+            concurrent[i] = run(samples[i])
+
+        threads = [
+            threading.Thread(target=worker, args=(i, ))
+            for i in range(len(samples))
+        ]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for r1, r2 in zip(sequential, concurrent):
+            self.assertTrue(r2 is not None)
+            self.assertTrue(len(r1) == len(r2))
+            for v1, v2 in zip(r1, r2):
+                self.assertTrue(abs(v1 - v2) <= 1e-12 * max(abs(v1), 1.))
+        # the results differ from one sample to the other
+        # the stress reaches a steady state which does not depend on the
+        # Young modulus, contrary to the elastic strain
+        self.assertTrue(abs(sequential[0][6] - sequential[1][6]) > 1e-5)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,84 @@
+import os
+import gc
+try:
+    import unittest2 as unittest
+except ImportError:
+    import unittest
+import numpy
+import tfel.math
+import tfel.material
+import mtest
+
+mtest.setVerboseMode(mtest.VerboseLevel.VERBOSE_QUIET)
+
+
+def build(young=150e9):
+    l = os.environ['MTEST_BEHAVIOUR_LIBRARY']
+    m = mtest.MTest()
+    m.setModellingHypothesis('Tridimensional')
+    m.setBehaviour('generic', l, 'ImplicitNorton')
+    m.setMaterialProperty('YoungModulus', young)
+    m.setMaterialProperty('PoissonRatio', 0.3)
+    m.setExternalStateVariable('Temperature', 293.15)
+    m.setImposedStrain('EXX', {0: 0, 1: 1e-3})
+    m.completeInitialisation()
+    s = mtest.StudyCurrentState()
+    wk = mtest.SolverWorkSpace()
+    m.initializeCurrentState(s)
+    m.initializeWorkSpace(wk)
+    m.execute(s, wk, 0, 1)
+    return m, s, wk
+
+
+def get_elastic_strain_view():
+    # only the view is returned: the study, the structure current state
+    # and the current state are no more referenced by python variables
+    m, s, wk = build()
+    cs = s.getStructureCurrentState('').istates[0]
+    v = cs.getInternalStateVariableView('ElasticStrain')
+    return v, numpy.array(cs.getInternalStateVariableValue('ElasticStrain'))
+
+
+class CurrentStateViews(unittest.TestCase):
+    def test_views(self):
+        m, s, wk = build()
+        cs = s.getStructureCurrentState('').istates[0]
+        for n in [
+                's_1', 's0', 's1', 'e0', 'e1', 'iv_1', 'iv0', 'iv1'
+        ]:
+            v = getattr(cs, n + '_view')
+            values = getattr(cs, n)
+            self.assertTrue(isinstance(v, numpy.ndarray))
+            self.assertTrue(v.dtype == numpy.float64)
+            self.assertTrue(v.shape == (len(values), ))
+            self.assertTrue(numpy.allclose(v, values, rtol=0, atol=0))
+        self.assertTrue(abs(cs.s1_view[0]) > 1e6)
+        # the views alias the buffers of the current state
+        cs.iv1_view[6] = 1.2e-3
+        self.assertTrue(abs(cs.getInternalStateVariableValue('p') -
+                            1.2e-3) < 1e-14)
+        p = cs.getInternalStateVariableView('p', 0)
+        self.assertTrue(p.shape == (1, ))
+        p[0] = 2.3e-3
+        self.assertTrue(abs(cs.getInternalStateVariableValue('p', 0) -
+                            2.3e-3) < 1e-14)
+        self.assertTrue(abs(cs.iv0[6] - 2.3e-3) < 1e-14)
+        with self.assertRaises(Exception):
+            cs.getInternalStateVariableView('p', 2)
+        with self.assertRaises(Exception):
+            cs.getInternalStateVariableView('UnknownVariable')
+
+    def test_lifetime(self):
+        v, values = get_elastic_strain_view()
+        self.assertTrue(v.base is not None)
+        gc.collect()
+        # allocating new studies would reuse the memory of the first one
+        # if it had been released
+        others = [build(young=100e9 + 10e9 * i) for i in range(4)]
+        self.assertTrue(v.shape == (6, ))
+        self.assertTrue(numpy.allclose(v, values, rtol=0, atol=0))
+        del others
+
+
+if __name__ == '__main__':
+    unittest.main()
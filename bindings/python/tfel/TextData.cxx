@@ -26,6 +26,8 @@ void declareTextData() {
   class_<TextData, boost::noncopyable>("TextData", no_init)
       .def(init<std::string>())
       .def(init<std::string, std::string>())
-      .def("getColumn", getColumn);
+      .def("getColumn", getColumn)
+      .def("findColumn", &TextData::findColumn)
+      .def("getLegend", &TextData::getLegend);
 
 }  // end of declaretvector
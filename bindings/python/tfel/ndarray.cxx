@@ -40,4 +40,13 @@ namespace tfel::numpy {
     return reinterpret_cast<double*>(a.get_data());
   }  // end of get_data
 
+  boost::python::numpy::ndarray make_view(double* const p,
+                                          const size_t n,
+                                          boost::python::object o) {
+    return boost::python::numpy::from_data(
+        p, boost::python::numpy::dtype::get_builtin<double>(),
+        boost::python::make_tuple(n),
+        boost::python::make_tuple(sizeof(double)), o);
+  }  // end of make_view
+
 }  // end of namespace tfel::numpy
@@ -16,6 +16,7 @@
 
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/qt.hxx"
@@ -50,8 +51,12 @@ namespace tfel::material {
     static std::string convert_to_string(const T& value) {
       if constexpr (tfel::math::isQuantity<T>()) {
         return std::to_string(value.getValue());
-      } else {
+      } else if constexpr (std::is_arithmetic_v<T>) {
         return std::to_string(value);
+      } else {
+        // numeric types providing a `getValue` free function, such as
+        // dual numbers
+        return convert_to_string(getValue(value));
       }
     }
 
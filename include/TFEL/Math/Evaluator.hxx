@@ -16,13 +16,17 @@
 #define LIB_TFEL_MATH_EVALUATOR_HXX
 
 #include <map>
+#include <span>
+#include <array>
 #include <memory>
 #include <vector>
 #include <string>
 #include <functional>
+#include <type_traits>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 #include "TFEL/Math/Parser/EvaluatorBase.hxx"
 #include "TFEL/Math/Parser/ExternalFunction.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -202,6 +206,28 @@ namespace tfel::math {
      * have been set with the `setVariableValue` method.
      */
     double operator()(const std::map<std::string, double>&);
+    /*!
+     * \brief evaluate the formula at many points
+     * \param[out] r: values of the formula at each point
+     * \param[in] v: values of the variables. The i-th span gives the
+     * values of the variable at the i-th position at each point.
+     * \note the values of the variables may be modified by this method.
+     */
+    void getValues(std::span<double>,
+                   std::span<const std::span<const double>>);
+    /*!
+     * \brief evaluate the formula at many points
+     * \param[out] r: values of the formula at each point
+     * \param[in] v: values of the variables, given in the order of their
+     * positions.
+     * \note the values of the variables may be modified by this method.
+     */
+    template <typename... Values>
+    void getValues(std::span<double>, const Values&...)  //
+        requires((sizeof...(Values) > 0) &&
+                 (std::is_convertible_v<const Values&,
+                                        std::span<const double>> &&
+                  ...));
     /*!
      * \return a string representation of the evaluator suitable to
      * be integrated in a C++ code.
@@ -236,6 +262,12 @@ namespace tfel::math {
         const std::map<std::string, std::vector<double>::size_type>&)
         const override;
     void getParametersNames(std::set<std::string>&) const override;
+    /*!
+     * \return the position of the given variable
+     * \param[in] n: name of the variable
+     */
+    std::vector<double>::size_type getVariablePosition(
+        const std::string&) const;
     ~Evaluator() override;
 
    private:
@@ -244,6 +276,8 @@ namespace tfel::math {
     static bool TFEL_VISIBILITY_LOCAL isNumber(const std::string&);
     //! \brief clear the object
     TFEL_VISIBILITY_LOCAL void clear();
+    //! \brief build the program associated with the expression
+    TFEL_VISIBILITY_LOCAL void compile();
     void TFEL_VISIBILITY_LOCAL
     treatDiff(std::vector<std::string>::const_iterator&,
               const std::vector<std::string>::const_iterator,
@@ -253,8 +287,6 @@ namespace tfel::math {
     registerVariable(const std::string&);
     std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
         TFEL_VISIBILITY_LOCAL getExternalFunctionManager();
-    std::vector<double>::size_type TFEL_VISIBILITY_LOCAL
-    getVariablePosition(const std::string&) const;
     std::vector<std::string> TFEL_VISIBILITY_LOCAL
     analyseParameters(std::vector<std::string>::const_iterator&,
                       const std::vector<std::string>::const_iterator);
@@ -350,10 +382,22 @@ namespace tfel::math {
      * formula to be evaluated
      */
     ExprPtr expr;
+    //! \brief flat representation of the expression used for evaluations
+    tfel::math::parser::ExprProgram program;
     //! \brief a pointer to externally defined functions
     std::shared_ptr<tfel::math::parser::ExternalFunctionManager> manager;
   };  // end of struct Evaluator
 
+  template <typename... Values>
+  void Evaluator::getValues(std::span<double> r, const Values&... v)  //
+      requires((sizeof...(Values) > 0) &&
+               (std::is_convertible_v<const Values&, std::span<const double>> &&
+                ...)) {
+    const auto values = std::array<std::span<const double>, sizeof...(Values)>{
+        std::span<const double>(v)...};
+    this->getValues(r, std::span<const std::span<const double>>(values));
+  }  // end of getValues
+
 }  // end of namespace tfel::math
 
 #include "TFEL/Math/Parser/EvaluatorTExpr.hxx"
@@ -0,0 +1,658 @@
+/*!
+ * \file   include/TFEL/Math/General/DualNumber.hxx
+ * \brief  This file declares the `DualNumber` class, used for the forward
+ * mode of automatic differentiation.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_GENERAL_DUALNUMBER_HXX
+#define LIB_TFEL_MATH_GENERAL_DUALNUMBER_HXX
+
+#include <cmath>
+#include <array>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/TypeTraits/IsReal.hxx"
+#include "TFEL/TypeTraits/IsScalar.hxx"
+#include "TFEL/TypeTraits/IsComplex.hxx"
+#include "TFEL/TypeTraits/BaseType.hxx"
+#include "TFEL/TypeTraits/Promote.hxx"
+#include "TFEL/TypeTraits/IsAssignableTo.hxx"
+#include "TFEL/TypeTraits/IsFundamentalNumericType.hxx"
+#include "TFEL/Metaprogramming/InvalidType.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/General/BasicOperations.hxx"
+#include "TFEL/Math/General/ResultType.hxx"
+#include "TFEL/Math/General/UnaryResultType.hxx"
+#include "TFEL/Math/power.hxx"
+
+namespace tfel::math {
+
+  //! \brief forward declaration
+  template <typename ValueType, unsigned short N>
+  struct DualNumber;
+
+  /*!
+   * \brief concept satisfied by the types which can be combined with a
+   * dual number
+   */
+  template <typename T>
+  concept DualNumberCompatibleConstant = std::is_arithmetic_v<T>;
+
+  //! \return the value of a dual number
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr ValueType getValue(
+      const DualNumber<ValueType, N>& x) noexcept {
+    return x.value;
+  }  // end of getValue
+
+  /*!
+   * \brief build a dual number whose `i`-th derivative is one
+   * \param[in] v: value
+   * \param[in] i: index of the associated variable
+   */
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> makeVariable(
+      const ValueType v, const unsigned short i) noexcept {
+    auto r = DualNumber<ValueType, N>(v);
+    r.derivatives[i] = ValueType{1};
+    return r;
+  }  // end of makeVariable
+
+  /*!
+   * \brief apply a function to a dual number, knowing its value `f` and
+   * its derivative `df`
+   */
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> applyChainRule(
+      const DualNumber<ValueType, N>& x,
+      const ValueType f,
+      const ValueType df) noexcept {
+    auto r = DualNumber<ValueType, N>(f);
+    for (unsigned short i = 0; i != N; ++i) {
+      r.derivatives[i] = df * x.derivatives[i];
+    }
+    return r;
+  }  // end of applyChainRule
+
+  /*!
+   * \brief a number carrying its value and its derivatives with respect
+   * to `N` independent variables.
+   *
+   * Evaluating a function on dual numbers whose derivatives have been
+   * seeded by the identity matrix gives the value of the function and
+   * its exact derivatives with respect to the `N` variables in a single
+   * evaluation (forward mode of automatic differentiation).
+   *
+   * Comparison operators only consider the values, so that branches
+   * are taken as in the evaluation on real numbers.
+   *
+   * \tparam ValueType: underlying numeric type
+   * \tparam N: number of derivatives
+   */
+  template <typename ValueType, unsigned short N>
+  struct DualNumber {
+    static_assert(std::is_floating_point_v<ValueType>,
+                  "invalid value type");
+    //! \brief a simple alias
+    using value_type = ValueType;
+    //! \brief default constructor
+    TFEL_HOST_DEVICE constexpr DualNumber() noexcept
+        : value(0), derivatives{} {}
+    /*!
+     * \brief constructor from a constant
+     * \param[in] v: value
+     */
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr DualNumber(const T v) noexcept  // NOLINT
+      requires(std::is_arithmetic_v<T>)
+        : value(static_cast<ValueType>(v)), derivatives{} {}
+    /*!
+     * \brief constructor from a value and the derivatives
+     * \param[in] v: value
+     * \param[in] d: derivatives
+     */
+    TFEL_HOST_DEVICE constexpr DualNumber(
+        const ValueType v, const std::array<ValueType, N>& d) noexcept
+        : value(v), derivatives(d) {}
+    //! \brief copy constructor
+    constexpr DualNumber(const DualNumber&) noexcept = default;
+    //! \brief move constructor
+    constexpr DualNumber(DualNumber&&) noexcept = default;
+    //! \brief copy assignement
+    constexpr DualNumber& operator=(const DualNumber&) noexcept = default;
+    //! \brief move assignement
+    constexpr DualNumber& operator=(DualNumber&&) noexcept = default;
+    //! \brief assignement from a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr DualNumber& operator=(const T v) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      this->value = static_cast<ValueType>(v);
+      this->derivatives.fill(ValueType{0});
+      return *this;
+    }
+    //! \brief add a dual number
+    TFEL_HOST_DEVICE constexpr DualNumber& operator+=(
+        const DualNumber& x) noexcept {
+      this->value += x.value;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] += x.derivatives[i];
+      }
+      return *this;
+    }
+    //! \brief substract a dual number
+    TFEL_HOST_DEVICE constexpr DualNumber& operator-=(
+        const DualNumber& x) noexcept {
+      this->value -= x.value;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] -= x.derivatives[i];
+      }
+      return *this;
+    }
+    //! \brief multiply by a dual number
+    TFEL_HOST_DEVICE constexpr DualNumber& operator*=(
+        const DualNumber& x) noexcept {
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] =
+            this->derivatives[i] * x.value + this->value * x.derivatives[i];
+      }
+      this->value *= x.value;
+      return *this;
+    }
+    //! \brief divide by a dual number
+    TFEL_HOST_DEVICE constexpr DualNumber& operator/=(
+        const DualNumber& x) noexcept {
+      const auto ix = 1 / x.value;
+      this->value *= ix;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->derivatives[i] =
+            (this->derivatives[i] - this->value * x.derivatives[i]) * ix;
+      }
+      return *this;
+    }
+    //! \brief add a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr DualNumber& operator+=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      this->value += x;
+      return *this;
+    }
+    //! \brief substract a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr DualNumber& operator-=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      this->value -= x;
+      return *this;
+    }
+    //! \brief multiply by a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr DualNumber& operator*=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      this->value *= x;
+      for (auto& d : this->derivatives) {
+        d *= x;
+      }
+      return *this;
+    }
+    //! \brief divide by a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr DualNumber& operator/=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      return this->operator*=(1 / static_cast<ValueType>(x));
+    }
+    // Mathematical functions are defined as hidden friends: they are
+    // found by argument-dependent lookup but do not hide the functions
+    // of the standard library acting on floating-point numbers.
+    TFEL_HOST_DEVICE friend DualNumber sqrt(const DualNumber& x) noexcept {
+      const auto v = std::sqrt(x.value);
+      if (ieee754::fpclassify(v) == FP_ZERO) {
+        // the derivative is infinite: a null sub-gradient is used, as
+        // the norms built on the square root, such as the von Mises
+        // stress, are not differentiable at zero. The same convention
+        // is used by `cbrt`, `pow` and `power`.
+        return DualNumber(v);
+      }
+      return applyChainRule(x, v, 1 / (2 * v));
+    }
+    TFEL_HOST_DEVICE friend DualNumber cbrt(const DualNumber& x) noexcept {
+      const auto v = std::cbrt(x.value);
+      if (ieee754::fpclassify(v) == FP_ZERO) {
+        return DualNumber(v);
+      }
+      return applyChainRule(x, v, 1 / (3 * v * v));
+    }
+    TFEL_HOST_DEVICE friend DualNumber exp(const DualNumber& x) noexcept {
+      const auto v = std::exp(x.value);
+      return applyChainRule(x, v, v);
+    }
+    TFEL_HOST_DEVICE friend DualNumber log(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::log(x.value), 1 / x.value);
+    }
+    TFEL_HOST_DEVICE friend DualNumber log10(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::log10(x.value),
+                            1 / (x.value * std::log(ValueType{10})));
+    }
+    TFEL_HOST_DEVICE friend DualNumber sin(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::sin(x.value), std::cos(x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber cos(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::cos(x.value), -std::sin(x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber tan(const DualNumber& x) noexcept {
+      const auto v = std::tan(x.value);
+      return applyChainRule(x, v, 1 + v * v);
+    }
+    TFEL_HOST_DEVICE friend DualNumber asin(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::asin(x.value),
+                            1 / std::sqrt(1 - x.value * x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber acos(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::acos(x.value),
+                            -1 / std::sqrt(1 - x.value * x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber atan(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::atan(x.value),
+                            1 / (1 + x.value * x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber sinh(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::sinh(x.value), std::cosh(x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber cosh(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::cosh(x.value), std::sinh(x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber tanh(const DualNumber& x) noexcept {
+      const auto v = std::tanh(x.value);
+      return applyChainRule(x, v, 1 - v * v);
+    }
+    TFEL_HOST_DEVICE friend DualNumber erf(const DualNumber& x) noexcept {
+      constexpr auto c = ValueType(1.1283791670955125738961589031215452);
+      return applyChainRule(x, std::erf(x.value),
+                            c * std::exp(-x.value * x.value));
+    }
+    TFEL_HOST_DEVICE friend DualNumber fabs(const DualNumber& x) noexcept {
+      return x.value < 0 ? -x : x;
+    }
+    TFEL_HOST_DEVICE friend DualNumber pow(
+        const DualNumber& x, const DualNumber& y) noexcept {
+      const auto v = std::pow(x.value, y.value);
+      auto r = DualNumber(v);
+      const auto dx = y.value * std::pow(x.value, y.value - 1);
+      const auto dy = x.value > 0 ? v * std::log(x.value) : ValueType{0};
+      for (unsigned short i = 0; i != N; ++i) {
+        r.derivatives[i] = dx * x.derivatives[i] + dy * y.derivatives[i];
+      }
+      return r;
+    }
+    template <DualNumberCompatibleConstant T>
+    TFEL_HOST_DEVICE friend DualNumber pow(
+        const DualNumber& x, const T y) noexcept {
+      const auto e = static_cast<ValueType>(y);
+      if ((ieee754::fpclassify(x.value) == FP_ZERO) && (e < 1)) {
+        return DualNumber(std::pow(x.value, e));
+      }
+      return applyChainRule(x, std::pow(x.value, e),
+                            e * std::pow(x.value, e - 1));
+    }
+    template <DualNumberCompatibleConstant T>
+    TFEL_HOST_DEVICE friend DualNumber pow(
+        const T x, const DualNumber& y) noexcept {
+      const auto b = static_cast<ValueType>(x);
+      const auto v = std::pow(b, y.value);
+      return applyChainRule(y, v, b > 0 ? v * std::log(b) : ValueType{0});
+    }
+    TFEL_HOST_DEVICE friend constexpr DualNumber min(
+        const DualNumber& x, const DualNumber& y) noexcept {
+      return y.value < x.value ? y : x;
+    }
+    template <DualNumberCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr DualNumber min(
+        const DualNumber& x, const T y) noexcept {
+      return y < x.value ? DualNumber(y) : x;
+    }
+    template <DualNumberCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr DualNumber min(
+        const T x, const DualNumber& y) noexcept {
+      return y.value < x ? y : DualNumber(x);
+    }
+    TFEL_HOST_DEVICE friend constexpr DualNumber max(
+        const DualNumber& x, const DualNumber& y) noexcept {
+      return x.value < y.value ? y : x;
+    }
+    template <DualNumberCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr DualNumber max(
+        const DualNumber& x, const T y) noexcept {
+      return x.value < y ? DualNumber(y) : x;
+    }
+    template <DualNumberCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr DualNumber max(
+        const T x, const DualNumber& y) noexcept {
+      return x < y.value ? y : DualNumber(x);
+    }
+    //! \brief value
+    ValueType value;
+    //! \brief derivatives
+    std::array<ValueType, N> derivatives;
+  };  // end of struct DualNumber
+
+  // unary operators
+
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> operator+(
+      const DualNumber<ValueType, N>& x) noexcept {
+    return x;
+  }
+
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> operator-(
+      const DualNumber<ValueType, N>& x) noexcept {
+    auto r = x;
+    r.value = -r.value;
+    for (auto& d : r.derivatives) {
+      d = -d;
+    }
+    return r;
+  }
+
+  // binary operators
+
+#define TFEL_MATH_DUALNUMBER_BINARY_OPERATOR(OP)                          \
+  template <typename ValueType, unsigned short N>                         \
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> operator OP(        \
+      const DualNumber<ValueType, N>& x,                                  \
+      const DualNumber<ValueType, N>& y) noexcept {                       \
+    auto r = x;                                                           \
+    r OP## = y;                                                           \
+    return r;                                                             \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            DualNumberCompatibleConstant T>                               \
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> operator OP(        \
+      const DualNumber<ValueType, N>& x, const T y) noexcept {            \
+    auto r = x;                                                           \
+    r OP## = y;                                                           \
+    return r;                                                             \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            DualNumberCompatibleConstant T>                               \
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> operator OP(        \
+      const T x, const DualNumber<ValueType, N>& y) noexcept {            \
+    auto r = DualNumber<ValueType, N>(x);                                 \
+    r OP## = y;                                                           \
+    return r;                                                             \
+  }
+
+  TFEL_MATH_DUALNUMBER_BINARY_OPERATOR(+)
+  TFEL_MATH_DUALNUMBER_BINARY_OPERATOR(-)
+  TFEL_MATH_DUALNUMBER_BINARY_OPERATOR(*)
+  TFEL_MATH_DUALNUMBER_BINARY_OPERATOR(/)
+
+#undef TFEL_MATH_DUALNUMBER_BINARY_OPERATOR
+
+  // comparison operators
+
+#define TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR(OP)                      \
+  template <typename ValueType, unsigned short N>                         \
+  TFEL_HOST_DEVICE constexpr bool operator OP(                            \
+      const DualNumber<ValueType, N>& x,                                  \
+      const DualNumber<ValueType, N>& y) noexcept {                       \
+    return x.value OP y.value;                                            \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            DualNumberCompatibleConstant T>                               \
+  TFEL_HOST_DEVICE constexpr bool operator OP(                            \
+      const DualNumber<ValueType, N>& x, const T y) noexcept {            \
+    return x.value OP y;                                                  \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            DualNumberCompatibleConstant T>                               \
+  TFEL_HOST_DEVICE constexpr bool operator OP(                            \
+      const T x, const DualNumber<ValueType, N>& y) noexcept {            \
+    return x OP y.value;                                                  \
+  }
+
+  TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR(==)
+  TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR(!=)
+  TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR(<)
+  TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR(<=)
+  TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR(>)
+  TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR(>=)
+
+#undef TFEL_MATH_DUALNUMBER_COMPARISON_OPERATOR
+
+  // mathematical functions
+
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr DualNumber<ValueType, N> abs(
+      const DualNumber<ValueType, N>& x) noexcept {
+    return x.value < 0 ? -x : x;
+  }
+
+
+  template <int M, typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE DualNumber<ValueType, N> power(
+      const DualNumber<ValueType, N>& x) noexcept {
+    if constexpr (M == 0) {
+      return DualNumber<ValueType, N>(1);
+    } else {
+      const auto v = power<M - 1>(x.value);
+      return applyChainRule(x, v * x.value, M * v);
+    }
+  }
+
+  template <int M, unsigned int D, typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE DualNumber<ValueType, N> power(
+      const DualNumber<ValueType, N>& x) noexcept requires(D != 0) {
+    if constexpr (D == 1) {
+      return power<M>(x);
+    } else {
+      const auto v = power<M, D>(x.value);
+      if (ieee754::fpclassify(x.value) == FP_ZERO) {
+        return DualNumber<ValueType, N>(v);
+      }
+      constexpr auto e = static_cast<ValueType>(M) / static_cast<ValueType>(D);
+      return applyChainRule(x, v, e * v / x.value);
+    }
+  }
+
+  template <typename ValueType, unsigned short N>
+  std::ostream& operator<<(std::ostream& os,
+                           const DualNumber<ValueType, N>& x) {
+    os << x.value << " [";
+    for (unsigned short i = 0; i != N; ++i) {
+      os << (i == 0 ? "" : " ") << x.derivatives[i];
+    }
+    return os << ']';
+  }
+
+  namespace internals {
+
+    //! \brief result of an operation involving dual numbers
+    template <typename ResultType, typename Op>
+    struct DualNumberResultType {
+      //! \brief result of the metafunction
+      using type = tfel::meta::InvalidType;
+    };
+
+    template <typename ResultType>
+    struct DualNumberResultType<ResultType, OpPlus> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+    template <typename ResultType>
+    struct DualNumberResultType<ResultType, OpMinus> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+    template <typename ResultType>
+    struct DualNumberResultType<ResultType, OpMult> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+    template <typename ResultType>
+    struct DualNumberResultType<ResultType, OpDiv> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+  }  // end of namespace internals
+
+  template <typename ValueType, unsigned short N, typename Op>
+  struct ResultType<DualNumber<ValueType, N>, DualNumber<ValueType, N>, Op>
+      : internals::DualNumberResultType<DualNumber<ValueType, N>, Op> {};
+
+  template <typename ValueType,
+            unsigned short N,
+            DualNumberCompatibleConstant T,
+            typename Op>
+  struct ResultType<DualNumber<ValueType, N>, T, Op>
+      : internals::DualNumberResultType<DualNumber<ValueType, N>, Op> {};
+
+  template <typename ValueType,
+            unsigned short N,
+            DualNumberCompatibleConstant T,
+            typename Op>
+  struct ResultType<T, DualNumber<ValueType, N>, Op>
+      : internals::DualNumberResultType<DualNumber<ValueType, N>, Op> {};
+
+  template <typename ValueType, unsigned short N>
+  struct UnaryResultType<DualNumber<ValueType, N>, OpNeg> {
+    //! \brief result of the metafunction
+    using type = DualNumber<ValueType, N>;
+  };
+
+  template <typename ValueType, unsigned short N, int M, unsigned int D>
+  struct UnaryResultType<DualNumber<ValueType, N>, Power<M, D>> {
+    //! \brief result of the metafunction
+    using type = DualNumber<ValueType, N>;
+  };
+
+}  // end of namespace tfel::math
+
+namespace tfel::math::ieee754 {
+
+  //! \brief classify the value of a dual number
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr int fpclassify(
+      const DualNumber<ValueType, N>& x) noexcept {
+    return tfel::math::ieee754::fpclassify(x.value);
+  }
+
+  //! \return if the value of a dual number is a NaN
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr bool isnan(
+      const DualNumber<ValueType, N>& x) noexcept {
+    return tfel::math::ieee754::isnan(x.value);
+  }
+
+  //! \return if the value of a dual number is finite
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr bool isfinite(
+      const DualNumber<ValueType, N>& x) noexcept {
+    return tfel::math::ieee754::isfinite(x.value);
+  }
+
+}  // end of namespace tfel::math::ieee754
+
+namespace tfel::typetraits {
+
+  template <typename ValueType, unsigned short N>
+  struct IsScalar<tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsScalar<const tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsFundamentalNumericType<tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsReal<tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsComplex<tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = false;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct BaseType<tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    using type = tfel::math::DualNumber<ValueType, N>;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct Promote<tfel::math::DualNumber<ValueType, N>,
+                 tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    using type = tfel::math::DualNumber<ValueType, N>;
+  };
+
+  template <typename ValueType,
+            unsigned short N,
+            tfel::math::DualNumberCompatibleConstant T>
+  struct Promote<tfel::math::DualNumber<ValueType, N>, T> {
+    //! \brief result of the metafunction
+    using type = tfel::math::DualNumber<ValueType, N>;
+  };
+
+  template <typename ValueType,
+            unsigned short N,
+            tfel::math::DualNumberCompatibleConstant T>
+  struct Promote<T, tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    using type = tfel::math::DualNumber<ValueType, N>;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsAssignableTo<tfel::math::DualNumber<ValueType, N>,
+                        tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool value = true;
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType,
+            unsigned short N,
+            tfel::math::DualNumberCompatibleConstant T>
+  struct IsAssignableTo<T, tfel::math::DualNumber<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool value = true;
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+}  // end of namespace tfel::typetraits
+
+namespace std {
+
+  template <typename ValueType, unsigned short N>
+  class numeric_limits<tfel::math::DualNumber<ValueType, N>>
+      : public numeric_limits<ValueType> {};
+
+}  // end of namespace std
+
+#endif /* LIB_TFEL_MATH_GENERAL_DUALNUMBER_HXX */
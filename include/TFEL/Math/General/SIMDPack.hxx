@@ -0,0 +1,787 @@
+/*!
+ * \file   include/TFEL/Math/General/SIMDPack.hxx
+ * \brief  This file declares the `SIMDPack` class, used to evaluate the
+ * same code on several sets of values in lock-step.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_GENERAL_SIMDPACK_HXX
+#define LIB_TFEL_MATH_GENERAL_SIMDPACK_HXX
+
+#include <cmath>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <cstdint>
+#include <ostream>
+#include <iterator>
+#include <type_traits>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/TypeTraits/IsReal.hxx"
+#include "TFEL/TypeTraits/IsScalar.hxx"
+#include "TFEL/TypeTraits/IsComplex.hxx"
+#include "TFEL/TypeTraits/BaseType.hxx"
+#include "TFEL/TypeTraits/Promote.hxx"
+#include "TFEL/TypeTraits/IsAssignableTo.hxx"
+#include "TFEL/TypeTraits/IsFundamentalNumericType.hxx"
+#include "TFEL/Metaprogramming/InvalidType.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/General/BasicOperations.hxx"
+#include "TFEL/Math/General/ResultType.hxx"
+#include "TFEL/Math/General/UnaryResultType.hxx"
+#include "TFEL/Math/power.hxx"
+
+namespace tfel::math {
+
+  //! \brief forward declaration
+  template <typename ValueType, unsigned short N>
+  struct SIMDPack;
+
+  /*!
+   * \brief concept satisfied by the types which can be combined with a
+   * pack
+   */
+  template <typename T>
+  concept SIMDPackCompatibleConstant = std::is_arithmetic_v<T>;
+
+  namespace internals {
+
+    //! \brief a metafunction returning if a type is a pack
+    template <typename T>
+    struct IsSIMDPack : std::false_type {};
+    //! \brief partial specialisation for packs
+    template <typename ValueType, unsigned short N>
+    struct IsSIMDPack<SIMDPack<ValueType, N>> : std::true_type {};
+
+    //! \return the lanes which diverged since the last reset
+    inline std::uint64_t& getDivergentSIMDLanesMask() noexcept {
+      thread_local std::uint64_t m = 0;
+      return m;
+    }  // end of getDivergentSIMDLanesMask
+
+  }  // end of namespace internals
+
+  /*!
+   * \return the lanes whose branches differed from the ones taken by the
+   * first lane since the last call to `resetDivergentSIMDLanes` in the
+   * current thread. The `i`-th bit is set if the `i`-th lane diverged.
+   */
+  inline std::uint64_t getDivergentSIMDLanes() noexcept {
+    return internals::getDivergentSIMDLanesMask();
+  }  // end of getDivergentSIMDLanes
+
+  //! \brief reset the lanes flagged as divergent in the current thread
+  inline void resetDivergentSIMDLanes() noexcept {
+    internals::getDivergentSIMDLanesMask() = 0;
+  }  // end of resetDivergentSIMDLanes
+
+  /*!
+   * \brief result of a comparison of packs.
+   *
+   * The conversion to a boolean, which occurs when a mask is used in a
+   * branch, returns the value of the first lane. The lanes which
+   * disagree with the first one are flagged as divergent, since the
+   * code executed afterwards is not the one they would have executed.
+   *
+   * \tparam N: number of lanes
+   */
+  template <unsigned short N>
+  struct SIMDMask {
+    static_assert((N > 0) && (N <= 64), "invalid number of lanes");
+    //! \return the value of the first lane
+    explicit operator bool() const noexcept {
+      const auto r = this->values[0];
+      for (unsigned short i = 1; i != N; ++i) {
+        if (this->values[i] != r) {
+          internals::getDivergentSIMDLanesMask() |= std::uint64_t{1} << i;
+        }
+      }
+      return r;
+    }
+    //! \return the value of the `i`-th lane
+    constexpr bool operator[](const unsigned short i) const noexcept {
+      return this->values[i];
+    }
+    //! \return the negation of the mask
+    constexpr SIMDMask operator!() const noexcept {
+      auto r = SIMDMask{};
+      for (unsigned short i = 0; i != N; ++i) {
+        r.values[i] = !this->values[i];
+      }
+      return r;
+    }
+    //! \brief values of the lanes
+    std::array<bool, N> values = {};
+  };  // end of struct SIMDMask
+
+  //! \return if all the lanes of the mask are true
+  template <unsigned short N>
+  constexpr bool all(const SIMDMask<N>& m) noexcept {
+    for (const auto v : m.values) {
+      if (!v) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of all
+
+  //! \return if at least one lane of the mask is true
+  template <unsigned short N>
+  constexpr bool any(const SIMDMask<N>& m) noexcept {
+    for (const auto v : m.values) {
+      if (v) {
+        return true;
+      }
+    }
+    return false;
+  }  // end of any
+
+  /*!
+   * \brief a fixed-size set of values, called lanes, on which all the
+   * operations are performed elementwise.
+   *
+   * Instantiating a behaviour on packs allows to integrate several
+   * integration points at once. The loops over the lanes have a size
+   * known at compile-time and are expected to be vectorised by the
+   * compiler.
+   *
+   * Comparisons return a `SIMDMask`. Branches follow the first lane:
+   * the other lanes are flagged as divergent when they disagree (see
+   * `getDivergentSIMDLanes`), and their results must then be discarded.
+   * Functions which do not require any branch, such as `min`, `max` or
+   * `abs`, are evaluated elementwise and never lead to divergence.
+   *
+   * \tparam ValueType: underlying numeric type
+   * \tparam N: number of lanes
+   */
+  template <typename ValueType, unsigned short N>
+  struct SIMDPack {
+    static_assert(std::is_floating_point_v<ValueType>,
+                  "invalid value type");
+    static_assert((N > 0) && (N <= 64), "invalid number of lanes");
+    //! \brief a simple alias
+    using value_type = ValueType;
+    //! \brief default constructor
+    TFEL_HOST_DEVICE constexpr SIMDPack() noexcept : values{} {}
+    /*!
+     * \brief constructor from a constant, set in all the lanes
+     * \param[in] v: value
+     */
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr SIMDPack(const T v) noexcept  // NOLINT
+      requires(std::is_arithmetic_v<T>)
+        : values{} {
+      this->values.fill(static_cast<ValueType>(v));
+    }
+    /*!
+     * \brief constructor from the values of the lanes
+     * \param[in] v: values
+     */
+    TFEL_HOST_DEVICE constexpr SIMDPack(
+        const std::array<ValueType, N>& v) noexcept
+        : values(v) {}
+    //! \brief copy constructor
+    constexpr SIMDPack(const SIMDPack&) noexcept = default;
+    //! \brief move constructor
+    constexpr SIMDPack(SIMDPack&&) noexcept = default;
+    //! \brief copy assignement
+    constexpr SIMDPack& operator=(const SIMDPack&) noexcept = default;
+    //! \brief move assignement
+    constexpr SIMDPack& operator=(SIMDPack&&) noexcept = default;
+    //! \brief assignement from a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator=(const T v) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      this->values.fill(static_cast<ValueType>(v));
+      return *this;
+    }
+    //! \return the value of the `i`-th lane
+    TFEL_HOST_DEVICE constexpr ValueType& operator[](
+        const unsigned short i) noexcept {
+      return this->values[i];
+    }
+    //! \return the value of the `i`-th lane
+    TFEL_HOST_DEVICE constexpr const ValueType& operator[](
+        const unsigned short i) const noexcept {
+      return this->values[i];
+    }
+    //! \brief add a pack
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator+=(
+        const SIMDPack& x) noexcept {
+      for (unsigned short i = 0; i != N; ++i) {
+        this->values[i] += x.values[i];
+      }
+      return *this;
+    }
+    //! \brief substract a pack
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator-=(
+        const SIMDPack& x) noexcept {
+      for (unsigned short i = 0; i != N; ++i) {
+        this->values[i] -= x.values[i];
+      }
+      return *this;
+    }
+    //! \brief multiply by a pack
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator*=(
+        const SIMDPack& x) noexcept {
+      for (unsigned short i = 0; i != N; ++i) {
+        this->values[i] *= x.values[i];
+      }
+      return *this;
+    }
+    //! \brief divide by a pack
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator/=(
+        const SIMDPack& x) noexcept {
+      for (unsigned short i = 0; i != N; ++i) {
+        this->values[i] /= x.values[i];
+      }
+      return *this;
+    }
+    //! \brief add a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator+=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      for (auto& v : this->values) {
+        v += x;
+      }
+      return *this;
+    }
+    //! \brief substract a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator-=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      for (auto& v : this->values) {
+        v -= x;
+      }
+      return *this;
+    }
+    //! \brief multiply by a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator*=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      for (auto& v : this->values) {
+        v *= x;
+      }
+      return *this;
+    }
+    //! \brief divide by a constant
+    template <typename T>
+    TFEL_HOST_DEVICE constexpr SIMDPack& operator/=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      for (auto& v : this->values) {
+        v /= x;
+      }
+      return *this;
+    }
+    /*!
+     * \brief apply a function to each lane
+     * \param[in] f: function
+     * \param[in] x: pack
+     */
+    template <typename Function>
+    TFEL_HOST_DEVICE static constexpr SIMDPack apply(
+        const Function& f, const SIMDPack& x) noexcept {
+      auto r = SIMDPack{};
+      for (unsigned short i = 0; i != N; ++i) {
+        r.values[i] = f(x.values[i]);
+      }
+      return r;
+    }
+    /*!
+     * \brief apply a function to each pair of lanes
+     * \param[in] f: function
+     * \param[in] x: first pack
+     * \param[in] y: second pack
+     */
+    template <typename Function>
+    TFEL_HOST_DEVICE static constexpr SIMDPack apply(
+        const Function& f, const SIMDPack& x, const SIMDPack& y) noexcept {
+      auto r = SIMDPack{};
+      for (unsigned short i = 0; i != N; ++i) {
+        r.values[i] = f(x.values[i], y.values[i]);
+      }
+      return r;
+    }
+    // Mathematical functions are defined as hidden friends: they are
+    // found by argument-dependent lookup but do not hide the functions
+    // of the standard library acting on floating-point numbers.
+#define TFEL_MATH_SIMDPACK_UNARY_FUNCTION(F)                           \
+  TFEL_HOST_DEVICE friend SIMDPack F(const SIMDPack& x) noexcept {     \
+    return SIMDPack::apply([](const ValueType v) { return std::F(v); }, \
+                           x);                                         \
+  }
+
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(sqrt)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(cbrt)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(exp)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(log)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(log10)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(sin)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(cos)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(tan)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(asin)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(acos)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(atan)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(sinh)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(cosh)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(tanh)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(erf)
+    TFEL_MATH_SIMDPACK_UNARY_FUNCTION(fabs)
+
+#undef TFEL_MATH_SIMDPACK_UNARY_FUNCTION
+
+    TFEL_HOST_DEVICE friend SIMDPack pow(const SIMDPack& x,
+                                         const SIMDPack& y) noexcept {
+      return SIMDPack::apply(
+          [](const ValueType a, const ValueType b) { return std::pow(a, b); },
+          x, y);
+    }
+    template <SIMDPackCompatibleConstant T>
+    TFEL_HOST_DEVICE friend SIMDPack pow(const SIMDPack& x,
+                                         const T y) noexcept {
+      return pow(x, SIMDPack(y));
+    }
+    template <SIMDPackCompatibleConstant T>
+    TFEL_HOST_DEVICE friend SIMDPack pow(const T x,
+                                         const SIMDPack& y) noexcept {
+      return pow(SIMDPack(x), y);
+    }
+    TFEL_HOST_DEVICE friend SIMDPack atan2(const SIMDPack& x,
+                                           const SIMDPack& y) noexcept {
+      return SIMDPack::apply(
+          [](const ValueType a, const ValueType b) { return std::atan2(a, b); },
+          x, y);
+    }
+    TFEL_HOST_DEVICE friend constexpr SIMDPack min(
+        const SIMDPack& x, const SIMDPack& y) noexcept {
+      return SIMDPack::apply(
+          [](const ValueType a, const ValueType b) { return b < a ? b : a; },
+          x, y);
+    }
+    template <SIMDPackCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr SIMDPack min(const SIMDPack& x,
+                                                   const T y) noexcept {
+      return min(x, SIMDPack(y));
+    }
+    template <SIMDPackCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr SIMDPack min(
+        const T x, const SIMDPack& y) noexcept {
+      return min(SIMDPack(x), y);
+    }
+    TFEL_HOST_DEVICE friend constexpr SIMDPack max(
+        const SIMDPack& x, const SIMDPack& y) noexcept {
+      return SIMDPack::apply(
+          [](const ValueType a, const ValueType b) { return a < b ? b : a; },
+          x, y);
+    }
+    template <SIMDPackCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr SIMDPack max(const SIMDPack& x,
+                                                   const T y) noexcept {
+      return max(x, SIMDPack(y));
+    }
+    template <SIMDPackCompatibleConstant T>
+    TFEL_HOST_DEVICE friend constexpr SIMDPack max(
+        const T x, const SIMDPack& y) noexcept {
+      return max(SIMDPack(x), y);
+    }
+    /*!
+     * \brief alignment of the values. Packs whose size is a power of two
+     * are aligned on their size (up to 64 bytes, i.e. the size of a
+     * cache line) so that they can be loaded in a vector register.
+     */
+    static constexpr std::size_t alignment =
+        ((N & (N - 1)) == 0) && (sizeof(ValueType) * N <= 64)
+            ? sizeof(ValueType) * N
+            : alignof(ValueType);
+    //! \brief values of the lanes
+    alignas(alignment) std::array<ValueType, N> values;
+  };  // end of struct SIMDPack
+
+  // unary operators
+
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr SIMDPack<ValueType, N> operator+(
+      const SIMDPack<ValueType, N>& x) noexcept {
+    return x;
+  }
+
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr SIMDPack<ValueType, N> operator-(
+      const SIMDPack<ValueType, N>& x) noexcept {
+    auto r = x;
+    for (auto& v : r.values) {
+      v = -v;
+    }
+    return r;
+  }
+
+  // binary operators
+
+#define TFEL_MATH_SIMDPACK_BINARY_OPERATOR(OP)                            \
+  template <typename ValueType, unsigned short N>                         \
+  TFEL_HOST_DEVICE constexpr SIMDPack<ValueType, N> operator OP(          \
+      const SIMDPack<ValueType, N>& x,                                    \
+      const SIMDPack<ValueType, N>& y) noexcept {                         \
+    auto r = x;                                                           \
+    r OP## = y;                                                           \
+    return r;                                                             \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            SIMDPackCompatibleConstant T>                                 \
+  TFEL_HOST_DEVICE constexpr SIMDPack<ValueType, N> operator OP(          \
+      const SIMDPack<ValueType, N>& x, const T y) noexcept {              \
+    auto r = x;                                                           \
+    r OP## = y;                                                           \
+    return r;                                                             \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            SIMDPackCompatibleConstant T>                                 \
+  TFEL_HOST_DEVICE constexpr SIMDPack<ValueType, N> operator OP(          \
+      const T x, const SIMDPack<ValueType, N>& y) noexcept {              \
+    auto r = SIMDPack<ValueType, N>(x);                                   \
+    r OP## = y;                                                           \
+    return r;                                                             \
+  }
+
+  TFEL_MATH_SIMDPACK_BINARY_OPERATOR(+)
+  TFEL_MATH_SIMDPACK_BINARY_OPERATOR(-)
+  TFEL_MATH_SIMDPACK_BINARY_OPERATOR(*)
+  TFEL_MATH_SIMDPACK_BINARY_OPERATOR(/)
+
+#undef TFEL_MATH_SIMDPACK_BINARY_OPERATOR
+
+  // comparison operators
+
+#define TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR(OP)                        \
+  template <typename ValueType, unsigned short N>                         \
+  TFEL_HOST_DEVICE constexpr SIMDMask<N> operator OP(                     \
+      const SIMDPack<ValueType, N>& x,                                    \
+      const SIMDPack<ValueType, N>& y) noexcept {                         \
+    auto r = SIMDMask<N>{};                                               \
+    for (unsigned short i = 0; i != N; ++i) {                             \
+      r.values[i] = x.values[i] OP y.values[i];                           \
+    }                                                                     \
+    return r;                                                             \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            SIMDPackCompatibleConstant T>                                 \
+  TFEL_HOST_DEVICE constexpr SIMDMask<N> operator OP(                     \
+      const SIMDPack<ValueType, N>& x, const T y) noexcept {              \
+    return x OP SIMDPack<ValueType, N>(y);                                \
+  }                                                                       \
+  template <typename ValueType, unsigned short N,                         \
+            SIMDPackCompatibleConstant T>                                 \
+  TFEL_HOST_DEVICE constexpr SIMDMask<N> operator OP(                     \
+      const T x, const SIMDPack<ValueType, N>& y) noexcept {              \
+    return SIMDPack<ValueType, N>(x) OP y;                                \
+  }
+
+  TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR(==)
+  TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR(!=)
+  TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR(<)
+  TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR(<=)
+  TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR(>)
+  TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR(>=)
+
+#undef TFEL_MATH_SIMDPACK_COMPARISON_OPERATOR
+
+  // mathematical functions
+
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr SIMDPack<ValueType, N> abs(
+      const SIMDPack<ValueType, N>& x) noexcept {
+    return SIMDPack<ValueType, N>::apply(
+        [](const ValueType v) { return v < 0 ? -v : v; }, x);
+  }
+
+  template <int M, typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr SIMDPack<ValueType, N> power(
+      const SIMDPack<ValueType, N>& x) noexcept {
+    return SIMDPack<ValueType, N>::apply(
+        [](const ValueType v) { return power<M>(v); }, x);
+  }
+
+  template <int M, unsigned int D, typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE SIMDPack<ValueType, N> power(
+      const SIMDPack<ValueType, N>& x) noexcept requires(D != 0) {
+    return SIMDPack<ValueType, N>::apply(
+        [](const ValueType v) { return power<M, D>(v); }, x);
+  }
+
+  template <typename ValueType, unsigned short N>
+  std::ostream& operator<<(std::ostream& os,
+                           const SIMDPack<ValueType, N>& x) {
+    os << '[';
+    for (unsigned short i = 0; i != N; ++i) {
+      os << (i == 0 ? "" : " ") << x.values[i];
+    }
+    return os << ']';
+  }
+
+  /*!
+   * \brief copy a value in the given lane of an object based on packs.
+   *
+   * Objects whose elements are packs, such as `stensor`s or `tvector`s,
+   * are treated element by element. Objects which are not based on
+   * packs (booleans, integers, enumerations) are only copied for the
+   * first lane.
+   *
+   * \param[out] dest: destination
+   * \param[in] src: source
+   * \param[in] lane: lane
+   */
+  template <typename DestinationType, typename SourceType>
+  TFEL_HOST_DEVICE constexpr void gatherLane(DestinationType& dest,
+                                             const SourceType& src,
+                                             const unsigned short lane) {
+    if constexpr (internals::IsSIMDPack<DestinationType>::value) {
+      dest.values[lane] = src;
+    } else if constexpr (requires {
+                           std::begin(dest);
+                           std::begin(src);
+                         }) {
+      auto p = std::begin(src);
+      for (auto& v : dest) {
+        gatherLane(v, *p, lane);
+        ++p;
+      }
+    } else {
+      if (lane == 0) {
+        dest = src;
+      }
+    }
+  }  // end of gatherLane
+
+  /*!
+   * \brief extract the given lane of an object based on packs.
+   * \param[out] dest: destination
+   * \param[in] src: source
+   * \param[in] lane: lane
+   * \see `gatherLane`
+   */
+  template <typename DestinationType, typename SourceType>
+  TFEL_HOST_DEVICE constexpr void scatterLane(DestinationType& dest,
+                                              const SourceType& src,
+                                              const unsigned short lane) {
+    if constexpr (internals::IsSIMDPack<SourceType>::value) {
+      dest = src.values[lane];
+    } else if constexpr (requires {
+                           std::begin(dest);
+                           std::begin(src);
+                         }) {
+      auto p = std::begin(src);
+      for (auto& v : dest) {
+        scatterLane(v, *p, lane);
+        ++p;
+      }
+    } else {
+      dest = src;
+    }
+  }  // end of scatterLane
+
+  namespace internals {
+
+    //! \brief result of an operation involving packs
+    template <typename ResultType, typename Op>
+    struct SIMDPackResultType {
+      //! \brief result of the metafunction
+      using type = tfel::meta::InvalidType;
+    };
+
+    template <typename ResultType>
+    struct SIMDPackResultType<ResultType, OpPlus> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+    template <typename ResultType>
+    struct SIMDPackResultType<ResultType, OpMinus> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+    template <typename ResultType>
+    struct SIMDPackResultType<ResultType, OpMult> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+    template <typename ResultType>
+    struct SIMDPackResultType<ResultType, OpDiv> {
+      //! \brief result of the metafunction
+      using type = ResultType;
+    };
+
+  }  // end of namespace internals
+
+  template <typename ValueType, unsigned short N, typename Op>
+  struct ResultType<SIMDPack<ValueType, N>, SIMDPack<ValueType, N>, Op>
+      : internals::SIMDPackResultType<SIMDPack<ValueType, N>, Op> {};
+
+  template <typename ValueType,
+            unsigned short N,
+            SIMDPackCompatibleConstant T,
+            typename Op>
+  struct ResultType<SIMDPack<ValueType, N>, T, Op>
+      : internals::SIMDPackResultType<SIMDPack<ValueType, N>, Op> {};
+
+  template <typename ValueType,
+            unsigned short N,
+            SIMDPackCompatibleConstant T,
+            typename Op>
+  struct ResultType<T, SIMDPack<ValueType, N>, Op>
+      : internals::SIMDPackResultType<SIMDPack<ValueType, N>, Op> {};
+
+  template <typename ValueType, unsigned short N>
+  struct UnaryResultType<SIMDPack<ValueType, N>, OpNeg> {
+    //! \brief result of the metafunction
+    using type = SIMDPack<ValueType, N>;
+  };
+
+  template <typename ValueType, unsigned short N, int M, unsigned int D>
+  struct UnaryResultType<SIMDPack<ValueType, N>, Power<M, D>> {
+    //! \brief result of the metafunction
+    using type = SIMDPack<ValueType, N>;
+  };
+
+}  // end of namespace tfel::math
+
+namespace tfel::math::ieee754 {
+
+  /*!
+   * \brief classify the value of the first lane of a pack. The lanes
+   * whose classification differs are flagged as divergent.
+   */
+  template <typename ValueType, unsigned short N>
+  int fpclassify(const SIMDPack<ValueType, N>& x) noexcept {
+    auto m = SIMDMask<N>{};
+    const auto c = tfel::math::ieee754::fpclassify(x.values[0]);
+    for (unsigned short i = 0; i != N; ++i) {
+      m.values[i] = tfel::math::ieee754::fpclassify(x.values[i]) == c;
+    }
+    static_cast<void>(static_cast<bool>(m));
+    return c;
+  }
+
+  //! \return which lanes of a pack are NaNs
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr SIMDMask<N> isnan(
+      const SIMDPack<ValueType, N>& x) noexcept {
+    auto r = SIMDMask<N>{};
+    for (unsigned short i = 0; i != N; ++i) {
+      r.values[i] = tfel::math::ieee754::isnan(x.values[i]);
+    }
+    return r;
+  }
+
+  //! \return which lanes of a pack are finite
+  template <typename ValueType, unsigned short N>
+  TFEL_HOST_DEVICE constexpr SIMDMask<N> isfinite(
+      const SIMDPack<ValueType, N>& x) noexcept {
+    auto r = SIMDMask<N>{};
+    for (unsigned short i = 0; i != N; ++i) {
+      r.values[i] = tfel::math::ieee754::isfinite(x.values[i]);
+    }
+    return r;
+  }
+
+}  // end of namespace tfel::math::ieee754
+
+namespace tfel::typetraits {
+
+  template <typename ValueType, unsigned short N>
+  struct IsScalar<tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsScalar<const tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsFundamentalNumericType<tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsReal<tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsComplex<tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool cond = false;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct BaseType<tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    using type = tfel::math::SIMDPack<ValueType, N>;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct Promote<tfel::math::SIMDPack<ValueType, N>,
+                 tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    using type = tfel::math::SIMDPack<ValueType, N>;
+  };
+
+  template <typename ValueType,
+            unsigned short N,
+            tfel::math::SIMDPackCompatibleConstant T>
+  struct Promote<tfel::math::SIMDPack<ValueType, N>, T> {
+    //! \brief result of the metafunction
+    using type = tfel::math::SIMDPack<ValueType, N>;
+  };
+
+  template <typename ValueType,
+            unsigned short N,
+            tfel::math::SIMDPackCompatibleConstant T>
+  struct Promote<T, tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    using type = tfel::math::SIMDPack<ValueType, N>;
+  };
+
+  template <typename ValueType, unsigned short N>
+  struct IsAssignableTo<tfel::math::SIMDPack<ValueType, N>,
+                        tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool value = true;
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+  template <typename ValueType,
+            unsigned short N,
+            tfel::math::SIMDPackCompatibleConstant T>
+  struct IsAssignableTo<T, tfel::math::SIMDPack<ValueType, N>> {
+    //! \brief result of the metafunction
+    static constexpr bool value = true;
+    //! \brief result of the metafunction
+    static constexpr bool cond = true;
+  };
+
+}  // end of namespace tfel::typetraits
+
+namespace std {
+
+  template <typename ValueType, unsigned short N>
+  class numeric_limits<tfel::math::SIMDPack<ValueType, N>>
+      : public numeric_limits<ValueType> {};
+
+}  // end of namespace std
+
+#endif /* LIB_TFEL_MATH_GENERAL_SIMDPACK_HXX */
@@ -14,35 +14,99 @@
 #ifndef LIB_TFEL_MATH_KRIGING_HXX
 #define LIB_TFEL_MATH_KRIGING_HXX
 
+#include <vector>
+
 #include "TFEL/Math/tvector.hxx"
 #include "TFEL/Math/vector.hxx"
 
 #include "TFEL/Math/Kriging/KrigingVariable.hxx"
 #include "TFEL/Math/Kriging/KrigingDefaultModels.hxx"
+#include "TFEL/Math/Kriging/KrigingNeighbourSearch.hxx"
 
 namespace tfel::math {
 
+  /*!
+   * \brief kriging of a function of `N` variables.
+   *
+   * The kriging system is solved by default using the symmetry of the
+   * covariance matrix: the drift constraints are eliminated and the
+   * projected covariance matrix is factorised by a Cholesky
+   * decomposition. A LU decomposition of the whole system is used if the
+   * projected covariance matrix is not definite.
+   *
+   * For large sets of samples, a local kriging can be used: each
+   * evaluation then only considers the nearest sample points, found
+   * using a k-d tree.
+   */
   template <unsigned short N,
             typename T = double,
             typename Model = KrigingDefaultModel<N, T>>
   struct TFEL_VISIBILITY_LOCAL Kriging : public Model {
+    //! \brief a simple alias
+    using Variable = typename KrigingVariable<N, T>::type;
+    //! \brief a simple alias
+    using size_type = typename tfel::math::vector<T>::size_type;
+
     Kriging() = default;
 
     void addValue(const typename KrigingVariable<N, T>::type&, const T&);
+    /*!
+     * \brief use a local kriging based on the given number of nearest
+     * sample points rather than a global kriging.
+     * \param[in] n: number of neighbours. A null value selects the global
+     * kriging, which is the default.
+     * \note this method must be called before the `buildInterpolation`
+     * method.
+     */
+    void setNumberOfNeighbours(const size_type);
 
     void buildInterpolation();
 
     T operator()(const typename KrigingVariable<N, T>::type&) const;
+    /*!
+     * \brief evaluate the kriging at many points
+     * \param[out] r: values
+     * \param[in] xv: points
+     * \param[in] n: number of points
+     */
+    void evaluate(T* const, const Variable* const, const size_type) const;
+    /*!
+     * \return the values of the kriging at the given points
+     * \param[in] xv: points
+     */
+    std::vector<T> evaluate(const std::vector<Variable>&) const;
 
     ~Kriging() noexcept;
 
    private:
     Kriging(const Kriging&) = delete;
     Kriging& operator=(const Kriging&) = delete;
+    /*!
+     * \brief solve the kriging system associated with the given sample
+     * points
+     * \param[out] w: weights of the sample points followed by the
+     * coefficients of the drifts
+     * \param[in] idx: indices of the sample points
+     */
+    void solve(tfel::math::vector<T>&, const std::vector<size_type>&) const;
+    /*!
+     * \return the value of a local kriging at the given point
+     * \param[in] xv: point
+     * \param[in,out] idx: workspace used to store the indices of the
+     * neighbours
+     * \param[in,out] w: workspace used to store the weights
+     */
+    T evaluateLocally(const Variable&,
+                      std::vector<size_type>&,
+                      tfel::math::vector<T>&) const;
 
     tfel::math::vector<typename KrigingVariable<N, T>::type> x;
     tfel::math::vector<T> f;
     tfel::math::vector<T> a;
+    //! \brief number of neighbours used by the local kriging
+    size_type nneighbours = 0;
+    //! \brief search of the nearest sample points
+    KrigingNeighbourSearch<N, T> neighbours;
 
   };  // end of struct Kriging
 
@@ -14,6 +14,7 @@
 #ifndef LIB_TFEL_MATH_KRIGINGIXX
 #define LIB_TFEL_MATH_KRIGINGIXX
 
+#include <cmath>
 #include <algorithm>
 
 #include "TFEL/Math/matrix.hxx"
@@ -65,6 +66,191 @@ namespace tfel::math {
                         const typename KrigingVariable<N, T>::type&) {}
     };  // end of ApplySpecificationDrifts
 
+    /*!
+     * \brief solve the kriging system
+     *
+     * \f[
+     * \begin{pmatrix}
+     *   K & P \\
+     *   P^{T} & 0
+     * \end{pmatrix}
+     * \begin{pmatrix}
+     *   w \\
+     *   b
+     * \end{pmatrix}
+     * =
+     * \begin{pmatrix}
+     *   f \\
+     *   0
+     * \end{pmatrix}
+     * \f]
+     *
+     * using its symmetry.
+     *
+     * The covariances of the default models are generalized
+     * covariances: the covariance matrix \(K\) is only definite on the
+     * space of the weights satisfying the drift constraints \(P^{T}\,w=0\).
+     * Those constraints are eliminated using a QR decomposition of
+     * \(P=Q\,R\), computed by Householder reflections. The projection of
+     * the covariance matrix on the null space of \(P^{T}\), which is
+     * either positive or negative definite, is then factorised by a
+     * Cholesky decomposition.
+     *
+     * \return false if the drifts are linearly dependent on the sample
+     * points or if the projected covariance matrix is not definite. In this
+     * case, the results are meaningless.
+     * \param[out] a: weights of the sample points followed by the
+     * coefficients of the drifts
+     * \param[in,out] K: covariance matrix. This matrix is overwritten.
+     * \param[in,out] P: values of the drifts at the sample points, stored
+     * column by column. This matrix is overwritten.
+     * \param[in] f: values at the sample points
+     */
+    template <typename T>
+    bool solveKrigingSystemBySymmetricFactorisation(
+        tfel::math::vector<T>& a,
+        matrix<T>& K,
+        matrix<T>& P,
+        const tfel::math::vector<T>& f) {
+      using size_type = typename matrix<T>::size_type;
+      const auto n = P.getNbRows();
+      const auto nb = P.getNbCols();
+      if (n <= nb) {
+        return false;
+      }
+      // QR decomposition of P. The Householder vector of the k-th
+      // reflection is stored in the k-th column of P, below the diagonal
+      // included, the diagonal of R in alpha and the square of the norm of
+      // the Householder vector in beta.
+      auto alpha = std::vector<T>(nb);
+      auto beta = std::vector<T>(nb);
+      for (size_type k = 0; k != nb; ++k) {
+        auto nrm = T(0);
+        for (size_type i = k; i != n; ++i) {
+          nrm += P(i, k) * P(i, k);
+        }
+        nrm = std::sqrt(nrm);
+        if (!(nrm > T(0))) {
+          return false;
+        }
+        alpha[k] = (P(k, k) > T(0)) ? -nrm : nrm;
+        P(k, k) -= alpha[k];
+        beta[k] = nrm * (nrm + std::abs(P(k, k) + alpha[k])) * 2;
+        for (size_type j = k + 1; j != nb; ++j) {
+          auto sv = T(0);
+          for (size_type i = k; i != n; ++i) {
+            sv += P(i, k) * P(i, j);
+          }
+          sv *= 2 / beta[k];
+          for (size_type i = k; i != n; ++i) {
+            P(i, j) -= sv * P(i, k);
+          }
+        }
+      }
+      // applying the k-th reflection to a vector
+      auto reflect = [&P, &beta, n](std::vector<T>& v, const size_type k) {
+        auto sv = T(0);
+        for (size_type i = k; i != n; ++i) {
+          sv += P(i, k) * v[i];
+        }
+        sv *= 2 / beta[k];
+        for (size_type i = k; i != n; ++i) {
+          v[i] -= sv * P(i, k);
+        }
+      };
+      // computation of Q^T K Q. The loops are ordered so that the rows of K
+      // are traversed contiguously.
+      auto tmp = std::vector<T>(n);
+      for (size_type k = 0; k != nb; ++k) {
+        const auto c = 2 / beta[k];
+        for (size_type i = 0; i != n; ++i) {
+          auto sv = T(0);
+          for (size_type j = k; j != n; ++j) {
+            sv += K(i, j) * P(j, k);
+          }
+          sv *= c;
+          for (size_type j = k; j != n; ++j) {
+            K(i, j) -= sv * P(j, k);
+          }
+        }
+        std::fill(tmp.begin(), tmp.end(), T(0));
+        for (size_type i = k; i != n; ++i) {
+          const auto vi = P(i, k);
+          for (size_type j = 0; j != n; ++j) {
+            tmp[j] += vi * K(i, j);
+          }
+        }
+        for (size_type i = k; i != n; ++i) {
+          const auto vi = c * P(i, k);
+          for (size_type j = 0; j != n; ++j) {
+            K(i, j) -= vi * tmp[j];
+          }
+        }
+      }
+      // Cholesky decomposition of the projected covariance matrix, i.e. the
+      // lower right block of Q^T K Q, multiplied by its sign. The factor is
+      // stored in the lower triangle of this block.
+      const auto sgn = K(nb, nb) > T(0) ? T(1) : T(-1);
+      for (size_type i = nb; i != n; ++i) {
+        for (size_type j = nb; j <= i; ++j) {
+          auto sv = sgn * K(i, j);
+          for (size_type l = nb; l != j; ++l) {
+            sv -= K(i, l) * K(j, l);
+          }
+          if (i == j) {
+            if (!(sv > T(0))) {
+              return false;
+            }
+            K(i, i) = std::sqrt(sv);
+          } else {
+            K(i, j) = sv / K(j, j);
+          }
+        }
+      }
+      // g = Q^T f
+      auto g = std::vector<T>(f.begin(), f.end());
+      for (size_type k = 0; k != nb; ++k) {
+        reflect(g, k);
+      }
+      // weights in the basis defined by Q, the first nb components being
+      // null by construction
+      auto y = std::vector<T>(n, T(0));
+      for (size_type i = nb; i != n; ++i) {
+        auto sv = sgn * g[i];
+        for (size_type l = nb; l != i; ++l) {
+          sv -= K(i, l) * y[l];
+        }
+        y[i] = sv / K(i, i);
+      }
+      for (size_type i = n; i-- != nb;) {
+        auto sv = y[i];
+        for (size_type l = i + 1; l != n; ++l) {
+          sv -= K(l, i) * y[l];
+        }
+        y[i] = sv / K(i, i);
+      }
+      // coefficients of the drifts: R b = g_1 - M_12 y_2. The upper
+      // triangle of the upper right block of Q^T K Q is untouched by the
+      // Cholesky decomposition.
+      a.resize(n + nb);
+      for (size_type k = nb; k-- != 0;) {
+        auto sv = g[k];
+        for (size_type l = nb; l != n; ++l) {
+          sv -= K(k, l) * y[l];
+        }
+        for (size_type l = k + 1; l != nb; ++l) {
+          sv -= P(k, l) * a[n + l];
+        }
+        a[n + k] = sv / alpha[k];
+      }
+      // weights: w = Q y
+      for (size_type k = nb; k-- != 0;) {
+        reflect(y, k);
+      }
+      std::copy(y.begin(), y.end(), a.begin());
+      return true;
+    }  // end of solveKrigingSystemBySymmetricFactorisation
+
   }  // end of namespace internals
 
   template <unsigned short N, typename T, typename Model>
@@ -73,6 +259,11 @@ namespace tfel::math {
     using namespace tfel::math;
     using namespace tfel::math::internals;
     typedef typename vector<T>::difference_type diff;
+    if (this->nneighbours != 0) {
+      auto idx = std::vector<size_type>{};
+      auto w = tfel::math::vector<T>{};
+      return this->evaluateLocally(xv, idx, w);
+    }
     typename vector<T>::size_type i;
     typename vector<T>::const_iterator p =
         a.begin() + static_cast<diff>(this->x.size());
@@ -84,6 +275,71 @@ namespace tfel::math {
     return r;
   }  // end of Kriging<N,T,Model>::operator()
 
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::evaluate(T* const r,
+                                      const Variable* const xv,
+                                      const size_type n) const {
+    using namespace tfel::math::internals;
+    using diff = typename tfel::math::vector<T>::difference_type;
+    if (this->nneighbours != 0) {
+      auto idx = std::vector<size_type>{};
+      auto w = tfel::math::vector<T>{};
+      for (size_type q = 0; q != n; ++q) {
+        r[q] = this->evaluateLocally(xv[q], idx, w);
+      }
+      return;
+    }
+    // the points are treated by blocks: each sample point is loaded once
+    // per block and the inner loop, over the points of the block, has no
+    // dependency between its iterations.
+    constexpr size_type block_size = 64;
+    const auto ns = this->x.size();
+    for (size_type qb = 0; qb < n; qb += block_size) {
+      const auto qe = std::min(qb + block_size, n);
+      std::fill(r + qb, r + qe, T(0));
+      for (size_type i = 0; i != ns; ++i) {
+        const auto& xi = this->x[i];
+        const auto ai = this->a[i];
+        for (size_type q = qb; q != qe; ++q) {
+          r[q] += ai * Model::covariance(xv[q] - xi);
+        }
+      }
+      for (size_type q = qb; q != qe; ++q) {
+        auto p = this->a.begin() + static_cast<diff>(ns);
+        ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(r[q], p,
+                                                                   xv[q]);
+      }
+    }
+  }  // end of Kriging<N,T,Model>::evaluate
+
+  template <unsigned short N, typename T, typename Model>
+  std::vector<T> Kriging<N, T, Model>::evaluate(
+      const std::vector<Variable>& xv) const {
+    auto r = std::vector<T>(xv.size());
+    this->evaluate(r.data(), xv.data(), xv.size());
+    return r;
+  }  // end of Kriging<N,T,Model>::evaluate
+
+  template <unsigned short N, typename T, typename Model>
+  T Kriging<N, T, Model>::evaluateLocally(const Variable& xv,
+                                          std::vector<size_type>& idx,
+                                          tfel::math::vector<T>& w) const {
+    using namespace tfel::math::internals;
+    using diff = typename tfel::math::vector<T>::difference_type;
+    const auto k = std::min(
+        std::max(this->nneighbours, size_type(Model::nb) + 1), this->x.size());
+    this->neighbours.find(idx, xv, k);
+    this->solve(w, idx);
+    auto r = T(0);
+    for (size_type i = 0; i != idx.size(); ++i) {
+      r += w[i] * Model::covariance(xv - this->x[idx[i]]);
+    }
+    typename tfel::math::vector<T>::const_iterator p =
+        w.begin() + static_cast<diff>(idx.size());
+    ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(r, p, xv);
+    return r;
+  }  // end of Kriging<N,T,Model>::evaluateLocally
+
   template <unsigned short N, typename T, typename Model>
   void Kriging<N, T, Model>::addValue(
       const typename KrigingVariable<N, T>::type& xv, const T& fv) {
@@ -93,16 +349,65 @@ namespace tfel::math {
   }
 
   template <unsigned short N, typename T, typename Model>
-  void Kriging<N, T, Model>::buildInterpolation() {
-    using namespace std;
-    using namespace tfel::math;
+  void Kriging<N, T, Model>::setNumberOfNeighbours(const size_type n) {
+    this->nneighbours = n;
+  }  // end of Kriging<N,T,Model>::setNumberOfNeighbours
+
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::solve(tfel::math::vector<T>& w,
+                                   const std::vector<size_type>& idx) const {
     using namespace tfel::math::internals;
 #ifdef HAVE_ATLAS
     using namespace tfel::math::atlas;
 #endif /* LIB_TFEL_MATH_KRIGINGIXX */
-    using tfel::math::vector;
-    typename vector<T>::size_type i;
-    typename vector<T>::size_type j;
+    const auto n = idx.size();
+    auto fv = tfel::math::vector<T>(n);
+    for (size_type i = 0; i != n; ++i) {
+      fv[i] = this->f[idx[i]];
+    }
+    {
+      auto K = matrix<T>(n, n);
+      auto P = matrix<T>(n, Model::nb);
+      for (size_type i = 0; i != n; ++i) {
+        const auto& xi = this->x[idx[i]];
+        for (size_type j = 0; j != i; ++j) {
+          K(i, j) = K(j, i) = Model::covariance(xi - this->x[idx[j]]);
+        }
+        K(i, i) = Model::nuggetEffect(idx[i], xi);
+        for (unsigned short k = 0; k != Model::nb; ++k) {
+          P(i, k) = (Model::drifts[k])(xi);
+        }
+      }
+      if (solveKrigingSystemBySymmetricFactorisation(w, K, P, fv)) {
+        return;
+      }
+    }
+    // the projected covariance matrix is not definite, the whole system is
+    // solved by a LU decomposition
+    auto xs = tfel::math::vector<Variable>(n);
+    for (size_type i = 0; i != n; ++i) {
+      xs[i] = this->x[idx[i]];
+    }
+    matrix<T> m(n + Model::nb, n + Model::nb, T(0));
+    w.resize(n + Model::nb, T(0));
+    std::copy(fv.begin(), fv.end(), w.begin());
+    std::fill(w.begin() + static_cast<std::ptrdiff_t>(n), w.end(), T(0));
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != i; ++j) {
+        m(i, j) = m(j, i) = Model::covariance(xs[i] - xs[j]);
+      }
+      m(i, i) = Model::nuggetEffect(idx[i], xs[i]);
+    }
+    ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(m, n, xs);
+#ifdef HAVE_ATLAS
+    gesv(m, w);
+#else
+    LUSolve::exe(m, w);
+#endif /* LIB_TFEL_MATH_KRIGINGIXX */
+  }  // end of Kriging<N,T,Model>::solve
+
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::buildInterpolation() {
     if (x.size() != f.size()) {
       throw(KrigingErrorInvalidLength());
     }
@@ -112,25 +417,17 @@ namespace tfel::math {
     if (x.size() <= Model::nb) {
       throw(KrigingErrorInsufficientData());
     }
-    matrix<T> m(x.size() + Model::nb, x.size() + Model::nb,
-                T(0));                                      // temporary matrix
-    this->a.resize(x.size() + Model::nb, T(0));             // unknowns
-    copy(this->f.begin(), this->f.end(), this->a.begin());  // copy values
-    // filling the matrix
-    for (i = 0; i != x.size(); ++i) {
-      for (j = 0; j != i; ++j) {
-        m(i, j) = m(j, i) = Model::covariance(this->x[i] - this->x[j]);
-      }
-      m(i, i) = Model::nuggetEffect(i, x[i]);
+    if (this->nneighbours != 0) {
+      // the local systems are solved at each evaluation
+      this->a.clear();
+      this->neighbours.build(this->x);
+      return;
     }
-    ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(
-        m, this->x.size(), this->x);
-    // computing unknown values
-#ifdef HAVE_ATLAS
-    gesv(m, this->a);
-#else
-    LUSolve::exe(m, this->a);
-#endif /* LIB_TFEL_MATH_KRIGINGIXX */
+    auto idx = std::vector<size_type>(this->x.size());
+    for (size_type i = 0; i != idx.size(); ++i) {
+      idx[i] = i;
+    }
+    this->solve(this->a, idx);
   }
 
   template <unsigned short N, typename T, typename Model>
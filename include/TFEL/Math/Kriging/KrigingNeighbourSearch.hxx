@@ -0,0 +1,178 @@
+/*!
+ * \file  include/TFEL/Math/Kriging/KrigingNeighbourSearch.hxx
+ * \brief This file declares the `KrigingNeighbourSearch` class.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGINGNEIGHBOURSEARCH_HXX
+#define LIB_TFEL_MATH_KRIGINGNEIGHBOURSEARCH_HXX
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/Kriging/KrigingVariable.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief a k-d tree used to find the nearest sample points of a
+   * kriging.
+   *
+   * The tree is stored implicitly in a permutation of the indices of the
+   * points: the median of the range `[b, e[` is stored at its middle and
+   * splits the range along the direction of largest extent of the points.
+   *
+   * \tparam N: dimension
+   * \tparam T: numeric type
+   */
+  template <unsigned short N, typename T>
+  struct KrigingNeighbourSearch {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief a simple alias
+    using Variable = typename KrigingVariable<N, T>::type;
+    /*!
+     * \brief build the tree
+     * \param[in] x: points
+     */
+    void build(const tfel::math::vector<Variable>& x) {
+      this->points = &x;
+      this->indices.resize(x.size());
+      this->axes.resize(x.size());
+      for (size_type i = 0; i != x.size(); ++i) {
+        this->indices[i] = i;
+      }
+      this->buildRange(0, x.size());
+    }  // end of build
+    /*!
+     * \brief find the nearest points
+     * \param[out] r: indices of the nearest points, sorted by increasing
+     * distance
+     * \param[in] xv: point
+     * \param[in] k: number of points searched
+     */
+    void find(std::vector<size_type>& r,
+              const Variable& xv,
+              const size_type k) const {
+      auto heap = std::vector<std::pair<T, size_type>>{};
+      heap.reserve(k + 1);
+      if (k != 0) {
+        this->findInRange(heap, xv, k, 0, this->indices.size());
+      }
+      std::sort_heap(heap.begin(), heap.end());
+      r.resize(heap.size());
+      for (size_type i = 0; i != heap.size(); ++i) {
+        r[i] = heap[i].second;
+      }
+    }  // end of find
+
+   private:
+    //! \return the i-th component of a point
+    static T component(const Variable& v, const unsigned short i) {
+      if constexpr (N == 1) {
+        static_cast<void>(i);
+        return v;
+      } else {
+        return v(i);
+      }
+    }  // end of component
+    //! \return the square of the distance between two points
+    static T distance2(const Variable& v1, const Variable& v2) {
+      auto d = T(0);
+      for (unsigned short i = 0; i != N; ++i) {
+        const auto c = component(v1, i) - component(v2, i);
+        d += c * c;
+      }
+      return d;
+    }  // end of distance2
+    //! \brief build the sub-tree associated with the range `[b, e[`
+    void buildRange(const size_type b, const size_type e) {
+      if (e - b < 2) {
+        return;
+      }
+      const auto& x = *(this->points);
+      // direction of largest extent
+      unsigned short axis = 0;
+      auto extent = T(-1);
+      for (unsigned short i = 0; i != N; ++i) {
+        const auto [pmin, pmax] = std::minmax_element(
+            this->indices.begin() + b, this->indices.begin() + e,
+            [&x, i](const size_type i1, const size_type i2) {
+              return component(x[i1], i) < component(x[i2], i);
+            });
+        const auto ei = component(x[*pmax], i) - component(x[*pmin], i);
+        if (ei > extent) {
+          extent = ei;
+          axis = i;
+        }
+      }
+      const auto m = b + (e - b) / 2;
+      std::nth_element(this->indices.begin() + b, this->indices.begin() + m,
+                       this->indices.begin() + e,
+                       [&x, axis](const size_type i1, const size_type i2) {
+                         return component(x[i1], axis) <
+                                component(x[i2], axis);
+                       });
+      this->axes[m] = axis;
+      this->buildRange(b, m);
+      this->buildRange(m + 1, e);
+    }  // end of buildRange
+    //! \brief search the nearest points in the range `[b, e[`
+    void findInRange(std::vector<std::pair<T, size_type>>& heap,
+                     const Variable& xv,
+                     const size_type k,
+                     const size_type b,
+                     const size_type e) const {
+      if (b == e) {
+        return;
+      }
+      const auto& x = *(this->points);
+      const auto m = b + (e - b) / 2;
+      const auto i = this->indices[m];
+      const auto d = distance2(xv, x[i]);
+      if (heap.size() < k) {
+        heap.emplace_back(d, i);
+        std::push_heap(heap.begin(), heap.end());
+      } else if (d < heap.front().first) {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = {d, i};
+        std::push_heap(heap.begin(), heap.end());
+      }
+      if (e - b == 1) {
+        return;
+      }
+      const auto axis = this->axes[m];
+      const auto delta = component(xv, axis) - component(x[i], axis);
+      if (delta < 0) {
+        this->findInRange(heap, xv, k, b, m);
+        if ((heap.size() < k) || (delta * delta < heap.front().first)) {
+          this->findInRange(heap, xv, k, m + 1, e);
+        }
+      } else {
+        this->findInRange(heap, xv, k, m + 1, e);
+        if ((heap.size() < k) || (delta * delta < heap.front().first)) {
+          this->findInRange(heap, xv, k, b, m);
+        }
+      }
+    }  // end of findInRange
+    //! \brief points
+    const tfel::math::vector<Variable>* points = nullptr;
+    //! \brief permutation of the indices of the points
+    std::vector<size_type> indices;
+    //! \brief splitting directions
+    std::vector<unsigned short> axes;
+  };  // end of struct KrigingNeighbourSearch
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_KRIGINGNEIGHBOURSEARCH_HXX */
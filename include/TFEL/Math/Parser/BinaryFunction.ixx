@@ -18,6 +18,7 @@
 #include <string>
 #include <cstring>
 #include <cerrno>
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -65,6 +66,13 @@ namespace tfel::math::parser {
     return res;
   }  // end of StandardBinaryFunction::StandardBinaryFunction
 
+  template <double (*f)(const double, const double)>
+  std::vector<double>::size_type StandardBinaryFunction<f>::compile(
+      ExprProgram& p) const {
+    const auto r1 = this->expr1->compile(p);
+    return p.addFunctionCall(f, r1, this->expr2->compile(p));
+  }  // end of compile
+
   template <double (*f)(const double, const double)>
   void StandardBinaryFunction<f>::checkCyclicDependency(
       std::vector<std::string>& names) const {
@@ -105,6 +105,7 @@ namespace tfel::math::parser {
     //
     bool isConstant() const override;
     double getValue() const override final;
+    std::vector<double>::size_type compile(ExprProgram&) const override final;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     std::string getCxxFormula(
         const std::vector<std::string>&) const override final;
@@ -15,6 +15,9 @@
 #ifndef LIB_TFEL_MATH_PARSER_BINARYOPERATORIXX
 #define LIB_TFEL_MATH_PARSER_BINARYOPERATORIXX
 
+#include <type_traits>
+#include "TFEL/Math/Parser/ExprProgram.hxx"
+
 namespace tfel::math::parser {
 
   template <typename Op>
@@ -38,6 +41,29 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  std::vector<double>::size_type BinaryOperation<Op>::compile(
+      ExprProgram& p) const {
+    using OpCode = ExprProgram::OpCode;
+    auto add = [this, &p](const OpCode op) {
+      const auto ra = this->a->compile(p);
+      return p.addOperation(op, ra, this->b->compile(p));
+    };
+    if constexpr (std::is_same_v<Op, OpPlus>) {
+      return add(OpCode::ADD);
+    } else if constexpr (std::is_same_v<Op, OpMinus>) {
+      return add(OpCode::SUB);
+    } else if constexpr (std::is_same_v<Op, OpMult>) {
+      return add(OpCode::MUL);
+    } else if constexpr (std::is_same_v<Op, OpDiv>) {
+      return add(OpCode::DIV);
+    } else if constexpr (std::is_same_v<Op, OpPower>) {
+      return add(OpCode::POW);
+    } else {
+      return p.addExpression(*this);
+    }
+  }  // end of compile
+
   template <typename Op>
   std::string BinaryOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -23,6 +23,9 @@
 
 namespace tfel::math::parser {
 
+  // forward declaration
+  struct ExprProgram;
+
   /*!
    * \brief base class resulting from the analysis of a formula.
    */
@@ -60,6 +63,14 @@ namespace tfel::math::parser {
         const std::vector<double>&,
         const std::vector<std::string>&,
         const std::map<std::string, std::vector<double>::size_type>&) const = 0;
+    /*!
+     * \brief translate the expression in instructions of the given program
+     * \return the register holding the result
+     * \param[in] p: program
+     * \note by default, the expression is evaluated by its `getValue`
+     * method.
+     */
+    virtual std::vector<double>::size_type compile(ExprProgram&) const;
     virtual ~Expr();
   };  // end of struct Expr
 
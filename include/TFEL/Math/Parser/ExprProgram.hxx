@@ -0,0 +1,258 @@
+/*!
+ * \file   include/TFEL/Math/Parser/ExprProgram.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_PARSER_EXPRPROGRAM_HXX
+#define LIB_TFEL_MATH_PARSER_EXPRPROGRAM_HXX
+
+#include <span>
+#include <vector>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::math::parser {
+
+  // forward declarations
+  struct Expr;
+  struct LogicalExpr;
+
+  /*!
+   * \brief a flat representation of an expression, suitable for fast
+   * evaluations.
+   *
+   * An expression is translated in a sequence of instructions acting on
+   * an array of registers. During this translation:
+   *
+   * - constant sub-expressions are evaluated once for all (constant
+   *   folding). Their values are stored in the initial values of the
+   *   registers.
+   * - common sub-expressions are only evaluated once.
+   *
+   * Expressions which can't be translated are evaluated by calling their
+   * `getValue` method. The values of the variables used by those
+   * expressions must thus be stored in the array of variables used to
+   * build them.
+   */
+  struct TFELMATHPARSER_VISIBILITY_EXPORT ExprProgram {
+    //! \brief a simple alias
+    using size_type = std::vector<double>::size_type;
+    //! \brief a simple alias
+    using UnaryFunctionPtr = double (*)(double);
+    //! \brief a simple alias
+    using BinaryFunctionPtr = double (*)(const double, const double);
+    //! \brief a simple alias
+    using ComparisonPtr = bool (*)(const double, const double);
+    //! \brief list of supported instructions
+    enum struct OpCode {
+      LOAD,          //!< r = v[a], where v is the array of variables
+      COPY,          //!< r = a
+      NEG,           //!< r = -a
+      ADD,           //!< r = a + b
+      SUB,           //!< r = a - b
+      MUL,           //!< r = a * b
+      DIV,           //!< r = a / b
+      POW,           //!< r = std::pow(a, b)
+      CALL1,         //!< r = f1(a), errno is checked
+      CALL2,         //!< r = f2(a, b), errno is checked
+      IPOW,          //!< r = f1(a), a must not be null if n is not null
+      GPOW,          //!< r = std::pow(a, n), errno is checked
+      COMPARE,       //!< r = c(a, b) ? 1 : 0
+      AND,           //!< r = a && b
+      OR,            //!< r = a || b
+      NOT,           //!< r = !a
+      JUMP,          //!< go to instruction a
+      JUMPIFNOT,     //!< go to instruction b if a is null
+      EVALUATE,      //!< r = e->getValue()
+      EVALUATELOGICAL  //!< r = l->getValue() ? 1 : 0
+    };
+    //! \brief description of an instruction
+    struct Instruction {
+      //! \brief operation
+      OpCode op;
+      //! \brief index of the output register
+      size_type r = 0;
+      //! \brief index of the first input register
+      size_type a = 0;
+      //! \brief index of the second input register
+      size_type b = 0;
+      //! \brief unary function
+      UnaryFunctionPtr f1 = nullptr;
+      //! \brief binary function
+      BinaryFunctionPtr f2 = nullptr;
+      //! \brief comparison operator
+      ComparisonPtr c = nullptr;
+      //! \brief expression evaluated by the `EVALUATE` instruction
+      const Expr* e = nullptr;
+      //! \brief expression evaluated by the `EVALUATELOGICAL` instruction
+      const LogicalExpr* l = nullptr;
+      //! \brief integer argument
+      int n = 0;
+    };  // end of struct Instruction
+    //! \brief default constructor
+    ExprProgram();
+    //! \brief move constructor
+    ExprProgram(ExprProgram&&);
+    //! \brief copy constructor
+    ExprProgram(const ExprProgram&);
+    //! \brief move assignement
+    ExprProgram& operator=(ExprProgram&&);
+    //! \brief standard assignement
+    ExprProgram& operator=(const ExprProgram&);
+    /*!
+     * \brief translate the given expression
+     * \param[in] e: expression
+     * \note the expression must outlive this object
+     */
+    void compile(const Expr&);
+    //! \brief remove all instructions
+    void clear();
+    //! \return if an expression has been compiled
+    bool empty() const;
+    //! \return the number of instructions
+    size_type getNumberOfInstructions() const;
+    //! \return the number of registers
+    size_type getNumberOfRegisters() const;
+    /*!
+     * \return if the program can be evaluated on blocks of points, i.e. if
+     * the program has no branch and if all the expressions have been
+     * translated.
+     */
+    bool isVectorizable() const;
+    /*!
+     * \return the value of the expression
+     * \param[in] v: values of the variables
+     */
+    double getValue(const std::vector<double>&) const;
+    /*!
+     * \brief evaluate the expression at many points
+     * \param[out] r: values of the expression
+     * \param[in] v: values of the variables. The i-th span gives the
+     * values of the i-th variable at each point.
+     * \pre the program must be vectorizable
+     */
+    void getValues(std::span<double>,
+                   std::span<const std::span<const double>>) const;
+    /*!
+     * \name methods used by the expressions to translate themselves
+     * \return the register holding the result of the instruction
+     */
+    //! \{
+    //! \param[in] v: value
+    size_type addConstant(const double);
+    //! \param[in] p: position of the variable
+    size_type addVariable(const size_type);
+    /*!
+     * \param[in] op: operation
+     * \param[in] a: first argument
+     * \param[in] b: second argument, if required
+     */
+    size_type addOperation(const OpCode, const size_type, const size_type = 0);
+    /*!
+     * \param[in] f: function
+     * \param[in] a: argument
+     */
+    size_type addFunctionCall(const UnaryFunctionPtr, const size_type);
+    /*!
+     * \param[in] f: function
+     * \param[in] a: first argument
+     * \param[in] b: second argument
+     */
+    size_type addFunctionCall(const BinaryFunctionPtr,
+                              const size_type,
+                              const size_type);
+    /*!
+     * \param[in] f: function computing the power of its argument
+     * \param[in] b: if true, the argument must not be null
+     * \param[in] a: argument
+     */
+    size_type addIntegerPower(const UnaryFunctionPtr,
+                              const bool,
+                              const size_type);
+    /*!
+     * \param[in] n: exponent
+     * \param[in] a: argument
+     */
+    size_type addGeneralPower(const int, const size_type);
+    /*!
+     * \param[in] c: comparison operator
+     * \param[in] a: first argument
+     * \param[in] b: second argument
+     */
+    size_type addComparison(const ComparisonPtr,
+                            const size_type,
+                            const size_type);
+    /*!
+     * \param[in] c: condition
+     * \param[in] a: expression evaluated if the condition is true
+     * \param[in] b: expression evaluated if the condition is false
+     */
+    size_type addConditionalExpression(const LogicalExpr&,
+                                       const Expr&,
+                                       const Expr&);
+    /*!
+     * \brief add an expression evaluated through its `getValue` method
+     * \param[in] e: expression
+     */
+    size_type addExpression(const Expr&);
+    /*!
+     * \brief add a logical expression evaluated through its `getValue`
+     * method
+     * \param[in] e: expression
+     */
+    size_type addLogicalExpression(const LogicalExpr&);
+    //! \}
+    //! \brief destructor
+    ~ExprProgram();
+
+   private:
+    //! \brief allocate a new register
+    TFEL_VISIBILITY_LOCAL size_type addRegister();
+    /*!
+     * \brief add a new instruction, or reuse the result of an equivalent
+     * instruction. If all the arguments of the instruction are constants,
+     * the instruction is evaluated immediately.
+     * \param[in] i: instruction
+     */
+    TFEL_VISIBILITY_LOCAL size_type add(Instruction);
+    /*!
+     * \brief translate an expression which is only evaluated
+     * conditionnally.
+     * \param[in] e: expression
+     */
+    TFEL_VISIBILITY_LOCAL size_type addBranch(const Expr&);
+    /*!
+     * \brief execute the instructions
+     * \param[in] r: registers
+     * \param[in] v: values of the variables
+     */
+    TFEL_VISIBILITY_LOCAL double execute(double* const,
+                                         const std::vector<double>&) const;
+    //! \brief instructions
+    std::vector<Instruction> code;
+    //! \brief initial values of the registers
+    std::vector<double> registers;
+    //! \brief flag stating if a register holds a constant
+    std::vector<bool> constants;
+    /*!
+     * \brief flag stating if the result of an instruction can be reused
+     * by the following instructions. This is only used during the
+     * translation.
+     */
+    std::vector<bool> reusable;
+    //! \brief register holding the result
+    size_type result = 0;
+    //! \brief flag stating if an expression has been compiled
+    bool compiled = false;
+  };  // end of struct ExprProgram
+
+}  // end of namespace tfel::math::parser
+
+#endif /* LIB_TFEL_MATH_PARSER_EXPRPROGRAM_HXX */
@@ -19,6 +19,7 @@
 #include <cerrno>
 #include <cstring>
 #include <cmath>
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 #ifndef __SUNPRO_CC
 #define TFEL_MATH_DIFFERENTIATEFUNCTION_PARTIALSPECIALISATION_DECLARATION(X) \
@@ -57,6 +58,12 @@ namespace tfel::math::parser {
     return res;
   }  // end of getValue
 
+  template <StandardFunctionPtr f>
+  std::vector<double>::size_type StandardFunction<f>::compile(
+      ExprProgram& p) const {
+    return p.addFunctionCall(f, this->expr->compile(p));
+  }  // end of compile
+
   template <StandardFunctionPtr f>
   std::string StandardFunction<f>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -135,6 +135,14 @@ namespace tfel::math::parser {
         const std::vector<double>&,
         const std::vector<std::string>&,
         const std::map<std::string, std::vector<double>::size_type>&) const = 0;
+    /*!
+     * \brief translate the expression in instructions of the given program
+     * \return the register holding the result
+     * \param[in] p: program
+     * \note by default, the expression is evaluated by its `getValue`
+     * method.
+     */
+    virtual std::vector<double>::size_type compile(ExprProgram&) const;
     virtual ~LogicalExpr();
   };  // end of struct LogicalExpr
 
@@ -148,6 +156,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(ExprProgram&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -176,6 +185,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(ExprProgram&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -202,6 +212,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(ExprProgram&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -18,6 +18,8 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <type_traits>
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -42,6 +44,13 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  std::vector<double>::size_type LogicalOperation<Op>::compile(
+      ExprProgram& p) const {
+    const auto ra = this->a->compile(p);
+    return p.addComparison(&Op::apply, ra, this->b->compile(p));
+  }  // end of compile
+
   template <typename Op>
   std::string LogicalOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -117,6 +126,23 @@ namespace tfel::math::parser {
     return Op::apply(this->a->getValue(), this->b->getValue());
   }  // end of getValue
 
+  template <typename Op>
+  std::vector<double>::size_type LogicalBinaryOperation<Op>::compile(
+      ExprProgram& p) const {
+    using OpCode = ExprProgram::OpCode;
+    auto add = [this, &p](const OpCode op) {
+      const auto ra = this->a->compile(p);
+      return p.addOperation(op, ra, this->b->compile(p));
+    };
+    if constexpr (std::is_same_v<Op, OpAnd>) {
+      return add(OpCode::AND);
+    } else if constexpr (std::is_same_v<Op, OpOr>) {
+      return add(OpCode::OR);
+    } else {
+      return p.addLogicalExpression(*this);
+    }
+  }  // end of compile
+
   template <typename Op>
   std::string LogicalBinaryOperation<Op>::getCxxFormula(
       const std::vector<std::string>& m) const {
@@ -34,6 +34,7 @@ namespace tfel::math::parser {
      */
     PowerFunction(const std::shared_ptr<Expr>) noexcept;
     double getValue() const override;
+    std::vector<double>::size_type compile(ExprProgram&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
@@ -66,6 +67,7 @@ namespace tfel::math::parser {
      */
     GeneralPowerFunction(const std::shared_ptr<Expr>, const int) noexcept;
     double getValue() const override;
+    std::vector<double>::size_type compile(ExprProgram&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
@@ -24,6 +24,7 @@
 #include "TFEL/Math/Parser/Number.hxx"
 #include "TFEL/Math/Parser/BinaryOperator.hxx"
 #include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -45,6 +46,18 @@ namespace tfel::math::parser {
     return tfel::math::power<N>(arg);
   }  // end of getValue
 
+  template <int N>
+  std::vector<double>::size_type PowerFunction<N>::compile(
+      ExprProgram& p) const {
+    if constexpr (N == 0) {
+      return p.addConstant(1);
+    } else {
+      return p.addIntegerPower(
+          [](const double x) { return tfel::math::power<N>(x); }, N < 0,
+          this->expr->compile(p));
+    }
+  }  // end of compile
+
   template <int N>
   std::string PowerFunction<N>::getCxxFormula(
       const std::vector<std::string>& m) const {
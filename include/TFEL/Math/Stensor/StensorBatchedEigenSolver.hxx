@@ -0,0 +1,111 @@
+/*!
+ * \file   include/TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx
+ * \brief  This file declares the `StensorBatchedEigenSolver` class.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX
+#define LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX
+
+#include <cstddef>
+#include "TFEL/Math/stensor.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief computation of the eigen values and eigen vectors of an array
+   * of symmetric tensors.
+   *
+   * The symmetric tensors are stored as a structure of arrays: the
+   * `i`-th component of the `k`-th tensor of a batch of `n` tensors is
+   * stored at index `i * n + k`. The eigen values and the components of
+   * the rotation matrices are stored in the same way: the `i`-th eigen
+   * value of the `k`-th tensor is stored at index `i * n + k` and the
+   * component `(i, j)` of its rotation matrix at index
+   * `(3 * i + j) * n + k`. As for the `stensor` class, the eigen vectors
+   * are the columns of the rotation matrix.
+   *
+   * The tensors are treated by blocks. In \f$3D\f$, the eigen values are
+   * computed by the solution of Harari and Albocher, which remains
+   * accurate for close eigen values, and the eigen vectors by cross
+   * products of the rows of the shifted tensors. Those kernels have no
+   * data-dependent branch, so that the loops over the tensors of a block
+   * can be vectorized by the compiler.
+   *
+   * The eigen vectors of tensors having close eigen values can't be
+   * computed accurately by those kernels. The eigen vectors of those
+   * tensors are computed by the scalar eigen solver given as template
+   * argument.
+   *
+   * In \f$2D\f$ and \f$3D\f$, the (in-plane) eigen values are sorted in
+   * ascending order. In \f$2D\f$, the third eigen value is the
+   * out-of-plane component of the tensor. In \f$1D\f$, the eigen values
+   * are the components of the tensor.
+   *
+   * \tparam N: space dimension
+   * \tparam T: numeric type
+   */
+  template <unsigned short N, typename T>
+  struct StensorBatchedEigenSolver {
+    static_assert((N == 1) || (N == 2) || (N == 3),
+                  "invalid space dimension");
+    static_assert(tfel::typetraits::IsFundamentalNumericType<T>::cond);
+    static_assert(tfel::typetraits::IsReal<T>::cond);
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief a simple alias
+    using EigenSolver = stensor_common::EigenSolver;
+    //! \brief number of tensors treated simultaneously
+    static constexpr size_type blockSize = 64;
+    /*!
+     * \brief compute the eigen values of an array of symmetric tensors
+     * \param[out] vp: eigen values
+     * \param[in]  s: symmetric tensors
+     * \param[in]  n: number of symmetric tensors
+     */
+    static void computeEigenValues(T* const, const T* const, const size_type);
+    /*!
+     * \brief compute the eigen values and the eigen vectors of an array of
+     * symmetric tensors
+     * \return the number of tensors whose eigen vectors were computed by
+     * the scalar eigen solver
+     * \tparam es: eigen solver used for ill-conditioned tensors
+     * \param[out] vp: eigen values
+     * \param[out] m: rotation matrices
+     * \param[in]  s: symmetric tensors
+     * \param[in]  n: number of symmetric tensors
+     */
+    template <EigenSolver es = stensor_common::TFELEIGENSOLVER>
+    static size_type computeEigenVectors(T* const,
+                                         T* const,
+                                         const T* const,
+                                         const size_type);
+
+   private:
+    /*!
+     * \brief compute the eigen vectors of one tensor with the scalar
+     * eigen solver
+     * \param[out] m: rotation matrices
+     * \param[in]  s: symmetric tensors
+     * \param[in]  n: number of symmetric tensors
+     * \param[in]  k: index of the tensor
+     */
+    template <EigenSolver es>
+    static void computeEigenVectorsWithScalarSolver(T* const,
+                                                    const T* const,
+                                                    const size_type,
+                                                    const size_type);
+  };  // end of struct StensorBatchedEigenSolver
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.ixx"
+
+#endif /* LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX */
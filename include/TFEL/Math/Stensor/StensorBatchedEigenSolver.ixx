@@ -0,0 +1,437 @@
+/*!
+ * \file   include/TFEL/Math/Stensor/StensorBatchedEigenSolver.ixx
+ * \brief  This file implements the `StensorBatchedEigenSolver` class.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX
+#define LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Math/General/MathConstants.hxx"
+#include "TFEL/Math/Stensor/Internals/SortEigenVectors.hxx"
+
+namespace tfel::math::internals {
+
+  /*!
+   * \brief data associated with a block of symmetric tensors. All the
+   * loops over the tensors of a block are free of data-dependent
+   * branches.
+   * \tparam N: space dimension
+   * \tparam T: numeric type
+   * \tparam M: maximal number of tensors in a block
+   */
+  template <unsigned short N, typename T, std::size_t M>
+  struct StensorBatchedEigenSolverBlock {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    /*!
+     * \brief load the tensors of the block and scale them by the
+     * largest absolute value of their components.
+     * \param[in] s: symmetric tensors
+     * \param[in] n: total number of tensors
+     * \param[in] k0: index of the first tensor of the block
+     * \param[in] nb: number of tensors in the block
+     */
+    void load(const T* const s,
+              const size_type n,
+              const size_type k0,
+              const size_type nb) {
+      constexpr auto icste = Cste<T>::isqrt2;
+      for (size_type i = 0; i != nb; ++i) {
+        const auto k = k0 + i;
+        this->a[0][i] = s[k];
+        this->a[1][i] = s[n + k];
+        this->a[2][i] = s[2 * n + k];
+        this->a[3][i] = s[3 * n + k] * icste;
+        if constexpr (N == 3) {
+          this->a[4][i] = s[4 * n + k] * icste;
+          this->a[5][i] = s[5 * n + k] * icste;
+        }
+      }
+      for (size_type i = 0; i != nb; ++i) {
+        // in 2D, the out-of-plane component is not scaled
+        auto smax = std::max(std::abs(this->a[0][i]), std::abs(this->a[1][i]));
+        smax = std::max(smax, std::abs(this->a[3][i]));
+        if constexpr (N == 3) {
+          smax = std::max(smax, std::abs(this->a[2][i]));
+          smax = std::max(smax, std::abs(this->a[4][i]));
+          smax = std::max(smax, std::abs(this->a[5][i]));
+        }
+        this->scale[i] = (smax > std::numeric_limits<T>::min()) ? smax : T(1);
+        const auto is = 1 / this->scale[i];
+        this->a[0][i] *= is;
+        this->a[1][i] *= is;
+        this->a[3][i] *= is;
+        if constexpr (N == 3) {
+          this->a[2][i] *= is;
+          this->a[4][i] *= is;
+          this->a[5][i] *= is;
+        }
+      }
+    }  // end of load
+    /*!
+     * \brief compute the eigen values of the scaled tensors, sorted in
+     * ascending order.
+     * \param[in] nb: number of tensors in the block
+     */
+    void computeEigenValues(const size_type nb) {
+      if constexpr (N == 2) {
+        for (size_type i = 0; i != nb; ++i) {
+          const auto c = (this->a[0][i] + this->a[1][i]) / 2;
+          const auto h = (this->a[0][i] - this->a[1][i]) / 2;
+          const auto d = std::sqrt(h * h + this->a[3][i] * this->a[3][i]);
+          this->vp[0][i] = c - d;
+          this->vp[1][i] = c + d;
+        }
+      } else {
+        // Harari's solution, which remains accurate for close eigen
+        // values, see the `HarariEigensolver3x3` class.
+        constexpr auto one_third = T(1) / T(3);
+        constexpr auto sqrt3 = Cste<T>::sqrt3;
+        auto& tr = this->vp[0];
+        auto& sj = this->vp[1];
+        auto& d = this->vp[2];
+        for (size_type i = 0; i != nb; ++i) {
+          const auto a3 = this->a[3][i];
+          const auto a4 = this->a[4][i];
+          const auto a5 = this->a[5][i];
+          const auto tri =
+              (this->a[0][i] + this->a[1][i] + this->a[2][i]) * one_third;
+          const auto b0 = this->a[0][i] - tri;
+          const auto b1 = this->a[1][i] - tri;
+          const auto b2 = this->a[2][i] - tri;
+          const auto J2 =
+              (b0 * b0 + b1 * b1 + b2 * b2) / 2 + a3 * a3 + a4 * a4 + a5 * a5;
+          const auto si = std::sqrt(J2 / 3);
+          // components of T = S * S - 2 * J2 / 3 * I
+          const auto t00 = b0 * b0 + a3 * a3 + a4 * a4 - 2 * J2 * one_third;
+          const auto t11 = a3 * a3 + b1 * b1 + a5 * a5 - 2 * J2 * one_third;
+          const auto t22 = a4 * a4 + a5 * a5 + b2 * b2 - 2 * J2 * one_third;
+          const auto t01 = b0 * a3 + a3 * b1 + a4 * a5;
+          const auto t02 = b0 * a4 + a3 * a5 + a4 * b2;
+          const auto t12 = a3 * a4 + b1 * a5 + a5 * b2;
+          auto norm2 = [](const T v00, const T v11, const T v22, const T v01,
+                          const T v02, const T v12) {
+            return v00 * v00 + v11 * v11 + v22 * v22 +
+                   2 * (v01 * v01 + v02 * v02 + v12 * v12);
+          };
+          const auto TmsS = norm2(t00 - si * b0, t11 - si * b1, t22 - si * b2,
+                                  t01 - si * a3, t02 - si * a4, t12 - si * a5);
+          const auto TpsS = norm2(t00 + si * b0, t11 + si * b1, t22 + si * b2,
+                                  t01 + si * a3, t02 + si * a4, t12 + si * a5);
+          const auto dmin = std::min(TmsS, TpsS);
+          const auto dmax = std::max(TmsS, TpsS);
+          tr[i] = tri;
+          this->rs[i] = si;
+          sj[i] = (TmsS <= TpsS) ? T(1) : T(-1);
+          // an isotropic tensor gives dmax = 0
+          d[i] = (dmax > std::numeric_limits<T>::min())
+                     ? std::sqrt(dmin / dmax)
+                     : T(0);
+        }
+        // the only loop calling transcendental functions
+        for (size_type i = 0; i != nb; ++i) {
+          const auto alpha = 2 * one_third * std::atan(d[i]);
+          this->cosa[i] = std::cos(alpha);
+          this->sina[i] = std::sin(alpha);
+        }
+        for (size_type i = 0; i != nb; ++i) {
+          const auto tri = tr[i];
+          const auto cd = this->rs[i] * this->cosa[i];
+          const auto sd = sqrt3 * this->rs[i] * this->sina[i];
+          // eigen values of the deviatoric part, in descending order
+          // when sj is positive and in ascending order otherwise
+          const auto e0 = 2 * cd;
+          const auto e1 = -cd + sd;
+          const auto e2 = -cd - sd;
+          const auto b = sj[i] > 0;
+          this->vp[0][i] = tri + (b ? e2 : -e0);
+          this->vp[1][i] = tri + (b ? e1 : -e1);
+          this->vp[2][i] = tri + (b ? e0 : -e2);
+        }
+      }
+    }  // end of computeEigenValues
+    /*!
+     * \brief compute the eigen vectors of the scaled tensors. The
+     * eigen values must have been computed.
+     * \param[in] nb: number of tensors in the block
+     * \param[in] tol: relative distance between two eigen values below
+     * which a tensor is flagged as ill-conditioned
+     */
+    void computeEigenVectors(const size_type nb, const T tol) {
+      if constexpr (N == 2) {
+        for (size_type i = 0; i != nb; ++i) {
+          const auto l = this->vp[1][i];
+          // two candidates orthogonal to the rows of the shifted tensor
+          const auto x1 = this->a[3][i];
+          const auto y1 = l - this->a[0][i];
+          const auto x2 = l - this->a[1][i];
+          const auto y2 = this->a[3][i];
+          const auto n1 = x1 * x1 + y1 * y1;
+          const auto n2 = x2 * x2 + y2 * y2;
+          const auto b = n1 > n2;
+          const auto nv = b ? n1 : n2;
+          const auto inv = (nv > 0) ? 1 / std::sqrt(nv) : T(0);
+          const auto x = (b ? x1 : x2) * inv;
+          const auto y = (b ? y1 : y2) * inv;
+          this->m[0][i] = y;
+          this->m[1][i] = x;
+          this->m[3][i] = -x;
+          this->m[4][i] = y;
+          this->ill[i] = (l - this->vp[0][i] < tol) ? 1 : 0;
+        }
+      } else {
+        auto eigen_vector = [this](T& vx, T& vy, T& vz, const size_type i,
+                                   const T l) {
+          const auto r00 = this->a[0][i] - l;
+          const auto r11 = this->a[1][i] - l;
+          const auto r22 = this->a[2][i] - l;
+          const auto r01 = this->a[3][i];
+          const auto r02 = this->a[4][i];
+          const auto r12 = this->a[5][i];
+          // cross products of the rows of the shifted tensor
+          const auto x01 = r01 * r12 - r02 * r11;
+          const auto y01 = r02 * r01 - r00 * r12;
+          const auto z01 = r00 * r11 - r01 * r01;
+          const auto x02 = r01 * r22 - r02 * r12;
+          const auto y02 = r02 * r02 - r00 * r22;
+          const auto z02 = r00 * r12 - r01 * r02;
+          const auto x12 = r11 * r22 - r12 * r12;
+          const auto y12 = r12 * r02 - r01 * r22;
+          const auto z12 = r01 * r12 - r11 * r02;
+          const auto n01 = x01 * x01 + y01 * y01 + z01 * z01;
+          const auto n02 = x02 * x02 + y02 * y02 + z02 * z02;
+          const auto n12 = x12 * x12 + y12 * y12 + z12 * z12;
+          const auto b1 = n01 > n02;
+          vx = b1 ? x01 : x02;
+          vy = b1 ? y01 : y02;
+          vz = b1 ? z01 : z02;
+          auto nv = b1 ? n01 : n02;
+          const auto b2 = n12 > nv;
+          vx = b2 ? x12 : vx;
+          vy = b2 ? y12 : vy;
+          vz = b2 ? z12 : vz;
+          nv = b2 ? n12 : nv;
+          const auto inv = (nv > 0) ? 1 / std::sqrt(nv) : T(0);
+          vx *= inv;
+          vy *= inv;
+          vz *= inv;
+        };
+        for (size_type i = 0; i != nb; ++i) {
+          auto x0 = T{}, y0 = T{}, z0 = T{};
+          auto x2 = T{}, y2 = T{}, z2 = T{};
+          eigen_vector(x0, y0, z0, i, this->vp[0][i]);
+          eigen_vector(x2, y2, z2, i, this->vp[2][i]);
+          // orthogonalisation of the second vector
+          const auto d = x0 * x2 + y0 * y2 + z0 * z2;
+          x2 -= d * x0;
+          y2 -= d * y0;
+          z2 -= d * z0;
+          const auto n2 = x2 * x2 + y2 * y2 + z2 * z2;
+          const auto in2 = (n2 > 0) ? 1 / std::sqrt(n2) : T(0);
+          x2 *= in2;
+          y2 *= in2;
+          z2 *= in2;
+          // the third vector completes a direct basis
+          const auto x1 = y2 * z0 - z2 * y0;
+          const auto y1 = z2 * x0 - x2 * z0;
+          const auto z1 = x2 * y0 - y2 * x0;
+          this->m[0][i] = x0;
+          this->m[1][i] = x1;
+          this->m[2][i] = x2;
+          this->m[3][i] = y0;
+          this->m[4][i] = y1;
+          this->m[5][i] = y2;
+          this->m[6][i] = z0;
+          this->m[7][i] = z1;
+          this->m[8][i] = z2;
+          const auto gap = std::min(this->vp[1][i] - this->vp[0][i],
+                                    this->vp[2][i] - this->vp[1][i]);
+          this->ill[i] = (gap < tol) ? 1 : 0;
+        }
+      }
+    }  // end of computeEigenVectors
+    /*!
+     * \brief write the eigen values
+     * \param[out] v: eigen values
+     * \param[in] s: symmetric tensors
+     * \param[in] n: total number of tensors
+     * \param[in] k0: index of the first tensor of the block
+     * \param[in] nb: number of tensors in the block
+     */
+    void writeEigenValues(T* const v,
+                          const T* const s,
+                          const size_type n,
+                          const size_type k0,
+                          const size_type nb) const {
+      for (size_type i = 0; i != nb; ++i) {
+        const auto k = k0 + i;
+        v[k] = this->vp[0][i] * this->scale[i];
+        v[n + k] = this->vp[1][i] * this->scale[i];
+        if constexpr (N == 2) {
+          v[2 * n + k] = s[2 * n + k];
+        } else {
+          v[2 * n + k] = this->vp[2][i] * this->scale[i];
+        }
+      }
+    }  // end of writeEigenValues
+    /*!
+     * \brief write the rotation matrices
+     * \param[out] r: rotation matrices
+     * \param[in] n: total number of tensors
+     * \param[in] k0: index of the first tensor of the block
+     * \param[in] nb: number of tensors in the block
+     */
+    void writeEigenVectors(T* const r,
+                           const size_type n,
+                           const size_type k0,
+                           const size_type nb) const {
+      for (size_type i = 0; i != nb; ++i) {
+        const auto k = k0 + i;
+        if constexpr (N == 2) {
+          r[k] = this->m[0][i];
+          r[n + k] = this->m[1][i];
+          r[2 * n + k] = T(0);
+          r[3 * n + k] = this->m[3][i];
+          r[4 * n + k] = this->m[4][i];
+          r[5 * n + k] = T(0);
+          r[6 * n + k] = T(0);
+          r[7 * n + k] = T(0);
+          r[8 * n + k] = T(1);
+        } else {
+          for (size_type c = 0; c != 9; ++c) {
+            r[c * n + k] = this->m[c][i];
+          }
+        }
+      }
+    }  // end of writeEigenVectors
+    //! \brief scaled components of the tensors
+    T a[StensorDimeToSize<N>::value][M];
+    //! \brief scaling factors
+    T scale[M];
+    //! \brief eigen values of the scaled tensors
+    T vp[3][M];
+    //! \brief norms of the deviatoric parts used by Harari's solution
+    T rs[M];
+    //! \brief cosines of the angles used by Harari's solution
+    T cosa[M];
+    //! \brief sines of the angles used by Harari's solution
+    T sina[M];
+    //! \brief components of the rotation matrices
+    T m[9][M];
+    //! \brief flags of the ill-conditioned tensors
+    unsigned char ill[M];
+  };  // end of struct StensorBatchedEigenSolverBlock
+
+}  // end of namespace tfel::math::internals
+
+namespace tfel::math {
+
+  template <unsigned short N, typename T>
+  void StensorBatchedEigenSolver<N, T>::computeEigenValues(T* const vp,
+                                                           const T* const s,
+                                                           const size_type n) {
+    if constexpr (N == 1) {
+      std::copy(s, s + 3 * n, vp);
+    } else {
+      using Block =
+          internals::StensorBatchedEigenSolverBlock<N, T, blockSize>;
+      Block block;
+      for (size_type k0 = 0; k0 < n; k0 += blockSize) {
+        const auto nb = std::min(blockSize, n - k0);
+        block.load(s, n, k0, nb);
+        block.computeEigenValues(nb);
+        block.writeEigenValues(vp, s, n, k0, nb);
+      }
+    }
+  }  // end of computeEigenValues
+
+  template <unsigned short N, typename T>
+  template <typename stensor_common::EigenSolver es>
+  typename StensorBatchedEigenSolver<N, T>::size_type
+  StensorBatchedEigenSolver<N, T>::computeEigenVectors(T* const vp,
+                                                       T* const m,
+                                                       const T* const s,
+                                                       const size_type n) {
+    if constexpr (N == 1) {
+      std::copy(s, s + 3 * n, vp);
+      for (size_type i = 0; i != 3; ++i) {
+        for (size_type j = 0; j != 3; ++j) {
+          std::fill(m + (3 * i + j) * n, m + (3 * i + j + 1) * n,
+                    (i == j) ? T(1) : T(0));
+        }
+      }
+      return 0;
+    } else {
+      using Block =
+          internals::StensorBatchedEigenSolverBlock<N, T, blockSize>;
+      const auto tol = std::cbrt(std::numeric_limits<T>::epsilon());
+      auto nill = size_type{};
+      Block block;
+      for (size_type k0 = 0; k0 < n; k0 += blockSize) {
+        const auto nb = std::min(blockSize, n - k0);
+        block.load(s, n, k0, nb);
+        block.computeEigenValues(nb);
+        block.computeEigenVectors(nb, tol);
+        block.writeEigenValues(vp, s, n, k0, nb);
+        block.writeEigenVectors(m, n, k0, nb);
+        for (size_type i = 0; i != nb; ++i) {
+          if (block.ill[i] != 0) {
+            computeEigenVectorsWithScalarSolver<es>(m, s, n, k0 + i);
+            ++nill;
+          }
+        }
+      }
+      return nill;
+    }
+  }  // end of computeEigenVectors
+
+  template <unsigned short N, typename T>
+  template <typename stensor_common::EigenSolver es>
+  void StensorBatchedEigenSolver<N, T>::computeEigenVectorsWithScalarSolver(
+      T* const m, const T* const s, const size_type n, const size_type k) {
+    auto st = stensor<N, T>{};
+    for (size_type c = 0; c != StensorDimeToSize<N>::value; ++c) {
+      st[c] = s[c * n + k];
+    }
+    auto v = tvector<3u, T>{};
+    auto r = tmatrix<3u, 3u, T>{};
+    st.template computeEigenVectors<es>(v, r);
+    if constexpr (N == 2) {
+      internals::SortEigenVectors<2u>::exe(v, r,
+                                           stensor_common::ASCENDING);
+    } else {
+      // sorting network, valid for equal eigen values
+      auto sort = [&v, &r](const unsigned short i, const unsigned short j) {
+        if (v(j) < v(i)) {
+          std::swap(v(i), v(j));
+          for (unsigned short l = 0; l != 3; ++l) {
+            std::swap(r(l, i), r(l, j));
+          }
+        }
+      };
+      sort(0, 1);
+      sort(1, 2);
+      sort(0, 1);
+    }
+    for (unsigned short i = 0; i != 3; ++i) {
+      for (unsigned short j = 0; j != 3; ++j) {
+        m[(3 * i + j) * n + k] = r(i, j);
+      }
+    }
+  }  // end of computeEigenVectorsWithScalarSolver
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX */
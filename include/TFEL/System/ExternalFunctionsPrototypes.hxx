@@ -69,9 +69,11 @@ typedef double DianaFEARealType;
 #include "MFront/GenericMaterialProperty/MaterialProperty.h"
 #include "MFront/GenericBehaviour/Types.h"
 typedef mfront_gmp_MaterialPropertyPtr GenericMaterialPropertyPtr;
+typedef mfront_gmp_MaterialPropertyArrayPtr GenericMaterialPropertyArrayPtr;
 
 // forward declaration
 typedef struct mfront_gb_BehaviourData mfront_gb_BehaviourData;
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
 
 #ifdef __cplusplus
 }
@@ -367,6 +369,15 @@ namespace tfel::system {
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourFctPtr)(
       ::mfront_gb_BehaviourData *const);
   //! \brief a simple alias.
+  typedef int(TFEL_ADDCALL_PTR GenericBehaviourBatchFctPtr)(
+      ::mfront_gb_BatchBehaviourData *const);
+  //! \brief a simple alias.
+  typedef int(TFEL_ADDCALL_PTR GenericBehaviourWithParametersFctPtr)(
+      ::mfront_gb_BehaviourData *const, const ::mfront_gb_real *const);
+  //! \brief a simple alias.
+  typedef void(TFEL_ADDCALL_PTR GenericBehaviourGetParametersFctPtr)(
+      ::mfront_gb_real *const);
+  //! \brief a simple alias.
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourInitializeFunctionPtr)(
       ::mfront_gb_BehaviourData *const, const ::mfront_gb_real *const);
   //! \brief a simple alias.
@@ -17,6 +17,9 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <utility>
+#include <type_traits>
+#include <unordered_map>
 
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
 #include <windows.h>
@@ -34,6 +37,13 @@ namespace tfel::system {
   /*!
    * \brief Structure in charge of loading external function and
    * retrieving information from shared libraries.
+   *
+   * The information about an entry point generated by `MFront` is
+   * read, when available, from the metadata tables associated with this
+   * entry point. Those tables give the addresses of all the symbols
+   * describing the entry point, which are thus retrieved without
+   * querying the dynamic loader for each of them. The legacy symbols are
+   * looked for in libraries generated without those tables.
    */
   struct TFELSYSTEM_VISIBILITY_EXPORT ExternalLibraryManager {
     //! \return the uniq instance of this class
@@ -566,12 +576,61 @@ namespace tfel::system {
      */
     GenericMaterialPropertyPtr getGenericMaterialProperty(const std::string&,
                                                           const std::string&);
+    /*!
+     * \return the function evaluating a material property generated by
+     * the `generic` interface on arrays of values of its arguments.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     * \note the name of the returned symbol is `f` followed by the
+     * `_array` suffix.
+     */
+    GenericMaterialPropertyArrayPtr getGenericMaterialPropertyArrayFunction(
+        const std::string&, const std::string&);
     /*!
      * \param[in] l: name of the library
      * \param[in] f: function name
      */
     GenericBehaviourFctPtr getGenericBehaviourFunction(const std::string&,
                                                        const std::string&);
+    /*!
+     * \return the function integrating a behaviour generated through the
+     * `generic` interface over a batch of integration points.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     * \note the name of the returned symbol is `f` followed by the
+     * `_integrateBatch` suffix.
+     */
+    GenericBehaviourBatchFctPtr getGenericBehaviourBatchFunction(
+        const std::string&, const std::string&);
+    /*!
+     * \return the function integrating a behaviour generated through the
+     * `generic` interface using a block of parameters given by the caller
+     * rather than the values shared by all the callers.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     * \note the name of the returned symbol is `f` followed by the
+     * `_integrateWithParameters` suffix.
+     * \note this function is not available if the parameters of the
+     * behaviour are treated as static variables.
+     */
+    GenericBehaviourWithParametersFctPtr
+    getGenericBehaviourWithParametersFunction(const std::string&,
+                                              const std::string&);
+    /*!
+     * \return the function returning the values of the parameters shared
+     * by all the callers of a behaviour generated through the `generic`
+     * interface. Those values are ordered as expected by the function
+     * returned by the `getGenericBehaviourWithParametersFunction` method.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     * \note the name of the returned symbol is `f` followed by the
+     * `_getParameters` suffix.
+     * \note this function is not available if the parameters of the
+     * behaviour are treated as static variables.
+     */
+    GenericBehaviourGetParametersFctPtr
+    getGenericBehaviourGetParametersFunction(const std::string&,
+                                             const std::string&);
     /*!
      * \return the post-processings associated with a behaviour generated
      * through the `generic` interface.
@@ -1146,6 +1205,32 @@ namespace tfel::system {
      * \return the function pointer
      */
     CastemFunctionPtr getCastemFunction(const std::string&, const std::string&);
+    //! \brief a simple alias
+    using GenericFunctionPtr = void (*)();
+    /*!
+     * \brief load a function from a library
+     * \param l : library  name
+     * \param f : function name
+     * \return the address of the function
+     * \throw std::runtime_error if the function is not found
+     */
+    GenericFunctionPtr getFunctionAddress(const std::string&,
+                                          const std::string&);
+    /*!
+     * \brief load a function from a library and convert it to the given
+     * pointer to function type
+     * \tparam FunctionPtr: pointer to function type
+     * \param l : library  name
+     * \param f : function name
+     * \return the function pointer
+     * \note the signature of the function can't be checked
+     */
+    template <typename FunctionPtr>
+    FunctionPtr getFunction(const std::string& l, const std::string& f) {
+      static_assert(std::is_function_v<std::remove_pointer_t<FunctionPtr>>,
+                    "invalid pointer to function type");
+      return reinterpret_cast<FunctionPtr>(this->getFunctionAddress(l, f));
+    }  // end of getFunction
 
     /*!
      * load a function from a library
@@ -1441,6 +1526,46 @@ namespace tfel::system {
      * \param[in] s: symbol
      */
     std::string getStringIfDefined(const std::string&, const std::string&);
+    /*!
+     * \return the string associated with the given symbol if defined. If the
+     * symbol is not defined, an empty string is returned.
+     * \param[in] l: library
+     * \param[in] f: entry point
+     * \param[in] s: symbol
+     */
+    TFEL_VISIBILITY_LOCAL std::string getStringIfDefined(const std::string&,
+                                                         const std::string&,
+                                                         const std::string&);
+    /*!
+     * \brief symbols describing an entry point, read from the metadata
+     * tables generated by `MFront` or from previous queries to the
+     * dynamic loader.
+     */
+    struct EntryPointSymbols {
+      //! \brief addresses of the symbols. A null address denotes a symbol
+      //! known to be undefined.
+      std::unordered_map<std::string, const void*> addresses;
+      //! \brief prefixes of the symbols known to be undefined
+      std::vector<std::string> undefined_prefixes;
+    };
+    /*!
+     * \return the symbols describing an entry point. The metadata tables
+     * associated with this entry point are read on the first call.
+     * \param[in] l: library
+     * \param[in] f: entry point
+     */
+    TFEL_VISIBILITY_LOCAL EntryPointSymbols& getEntryPointSymbols(
+        const std::string&, const std::string&);
+    /*!
+     * \return the address of a symbol describing an entry point, or a null
+     * pointer if this symbol is not defined.
+     * \param[in] l: library
+     * \param[in] f: entry point
+     * \param[in] s: symbol
+     */
+    TFEL_VISIBILITY_LOCAL const void* getSymbolAddress(const std::string&,
+                                                       const std::string&,
+                                                       const std::string&);
     /*!
      * \return an array of strings associated with an entry point
      * \param[in] l: library
@@ -1467,6 +1592,9 @@ namespace tfel::system {
 #else
     std::map<std::string, void*> librairies;
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    //! \brief symbols of the entry points, indexed by library and entry point
+    std::map<std::pair<std::string, std::string>, EntryPointSymbols>
+        entry_points_symbols;
 
   };  // end of struct LibraryManager
 
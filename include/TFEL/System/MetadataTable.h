@@ -0,0 +1,61 @@
+/*!
+ * \file   include/TFEL/System/MetadataTable.h
+ * \brief  This file declares the structures describing the metadata
+ * tables exported by the libraries generated by `MFront`.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_SYSTEM_METADATATABLE_H
+#define LIB_TFEL_SYSTEM_METADATATABLE_H
+
+/*!
+ * \brief version of the metadata tables described in this file
+ */
+#define MFRONT_METADATA_TABLE_VERSION 1u
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief an entry of a metadata table
+ */
+struct mfront_metadata_entry {
+  //! \brief name of the symbol
+  const char* name;
+  //! \brief address of the symbol
+  const void* address;
+};
+
+/*!
+ * \brief a metadata table, listing the symbols describing an entry point
+ * (or the symbols describing an entry point for a specific modelling
+ * hypothesis). Such a table allows the `ExternalLibraryManager` class to
+ * retrieve all those symbols at once.
+ */
+struct mfront_metadata_table {
+  //! \brief version of the table
+  unsigned int version;
+  //! \brief number of entries
+  unsigned int size;
+  //! \brief entries
+  const struct mfront_metadata_entry* entries;
+};
+
+//! \brief a simple alias
+typedef struct mfront_metadata_entry mfront_metadata_entry;
+//! \brief a simple alias
+typedef struct mfront_metadata_table mfront_metadata_table;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIB_TFEL_SYSTEM_METADATATABLE_H */
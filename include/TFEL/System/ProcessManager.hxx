@@ -111,6 +111,17 @@ namespace tfel::system {
     virtual ProcessId createProcess(ProcessManager::Command&);
 
     virtual void wait(const ProcessId);
+    /*!
+     * \brief wait until the end of the given process
+     * \param[in] pid: process id
+     * \throw SystemError if the process exited du to a signal or if its
+     * exit value is not `EXIT_SUCCESS`.
+     *
+     * \note contrary to the `wait` method, the end of the process is
+     * detected by the handler of the `SIGCHLD` signal. This allows
+     * several processes to be launched and then waited for.
+     */
+    virtual void join(const ProcessId);
 
     /*!
      * destructor.
@@ -160,6 +171,12 @@ namespace tfel::system {
     TFEL_VISIBILITY_LOCAL void setProcessExitStatus(Process&, const int);
 
     TFEL_VISIBILITY_LOCAL void closeProcessFiles(const ProcessId);
+    /*!
+     * \brief wait until the end of the given process is detected by the
+     * handler of the `SIGCHLD` signal
+     * \param[in] p: process
+     */
+    TFEL_VISIBILITY_LOCAL void waitForTermination(const Process&);
 
     TFEL_VISIBILITY_LOCAL
     std::vector<Process>::reverse_iterator findProcess(const ProcessId);
@@ -1,12 +1,16 @@
 /*!
  * \file   ThreadPool.hxx
- * \brief A ThreadPool implementation based on the initial
+ * \brief A ThreadPool implementation initially based on the
  * implementation of Jakob Progsch, Václav Zeman:
  * <https://github.com/progschj/ThreadPool>
  *
  * We added the possibility to handle exceptions through the
  * ThreadedTaskResult class.
  *
+ * Each worker now owns its own task queue. Idle workers steal tasks
+ * from the other queues, so that submitting and executing tasks does
+ * not require a global lock.
+ *
  * \author Thomas Helfer
  * \date   19 juin 2016
  * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
@@ -20,12 +24,13 @@
 #ifndef TFEL_SYSTEM_THREAD_POOL_HXX
 #define TFEL_SYSTEM_THREAD_POOL_HXX
 
-#include <queue>
 #include <mutex>
+#include <cstddef>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <thread>
 #include <future>
-#include <functional>
 #include <condition_variable>
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/System/ThreadedTaskResult.hxx"
@@ -34,6 +39,10 @@ namespace tfel::system {
 
   /*!
    * \brief structure handling a fixed-size pool of threads
+   *
+   * Each worker owns a task queue. A worker executes the last task
+   * pushed in its own queue and, when this queue is empty, steals the
+   * oldest task of the other queues.
    */
   struct TFELSYSTEM_VISIBILITY_EXPORT ThreadPool {
     //! a simple alias
@@ -51,6 +60,23 @@ namespace tfel::system {
     template <typename F, typename... Args>
     std::future<ThreadedTaskResult<std::invoke_result_t<F, Args...>>> addTask(
         F&&, Args&&...);
+    /*!
+     * \brief call the given function for each index in the range
+     * `[b, e[`.
+     *
+     * The range is split in chunks of `g` indices which are distributed
+     * among the workers. The calling thread also executes chunks until
+     * all of them are treated. If the function throws, the first
+     * exception caught is rethrown by the calling thread once all
+     * chunks have been treated.
+     *
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     * \param[in] g: grain size, i.e. number of indices treated by a task
+     * \param[in] f: function called for each index
+     */
+    template <typename F>
+    void parallel_for(const size_type, const size_type, const size_type, F&&);
     //! \return the number of threads managed by the ppol
     size_type getNumberOfThreads() const;
     //! \brief wait for all tasks to be finished
@@ -62,17 +88,65 @@ namespace tfel::system {
     //! wrapper around the given task
     template <typename F>
     struct Wrapper;
-    //! enum describing the status of workers
-    enum Status { WORKING, IDLE };  // end of enum Status
-    std::vector<Status> statuses;
+    //! \brief data associated with a call to the `parallel_for` method
+    template <typename F>
+    struct ParallelForData;
+    /*!
+     * \brief a task stored in a work queue.
+     *
+     * A task is described by a function pointer and a pointer to its
+     * data, which avoids the type erasure provided by `std::function`.
+     */
+    struct Task {
+      //! \brief function executing the task
+      void (*execute)(void*, const size_type, const size_type) = nullptr;
+      //! \brief data passed to the function
+      void* data = nullptr;
+      //! \brief first index treated by the task
+      size_type first = 0;
+      //! \brief past-the-end index treated by the task
+      size_type last = 0;
+    };
+    //! \brief task queue associated with a worker
+    struct WorkQueue;
+    /*!
+     * \brief add a task to one of the work queues
+     * \param[in] t: task
+     */
+    void push(const Task&);
+    /*!
+     * \brief execute a task, if any
+     * \return true if a task has been executed
+     * \param[in] i: index of the queue to be looked at first
+     */
+    bool tryExecuteTask(const size_type);
+    //! \return the index of the queue where the next task will be added
+    size_type getNextQueueIndex();
+    //! \brief task queues, one per worker
+    std::vector<std::unique_ptr<WorkQueue>> queues;
     //! list of available threads
     std::vector<std::thread> workers;
-    // the task queue
-    std::queue<std::function<void()>> tasks;
-    // synchronization
+    //! \brief index used to distribute the tasks among the queues
+    std::atomic<size_type> next_queue{0};
+    /*!
+     * \brief number of tasks waiting in the queues
+     *
+     * \note this counter is increased after the task is made available,
+     * and may thus be temporarily negative.
+     */
+    std::atomic<std::ptrdiff_t> pending{0};
+    //! \brief number of tasks submitted but not yet executed
+    std::atomic<size_type> unfinished{0};
+    //! \brief number of sleeping workers
+    std::atomic<size_type> sleeping{0};
+    //! \brief mutex used by the condition variables
     std::mutex m;
+    //! \brief condition variable used to wake up sleeping workers
     std::condition_variable c;
-    bool stop = false;
+    //! \brief condition variable used by the `wait` method
+    std::condition_variable done;
+    //! \brief boolean stating if the pool is being destroyed
+    std::atomic<bool> stop{false};
   };
 
 }  // end of namespace tfel::system
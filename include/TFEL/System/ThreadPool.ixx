@@ -15,6 +15,9 @@
 #define TFEL_SYSTEM_THREAD_POOL_IXX
 
 #include <memory>
+#include <exception>
+#include <stdexcept>
+#include <functional>
 #include <type_traits>
 
 namespace tfel::system {
@@ -58,29 +61,95 @@ namespace tfel::system {
     F f;
   };
 
+  template <typename F>
+  struct ThreadPool::ParallelForData {
+    /*!
+     * \brief execute the function for all indices in the range `[b, e[`
+     * \param[in] d: pointer to the data
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     */
+    static void execute(void* const d, const size_type b, const size_type e) {
+      auto& pd = *(static_cast<ParallelForData*>(d));
+      try {
+        for (auto i = b; i != e; ++i) {
+          pd.f(i);
+        }
+      } catch (...) {
+        if (!pd.failed.test_and_set()) {
+          pd.exception = std::current_exception();
+        }
+      }
+      pd.remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }  // end of execute
+    //! \brief function called for each index
+    F& f;
+    //! \brief number of chunks not treated yet
+    std::atomic<size_type> remaining;
+    //! \brief flag set by the first chunk throwing an exception
+    std::atomic_flag failed = ATOMIC_FLAG_INIT;
+    //! \brief first exception thrown
+    std::exception_ptr exception;
+  };
+
   // add new work item to the pool
   template <typename F, typename... Args>
   std::future<ThreadedTaskResult<std::invoke_result_t<F, Args...>>>
   ThreadPool::addTask(F&& f, Args&&... a) {
     using return_type = ThreadedTaskResult<std::invoke_result_t<F, Args...>>;
     using task = std::packaged_task<return_type()>;
-    auto t = std::make_shared<task>(
+    // don't allow enqueueing after stopping the pool
+    if (this->stop) {
+      throw std::runtime_error(
+          "ThreadPool::addTask: "
+          "enqueue on stopped ThreadPool");
+    }
+    auto t = std::make_unique<task>(
         std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
     auto res = t->get_future();
-    {
-      std::unique_lock<std::mutex> lock(this->m);
-      // don't allow enqueueing after stopping the pool
-      if (this->stop) {
-        throw std::runtime_error(
-            "ThreadPool::addTask: "
-            "enqueue on stopped ThreadPool");
-      }
-      this->tasks.emplace([t] { (*t)(); });
-    }
-    this->c.notify_one();
+    auto execute = [](void* const d, const size_type, const size_type) {
+      auto pt = std::unique_ptr<task>(static_cast<task*>(d));
+      (*pt)();
+    };
+    this->push(Task{execute, t.release(), 0, 0});
     return res;
   }
 
+  template <typename F>
+  void ThreadPool::parallel_for(const size_type b,
+                                const size_type e,
+                                const size_type g,
+                                F&& f) {
+    if (e <= b) {
+      return;
+    }
+    const auto grain = g == 0 ? size_type{1} : g;
+    const auto nchunks = (e - b + grain - 1) / grain;
+    if ((nchunks == 1) || (this->workers.empty())) {
+      for (auto i = b; i != e; ++i) {
+        f(i);
+      }
+      return;
+    }
+    using Data = ParallelForData<std::remove_reference_t<F>>;
+    auto d = Data{f, {nchunks}, ATOMIC_FLAG_INIT, nullptr};
+    for (size_type i = 0; i != nchunks; ++i) {
+      const auto cb = b + i * grain;
+      const auto ce = (i + 1 == nchunks) ? e : cb + grain;
+      this->push(Task{&Data::execute, &d, cb, ce});
+    }
+    // the calling thread helps the workers
+    const auto i0 = this->getNextQueueIndex();
+    while (d.remaining.load(std::memory_order_acquire) != 0) {
+      if (!this->tryExecuteTask(i0)) {
+        std::this_thread::yield();
+      }
+    }
+    if (d.exception) {
+      std::rethrow_exception(d.exception);
+    }
+  }  // end of parallel_for
+
 }  // end of namespace tfel::system
 
 #endif /* TFEL_SYSTEM_THREAD_POOL_IXX */
@@ -100,6 +100,21 @@ double(TFEL_ADDCALL_PTR tfel_getGenericMaterialProperty(
                                            const mfront_gmp_real* const,
                                            const mfront_gmp_size_type,
                                            const mfront_gmp_OutOfBoundsPolicy);
+/*!
+ * \brief return a function generated by the generic material property
+ * interface which evaluates the material property on arrays of values.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+void(TFEL_ADDCALL_PTR tfel_getGenericMaterialPropertyArrayFunction(
+    LibraryHandlerPtr,
+    const char* const))(mfront_gmp_OutputStatus* const,
+                        const mfront_gmp_real* const* const,
+                        mfront_gmp_real* const,
+                        const mfront_gmp_size_type,
+                        const mfront_gmp_OutOfBoundsPolicy);
 /*!
  * \brief return a function generated by the generic behaviour interface
  * \param l: library handler
@@ -110,6 +125,40 @@ double(TFEL_ADDCALL_PTR tfel_getGenericMaterialProperty(
 int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourFunction(LibraryHandlerPtr,
                                                       const char* const))(
     struct mfront_gb_BehaviourData* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * which integrates the behaviour over a batch of integration points.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourBatchFunction(LibraryHandlerPtr,
+                                                           const char* const))(
+    struct mfront_gb_BatchBehaviourData* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * which integrates the behaviour using a block of parameters given by the
+ * caller.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourWithParametersFunction(
+    LibraryHandlerPtr,
+    const char* const))(struct mfront_gb_BehaviourData* const,
+                        const mfront_gb_real* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * which returns the values of the parameters shared by all the callers.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+void(TFEL_ADDCALL_PTR tfel_getGenericBehaviourGetParametersFunction(
+    LibraryHandlerPtr, const char* const))(mfront_gb_real* const);
 /*!
  * \brief return a function generated by the generic behaviour interface
  * associated with an initialize functions.
@@ -0,0 +1,110 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryResultFile.hxx
+ * \brief   This file declares the classes and functions used to write and
+ * read result files in a binary columnar format.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYRESULTFILE_HXX
+#define LIB_TFEL_UTILITIES_BINARYRESULTFILE_HXX
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <string_view>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class in charge of writing a result file in a binary columnar
+   * format.
+   *
+   * The file starts with a header containing a magic string, the version of
+   * the format, a byte order mark and the legends of the columns. The lines
+   * are then buffered and written by blocks. Each block starts with its
+   * number of lines and stores the values column by column. A column whose
+   * values are all equal in a block is stored only once. Storing values
+   * column by column makes the blocks easy to compress by general purpose
+   * tools.
+   *
+   * Values are written in the native byte order. The byte order mark allows
+   * the reader to detect files written on a machine with a different byte
+   * order.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryResultFileWriter {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] l: legends of the columns
+     * \param[in] n: number of lines per block
+     */
+    BinaryResultFileWriter(const std::string&,
+                           const std::vector<std::string>&,
+                           const size_type = 1024);
+    /*!
+     * \brief add a new line
+     * \param[in] v: values of the line
+     */
+    void addLine(const std::vector<double>&);
+    //! \brief write the buffered lines, if any, and flush the file
+    void flush();
+    //! \return the number of columns
+    size_type getNumberOfColumns() const noexcept;
+    //! \brief destructor
+    ~BinaryResultFileWriter() noexcept;
+
+   private:
+    BinaryResultFileWriter(BinaryResultFileWriter&&) = delete;
+    BinaryResultFileWriter(const BinaryResultFileWriter&) = delete;
+    BinaryResultFileWriter& operator=(BinaryResultFileWriter&&) = delete;
+    BinaryResultFileWriter& operator=(const BinaryResultFileWriter&) = delete;
+    //! \brief write the buffered lines as a new block
+    TFEL_VISIBILITY_LOCAL void writeBlock();
+    //! \brief output file
+    std::ofstream file;
+    //! \brief buffered values, stored line by line
+    std::vector<double> values;
+    //! \brief number of columns
+    size_type ncolumns;
+    //! \brief number of lines per block
+    size_type block_size;
+  };  // end of struct BinaryResultFileWriter
+
+  //! \brief content of a result file in the binary format
+  struct BinaryResultFileContent {
+    //! \brief legends of the columns
+    std::vector<std::string> legends;
+    //! \brief values, stored line by line
+    std::vector<double> values;
+    //! \brief number of lines
+    std::size_t nlines = 0;
+  };  // end of struct BinaryResultFileContent
+
+  /*!
+   * \return true if the given data starts with the header of a result file
+   * in the binary format
+   * \param[in] d: data
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT bool isBinaryResultFile(
+      const std::string_view) noexcept;
+  /*!
+   * \return the content of a result file in the binary format
+   * \param[in] d: data
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT BinaryResultFileContent
+  readBinaryResultFile(const std::string_view);
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYRESULTFILE_HXX */
@@ -109,6 +109,16 @@ namespace tfel::utilities {
   TFELUTILITIES_VISIBILITY_EXPORT void replace_all(std::string&,
                                                    const char,
                                                    std::string_view);
+  /*!
+   * \return a stable hash of the given string, as a string of 16
+   * hexadecimal digits. Contrary to `std::hash`, the result does not
+   * depend on the process nor on the implementation of the standard
+   * library, so that it can be used to name files shared by successive
+   * runs.
+   * \param[in] s: string
+   * \note the 64 bits FNV-1a algorithm is used
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT std::string getStableHash(std::string_view);
   /*!
    * \brief convert a string to the given type
    * \param[in] s: string to be converted
@@ -14,8 +14,10 @@
 #ifndef LIB_TFEL_UTILITIES_TEXTDATA_HXX
 #define LIB_TFEL_UTILITIES_TEXTDATA_HXX
 
+#include <mutex>
 #include <vector>
 #include <string>
+#include <cstddef>
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Utilities/Token.hxx"
@@ -24,6 +26,12 @@ namespace tfel::utilities {
 
   /*!
    * \brief class in charge of reading data in a text file
+   *
+   * The file is read in one block and the data lines made of numbers
+   * separated by white spaces are directly converted to floating point
+   * values. Other data lines are handled by the `CxxTokenizer` class
+   * when a column is requested. The tokens returned by the `begin` and
+   * `end` methods are only built on demand.
    */
   struct TFELUTILITIES_VISIBILITY_EXPORT TextData {
     //! a simple alias
@@ -51,6 +59,10 @@ namespace tfel::utilities {
      *   the behaviour of gnuplot when the following command is
      *   used:
      *   set key autotitle columnhead
+     *
+     * Result files written in the binary format by the
+     * `BinaryResultFileWriter` class are detected automatically,
+     * whatever the format specified.
      */
     TextData(const std::string&, const std::string& = "");
     /*!
@@ -112,8 +124,30 @@ namespace tfel::utilities {
     TextData(const TextData&) = delete;
     TextData& operator=(TextData&&) = delete;
     TextData& operator=(const TextData&) = delete;
-    //! list of all tokens of the file, sorted by line
-    std::vector<Line> lines;
+    /*!
+     * \return the tokens of the given data line
+     * \param[in] r: index of the data line
+     */
+    TFEL_VISIBILITY_LOCAL Line tokenize(const std::size_t) const;
+    //! \brief list of all tokens of the file, sorted by line
+    mutable std::vector<Line> lines;
+    //! \brief flag used to build the list of tokens only once
+    mutable std::once_flag lines_flag;
+    //! \brief text of the data lines
+    std::string text;
+    //! \brief offsets of the data lines in `text`
+    std::vector<std::size_t> text_offsets;
+    //! \brief values of the data lines, stored line by line
+    std::vector<double> values;
+    //! \brief offsets of the data lines in `values`
+    std::vector<std::size_t> value_offsets;
+    //! \brief line numbers of the data lines
+    std::vector<size_type> line_numbers;
+    /*!
+     * \brief data lines which are not only made of numbers. The values
+     * of those lines are converted when a column is requested.
+     */
+    std::vector<std::size_t> irregular_lines;
     //! list of column titles
     std::vector<std::string> legends;
     //! first commented lines
@@ -141,6 +141,18 @@ namespace mfront {
     virtual void writeBehaviourConstructorBody(std::ostream &,
                                                const BehaviourDescription &,
                                                const Hypothesis) const = 0;
+    /*!
+     * \brief write the code, inserted in the behaviour constructor
+     * associated with the interface just after the initialisation of the
+     * parameters, which allows the interface to override their values.
+     * \param[in] os: output file
+     * \param[in] mb: behaviour description
+     * \param[in] h:  modelling hypothesis
+     */
+    virtual void writeBehaviourConstructorParametersOverrides(
+        std::ostream &,
+        const BehaviourDescription &,
+        const Hypothesis) const = 0;
 
     virtual void writeBehaviourDataConstructor(
         std::ostream &,
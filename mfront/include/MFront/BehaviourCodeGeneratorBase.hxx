@@ -77,6 +77,17 @@ namespace mfront {
      * state variables
      */
     virtual bool usesStateVariableTimeDerivative() const;
+    /*!
+     * \brief return if the generated classes must provide constructors
+     * converting objects associated with another numeric type
+     */
+    virtual bool requiresNumericTypeConversions() const;
+    /*!
+     * \brief return if the generated classes must provide the methods
+     * copying the data of one integration point in a lane of the classes
+     * instantiated on packs of values and back.
+     */
+    virtual bool requiresLaneAccessors() const;
     /*!
      * write the given variable declaration
      * \param[out] f                 : output file
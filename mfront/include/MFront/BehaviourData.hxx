@@ -143,6 +143,18 @@ namespace mfront {
     static const char* const compareToNumericalJacobian;
     //! list of jacobian blocks that must be computed numerically
     static const char* const numericallyComputedJacobianBlocks;
+    /*!
+     * \brief list of jacobian blocks known to be null. Those blocks are
+     * used to colour the columns of the jacobian when it is computed by
+     * central differences.
+     */
+    static const char* const nullJacobianBlocks;
+    /*!
+     * \brief method used to compute the jacobian when it is not given
+     * analytically. Supported values are
+     * `CentralDifferences` (default) and `AutomaticDifferentiation`.
+     */
+    static const char* const jacobianComputation;
     /*!
      * a boolean attribute telling if the additionnal variables can be
      * declared. This attribute is set by DSL's when the first code
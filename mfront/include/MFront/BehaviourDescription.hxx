@@ -202,6 +202,12 @@ namespace mfront {
     static const char* const requiresThermalExpansionCoefficientTensor;
     //! \brief attribute name
     static const char* const setRequireThermalExpansionCoefficientTensor;
+    /*!
+     * \brief attribute name. If defined, this attribute gives the number of
+     * integration points integrated in lock-step by the interfaces
+     * supporting vectorisation.
+     */
+    static const char* const vectorisationWidth;
     //! \brief default constructor
     BehaviourDescription();
     /*!
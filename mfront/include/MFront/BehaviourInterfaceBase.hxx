@@ -43,6 +43,10 @@ namespace mfront {
     std::pair<std::vector<BehaviourMaterialProperty>, SupportedTypes::TypeSize>
     buildMaterialPropertiesList(const BehaviourDescription &,
                                 const Hypothesis) const override;
+    void writeBehaviourConstructorParametersOverrides(
+        std::ostream &,
+        const BehaviourDescription &,
+        const Hypothesis) const override;
     void writeBehaviourInitializeFunctions(std::ostream &,
                                            const BehaviourDescription &,
                                            const Hypothesis) const override;
@@ -24,19 +24,41 @@
 
 #include "MFront/MFrontConfig.hxx"
 
-#include <array>
-#include <atomic>
+#include <mutex>
+#include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
 
 namespace mfront {
 
   /*!
    * structure in charge of performance measurements in mechanical
    * behaviour
+   *
+   * Each thread reports its measures in its own slot, aligned on a
+   * cache line, so that threads integrating the same behaviour do not
+   * share any written memory. For each code block, the number of
+   * calls, the total, minimal and maximal times and an histogram of the
+   * times are recorded. The number of iterations of the non linear
+   * solver is also recorded for each integration of implicit
+   * behaviours.
+   *
+   * The measures of all threads are merged when the profiler is
+   * destroyed. The results are then printed on the standard output,
+   * unless the `MFRONT_PROFILING_OUTPUT` environment variable is
+   * defined, in which case they are written in `JSON` format in the
+   * given file. If the `MFRONT_PROFILING_TRACE` environment variable is
+   * defined, every measure is also recorded and written in the given
+   * file in the Chrome trace event format. In both file names, the
+   * `@behaviour@` and `@pid@` patterns are replaced respectively by
+   * the name of the behaviour and the process id.
    */
   struct MFRONTPROFILING_VISIBILITY_EXPORT BehaviourProfiler {
     //! a simple alias
     using index_type = unsigned short;
+    //! \brief measures of a thread (opaque structure)
+    struct ThreadMeasures;
     /*!
      * a timer for a specicied code block.
      * This descructor will increase the time count for the code block.
@@ -57,6 +79,8 @@ namespace mfront {
       Timer& operator=(Timer&&) = delete;
       //! timer to which the results are reported
       BehaviourProfiler& gtimer;
+      //! measures of the current thread
+      ThreadMeasures& measures;
       //! code block associated with the timer
       const index_type c;
 #if !(defined _WIN32 || defined _WIN64)
@@ -64,6 +88,8 @@ namespace mfront {
       timespec start;
       //! end
       timespec end;
+      //! start of the measure on the monotonic clock (trace only)
+      timespec wstart;
 #endif
     };  // end of struct Timer
     /*!
@@ -137,14 +163,40 @@ namespace mfront {
         APOSTERIORITIMESTEPSCALINGFACTOR = 21;
     //! code block index in the measures array
     static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type TOTALTIME = 22;
+    //! number of code blocks
+    static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type
+        NUMBEROFCODEBLOCKS = 23;
+    /*!
+     * \brief report the number of iterations of the non linear solver
+     * for one integration
+     * \param[in] n: number of iterations
+     * \param[in] b: boolean stating if the solver converged
+     */
+    void reportNewtonIterations(const std::intmax_t, const bool);
     //! destructor
     ~BehaviourProfiler();
 
    protected:
+    //! \return the measures of the current thread
+    ThreadMeasures& getThreadMeasures();
+    //! \brief print the merged measures on the standard output
+    void print(const ThreadMeasures&) const;
+    //! \brief write the merged measures in `JSON` format
+    void writeJSON(const std::string&, const ThreadMeasures&) const;
+    //! \brief write the recorded events in the Chrome trace event format
+    void writeTrace(const std::string&) const;
     //! name of the behaviour
     const std::string name;
-    //! time spend in each code block (nanoseconds)
-    std::array<std::atomic<intmax_t>, 23> measures;
+    //! output file of the merged measures (JSON format)
+    std::string output;
+    //! output file of the events (Chrome trace format)
+    std::string trace;
+    //! \brief identifier of the profiler
+    const std::uintmax_t identifier;
+    //! \brief mutex used to register new threads
+    std::mutex m;
+    //! measures of each thread
+    std::vector<std::unique_ptr<ThreadMeasures>> threads;
   };  // end of BehaviourProfiler
 
 }  // end of namespace mfront
@@ -0,0 +1,167 @@
+/*!
+ * \file   mfront/include/MFront/CompilationCache.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_COMPILATIONCACHE_HXX
+#define LIB_MFRONT_COMPILATIONCACHE_HXX
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+#include "MFront/MFrontConfig.hxx"
+#include "MFront/TargetsDescription.hxx"
+
+namespace mfront {
+
+  // forward declaration
+  struct GeneratorOptions;
+
+  /*!
+   * \brief a persistent, content-addressed, cache of the files generated
+   * by `MFront` and of the associated object files.
+   *
+   * An input file is associated with a key built from its content, the
+   * version of `TFEL`, the options of `MFront` (interfaces, search
+   * paths, substitutions, etc.) and the environment variables used by
+   * the compilation (`CXX`, `CXXFLAGS`, etc.). For each key, the cache
+   * stores the list of the files read while treating the input file
+   * (imported files, material properties, models, etc.) and one entry
+   * per content of those dependencies.
+   *
+   * An entry contains the generated sources, the description of the
+   * targets and, once the libraries have been built with the `make`
+   * generator, the object files, classified by compilation flags.
+   *
+   * All the accesses to the cache directory are protected by the
+   * `MFrontLock`, and new entries are built in temporary directories
+   * which are then renamed, so that the cache can be shared by
+   * concurrent `MFront` processes.
+   *
+   * Input files may be treated while treating another input file (for
+   * instance, the material properties used by a behaviour). The
+   * recordings are thus stacked: the dependencies of a nested input
+   * file are also dependencies of the input file which requires it.
+   *
+   * The cache is disabled by default. It is enabled by defining a cache
+   * directory, either explicitly or through the `MFRONT_CACHE_DIRECTORY`
+   * environment variable.
+   */
+  struct MFRONT_VISIBILITY_EXPORT CompilationCache {
+    //! \return the unique instance of this class
+    static CompilationCache& getCompilationCache();
+    /*!
+     * \brief set the cache directory and enable the cache
+     * \param[in] d: directory
+     */
+    void setDirectory(const std::string&);
+    //! \return the cache directory
+    const std::string& getDirectory() const;
+    //! \return if the cache is enabled
+    bool isEnabled() const;
+    /*!
+     * \return the key associated with the given input file or an empty
+     * string if the input file can't be cached.
+     * \param[in] f: input file
+     * \param[in] o: description of the options of `MFront`
+     */
+    std::string getKey(const std::string&, const std::string&) const;
+    /*!
+     * \brief restore the files generated for the given key, if an entry
+     * matching the current content of the dependencies is available.
+     *
+     * If an input file is being recorded, the dependencies of the
+     * restored entry are added to its dependencies.
+     *
+     * \return true if the files have been restored
+     * \param[out] td: description of the targets
+     * \param[in] k: key
+     */
+    bool restore(TargetsDescription&, const std::string&);
+    /*!
+     * \brief start recording the dependencies and the files generated
+     * by the treatment of an input file. If another input file is
+     * being recorded, this recording is nested in the current one.
+     */
+    void startRecording();
+    /*!
+     * \brief add a file read while treating the current input file
+     * \param[in] f: file
+     */
+    void addDependency(const std::string&);
+    /*!
+     * \brief stop the current recording and store a new entry for the
+     * given key. The dependencies of the current input file are added
+     * to the dependencies of the enclosing recording, if any.
+     * \param[in] k: key
+     * \param[in] td: description of the targets
+     */
+    void store(const std::string&, const TargetsDescription&);
+    /*!
+     * \brief stop the current recording without storing any entry,
+     * for example if the treatment of the input file failed. The
+     * dependencies of the current input file are added to the
+     * dependencies of the enclosing recording, if any.
+     */
+    void stopRecording();
+    /*!
+     * \return the key associated with the compilation flags, used to
+     * classify object files
+     * \param[in] t: description of all the targets
+     * \param[in] o: generator options
+     */
+    std::string getObjectsKey(const TargetsDescription&,
+                              const GeneratorOptions&) const;
+    /*!
+     * \brief copy the object files of the entries used by the current
+     * process in the `src` directory, if available.
+     * \param[in] k: key associated with the compilation flags
+     */
+    void restoreObjects(const std::string&);
+    /*!
+     * \brief store the object files of the entries used by the current
+     * process.
+     * \param[in] k: key associated with the compilation flags
+     */
+    void storeObjects(const std::string&);
+
+   private:
+    //! \brief default constructor
+    CompilationCache();
+    CompilationCache(CompilationCache&&) = delete;
+    CompilationCache(const CompilationCache&) = delete;
+    CompilationCache& operator=(CompilationCache&&) = delete;
+    CompilationCache& operator=(const CompilationCache&) = delete;
+    //! \brief description of the recording of an input file
+    struct Recording {
+      //! \brief dependencies of the input file
+      std::vector<std::string> dependencies;
+      //! \brief modification times of the files before the treatment
+      std::map<std::string, long long> snapshot;
+    };
+    /*!
+     * \brief remove the current recording and add its dependencies to
+     * the enclosing recording, if any.
+     * \return the removed recording
+     */
+    Recording popRecording();
+    //! \brief cache directory
+    std::string directory;
+    //! \brief stack of the recordings of the input files being treated
+    std::vector<Recording> recordings;
+    //! \brief entries used by the current process
+    std::vector<std::pair<std::string, TargetsDescription>> entries;
+  };  // end of struct CompilationCache
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_COMPILATIONCACHE_HXX */
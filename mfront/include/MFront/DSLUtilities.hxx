@@ -19,6 +19,7 @@
 #include <tuple>
 #include <vector>
 #include <string>
+#include <sstream>
 #include <string_view>
 
 #include "MFront/MFrontConfig.hxx"
@@ -70,6 +71,26 @@ namespace mfront {
    */
   MFRONT_VISIBILITY_EXPORT std::vector<std::string> getST2toST2TypeAliases();
 
+  /*!
+   * \brief an output stream which records the names of the symbols
+   * exported using the `MFRONT_EXPORT_SYMBOL` and
+   * `MFRONT_EXPORT_ARRAY_OF_SYMBOLS` macros.
+   */
+  struct MFRONT_VISIBILITY_EXPORT SymbolsOutputStream
+      : public std::ostringstream {
+    //! \brief destructor
+    ~SymbolsOutputStream() override;
+    //! \brief names of the exported symbols
+    std::vector<std::string> symbols;
+  };
+  /*!
+   * \brief record the name of an exported symbol if the given stream is
+   * a `SymbolsOutputStream`. This function does nothing otherwise.
+   * \param[out] os: output stream
+   * \param[in] n: name of the symbol
+   */
+  MFRONT_VISIBILITY_EXPORT void recordExportedSymbol(std::ostream&,
+                                                     const std::string_view);
   /*!
    * \brief export a symbol using the `MFRONT_EXPORT_SYMBOL` macro
    * \param[out] os: output stream
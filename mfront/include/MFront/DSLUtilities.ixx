@@ -24,6 +24,7 @@ namespace mfront {
                     const std::string_view t,
                     const std::string_view n,
                     const ValueType& v) {
+    recordExportedSymbol(os, n);
     os << "MFRONT_EXPORT_SYMBOL(" << t << ", " << n << ", " << v << ");\n\n";
   }  // end of exportSymbol
 
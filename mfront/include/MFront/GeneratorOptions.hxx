@@ -91,6 +91,11 @@ namespace mfront {
     bool nodeps = false;
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
     bool melt = true;
+    /*!
+     * \brief number of parallel jobs used to build the libraries. If
+     * null, the number of available cores is used.
+     */
+    unsigned short jobs = 0;
   };  // end of struct GeneratorOptions
 
 }  // end of namespace mfront
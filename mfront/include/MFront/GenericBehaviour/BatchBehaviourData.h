@@ -0,0 +1,99 @@
+/*!
+ * \file   include/MFront/GenericBehaviour/BatchBehaviourData.h
+ * \brief  This file declares the structure passed to the functions
+ * integrating a behaviour over a batch of integration points.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with linking exception
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+
+#include "MFront/GenericBehaviour/Types.h"
+#include "MFront/GenericBehaviour/State.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief structure passed to the integration of a behaviour over a batch of
+ * integration points.
+ */
+#ifndef MFRONT_GB_BATCHBEHAVIOURDATA_FORWARD_DECLARATION
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
+#endif
+
+/*!
+ * \brief structure passed to the integration of a behaviour over a batch of
+ * integration points.
+ *
+ * All the buffers are stored using a structure-of-arrays layout: the
+ * `c`-th component of a quantity at the `i`-th integration point is
+ * stored at index `c * n + i`. The buffers referenced by the `s0` and `s1`
+ * members follow this convention, so the `mass_density`, `stored_energy`
+ * and `dissipated_energy` buffers, when given, must hold `n` values.
+ *
+ * The meaning of the values stored in the stiffness matrix buffer `K` is
+ * the same as for the `mfront_gb_BehaviourData` structure, except that the
+ * `K[0]`, `K[1]` and `K[2]` input values are given per integration point.
+ */
+struct mfront_gb_BatchBehaviourData {
+  /*!
+   * \brief pointer to a buffer used to store error message
+   *
+   * \note This pointer can be nullptr. If not null, the pointer must
+   * point to a buffer which is at least 512 characters wide (longer
+   * error message are truncated). Only the error message associated with
+   * the first integration point which failed is reported.
+   */
+  char* error_message;
+  //! \brief time increment
+  mfront_gb_real dt;
+  //! \brief number of integration points
+  mfront_gb_size_type n;
+  //! \brief stiffness matrices
+  mfront_gb_real* K;
+  /*!
+   * \brief proposed time step increment increase factor (one value per
+   * integration point)
+   */
+  mfront_gb_real* rdt;
+  /*!
+   * \brief speed of sound (only computed if requested). This pointer can be
+   * nullptr.
+   */
+  mfront_gb_real* speed_of_sound;
+  /*!
+   * \brief status of the integration at each integration point. This
+   * pointer can be nullptr.
+   */
+  int* status;
+  //! \brief states at the beginning of the time step
+  mfront_gb_InitialState s0;
+  //! \brief states at the end of the time step
+  mfront_gb_State s1;
+};
+
+#ifdef __cplusplus
+
+namespace mfront::gb {
+
+  //! \brief a simple alias
+  using BatchBehaviourData = ::mfront_gb_BatchBehaviourData;
+
+}  // end of namespace mfront::gb
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H */
@@ -0,0 +1,295 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/IntegrateBatch.hxx
+ * \brief  This file implements the integration of a behaviour over a batch
+ * of integration points.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEBATCH_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEBATCH_HXX
+
+#include <array>
+#include <algorithm>
+#include "MFront/GenericBehaviour/Types.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+namespace mfront::gb {
+
+  namespace internals {
+
+    /*!
+     * \brief copy the values associated with the `i`-th integration point
+     * from a buffer stored using a structure-of-arrays layout
+     * \tparam N: number of components
+     * \param[out] dest: destination
+     * \param[in] src: source buffer
+     * \param[in] i: index of the integration point
+     * \param[in] n: number of integration points
+     */
+    template <size_type N>
+    void gatherBatchValues(real* const dest,
+                           const real* const src,
+                           const size_type i,
+                           const size_type n) {
+      for (size_type c = 0; c != N; ++c) {
+        dest[c] = src[c * n + i];
+      }
+    }  // end of gatherBatchValues
+
+    /*!
+     * \brief copy the values associated with the `i`-th integration point
+     * in a buffer stored using a structure-of-arrays layout
+     * \tparam N: number of components
+     * \param[out] dest: destination buffer
+     * \param[in] src: source
+     * \param[in] i: index of the integration point
+     * \param[in] n: number of integration points
+     */
+    template <size_type N>
+    void scatterBatchValues(real* const dest,
+                            const real* const src,
+                            const size_type i,
+                            const size_type n) {
+      for (size_type c = 0; c != N; ++c) {
+        dest[c * n + i] = src[c];
+      }
+    }  // end of scatterBatchValues
+
+    /*!
+     * \brief buffers holding the data of one integration point of a
+     * batch.
+     *
+     * The buffers are allocated on the stack and their sizes are known at
+     * compile-time, so no memory allocation is performed. The member `pd`
+     * points to those buffers and can be passed to the functions
+     * integrating the behaviour at one integration point.
+     *
+     * \tparam GradientsSize: number of components of the gradients
+     * \tparam ThermodynamicForcesSize: number of components of the
+     * thermodynamic forces
+     * \tparam MaterialPropertiesSize: number of material properties
+     * \tparam InternalStateVariablesSize: number of internal state
+     * variables
+     * \tparam ExternalStateVariablesSize: number of external state
+     * variables
+     * \tparam StiffnessMatrixSize: size of the stiffness matrix
+     */
+    template <size_type GradientsSize,
+              size_type ThermodynamicForcesSize,
+              size_type MaterialPropertiesSize,
+              size_type InternalStateVariablesSize,
+              size_type ExternalStateVariablesSize,
+              size_type StiffnessMatrixSize>
+    struct BatchPointBuffers {
+      //! \brief default constructor
+      BatchPointBuffers() = default;
+      // `pd` points to the members of this object, which thus can't be
+      // copied nor moved
+      BatchPointBuffers(BatchPointBuffers&&) = delete;
+      BatchPointBuffers(const BatchPointBuffers&) = delete;
+      BatchPointBuffers& operator=(BatchPointBuffers&&) = delete;
+      BatchPointBuffers& operator=(const BatchPointBuffers&) = delete;
+      /*!
+       * \brief set the pointers of `pd` to the buffers. The optional
+       * buffers are only used if the batch data provides them.
+       * \param[in] d: batch data
+       */
+      void initialize(const BatchBehaviourData& d) {
+        this->pd = BehaviourData{};
+        this->pd.dt = d.dt;
+        this->pd.K = this->K.data();
+        this->pd.rdt = &(this->rdt);
+        this->pd.speed_of_sound = &(this->speed_of_sound);
+        this->pd.s0.gradients = this->g0.data();
+        this->pd.s0.thermodynamic_forces = this->th0.data();
+        this->pd.s0.material_properties = this->mps0.data();
+        this->pd.s0.internal_state_variables = this->isvs0.data();
+        this->pd.s0.external_state_variables = this->esvs0.data();
+        this->pd.s0.mass_density =
+            d.s0.mass_density != nullptr ? &(this->rho0) : nullptr;
+        this->pd.s0.stored_energy =
+            d.s0.stored_energy != nullptr ? &(this->se0) : nullptr;
+        this->pd.s0.dissipated_energy =
+            d.s0.dissipated_energy != nullptr ? &(this->de0) : nullptr;
+        this->pd.s1.gradients = this->g1.data();
+        this->pd.s1.thermodynamic_forces = this->th1.data();
+        this->pd.s1.material_properties = this->mps1.data();
+        this->pd.s1.internal_state_variables = this->isvs1.data();
+        this->pd.s1.external_state_variables = this->esvs1.data();
+        this->pd.s1.mass_density =
+            d.s1.mass_density != nullptr ? &(this->rho1) : nullptr;
+        this->pd.s1.stored_energy =
+            d.s1.stored_energy != nullptr ? &(this->se1) : nullptr;
+        this->pd.s1.dissipated_energy =
+            d.s1.dissipated_energy != nullptr ? &(this->de1) : nullptr;
+      }  // end of initialize
+      /*!
+       * \brief copy the inputs of the `i`-th integration point of the
+       * batch in the buffers
+       * \param[in] d: batch data
+       * \param[in] i: index of the integration point
+       */
+      void gather(const BatchBehaviourData& d, const size_type i) {
+        const auto n = d.n;
+        gatherBatchValues<GradientsSize>(this->g0.data(), d.s0.gradients, i,
+                                         n);
+        gatherBatchValues<GradientsSize>(this->g1.data(), d.s1.gradients, i,
+                                         n);
+        gatherBatchValues<ThermodynamicForcesSize>(
+            this->th0.data(), d.s0.thermodynamic_forces, i, n);
+        gatherBatchValues<ThermodynamicForcesSize>(
+            this->th1.data(), d.s1.thermodynamic_forces, i, n);
+        gatherBatchValues<MaterialPropertiesSize>(
+            this->mps0.data(), d.s0.material_properties, i, n);
+        gatherBatchValues<MaterialPropertiesSize>(
+            this->mps1.data(), d.s1.material_properties, i, n);
+        gatherBatchValues<InternalStateVariablesSize>(
+            this->isvs0.data(), d.s0.internal_state_variables, i, n);
+        gatherBatchValues<InternalStateVariablesSize>(
+            this->isvs1.data(), d.s1.internal_state_variables, i, n);
+        gatherBatchValues<ExternalStateVariablesSize>(
+            this->esvs0.data(), d.s0.external_state_variables, i, n);
+        gatherBatchValues<ExternalStateVariablesSize>(
+            this->esvs1.data(), d.s1.external_state_variables, i, n);
+        gatherBatchValues<StiffnessMatrixSize>(this->K.data(), d.K, i, n);
+        this->rdt = d.rdt[i];
+        if (d.s0.mass_density != nullptr) {
+          this->rho0 = d.s0.mass_density[i];
+        }
+        if (d.s1.mass_density != nullptr) {
+          this->rho1 = d.s1.mass_density[i];
+        }
+        if (d.s0.stored_energy != nullptr) {
+          this->se0 = d.s0.stored_energy[i];
+        }
+        if (d.s0.dissipated_energy != nullptr) {
+          this->de0 = d.s0.dissipated_energy[i];
+        }
+      }  // end of gather
+      /*!
+       * \brief copy the outputs stored in the buffers in the batch data
+       * \param[in,out] d: batch data
+       * \param[in] i: index of the integration point
+       * \param[in] s: status returned by the integration
+       */
+      void scatter(BatchBehaviourData& d,
+                   const size_type i,
+                   const int s) const {
+        const auto n = d.n;
+        scatterBatchValues<ThermodynamicForcesSize>(
+            d.s1.thermodynamic_forces, this->th1.data(), i, n);
+        scatterBatchValues<InternalStateVariablesSize>(
+            d.s1.internal_state_variables, this->isvs1.data(), i, n);
+        scatterBatchValues<StiffnessMatrixSize>(d.K, this->K.data(), i, n);
+        d.rdt[i] = this->rdt;
+        if (d.speed_of_sound != nullptr) {
+          d.speed_of_sound[i] = this->speed_of_sound;
+        }
+        if (d.s1.stored_energy != nullptr) {
+          d.s1.stored_energy[i] = this->se1;
+        }
+        if (d.s1.dissipated_energy != nullptr) {
+          d.s1.dissipated_energy[i] = this->de1;
+        }
+        if (d.status != nullptr) {
+          d.status[i] = s;
+        }
+      }  // end of scatter
+      //! \brief gradients at the beginning of the time step
+      std::array<real, GradientsSize> g0 = {};
+      //! \brief gradients at the end of the time step
+      std::array<real, GradientsSize> g1 = {};
+      //! \brief thermodynamic forces at the beginning of the time step
+      std::array<real, ThermodynamicForcesSize> th0 = {};
+      //! \brief thermodynamic forces at the end of the time step
+      std::array<real, ThermodynamicForcesSize> th1 = {};
+      //! \brief material properties at the beginning of the time step
+      std::array<real, MaterialPropertiesSize> mps0 = {};
+      //! \brief material properties at the end of the time step
+      std::array<real, MaterialPropertiesSize> mps1 = {};
+      //! \brief internal state variables at the beginning of the time step
+      std::array<real, InternalStateVariablesSize> isvs0 = {};
+      //! \brief internal state variables at the end of the time step
+      std::array<real, InternalStateVariablesSize> isvs1 = {};
+      //! \brief external state variables at the beginning of the time step
+      std::array<real, ExternalStateVariablesSize> esvs0 = {};
+      //! \brief external state variables at the end of the time step
+      std::array<real, ExternalStateVariablesSize> esvs1 = {};
+      //! \brief stiffness matrix
+      std::array<real, StiffnessMatrixSize> K = {};
+      //! \brief ratio between the time step proposed and the time step
+      real rdt = real{};
+      //! \brief speed of sound
+      real speed_of_sound = real{};
+      //! \brief mass density at the beginning of the time step
+      real rho0 = real{};
+      //! \brief mass density at the end of the time step
+      real rho1 = real{};
+      //! \brief stored energy at the beginning of the time step
+      real se0 = real{};
+      //! \brief stored energy at the end of the time step
+      real se1 = real{};
+      //! \brief dissipated energy at the beginning of the time step
+      real de0 = real{};
+      //! \brief dissipated energy at the end of the time step
+      real de1 = real{};
+      //! \brief data of the integration point
+      BehaviourData pd = {};
+    };  // end of struct BatchPointBuffers
+
+  }  // end of namespace internals
+
+  /*!
+   * \brief integrate a behaviour over a batch of integration points.
+   *
+   * The per-point data are copied in buffers allocated on the stack whose
+   * sizes are known at compile-time, so no memory allocation is performed.
+   *
+   * \tparam GradientsSize: number of components of the gradients
+   * \tparam ThermodynamicForcesSize: number of components of the
+   * thermodynamic forces
+   * \tparam MaterialPropertiesSize: number of material properties
+   * \tparam InternalStateVariablesSize: number of internal state variables
+   * \tparam ExternalStateVariablesSize: number of external state variables
+   * \tparam StiffnessMatrixSize: size of the stiffness matrix
+   * \tparam IntegrationFunction: type of the function integrating the
+   * behaviour at one integration point
+   * \param[in,out] d: batch data
+   * \param[in] f: function integrating the behaviour at one integration point
+   * \return the minimum of the status returned at each integration point
+   */
+  template <size_type GradientsSize,
+            size_type ThermodynamicForcesSize,
+            size_type MaterialPropertiesSize,
+            size_type InternalStateVariablesSize,
+            size_type ExternalStateVariablesSize,
+            size_type StiffnessMatrixSize,
+            typename IntegrationFunction>
+  int integrateBatch(BatchBehaviourData& d, const IntegrationFunction& f) {
+    auto buffers = internals::BatchPointBuffers<
+        GradientsSize, ThermodynamicForcesSize, MaterialPropertiesSize,
+        InternalStateVariablesSize, ExternalStateVariablesSize,
+        StiffnessMatrixSize>{};
+    buffers.initialize(d);
+    auto r = 1;
+    for (size_type i = 0; i != d.n; ++i) {
+      buffers.pd.error_message = (r == 1) ? d.error_message : nullptr;
+      buffers.gather(d, i);
+      const auto ri = f(&(buffers.pd));
+      buffers.scatter(d, i, ri);
+      r = std::min(r, ri);
+    }
+    return r;
+  }  // end of integrateBatch
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEBATCH_HXX */
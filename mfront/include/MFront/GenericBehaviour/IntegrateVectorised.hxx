@@ -0,0 +1,287 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/IntegrateVectorised.hxx
+ * \brief  This file implements the integration of a behaviour over a batch
+ * of integration points treated in lock-step by a behaviour instantiated
+ * on packs of values.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEVECTORISED_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEVECTORISED_HXX
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+#include "TFEL/Math/General/SIMDPack.hxx"
+#include "TFEL/Material/OutOfBoundsPolicy.hxx"
+#include "TFEL/Material/MechanicalBehaviourTraits.hxx"
+#include "MFront/GenericBehaviour/Types.hxx"
+#include "MFront/GenericBehaviour/Integrate.hxx"
+#include "MFront/GenericBehaviour/IntegrateBatch.hxx"
+
+namespace mfront::gb {
+
+  namespace internals {
+
+    /*!
+     * \return the type of stiffness matrix requested by the caller, using
+     * the same conventions as the `integrate` function
+     * \tparam Behaviour: class implementing the behaviour
+     * \param[in] Ke: first value of the stiffness matrix
+     */
+    template <typename Behaviour>
+    typename Behaviour::SMType getStiffnessMatrixType(const real Ke) {
+      if (Ke < 0.5) {
+        return Behaviour::NOSTIFFNESSREQUESTED;
+      } else if ((0.5 < Ke) && (Ke < 1.5)) {
+        return Behaviour::ELASTIC;
+      } else if ((1.5 < Ke) && (Ke < 2.5)) {
+        return Behaviour::SECANTOPERATOR;
+      } else if ((2.5 < Ke) && (Ke < 3.5)) {
+        return Behaviour::TANGENTOPERATOR;
+      }
+      return Behaviour::CONSISTENTTANGENTOPERATOR;
+    }  // end of getStiffnessMatrixType
+
+    /*!
+     * \brief integrate the behaviour at the integration points stored in
+     * the given buffers in lock-step.
+     *
+     * The integration points are first handled by instances of the
+     * behaviour on real numbers, so that the data are initialised as in
+     * the `integrate` function. Those data are then copied in the lanes of
+     * an instance of the behaviour on packs, which is integrated. The
+     * results of the lanes which did not diverge are finally copied back
+     * in the instances on real numbers, which export them.
+     *
+     * Prediction operators and the speed of sound are not handled.
+     *
+     * \tparam Behaviour: class implementing the behaviour on real numbers
+     * \tparam VectorisedBehaviour: class implementing the behaviour on
+     * packs
+     * \tparam Buffers: buffers of the integration points
+     * \tparam W: number of lanes
+     * \param[in,out] buffers: buffers of the integration points
+     * \param[in] f: choice of consistent tangent operator
+     * \param[in] p: out of bounds policy
+     * \return the lanes successfully integrated. The `i`-th bit is set if
+     * the results of the `i`-th lane have been exported in its buffer.
+     */
+    template <typename Behaviour,
+              typename VectorisedBehaviour,
+              typename Buffers,
+              std::size_t W>
+    std::uint64_t integrateVectorisedBlock(
+        std::array<Buffers, W>& buffers,
+        const typename Behaviour::SMFlag f,
+        const tfel::material::OutOfBoundsPolicy p) {
+      using MTraits = tfel::material::MechanicalBehaviourTraits<Behaviour>;
+      using VectorisedReal = typename VectorisedBehaviour::real;
+      using VectorisedStress = typename VectorisedBehaviour::stress;
+      using VectorisedSMFlag = typename VectorisedBehaviour::SMFlag;
+      using VectorisedBehaviourData =
+          typename VectorisedBehaviour::BehaviourData;
+      using VectorisedIntegrationData =
+          typename VectorisedBehaviour::IntegrationData;
+      // all the lanes must request the same stiffness matrix
+      auto Ke = std::array<real, W>{};
+      for (std::size_t l = 0; l != W; ++l) {
+        Ke[l] = buffers[l].K[0];
+        if ((Ke[l] < -0.25) || (Ke[l] > 50)) {
+          return 0;
+        }
+      }
+      const auto smt = getStiffnessMatrixType<VectorisedBehaviour>(Ke[0]);
+      for (std::size_t l = 1; l != W; ++l) {
+        if ((getStiffnessMatrixType<VectorisedBehaviour>(Ke[l]) != smt) ||
+            ((Ke[l] > 0.5) != (Ke[0] > 0.5))) {
+          return 0;
+        }
+      }
+      if constexpr (!MTraits::hasConsistentTangentOperator) {
+        if (smt != VectorisedBehaviour::NOSTIFFNESSREQUESTED) {
+          return 0;
+        }
+      }
+      try {
+        auto behaviours = std::array<std::optional<Behaviour>, W>{};
+        auto bd = VectorisedBehaviourData{};
+        auto id = VectorisedIntegrationData{};
+        auto rdt = VectorisedReal{};
+        for (std::size_t l = 0; l != W; ++l) {
+          const auto lane = static_cast<unsigned short>(l);
+          const auto& b = behaviours[l].emplace(buffers[l].pd);
+          bd.gatherLane(b, lane);
+          id.gatherLane(b, lane);
+          rdt[lane] = buffers[l].rdt;
+        }
+        tfel::math::resetDivergentSIMDLanes();
+        VectorisedBehaviour vb(bd, id);
+        vb.setOutOfBoundsPolicy(p);
+        if (!vb.initialize()) {
+          return 0;
+        }
+        vb.checkBounds();
+        const auto tsf = vb.computeAPrioriTimeStepScalingFactor(rdt);
+        rdt = tsf.second;
+        if (!tsf.first) {
+          return 0;
+        }
+        const auto vf = static_cast<VectorisedSMFlag>(static_cast<int>(f));
+        if (vb.integrate(vf, smt) == VectorisedBehaviour::FAILURE) {
+          return 0;
+        }
+        const auto atsf = vb.computeAPosterioriTimeStepScalingFactor(rdt);
+        rdt = min(rdt, atsf.second);
+        if (!atsf.first) {
+          return 0;
+        }
+        auto se = VectorisedStress{};
+        if constexpr (MTraits::hasComputeInternalEnergy) {
+          for (std::size_t l = 0; l != W; ++l) {
+            se[static_cast<unsigned short>(l)] =
+                *(buffers[l].pd.s0.stored_energy);
+          }
+          vb.computeInternalEnergy(se);
+        }
+        auto de = VectorisedStress{};
+        if constexpr (MTraits::hasComputeDissipatedEnergy) {
+          for (std::size_t l = 0; l != W; ++l) {
+            de[static_cast<unsigned short>(l)] =
+                *(buffers[l].pd.s0.dissipated_energy);
+          }
+          vb.computeDissipatedEnergy(de);
+        }
+        const auto diverged = tfel::math::getDivergentSIMDLanes();
+        auto treated = std::uint64_t{};
+        for (std::size_t l = 0; l != W; ++l) {
+          const auto lane = static_cast<unsigned short>(l);
+          if ((diverged & (std::uint64_t{1} << l)) != 0) {
+            continue;
+          }
+          auto& b = *(behaviours[l]);
+          auto& pd = buffers[l].pd;
+          vb.scatterLane(b, lane);
+          b.exportStateData(pd.s1);
+          if constexpr (MTraits::hasConsistentTangentOperator) {
+            if (Ke[l] > 0.5) {
+              exportTangentOperator(pd.K, b.getTangentOperator());
+            }
+          }
+          if constexpr (MTraits::hasComputeInternalEnergy) {
+            *(pd.s1.stored_energy) = se[lane];
+          }
+          if constexpr (MTraits::hasComputeDissipatedEnergy) {
+            *(pd.s1.dissipated_energy) = de[lane];
+          }
+          buffers[l].rdt = rdt[lane];
+          treated |= std::uint64_t{1} << l;
+        }
+        return treated;
+      } catch (...) {
+      }
+      return 0;
+    }  // end of integrateVectorisedBlock
+
+  }  // end of namespace internals
+
+  /*!
+   * \brief integrate a behaviour over a batch of integration points,
+   * treated by blocks of `W` integration points in lock-step.
+   *
+   * The integration points of a block whose lanes diverged, i.e. took
+   * other branches than the first lane, or whose integration failed are
+   * integrated again one by one using the given function, as well as the
+   * remaining integration points when the size of the batch is not a
+   * multiple of `W`. Hence the results are the same as the ones of the
+   * `integrateBatch` function, up to rounding errors.
+   *
+   * \tparam Behaviour: class implementing the behaviour on real numbers
+   * \tparam VectorisedBehaviour: class implementing the behaviour on
+   * packs of `W` real numbers
+   * \tparam W: number of lanes
+   * \tparam GradientsSize: number of components of the gradients
+   * \tparam ThermodynamicForcesSize: number of components of the
+   * thermodynamic forces
+   * \tparam MaterialPropertiesSize: number of material properties
+   * \tparam InternalStateVariablesSize: number of internal state variables
+   * \tparam ExternalStateVariablesSize: number of external state variables
+   * \tparam StiffnessMatrixSize: size of the stiffness matrix
+   * \tparam IntegrationFunction: type of the function integrating the
+   * behaviour at one integration point
+   * \param[in,out] d: batch data
+   * \param[in] f: function integrating the behaviour at one integration point
+   * \param[in] smf: choice of consistent tangent operator
+   * \param[in] p: out of bounds policy
+   * \return the minimum of the status returned at each integration point
+   */
+  template <typename Behaviour,
+            typename VectorisedBehaviour,
+            unsigned short W,
+            size_type GradientsSize,
+            size_type ThermodynamicForcesSize,
+            size_type MaterialPropertiesSize,
+            size_type InternalStateVariablesSize,
+            size_type ExternalStateVariablesSize,
+            size_type StiffnessMatrixSize,
+            typename IntegrationFunction>
+  int integrateVectorisedBatch(BatchBehaviourData& d,
+                               const IntegrationFunction& f,
+                               const typename Behaviour::SMFlag smf,
+                               const tfel::material::OutOfBoundsPolicy p) {
+    using Buffers = internals::BatchPointBuffers<
+        GradientsSize, ThermodynamicForcesSize, MaterialPropertiesSize,
+        InternalStateVariablesSize, ExternalStateVariablesSize,
+        StiffnessMatrixSize>;
+    static_assert(
+        std::is_same_v<typename VectorisedBehaviour::real,
+                       tfel::math::SIMDPack<typename Behaviour::real, W>>,
+        "invalid vectorised behaviour");
+    std::array<Buffers, W> buffers;
+    for (auto& b : buffers) {
+      b.initialize(d);
+    }
+    auto r = 1;
+    // scalar integration of the i-th integration point
+    auto integrate_point = [&d, &f, &r](Buffers& b, const size_type i) {
+      b.pd.error_message = (r == 1) ? d.error_message : nullptr;
+      b.gather(d, i);
+      const auto ri = f(&(b.pd));
+      b.scatter(d, i, ri);
+      r = std::min(r, ri);
+    };
+    auto i = size_type{};
+    for (; i + W <= d.n; i += W) {
+      for (size_type l = 0; l != W; ++l) {
+        buffers[l].gather(d, i + l);
+      }
+      const auto treated =
+          internals::integrateVectorisedBlock<Behaviour, VectorisedBehaviour>(
+              buffers, smf, p);
+      for (size_type l = 0; l != W; ++l) {
+        if ((treated & (std::uint64_t{1} << l)) != 0) {
+          const auto rl = buffers[l].rdt < real{0.99} ? 0 : 1;
+          buffers[l].scatter(d, i + l, rl);
+          r = std::min(r, rl);
+        } else {
+          integrate_point(buffers[l], i + l);
+        }
+      }
+    }
+    for (; i != d.n; ++i) {
+      integrate_point(buffers[0], i);
+    }
+    return r;
+  }  // end of integrateVectorisedBatch
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEVECTORISED_HXX */
@@ -0,0 +1,70 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/Parameters.hxx
+ * \brief  This file declares the facilities used to pass a block of
+ * parameters to a behaviour generated by the `generic` interface, in
+ * place of the values stored in the `ParametersInitializer` singleton.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_PARAMETERS_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_PARAMETERS_HXX
+
+#include "MFront/GenericBehaviour/Types.hxx"
+
+namespace mfront::gb {
+
+  /*!
+   * \return a reference to the block of parameters used by the behaviours
+   * constructed by the current thread, or a reference to the null pointer
+   * if the values stored in the `ParametersInitializer` singleton shall be
+   * used.
+   *
+   * The values of the block are ordered as the names exported by the
+   * `<function>_Parameters` symbol (arrays being expanded). Integer
+   * parameters are stored as reals.
+   */
+  inline const real*& getThreadLocalParameters() noexcept {
+    thread_local const real* parameters = nullptr;
+    return parameters;
+  }  // end of getThreadLocalParameters
+
+  /*!
+   * \brief an helper class which sets the block of parameters used by the
+   * current thread during its lifetime and restores the previous one on
+   * destruction.
+   */
+  struct ThreadLocalParametersScope {
+    /*!
+     * \brief constructor
+     * \param[in] p: block of parameters
+     */
+    explicit ThreadLocalParametersScope(const real* const p) noexcept
+        : previous(getThreadLocalParameters()) {
+      getThreadLocalParameters() = p;
+    }  // end of ThreadLocalParametersScope
+    ThreadLocalParametersScope(ThreadLocalParametersScope&&) = delete;
+    ThreadLocalParametersScope(const ThreadLocalParametersScope&) = delete;
+    ThreadLocalParametersScope& operator=(ThreadLocalParametersScope&&) =
+        delete;
+    ThreadLocalParametersScope& operator=(const ThreadLocalParametersScope&) =
+        delete;
+    //! \brief destructor
+    ~ThreadLocalParametersScope() noexcept {
+      getThreadLocalParameters() = this->previous;
+    }  // end of ~ThreadLocalParametersScope
+
+   private:
+    //! \brief block of parameters previously used
+    const real* const previous;
+  };  // end of struct ThreadLocalParametersScope
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_PARAMETERS_HXX */
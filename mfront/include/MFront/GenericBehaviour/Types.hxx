@@ -20,6 +20,8 @@ namespace mfront::gb {
 
   //! \brief a simple alias
   using real = ::mfront_gb_real;
+  //! \brief a simple alias
+  using size_type = ::mfront_gb_size_type;
 
 }  // namespace mfront::gb
 
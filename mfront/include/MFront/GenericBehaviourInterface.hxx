@@ -58,6 +58,10 @@ namespace mfront {
     void writeBehaviourConstructorBody(std::ostream&,
                                        const BehaviourDescription&,
                                        const Hypothesis) const override;
+    void writeBehaviourConstructorParametersOverrides(
+        std::ostream&,
+        const BehaviourDescription&,
+        const Hypothesis) const override;
     void writeBehaviourDataConstructor(
         std::ostream&,
         const Hypothesis,
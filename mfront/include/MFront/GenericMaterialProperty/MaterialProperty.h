@@ -36,6 +36,19 @@ typedef mfront_gmp_real(
     const mfront_gmp_size_type,           // number of arguments
     const mfront_gmp_OutOfBoundsPolicy);  // out of bounds policy
 
+/*!
+ * \brief a simple alias to the function evaluating a material property
+ * on arrays of values of the arguments. The function generated for a
+ * material property named `f` is named `f_array`.
+ */
+typedef void(
+    GENERIC_MATERIALPROPERTY_ADDCALL_PTR mfront_gmp_MaterialPropertyArrayPtr)(
+    mfront_gmp_OutputStatus* const,         // output status
+    const mfront_gmp_real* const* const,    // arrays of values of arguments
+    mfront_gmp_real* const,                 // values of the material property
+    const mfront_gmp_size_type,             // size of the arrays
+    const mfront_gmp_OutOfBoundsPolicy);    // out of bounds policy
+
 #ifdef __cplusplus
 }  // end of extern "C"
 #endif /* __cplusplus */
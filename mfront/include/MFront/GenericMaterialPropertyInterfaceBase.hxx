@@ -14,6 +14,7 @@
 #ifndef LIB_MFRONT_GENERICMATERIALPROPERTYINTERFACEBASE_HXX
 #define LIB_MFRONT_GENERICMATERIALPROPERTYINTERFACEBASE_HXX
 
+#include <iosfwd>
 #include <string>
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "MFront/MFrontConfig.hxx"
@@ -98,6 +99,18 @@ namespace mfront {
      */
     virtual void writeSrcFile(const MaterialPropertyDescription&,
                               const FileDescription&) const;
+    /*!
+     * \brief write the function evaluating the material property on
+     * arrays of values of the inputs. The bounds of the inputs are
+     * checked once for the whole arrays, so that the loop evaluating
+     * the material property can be vectorized by the compiler.
+     * \param[out] os: output stream
+     * \param[in] mpd: material property description
+     * \param[in] fd:  mfront file description
+     */
+    virtual void writeArrayFunction(std::ostream&,
+                                    const MaterialPropertyDescription&,
+                                    const FileDescription&) const;
   };  // end of MfrontGenericMaterialPropertyInterfaceBase
 
 }  // end of namespace mfront
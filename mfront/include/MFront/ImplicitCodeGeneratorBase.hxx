@@ -69,6 +69,8 @@ namespace mfront {
     virtual void writeDerivativeView(std::ostream&,
                                      const DerivativeViewDescription&) const;
 
+    bool requiresNumericTypeConversions() const override;
+
     void writeBehaviourFriends(std::ostream&, const Hypothesis) const override;
 
     void writeBehaviourLocalVariablesInitialisation(
@@ -100,8 +102,32 @@ namespace mfront {
     void writeBehaviourParserSpecificInitializeMethodPart(
         std::ostream&, const Hypothesis) const override;
 
+    /*!
+     * \brief write the constructor building the behaviour from the
+     * behaviour associated with another numeric type. This constructor
+     * is used to compute the jacobian by automatic differentiation.
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void writeNumericTypeConversionConstructor(std::ostream&,
+                                                       const Hypothesis) const;
+
     virtual void writeComputeNumericalJacobian(std::ostream&,
                                                const Hypothesis) const;
+    /*!
+     * \brief write the computation of the numerical jacobian by central
+     * differences when some jacobian blocks are known to be null.
+     *
+     * The integration variables whose columns of the jacobian have
+     * disjoint sparsity patterns are gathered in colours. The columns
+     * associated with a colour are computed simultaneously, with only one
+     * pair of evaluations of the residual.
+     *
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void writeColouredNumericalJacobian(std::ostream&,
+                                                const Hypothesis) const;
 
     void writeBehaviourComputeTangentOperatorBody(
         std::ostream&, const Hypothesis, const std::string&) const override;
@@ -124,6 +124,8 @@ namespace mfront {
     virtual void treatCompareToNumericalJacobian();
     //! \brief treat the `@JacobianComparisonCriterion` keyword
     virtual void treatJacobianComparisonCriterion();
+    //! \brief treat the `@JacobianComputation` keyword
+    virtual void treatJacobianComputation();
     //! \brief treat the `@InitJacobian` keyword
     virtual void treatInitJacobian();
     //! \brief treat the `@InitJacobianInvert` keyword
@@ -132,6 +134,15 @@ namespace mfront {
     virtual void treatMaximumIncrementValuePerIteration();
     //! \brief treat the `@NumericallyComputedJacobianBlocks` keyword
     virtual void treatNumericallyComputedJacobianBlocks();
+    //! \brief treat the `@NullJacobianBlocks` keyword
+    virtual void treatNullJacobianBlocks();
+    /*!
+     * \brief read a list of jacobian blocks and append it to the given
+     * attribute for all the modelling hypotheses specified.
+     * \param[in] m: calling method
+     * \param[in] a: attribute name
+     */
+    virtual void readJacobianBlocks(const std::string&, const char* const);
     /*!
      * \brief set the non linear solver
      * \param[in] s: non linear solver
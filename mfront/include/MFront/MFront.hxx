@@ -106,6 +106,19 @@ namespace mfront {
 
     virtual void registerArgumentCallBacks();
 
+    /*!
+     * \brief analyse a file and generate the output files, without
+     * using the compilation cache
+     * \param[in] f : file name
+     * \return the target's description
+     */
+    virtual TargetsDescription generateOutputFiles(const std::string &) const;
+    /*!
+     * \return a description of the command line options used to build
+     * the keys of the compilation cache
+     */
+    virtual std::string getCompilationCacheOptionsDescription() const;
+
     virtual void analyseTargetsFile();
 
     virtual void writeTargetsDescription() const;
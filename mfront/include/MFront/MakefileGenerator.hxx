@@ -48,6 +48,44 @@ namespace mfront {
       const std::string&,
       const std::string& = "src",
       const std::string& = "Makefile.mfront");
+  /*!
+   * \brief a function calling the `make` utility in the given
+   * directory using the specified file and the given number of jobs.
+   * \param[in] t : target name
+   * \param[in] d : directory
+   * \param[in] f : file name
+   * \param[in] n : number of jobs. If null, the number of jobs is the
+   * number of available cores.
+   *
+   * \note if `mfront` is called by a `make` process providing a job
+   * server, the job server is used and the number of jobs is ignored.
+   */
+  MFRONT_VISIBILITY_EXPORT void callMake(const std::string&,
+                                         const std::string&,
+                                         const std::string&,
+                                         const unsigned short);
+  /*!
+   * \brief compile the object files required by the given target,
+   * each object file being compiled by a dedicated call to the `make`
+   * utility. At most `o.jobs` compilations run in parallel and the
+   * compilation time of each translation unit is reported if the
+   * verbose level is greater than `VERBOSE_LEVEL2`.
+   * \param[in] t : target description
+   * \param[in] n : target name
+   * \param[in] o : options
+   * \param[in] d : directory
+   * \param[in] f : file name
+   *
+   * \note nothing is done if `mfront` is called by a `make` process
+   * providing a job server: the object files are then compiled by the
+   * `callMake` function using this job server.
+   */
+  MFRONT_VISIBILITY_EXPORT void compileObjectFiles(
+      const TargetsDescription&,
+      const std::string&,
+      const GeneratorOptions&,
+      const std::string& = "src",
+      const std::string& = "Makefile.mfront");
 
 }  // end of namespace mfront
 
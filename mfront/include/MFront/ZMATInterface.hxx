@@ -79,6 +79,10 @@ namespace mfront {
         const BehaviourDescription &) const override;
     void writeIntegrationDataMainVariablesSetters(
         std::ostream &, const BehaviourDescription &) const override;
+    void writeBehaviourConstructorParametersOverrides(
+        std::ostream &,
+        const BehaviourDescription &,
+        const Hypothesis) const override;
     void writeBehaviourInitializeFunctions(std::ostream &,
                                            const BehaviourDescription &,
                                            const Hypothesis) const override;
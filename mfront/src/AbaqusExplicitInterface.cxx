@@ -1022,21 +1022,13 @@ namespace mfront {
           << "integrate(i);\n"
           << "}\n";
     } else if (ppolicy == "ThreadPool") {
-      out << "auto integrate2 = [&integrate,nblock](const int b, const int "
-             "e){\n"
-          << "for(int i=b;i!=e;++i){\n"
-          << "integrate(i);\n"
-          << "}\n"
-          << "};\n"
-          << "const auto nthreads = pool.getNumberOfThreads();\n"
-          << "const auto ntasks   = nthreads/(*nblock);\n"
-          << "for(tfel::system::ThreadPool::size_type i=0;i!=nthreads;++i){\n"
-          << "pool.addTask(integrate2,i*ntasks,(i+1)*ntasks);\n"
-          << "}\n"
-          << "if(*nblock-ntasks*nthreads!=0){\n"
-          << "pool.addTask(integrate2,nthreads*ntasks,*nblock);\n"
-          << "}\n"
-          << "pool.wait();\n";
+      out << "const auto nthreads = pool.getNumberOfThreads();\n"
+          << "const auto npoints = "
+          << "static_cast<tfel::system::ThreadPool::size_type>(*nblock);\n"
+          << "pool.parallel_for(0, npoints, npoints / (4 * nthreads),\n"
+          << "[&integrate](const tfel::system::ThreadPool::size_type i){\n"
+          << "integrate(static_cast<int>(i));\n"
+          << "});\n";
     } else {
       tfel::raise(
           "AbaqusExplicitInterface::writeIntegrateLoop: "
@@ -985,6 +985,14 @@ namespace mfront {
     return false;
   }  // end of usesStateVariableTimeDerivative
 
+  bool BehaviourCodeGeneratorBase::requiresNumericTypeConversions() const {
+    return false;
+  }  // end of requiresNumericTypeConversions
+
+  bool BehaviourCodeGeneratorBase::requiresLaneAccessors() const {
+    return this->bd.hasAttribute(BehaviourDescription::vectorisationWidth);
+  }  // end of requiresLaneAccessors
+
   std::string
   BehaviourCodeGeneratorBase::getIntegrationVariablesIncrementsInitializers(
       const Hypothesis h) const {
@@ -1143,6 +1151,9 @@ namespace mfront {
        << "#include\"TFEL/Math/Array/runtime_arrayIO.hxx\"\n"
        << "#include\"TFEL/Math/fsarray.hxx\"\n"
        << "#include\"TFEL/Math/runtime_array.hxx\"\n";
+    if (this->requiresLaneAccessors()) {
+      os << "#include\"TFEL/Math/General/SIMDPack.hxx\"\n";
+    }
     if (this->bd.useQt()) {
       os << "#include\"TFEL/Math/qt.hxx\"\n";
       os << "#include\"TFEL/Math/Quantity/qtIO.hxx\"\n";
@@ -1256,73 +1267,103 @@ namespace mfront {
       std::ostream& os, const Hypothesis h) const {
     const auto& md = this->bd.getBehaviourData(h);
     this->checkBehaviourDataFile(os);
-    os << "/*!\n"
-       << "* \\brief Default constructor\n"
-       << "*/\n"
-       << this->bd.getClassName() << "BehaviourData()\n"
-       << "{}\n\n"
-       << "/*!\n"
-       << "* \\brief copy constructor\n"
-       << "*/\n"
-       << this->bd.getClassName() << "BehaviourData(const "
-       << this->bd.getClassName() << "BehaviourData& src)\n"
-       << ": ";
-    auto first = true;
+    // data members
+    auto members = std::vector<std::string>{};
     if (this->bd.getAttribute(BehaviourDescription::requiresStiffnessTensor,
                               false)) {
-      os << "D(src.D)";
-      first = false;
+      members.push_back("D");
     }
     if (this->bd.getAttribute(
             BehaviourDescription::requiresThermalExpansionCoefficientTensor,
             false)) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << "A(src.A)";
-      first = false;
+      members.push_back("A");
     }
     for (const auto& mv : this->bd.getMainVariables()) {
-      if (!first) {
-        os << ",\n";
-      }
       if (Gradient::isIncrementKnown(mv.first)) {
-        os << mv.first.name << "(src." << mv.first.name << "),\n";
+        members.push_back(mv.first.name);
       } else {
-        os << mv.first.name << "0(src." << mv.first.name << "0),\n";
+        members.push_back(mv.first.name + "0");
       }
-      os << mv.second.name << "(src." << mv.second.name << ")";
-      first = false;
+      members.push_back(mv.second.name);
     }
     for (const auto& v : md.getMaterialProperties()) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
+      members.push_back(v.name);
     }
     for (const auto& v : md.getStateVariables()) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
+      members.push_back(v.name);
     }
     for (const auto& v : md.getAuxiliaryStateVariables()) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
+      members.push_back(v.name);
     }
     for (const auto& v : md.getExternalStateVariables()) {
-      if (!first) {
-        os << ",\n";
+      members.push_back(v.name);
+    }
+    // members initializers, from an object named `src`
+    auto init = std::string{};
+    for (const auto& m : members) {
+      init += (init.empty() ? ": " : ",\n") + m + "(src." + m + ")";
+    }
+    os << "/*!\n"
+       << "* \\brief Default constructor\n"
+       << "*/\n"
+       << this->bd.getClassName() << "BehaviourData()\n"
+       << "{}\n\n"
+       << "/*!\n"
+       << "* \\brief copy constructor\n"
+       << "*/\n"
+       << this->bd.getClassName() << "BehaviourData(const "
+       << this->bd.getClassName() << "BehaviourData& src)\n"
+       << init << "\n{}\n\n";
+    if (this->requiresNumericTypeConversions()) {
+      os << "template<ModellingHypothesis::Hypothesis,typename,bool>\n"
+         << "friend class " << this->bd.getClassName() << "BehaviourData;\n\n"
+         << "/*!\n"
+         << "* \\brief constructor from the behaviour data associated with "
+         << "another numeric type\n"
+         << "*/\n"
+         << "template<typename OtherNumericType>\n"
+         << "explicit " << this->bd.getClassName() << "BehaviourData(const "
+         << this->bd.getClassName()
+         << "BehaviourData<hypothesis, OtherNumericType, false>& src)\n"
+         << init << "\n{}\n\n";
+    }
+    if (this->requiresLaneAccessors()) {
+      if (!this->requiresNumericTypeConversions()) {
+        os << "template<ModellingHypothesis::Hypothesis,typename,bool>\n"
+           << "friend class " << this->bd.getClassName()
+           << "BehaviourData;\n\n";
       }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
+      os << "/*!\n"
+         << "* \\brief copy the behaviour data of one integration point in "
+         << "the given lane\n"
+         << "* \\param[in] src: behaviour data of the integration point\n"
+         << "* \\param[in] lane: lane\n"
+         << "*/\n"
+         << "template<typename OtherNumericType>\n"
+         << "void gatherLane(const " << this->bd.getClassName()
+         << "BehaviourData<hypothesis, OtherNumericType, false>& src,\n"
+         << "const unsigned short lane){\n";
+      for (const auto& m : members) {
+        os << "tfel::math::gatherLane(this->" << m << ", src." << m
+           << ", lane);\n";
+      }
+      os << "} // end of gatherLane\n\n"
+         << "/*!\n"
+         << "* \\brief copy the given lane in the behaviour data of one "
+         << "integration point\n"
+         << "* \\param[out] dest: behaviour data of the integration point\n"
+         << "* \\param[in] lane: lane\n"
+         << "*/\n"
+         << "template<typename OtherNumericType>\n"
+         << "void scatterLane(" << this->bd.getClassName()
+         << "BehaviourData<hypothesis, OtherNumericType, false>& dest,\n"
+         << "const unsigned short lane) const{\n";
+      for (const auto& m : members) {
+        os << "tfel::math::scatterLane(dest." << m << ", this->" << m
+           << ", lane);\n";
+      }
+      os << "} // end of scatterLane\n\n";
     }
-    os << "\n{}\n\n";
     // Creating constructor for external interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
@@ -2275,12 +2316,18 @@ namespace mfront {
   void BehaviourCodeGeneratorBase::writeBehaviourConstructors(
       std::ostream& os, const Hypothesis h) const {
     auto tmpnames = std::vector<std::string>{};
-    auto write_body = [this, &os, &tmpnames, h] {
+    // the interface, if any, is given the opportunity to override the
+    // values of the parameters
+    auto write_body = [this, &os, &tmpnames,
+                       h](const AbstractBehaviourInterface* const i) {
       os << "using namespace std;\n"
          << "using namespace tfel::math;\n"
          << "using std::vector;\n";
       writeMaterialLaws(os, this->bd.getMaterialLaws());
       this->writeBehaviourParameterInitialisation(os, h);
+      if (i != nullptr) {
+        i->writeBehaviourConstructorParametersOverrides(os, this->bd, h);
+      }
       // calling models
       for (const auto& m : this->bd.getModelsDescriptions()) {
         auto inputs = std::vector<std::string>{};
@@ -2329,18 +2376,41 @@ namespace mfront {
       os << ",\n" << init;
     }
     os << "\n{\n";
-    write_body();
+    write_body(nullptr);
     os << "}\n\n";
     // constructor specific to interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
         i.second->writeBehaviourConstructorHeader(os, this->bd, h, init);
         os << "\n{\n";
-        write_body();
+        write_body(i.second.get());
         i.second->writeBehaviourConstructorBody(os, this->bd, h);
         os << "}\n\n";
       }
     }
+    if (this->requiresLaneAccessors()) {
+      const auto& cn = this->bd.getClassName();
+      if (!this->requiresNumericTypeConversions()) {
+        os << "template<ModellingHypothesis::Hypothesis,typename,bool>\n"
+           << "friend struct " << cn << ";\n\n";
+      }
+      os << "/*!\n"
+         << "* \\brief copy the state of the given lane, i.e. the behaviour "
+         << "data and the tangent operator, in the behaviour of one "
+         << "integration point\n"
+         << "* \\param[out] dest: behaviour of the integration point\n"
+         << "* \\param[in] lane: lane\n"
+         << "*/\n"
+         << "template<typename OtherNumericType>\n"
+         << "void scatterLane(" << cn
+         << "<hypothesis, OtherNumericType, false>& dest,\n"
+         << "const unsigned short lane) const{\n"
+         << "BehaviourData::scatterLane(dest, lane);\n";
+      if (this->bd.hasTangentOperator()) {
+        os << "tfel::math::scatterLane(dest.Dt, this->Dt, lane);\n";
+      }
+      os << "} // end of scatterLane\n\n";
+    }
   }
 
   void BehaviourCodeGeneratorBase::writeHillTensorComputation(
@@ -4794,6 +4864,9 @@ namespace mfront {
        << "#include\"TFEL/TypeTraits/IsReal.hxx\"\n"
        << "#include\"TFEL/TypeTraits/Promote.hxx\"\n"
        << "#include\"TFEL/Math/General/IEEE754.hxx\"\n";
+    if (this->requiresLaneAccessors()) {
+      os << "#include\"TFEL/Math/General/SIMDPack.hxx\"\n";
+    }
     this->bd.requiresTVectorOrVectorIncludes(b1, b2);
     if (b1) {
       os << "#include\"TFEL/Math/tvector.hxx\"\n"
@@ -4878,6 +4951,25 @@ namespace mfront {
       std::ostream& os, const Hypothesis h) const {
     const auto& md = this->bd.getBehaviourData(h);
     this->checkIntegrationDataFile(os);
+    // members initializers, from an object named `src`
+    // data members
+    auto members = std::vector<std::string>{};
+    for (const auto& v : this->bd.getMainVariables()) {
+      if (Gradient::isIncrementKnown(v.first)) {
+        members.push_back("d" + v.first.name);
+      } else {
+        members.push_back(v.first.name + "1");
+      }
+    }
+    members.push_back("dt");
+    for (const auto& v : md.getExternalStateVariables()) {
+      members.push_back("d" + v.name);
+    }
+    // members initializers, from an object named `src`
+    auto init = std::string{};
+    for (const auto& m : members) {
+      init += (init.empty() ? ": " : ",\n") + m + "(src." + m + ")";
+    }
     os << "/*!\n"
        << "* \\brief Default constructor\n"
        << "*/\n"
@@ -4888,19 +4980,43 @@ namespace mfront {
        << "*/\n"
        << this->bd.getClassName() << "IntegrationData(const "
        << this->bd.getClassName() << "IntegrationData& src)\n"
-       << ": ";
-    for (const auto& v : this->bd.getMainVariables()) {
-      if (Gradient::isIncrementKnown(v.first)) {
-        os << "d" << v.first.name << "(src.d" << v.first.name << "),\n";
-      } else {
-        os << v.first.name << "1(src." << v.first.name << "1),\n";
-      }
+       << init << "\n{}\n\n";
+    if (this->requiresNumericTypeConversions()) {
+      os << "template<ModellingHypothesis::Hypothesis,typename,bool>\n"
+         << "friend class " << this->bd.getClassName()
+         << "IntegrationData;\n\n"
+         << "/*!\n"
+         << "* \\brief constructor from the integration data associated "
+         << "with another numeric type\n"
+         << "*/\n"
+         << "template<typename OtherNumericType>\n"
+         << "explicit " << this->bd.getClassName() << "IntegrationData(const "
+         << this->bd.getClassName()
+         << "IntegrationData<hypothesis, OtherNumericType, false>& src)\n"
+         << init << "\n{}\n\n";
     }
-    os << "dt(src.dt)";
-    for (const auto& v : md.getExternalStateVariables()) {
-      os << ",\nd" << v.name << "(src.d" << v.name << ")";
+    if (this->requiresLaneAccessors()) {
+      if (!this->requiresNumericTypeConversions()) {
+        os << "template<ModellingHypothesis::Hypothesis,typename,bool>\n"
+           << "friend class " << this->bd.getClassName()
+           << "IntegrationData;\n\n";
+      }
+      os << "/*!\n"
+         << "* \\brief copy the integration data of one integration point "
+         << "in the given lane\n"
+         << "* \\param[in] src: integration data of the integration point\n"
+         << "* \\param[in] lane: lane\n"
+         << "*/\n"
+         << "template<typename OtherNumericType>\n"
+         << "void gatherLane(const " << this->bd.getClassName()
+         << "IntegrationData<hypothesis, OtherNumericType, false>& src,\n"
+         << "const unsigned short lane){\n";
+      for (const auto& m : members) {
+        os << "tfel::math::gatherLane(this->" << m << ", src." << m
+           << ", lane);\n";
+      }
+      os << "} // end of gatherLane\n\n";
     }
-    os << "\n{}\n\n";
     // Creating constructor for external interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
@@ -93,6 +93,9 @@ namespace mfront {
       "compareToNumericalJacobian";
   const char* const BehaviourData::numericallyComputedJacobianBlocks =
       "numericallyComputedJacobianBlocks";
+  const char* const BehaviourData::nullJacobianBlocks = "nullJacobianBlocks";
+  const char* const BehaviourData::jacobianComputation =
+      "jacobianComputation";
   const char* const BehaviourData::allowsNewUserDefinedVariables =
       "allowsNewUserDefinedVariables";
   const char* const BehaviourData::algorithm = "algorithm";
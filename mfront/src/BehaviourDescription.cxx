@@ -405,6 +405,9 @@ namespace mfront {
       BehaviourDescription::requiresThermalExpansionCoefficientTensor =
           "requiresThermalExpansionCoefficientTensor";
 
+  const char* const BehaviourDescription::vectorisationWidth =
+      "vectorisationWidth";
+
   BehaviourDescription::BehaviourDescription() {
     constexpr auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     const auto* const Topt = BehaviourDescription::
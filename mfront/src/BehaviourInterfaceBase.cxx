@@ -71,6 +71,10 @@ namespace mfront {
     return mhs.find(h) != mhs.end();
   }  // end of isBehaviourConstructorRequired
 
+  void BehaviourInterfaceBase::writeBehaviourConstructorParametersOverrides(
+      std::ostream&, const BehaviourDescription&, const Hypothesis) const {
+  }  // end of writeBehaviourConstructorParametersOverrides
+
   void BehaviourInterfaceBase::writeBehaviourInitializeFunctions(
       std::ostream&, const BehaviourDescription&, const Hypothesis) const {
   }  // end of writeBehaviourInitializeFunctions
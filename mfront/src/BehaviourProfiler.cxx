@@ -12,28 +12,166 @@
  */
 
 #include <ctime>
+#include <array>
+#include <limits>
 #include <string>
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
+#include <map>
+#if defined _WIN32 || defined _WIN64
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 #include "TFEL/Raise.hxx"
 #include "MFront/BehaviourProfiler.hxx"
 
 namespace mfront {
 
-#if !(defined _WIN32 || defined _WIN64)
+  //! \brief number of bins of the histograms
+  static constexpr std::size_t histogramSize = 40;
+  //! \brief maximum number of events recorded per thread
+  static constexpr std::size_t maximumNumberOfEvents = 1 << 20;
+
+  //! \brief measures associated with a code block
+  struct CodeBlockMeasures {
+    //! \brief number of calls
+    std::intmax_t calls = 0;
+    //! \brief total time (nanoseconds)
+    std::intmax_t total = 0;
+    //! \brief minimal time (nanoseconds)
+    std::intmax_t min = std::numeric_limits<std::intmax_t>::max();
+    //! \brief maximal time (nanoseconds)
+    std::intmax_t max = 0;
+    /*!
+     * \brief histogram of the times. The bin `i` counts the times
+     * between \(2^{i}\) and \(2^{i+1}\) nanoseconds. The last bin counts
+     * all the greater times.
+     */
+    std::array<std::intmax_t, histogramSize> histogram = {};
+  };  // end of CodeBlockMeasures
+
+  //! \brief a measure recorded for the Chrome trace output
+  struct ProfilingEvent {
+    //! \brief start of the measure on the monotonic clock (nanoseconds)
+    std::intmax_t start;
+    //! \brief duration of the measure (nanoseconds)
+    std::intmax_t duration;
+    //! \brief code block
+    BehaviourProfiler::index_type block;
+  };  // end of ProfilingEvent
+
+  struct alignas(64) BehaviourProfiler::ThreadMeasures {
+    //! \brief measures of each code block
+    std::array<CodeBlockMeasures, BehaviourProfiler::NUMBEROFCODEBLOCKS>
+        blocks;
+    //! \brief number of integrations using the non linear solver
+    std::intmax_t integrations = 0;
+    //! \brief number of integrations for which the solver failed
+    std::intmax_t failures = 0;
+    //! \brief total number of iterations of the non linear solver
+    std::intmax_t iterations = 0;
+    //! \brief minimal number of iterations
+    std::intmax_t min_iterations = std::numeric_limits<std::intmax_t>::max();
+    //! \brief maximal number of iterations
+    std::intmax_t max_iterations = 0;
+    /*!
+     * \brief histogram of the number of iterations. The last bin counts
+     * all the integrations requiring at least `histogramSize - 1`
+     * iterations.
+     */
+    std::array<std::intmax_t, histogramSize> iterations_histogram = {};
+    //! \brief recorded events (only used for the trace output)
+    std::vector<ProfilingEvent> events;
+    //! \brief number of events which could not be recorded
+    std::intmax_t dropped_events = 0;
+    //! \brief index of the thread
+    std::size_t index = 0;
+  };  // end of BehaviourProfiler::ThreadMeasures
+
+  //! \return a new identifier for a profiler
+  static std::uintmax_t getNewProfilerIdentifier() {
+    static std::atomic<std::uintmax_t> i(0);
+    return i++;
+  }  // end of getNewProfilerIdentifier
+
+  /*!
+   * \return the value of the given environment variable, or an empty
+   * string, where the `@behaviour@` and `@pid@` patterns are replaced
+   * \param[in] v: environment variable
+   * \param[in] n: behaviour name
+   */
+  static std::string getOutputFileName(const char* const v,
+                                       const std::string& n) {
+    const auto* const e = std::getenv(v);
+    if (e == nullptr) {
+      return "";
+    }
+    auto f = std::string(e);
+#if defined _WIN32 || defined _WIN64
+    const auto pid = std::to_string(::_getpid());
+#else
+    const auto pid = std::to_string(::getpid());
+#endif
+    for (const auto& [p, r] : {std::make_pair(std::string("@behaviour@"), n),
+                               std::make_pair(std::string("@pid@"), pid)}) {
+      auto pos = f.find(p);
+      while (pos != std::string::npos) {
+        f.replace(pos, p.size(), r);
+        pos = f.find(p, pos + r.size());
+      }
+    }
+    return f;
+  }  // end of getOutputFileName
+
+  //! \return the bin of an histogram associated with the given time
+  static std::size_t getHistogramBin(std::intmax_t t) {
+    auto b = std::size_t{};
+    while (((t >>= 1) != 0) && (b + 1 != histogramSize)) {
+      ++b;
+    }
+    return b;
+  }  // end of getHistogramBin
+
   /*!
    * add a new measure
-   * t     : measure to which the new measure is added
-   * start : start of the measure
-   * end   : end of the measure
+   * \param[in,out] m: measures of the code block
+   * \param[in] t: time
    */
-  static inline void add_measure(std::atomic<intmax_t>& t,
-                                 const timespec& start,
-                                 const timespec& end) {
+  static inline void add_measure(CodeBlockMeasures& m, const std::intmax_t t) {
+    ++(m.calls);
+    m.total += t;
+    m.min = std::min(m.min, t);
+    m.max = std::max(m.max, t);
+    ++(m.histogram[getHistogramBin(t)]);
+  }  // end of add_measure
+
+  //! \brief merge the measures of a code block
+  static void merge(CodeBlockMeasures& m, const CodeBlockMeasures& m2) {
+    m.calls += m2.calls;
+    m.total += m2.total;
+    m.min = std::min(m.min, m2.min);
+    m.max = std::max(m.max, m2.max);
+    for (std::size_t i = 0; i != histogramSize; ++i) {
+      m.histogram[i] += m2.histogram[i];
+    }
+  }  // end of merge
+
+#if !(defined _WIN32 || defined _WIN64)
+  /*!
+   * \return the time elapsed between two instants, in nanoseconds
+   * \param[in] start : start of the measure
+   * \param[in] end   : end of the measure
+   */
+  static inline std::intmax_t get_duration(const timespec& start,
+                                           const timespec& end) {
     /* http://www.guyrutenberg.com/2007/09/22/profiling-code-using-clock_gettime
      */
     timespec temp;
@@ -44,8 +182,9 @@ namespace mfront {
       temp.tv_sec = end.tv_sec - start.tv_sec;
       temp.tv_nsec = end.tv_nsec - start.tv_nsec;
     }
-    t += 1000000000 * temp.tv_sec + temp.tv_nsec;
-  }  // end of add_measure
+    return 1000000000 * static_cast<std::intmax_t>(temp.tv_sec) +
+           static_cast<std::intmax_t>(temp.tv_nsec);
+  }  // end of get_duration
 #endif
 
   /*!
@@ -173,8 +312,11 @@ namespace mfront {
   }
 
   BehaviourProfiler::Timer::Timer(BehaviourProfiler& t, const unsigned short cn)
-      : gtimer(t), c(cn) {
+      : gtimer(t), measures(t.getThreadMeasures()), c(cn) {
 #if !(defined _WIN32 || defined _WIN64)
+    if (!this->gtimer.trace.empty()) {
+      ::clock_gettime(CLOCK_MONOTONIC, &(this->wstart));
+    }
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->start));
 #endif
   }  // end of BehaviourProfiler::Timer
@@ -182,34 +324,286 @@ namespace mfront {
   BehaviourProfiler::Timer::~Timer() {
 #if !(defined _WIN32 || defined _WIN64)
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->end));
-    add_measure(this->gtimer.measures[this->c], this->start, this->end);
+    add_measure(this->measures.blocks[this->c],
+                get_duration(this->start, this->end));
+    if (!this->gtimer.trace.empty()) {
+      auto& events = this->measures.events;
+      if (events.size() == maximumNumberOfEvents) {
+        ++(this->measures.dropped_events);
+        return;
+      }
+      timespec wend;
+      ::clock_gettime(CLOCK_MONOTONIC, &wend);
+      const auto origin = timespec{0, 0};
+      events.push_back({get_duration(origin, this->wstart),
+                        get_duration(this->wstart, wend), this->c});
+    }
 #endif
   }  // end of BehaviourProfiler::~Timer
 
-  BehaviourProfiler::BehaviourProfiler(const std::string& n) : name(n) {
-    std::fill(begin(measures), end(measures), 0);
+  BehaviourProfiler::BehaviourProfiler(const std::string& n)
+      : name(n),
+        output(getOutputFileName("MFRONT_PROFILING_OUTPUT", n)),
+        trace(getOutputFileName("MFRONT_PROFILING_TRACE", n)),
+        identifier(getNewProfilerIdentifier()) {
   }  // end of BehaviourProfiler::BehaviourProfiler
 
-  BehaviourProfiler::~BehaviourProfiler() {
-    using size_type = std::array<std::atomic<std::intmax_t>, 23>::size_type;
+  BehaviourProfiler::ThreadMeasures& BehaviourProfiler::getThreadMeasures() {
+    // measures of the current thread, for each profiler already used by
+    // this thread
+    thread_local std::vector<std::pair<std::uintmax_t, ThreadMeasures*>>
+        cache;
+    for (const auto& [id, tm] : cache) {
+      if (id == this->identifier) {
+        return *tm;
+      }
+    }
+    auto lock = std::lock_guard<std::mutex>(this->m);
+    this->threads.push_back(std::make_unique<ThreadMeasures>());
+    auto& tm = *(this->threads.back());
+    tm.index = this->threads.size() - 1;
+    cache.push_back({this->identifier, &tm});
+    return tm;
+  }  // end of BehaviourProfiler::getThreadMeasures
+
+  void BehaviourProfiler::reportNewtonIterations(const std::intmax_t n,
+                                                 const bool b) {
+    auto& tm = this->getThreadMeasures();
+    ++(tm.integrations);
+    if (!b) {
+      ++(tm.failures);
+    }
+    tm.iterations += n;
+    tm.min_iterations = std::min(tm.min_iterations, n);
+    tm.max_iterations = std::max(tm.max_iterations, n);
+    const auto i = static_cast<std::size_t>(std::max(n, std::intmax_t{0}));
+    ++(tm.iterations_histogram[std::min(i, histogramSize - 1)]);
+  }  // end of BehaviourProfiler::reportNewtonIterations
+
+  void BehaviourProfiler::print(const ThreadMeasures& r) const {
+    using size_type = std::array<CodeBlockMeasures, 23>::size_type;
+    const auto& measures = r.blocks;
     std::cout << "\nResults of " << this->name << " profiling : ";
-    print_time(std::cout, measures.back());
+    print_time(std::cout, measures.back().total);
+    if (this->threads.size() > 1) {
+      std::cout << " (" << this->threads.size() << " threads)";
+    }
     std::cout << '\n';
     std::string::size_type w{0};
     for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+      if (measures[i].calls != 0) {
         w = std::max(w, getCodeBlockName(i).size());
       }
     }
     for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+      const auto& mi = measures[i];
+      if (mi.calls != 0) {
         std::cout << "- " << std::setw(w) << std::left << getCodeBlockName(i)
                   << " : ";
-        print_time(std::cout, measures[i]);
-        std::cout << " (" << measures[i] << " ns)\n";
+        print_time(std::cout, mi.total);
+        std::cout << " (" << mi.total << " ns, " << mi.calls
+                  << " calls, min: " << mi.min << " ns, max: " << mi.max
+                  << " ns)\n";
       }
     }
+    if (r.integrations != 0) {
+      std::cout << "- Newton iterations : " << r.iterations << " ("
+                << r.integrations << " integrations, mean: "
+                << static_cast<double>(r.iterations) /
+                       static_cast<double>(r.integrations)
+                << ", min: " << r.min_iterations
+                << ", max: " << r.max_iterations
+                << ", failures: " << r.failures << ")\n";
+    }
     std::cout << std::endl;
+  }  // end of BehaviourProfiler::print
+
+  /*!
+   * \brief write an histogram as a list of pairs of the lower bound of
+   * the non empty bins and their number of elements.
+   * \param[out] os: output stream
+   * \param[in] h: histogram
+   * \param[in] log: if true, the bin `i` starts at \(2^{i}\), otherwise
+   * it starts at \(i\)
+   */
+  static void writeJSONHistogram(
+      std::ostream& os,
+      const std::array<std::intmax_t, histogramSize>& h,
+      const bool log) {
+    os << '[';
+    auto first = true;
+    for (std::size_t i = 0; i != histogramSize; ++i) {
+      if (h[i] == 0) {
+        continue;
+      }
+      if (!first) {
+        os << ", ";
+      }
+      const auto lb = log ? (i == 0 ? std::intmax_t{0} : std::intmax_t{1} << i)
+                          : static_cast<std::intmax_t>(i);
+      os << '[' << lb << ", " << h[i] << ']';
+      first = false;
+    }
+    os << ']';
+  }  // end of writeJSONHistogram
+
+  //! \brief write the measures of a code block
+  static void writeJSONMeasures(std::ostream& os, const CodeBlockMeasures& m) {
+    os << "\"calls\": " << m.calls << ", \"total\": " << m.total
+       << ", \"min\": " << m.min << ", \"max\": " << m.max
+       << ", \"histogram\": ";
+    writeJSONHistogram(os, m.histogram, true);
+  }  // end of writeJSONMeasures
+
+  //! \brief a node of the tree of code blocks
+  struct CodeBlocksTreeNode {
+    //! \brief measures associated with the code block, if any
+    const CodeBlockMeasures* measures = nullptr;
+    //! \brief nested code blocks
+    std::map<std::string, CodeBlocksTreeNode> children;
+  };  // end of CodeBlocksTreeNode
+
+  //! \brief write a tree of code blocks
+  static void writeJSONCodeBlocks(
+      std::ostream& os,
+      const std::map<std::string, CodeBlocksTreeNode>& nodes) {
+    os << '{';
+    auto first = true;
+    for (const auto& [n, node] : nodes) {
+      if (!first) {
+        os << ", ";
+      }
+      os << '"' << n << "\": {";
+      if (node.measures != nullptr) {
+        writeJSONMeasures(os, *(node.measures));
+        if (!node.children.empty()) {
+          os << ", ";
+        }
+      }
+      if (!node.children.empty()) {
+        os << "\"children\": ";
+        writeJSONCodeBlocks(os, node.children);
+      }
+      os << '}';
+      first = false;
+    }
+    os << '}';
+  }  // end of writeJSONCodeBlocks
+
+  void BehaviourProfiler::writeJSON(const std::string& f,
+                                    const ThreadMeasures& r) const {
+    using size_type = std::array<CodeBlockMeasures, 23>::size_type;
+    // code blocks are organised hierarchically using their names
+    auto root = std::map<std::string, CodeBlocksTreeNode>{};
+    for (size_type i = 0; i + 1 != r.blocks.size(); ++i) {
+      if (r.blocks[i].calls == 0) {
+        continue;
+      }
+      const auto n = getCodeBlockName(i);
+      auto* nodes = &root;
+      auto b = std::string::size_type{};
+      auto pos = n.find("::");
+      while (pos != std::string::npos) {
+        nodes = &((*nodes)[n.substr(b, pos - b)].children);
+        b = pos + 2;
+        pos = n.find("::", b);
+      }
+      (*nodes)[n.substr(b)].measures = &(r.blocks[i]);
+    }
+    std::ofstream os(f);
+    tfel::raise_if(!os, "BehaviourProfiler::writeJSON: can't open file '" +
+                            f + "'");
+    os << "{\n"
+       << "\"behaviour\": \"" << this->name << "\",\n"
+       << "\"threads\": " << this->threads.size() << ",\n"
+       << "\"time_unit\": \"ns\",\n"
+       << "\"total_time\": {";
+    writeJSONMeasures(os, r.blocks.back());
+    os << "},\n"
+       << "\"code_blocks\": ";
+    writeJSONCodeBlocks(os, root);
+    if (r.integrations != 0) {
+      os << ",\n"
+         << "\"newton_iterations\": {\"integrations\": " << r.integrations
+         << ", \"failures\": " << r.failures
+         << ", \"total\": " << r.iterations
+         << ", \"min\": " << r.min_iterations
+         << ", \"max\": " << r.max_iterations << ", \"histogram\": ";
+      writeJSONHistogram(os, r.iterations_histogram, false);
+      os << '}';
+    }
+    os << "\n}\n";
+  }  // end of BehaviourProfiler::writeJSON
+
+  void BehaviourProfiler::writeTrace(const std::string& f) const {
+#if defined _WIN32 || defined _WIN64
+    const auto pid = ::_getpid();
+#else
+    const auto pid = ::getpid();
+#endif
+    auto origin = std::numeric_limits<std::intmax_t>::max();
+    auto dropped_events = std::intmax_t{};
+    for (const auto& t : this->threads) {
+      dropped_events += t->dropped_events;
+      for (const auto& e : t->events) {
+        origin = std::min(origin, e.start);
+      }
+    }
+    std::ofstream os(f);
+    tfel::raise_if(!os, "BehaviourProfiler::writeTrace: can't open file '" +
+                            f + "'");
+    os.precision(14);
+    os << "{\"traceEvents\": [\n"
+       << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid
+       << ", \"args\": {\"name\": \"" << this->name << "\"}}";
+    for (const auto& t : this->threads) {
+      os << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid
+         << ", \"tid\": " << t->index << ", \"args\": {\"name\": \"thread "
+         << t->index << "\"}}";
+      for (const auto& e : t->events) {
+        // times are given in microseconds
+        os << ",\n{\"name\": \"" << getCodeBlockName(e.block)
+           << "\", \"cat\": \"" << this->name
+           << "\", \"ph\": \"X\", \"ts\": "
+           << static_cast<double>(e.start - origin) / 1000
+           << ", \"dur\": " << static_cast<double>(e.duration) / 1000
+           << ", \"pid\": " << pid << ", \"tid\": " << t->index << '}';
+      }
+    }
+    os << "\n],\n"
+       << "\"displayTimeUnit\": \"ns\",\n"
+       << "\"otherData\": {\"dropped_events\": " << dropped_events << "}\n"
+       << "}\n";
+  }  // end of BehaviourProfiler::writeTrace
+
+  BehaviourProfiler::~BehaviourProfiler() {
+    auto r = ThreadMeasures{};
+    for (const auto& t : this->threads) {
+      for (std::size_t i = 0; i != r.blocks.size(); ++i) {
+        merge(r.blocks[i], t->blocks[i]);
+      }
+      r.integrations += t->integrations;
+      r.failures += t->failures;
+      r.iterations += t->iterations;
+      r.min_iterations = std::min(r.min_iterations, t->min_iterations);
+      r.max_iterations = std::max(r.max_iterations, t->max_iterations);
+      for (std::size_t i = 0; i != histogramSize; ++i) {
+        r.iterations_histogram[i] += t->iterations_histogram[i];
+      }
+    }
+    try {
+      if (this->output.empty()) {
+        this->print(r);
+      } else {
+        this->writeJSON(this->output, r);
+      }
+      if (!this->trace.empty()) {
+        this->writeTrace(this->trace);
+      }
+    } catch (std::exception& e) {
+      std::cerr << "BehaviourProfiler::~BehaviourProfiler: " << e.what()
+                << '\n';
+    }
   }  // end of BehaviourProfiler::~BehaviourProfiler
 
 }  // end of namespace mfront
@@ -0,0 +1,452 @@
+/*!
+ * \file   mfront/src/CompilationCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <set>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
+#include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "MFront/MFrontLogStream.hxx"
+#include "MFront/MFrontLock.hxx"
+#include "MFront/GeneratorOptions.hxx"
+#include "MFront/SearchPathsHandler.hxx"
+#include "MFront/CompilationCache.hxx"
+
+namespace mfront {
+
+  namespace fs = std::filesystem;
+
+  /*!
+   * \brief read the content of a file
+   * \return true on success
+   * \param[out] c: content
+   * \param[in] f: file
+   */
+  static bool readFile(std::string& c, const fs::path& f) {
+    auto e = std::error_code{};
+    if (!fs::is_regular_file(f, e)) {
+      return false;
+    }
+    std::ifstream in(f, std::ios::binary);
+    if (!in) {
+      return false;
+    }
+    c.assign(std::istreambuf_iterator<char>(in),
+             std::istreambuf_iterator<char>());
+    return !in.bad();
+  }  // end of readFile
+
+  //! \return true if both files exist and have the same content
+  static bool areIdentical(const fs::path& f1, const fs::path& f2) {
+    auto e = std::error_code{};
+    if ((!fs::is_regular_file(f1, e)) || (!fs::is_regular_file(f2, e)) ||
+        (fs::file_size(f1, e) != fs::file_size(f2, e))) {
+      return false;
+    }
+    auto c1 = std::string{};
+    auto c2 = std::string{};
+    return readFile(c1, f1) && readFile(c2, f2) && (c1 == c2);
+  }  // end of areIdentical
+
+  //! \return a suffix specific to the current process
+  static std::string getProcessSuffix() {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    return '.' + std::to_string(::_getpid());
+#else
+    return '.' + std::to_string(::getpid());
+#endif
+  }  // end of getProcessSuffix
+
+  /*!
+   * \brief copy a file through a temporary file, so that the
+   * destination is never partially written
+   * \param[in] s: source
+   * \param[in] d: destination
+   */
+  static void copyFile(const fs::path& s, const fs::path& d) {
+    if (d.has_parent_path()) {
+      fs::create_directories(d.parent_path());
+    }
+    const auto tmp = fs::path(d.string() + getProcessSuffix());
+    fs::copy_file(s, tmp, fs::copy_options::overwrite_existing);
+    fs::rename(tmp, d);
+  }  // end of copyFile
+
+  //! \return the value of the environment variables used by the build
+  static std::string getEnvironmentDescription() {
+    auto r = std::string{};
+    for (const auto v :
+         {"CXX", "CC", "INCLUDES", "CXXFLAGS", "CFLAGS", "LDFLAGS"}) {
+      const auto e = ::getenv(v);
+      r += std::string(v) + '=' + ((e == nullptr) ? "" : e) + '\n';
+    }
+    return r;
+  }  // end of getEnvironmentDescription
+
+  /*!
+   * \return a hash of the paths and contents of the given files or an
+   * empty string if one of them can't be read.
+   * \param[in] files: files
+   */
+  static std::string getDependenciesHash(
+      const std::vector<std::string>& files) {
+    auto r = std::string{};
+    auto c = std::string{};
+    for (const auto& f : files) {
+      if (!readFile(c, f)) {
+        return "";
+      }
+      r += f + '\n' + std::to_string(c.size()) + '\n' + c;
+    }
+    return tfel::utilities::getStableHash(r);
+  }  // end of getDependenciesHash
+
+  //! \return the files contained in the `src` and `include` directories
+  static std::map<std::string, long long> getGeneratedFiles() {
+    auto r = std::map<std::string, long long>{};
+    for (const auto d : {"src", "include"}) {
+      auto e = std::error_code{};
+      if (!fs::is_directory(d, e)) {
+        continue;
+      }
+      for (const auto& p : fs::recursive_directory_iterator(d, e)) {
+        if (!p.is_regular_file(e)) {
+          continue;
+        }
+        const auto& f = p.path();
+        const auto ext = f.extension().string();
+        const auto n = f.filename().string();
+        // files handled by the build system
+        if ((ext == ".o") || (ext == ".d") || (ext == ".so") ||
+            (ext == ".dll") || (ext == ".bundle") || (ext == ".lib") ||
+            (n == "targets.lst") || (n == "Makefile.mfront") ||
+            (n == "CMakeLists.txt") || (n.find(".d.") != std::string::npos)) {
+          continue;
+        }
+        const auto t = fs::last_write_time(f, e);
+        if (!e) {
+          r[f.generic_string()] = static_cast<long long>(
+              t.time_since_epoch().count());
+        }
+      }
+    }
+    return r;
+  }  // end of getGeneratedFiles
+
+  //! \return the name of the object file associated with a source file
+  static std::string getObjectFileName(const std::string& s) {
+    for (const auto ext : {".cxx", ".cpp", ".c"}) {
+      const auto n = std::char_traits<char>::length(ext);
+      if ((s.size() > n) && (s.compare(s.size() - n, n, ext) == 0)) {
+        return s.substr(0, s.size() - n) + ".o";
+      }
+    }
+    return "";
+  }  // end of getObjectFileName
+
+  //! \brief report an error related to the cache
+  static void reportCacheError(const std::string& m, const std::string& e) {
+    if (getVerboseMode() >= VERBOSE_LEVEL1) {
+      getLogStream() << "CompilationCache::" << m << ": " << e << '\n';
+    }
+  }  // end of reportCacheError
+
+  CompilationCache& CompilationCache::getCompilationCache() {
+    static CompilationCache c;
+    return c;
+  }  // end of getCompilationCache
+
+  CompilationCache::CompilationCache() {
+    const auto d = ::getenv("MFRONT_CACHE_DIRECTORY");
+    if ((d != nullptr) && (*d != '\0')) {
+      this->setDirectory(d);
+    }
+  }  // end of CompilationCache
+
+  void CompilationCache::setDirectory(const std::string& d) {
+    tfel::raise_if(d.empty(),
+                   "CompilationCache::setDirectory: "
+                   "empty directory name");
+    auto e = std::error_code{};
+    fs::create_directories(d, e);
+    tfel::raise_if(static_cast<bool>(e) || !fs::is_directory(d),
+                   "CompilationCache::setDirectory: "
+                   "can't create directory '" +
+                       d + "'");
+    this->directory = fs::absolute(d).string();
+  }  // end of setDirectory
+
+  const std::string& CompilationCache::getDirectory() const {
+    return this->directory;
+  }  // end of getDirectory
+
+  bool CompilationCache::isEnabled() const {
+    return !this->directory.empty();
+  }  // end of isEnabled
+
+  std::string CompilationCache::getKey(const std::string& f,
+                                       const std::string& o) const {
+    auto c = std::string{};
+    // files stored in `madnex` databases are not cached
+    if ((!this->isEnabled()) || (!readFile(c, f))) {
+      return "";
+    }
+    return tfel::utilities::getStableHash(
+        std::string(::getTFELVersion()) + '\n' + f + '\n' + o + '\n' +
+        getEnvironmentDescription() + c);
+  }  // end of getKey
+
+  bool CompilationCache::restore(TargetsDescription& td,
+                                 const std::string& k) {
+    if (k.empty()) {
+      return false;
+    }
+    try {
+      MFrontLockGuard lock;
+      const auto kd = fs::path(this->directory) / k;
+      std::ifstream manifest(kd / "dependencies");
+      if (!manifest) {
+        return false;
+      }
+      auto deps = std::vector<std::string>{};
+      auto l = std::string{};
+      while (std::getline(manifest, l)) {
+        deps.push_back(l);
+      }
+      const auto h = getDependenciesHash(deps);
+      const auto e = kd / h;
+      auto ec = std::error_code{};
+      if ((h.empty()) || (!fs::is_directory(e, ec))) {
+        return false;
+      }
+      tfel::utilities::CxxTokenizer tokenizer{(e / "targets.lst").string()};
+      auto c = tokenizer.begin();
+      const auto t = read<TargetsDescription>(c, tokenizer.end());
+      mergeTargetsDescription(td, t, true);
+      const auto files = e / "files";
+      for (const auto& p : fs::recursive_directory_iterator(files)) {
+        if (!p.is_regular_file()) {
+          continue;
+        }
+        const auto d = fs::relative(p.path(), files);
+        // identical files are not overwritten to avoid useless
+        // recompilations
+        if (!areIdentical(p.path(), d)) {
+          copyFile(p.path(), d);
+        }
+      }
+      for (const auto& d : deps) {
+        this->addDependency(d);
+      }
+      this->entries.push_back({e.string(), td});
+      if (getVerboseMode() >= VERBOSE_LEVEL2) {
+        getLogStream() << "CompilationCache::restore: "
+                       << "using entry '" << e.string() << "'\n";
+      }
+      return true;
+    } catch (std::exception& ex) {
+      reportCacheError("restore", ex.what());
+    }
+    return false;
+  }  // end of restore
+
+  void CompilationCache::startRecording() {
+    this->recordings.push_back({{}, getGeneratedFiles()});
+  }  // end of startRecording
+
+  void CompilationCache::addDependency(const std::string& f) {
+    if (this->recordings.empty()) {
+      return;
+    }
+    auto& deps = this->recordings.back().dependencies;
+    if (std::find(deps.begin(), deps.end(), f) == deps.end()) {
+      deps.push_back(f);
+    }
+  }  // end of addDependency
+
+  CompilationCache::Recording CompilationCache::popRecording() {
+    tfel::raise_if(this->recordings.empty(),
+                   "CompilationCache::popRecording: "
+                   "no input file is being recorded");
+    auto r = std::move(this->recordings.back());
+    this->recordings.pop_back();
+    for (const auto& d : r.dependencies) {
+      this->addDependency(d);
+    }
+    return r;
+  }  // end of popRecording
+
+  void CompilationCache::stopRecording() {
+    this->popRecording();
+  }  // end of stopRecording
+
+  void CompilationCache::store(const std::string& k,
+                               const TargetsDescription& td) {
+    const auto r = this->popRecording();
+    if (k.empty()) {
+      return;
+    }
+    const auto h = getDependenciesHash(r.dependencies);
+    if (h.empty()) {
+      return;
+    }
+    // generated files
+    auto files = std::set<std::string>{};
+    for (const auto& f : getGeneratedFiles()) {
+      const auto p = r.snapshot.find(f.first);
+      if ((p == r.snapshot.end()) || (p->second != f.second)) {
+        files.insert(f.first);
+      }
+    }
+    auto ec = std::error_code{};
+    for (const auto& l : td.libraries) {
+      for (const auto& s : l.sources) {
+        if (fs::is_regular_file("src/" + s, ec)) {
+          files.insert("src/" + s);
+        }
+      }
+    }
+    for (const auto& hd : td.headers) {
+      if (fs::is_regular_file("include/" + hd, ec)) {
+        files.insert("include/" + hd);
+      }
+    }
+    const auto kd = fs::path(this->directory) / k;
+    const auto e = kd / h;
+    const auto tmp = fs::path(e.string() + getProcessSuffix());
+    try {
+      MFrontLockGuard lock;
+      if (!fs::is_directory(e, ec)) {
+        fs::remove_all(tmp, ec);
+        fs::create_directories(tmp);
+        for (const auto& f : files) {
+          const auto d = tmp / "files" / f;
+          fs::create_directories(d.parent_path());
+          fs::copy_file(f, d);
+        }
+        {
+          std::ofstream out(tmp / "targets.lst");
+          out.exceptions(std::ios::badbit | std::ios::failbit);
+          out << td;
+        }
+        fs::rename(tmp, e);
+      }
+      const auto manifest = kd / "dependencies";
+      const auto tmanifest = fs::path(manifest.string() + getProcessSuffix());
+      {
+        std::ofstream out(tmanifest);
+        out.exceptions(std::ios::badbit | std::ios::failbit);
+        for (const auto& d : r.dependencies) {
+          out << d << '\n';
+        }
+      }
+      fs::rename(tmanifest, manifest);
+      this->entries.push_back({e.string(), td});
+    } catch (std::exception& ex) {
+      fs::remove_all(tmp, ec);
+      reportCacheError("store", ex.what());
+    }
+  }  // end of store
+
+  std::string CompilationCache::getObjectsKey(
+      const TargetsDescription& t, const GeneratorOptions& o) const {
+    auto flags = std::set<std::string>{};
+    for (const auto& l : t.libraries) {
+      flags.insert(l.cppflags.begin(), l.cppflags.end());
+      for (const auto& i : l.include_directories) {
+        flags.insert("-I" + i);
+      }
+    }
+    for (const auto& i : o.include_paths) {
+      flags.insert("-I" + i);
+    }
+    for (const auto& i : SearchPathsHandler::getSearchPaths()) {
+      flags.insert("-I" + i);
+    }
+    auto k = std::string(::getTFELVersion()) + '\n' + o.sys + '\n' +
+             std::to_string(static_cast<int>(o.olevel)) + '\n' +
+             std::to_string(o.debugFlags) + '\n' +
+             getEnvironmentDescription();
+    for (const auto& f : flags) {
+      k += f + '\n';
+    }
+    return "objects-" + tfel::utilities::getStableHash(k);
+  }  // end of getObjectsKey
+
+  void CompilationCache::restoreObjects(const std::string& k) {
+    try {
+      MFrontLockGuard lock;
+      auto ec = std::error_code{};
+      for (const auto& e : this->entries) {
+        const auto od = fs::path(e.first) / k;
+        if (!fs::is_directory(od, ec)) {
+          continue;
+        }
+        for (const auto& l : e.second.libraries) {
+          for (const auto& s : l.sources) {
+            const auto o = getObjectFileName(s);
+            if ((o.empty()) || (!fs::is_regular_file(od / o, ec))) {
+              continue;
+            }
+            const auto d = fs::path("src") / o;
+            if (!areIdentical(od / o, d)) {
+              copyFile(od / o, d);
+            }
+            // the object file must be more recent than the sources
+            fs::last_write_time(d, fs::file_time_type::clock::now());
+          }
+        }
+      }
+    } catch (std::exception& ex) {
+      reportCacheError("restoreObjects", ex.what());
+    }
+  }  // end of restoreObjects
+
+  void CompilationCache::storeObjects(const std::string& k) {
+    try {
+      MFrontLockGuard lock;
+      auto ec = std::error_code{};
+      for (const auto& e : this->entries) {
+        const auto od = fs::path(e.first) / k;
+        for (const auto& l : e.second.libraries) {
+          for (const auto& s : l.sources) {
+            const auto o = getObjectFileName(s);
+            const auto src = fs::path("src") / o;
+            if ((o.empty()) || (!fs::is_regular_file(src, ec)) ||
+                (fs::exists(od / o, ec))) {
+              continue;
+            }
+            copyFile(src, od / o);
+          }
+        }
+      }
+    } catch (std::exception& ex) {
+      reportCacheError("storeObjects", ex.what());
+    }
+  }  // end of storeObjects
+
+}  // end of namespace mfront
@@ -41,6 +41,7 @@
 #include "MFront/MFrontMaterialPropertyInterface.hxx"
 #include "MFront/StaticVariableDescription.hxx"
 #include "MFront/GlobalDomainSpecificLanguageOptionsManager.hxx"
+#include "MFront/CompilationCache.hxx"
 #include "MFront/MaterialPropertyDSL.hxx"
 
 // fixing a bug on current glibc++ cygwin versions (19/08/2015)
@@ -241,6 +242,8 @@ namespace mfront {
         (tfel::utilities::starts_with(f, "edf:"))) {
 #ifdef MFRONT_HAVE_MADNEX
       const auto path = decomposeImplementationPathInMadnexFile(f);
+      CompilationCache::getCompilationCache().addDependency(
+          std::get<0>(path));
       const auto& material = std::get<2>(path);
       const auto& name = std::get<3>(path);
       const auto impl = madnex::getMFrontImplementation(
@@ -269,6 +272,7 @@ namespace mfront {
       tfel::raise("DSLBase::openFile: madnex support was not enabled");
 #endif /* MFRONT_HAVE_MADNEX */
     } else {
+      CompilationCache::getCompilationCache().addDependency(f);
       CxxTokenizer::openFile(f);
     }
     // substitutions
@@ -90,6 +90,14 @@ namespace mfront {
     return aliases;
   }  // end of getTypeAliases
 
+  SymbolsOutputStream::~SymbolsOutputStream() = default;
+
+  void recordExportedSymbol(std::ostream& os, const std::string_view n) {
+    if (auto* const sos = dynamic_cast<SymbolsOutputStream*>(&os)) {
+      sos->symbols.emplace_back(n);
+    }
+  }  // end of recordExportedSymbol
+
   void exportStringSymbol(std::ostream& os,
                           const std::string_view n,
                           const std::string_view v) {
@@ -137,6 +145,7 @@ namespace mfront {
       }
       return s;
     }();
+    recordExportedSymbol(os, std::string{n} + "_ParametersTypes");
     os << "MFRONT_EXPORT_ARRAY_OF_SYMBOLS(int, " << n << "_ParametersTypes, "
        << size << ", MFRONT_EXPORT_ARRAY_ARGUMENTS(";
     for (auto p = parameters.begin(); p != parameters.end();) {
@@ -201,6 +210,7 @@ namespace mfront {
     }
     auto i = decltype(values.size()){};
     auto p = values.begin();
+    recordExportedSymbol(os, s);
     os << "MFRONT_EXPORT_ARRAY_OF_SYMBOLS(int, " << s << ", " << values.size()
        << ", MFRONT_EXPORT_ARRAY_ARGUMENTS(";
     while (p != values.end()) {
@@ -226,6 +236,7 @@ namespace mfront {
     }
     auto i = decltype(values.size()){};
     auto p = values.begin();
+    recordExportedSymbol(os, s);
     os << "MFRONT_EXPORT_ARRAY_OF_SYMBOLS(const char *, " << s << ", "
        << values.size() << ", MFRONT_EXPORT_ARRAY_ARGUMENTS(";
     while (p != values.end()) {
@@ -251,6 +262,7 @@ namespace mfront {
     exportUnsignedShortSymbol(out, std::string{name} + "_nargs",
                               mpd.inputs.size());
     if (!mpd.inputs.empty()) {
+      recordExportedSymbol(out, std::string{name} + "_args");
       out << "MFRONT_EXPORT_ARRAY_OF_SYMBOLS(const char *, " << name
           << "_args, " << mpd.inputs.size()
           << ", MFRONT_EXPORT_ARRAY_ARGUMENTS(";
@@ -272,6 +284,8 @@ namespace mfront {
                          const VariableBoundsDescription& b) {
     if ((b.boundsType == VariableBoundsDescription::LOWER) ||
         (b.boundsType == VariableBoundsDescription::LOWERANDUPPER)) {
+      recordExportedSymbol(out, std::string{n} + "_" + std::string{vn} +
+                                    "_Lower" + std::string{bt} + "Bound");
       out << "MFRONT_EXPORT_SYMBOL(long double, "  //
           << n << "_" << vn << "_"
           << "Lower" << bt << "Bound, "  //
@@ -279,6 +293,8 @@ namespace mfront {
     }
     if ((b.boundsType == VariableBoundsDescription::UPPER) ||
         (b.boundsType == VariableBoundsDescription::LOWERANDUPPER)) {
+      recordExportedSymbol(out, std::string{n} + "_" + std::string{vn} +
+                                    "_Upper" + std::string{bt} + "Bound");
       out << "MFRONT_EXPORT_SYMBOL(long double, "  //
           << n << "_" << vn << "_"
           << "Upper" << bt << "Bound, "  //
@@ -11,6 +11,8 @@
  * project under specific licensing conditions.
  */
 
+#include <array>
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 #include "TFEL/Raise.hxx"
@@ -999,7 +1001,8 @@ namespace mfront {
       if (std::find(i.begin(), i.end(), this->getName()) != i.end()) {
         const auto keys = std::vector<std::string>{
             {"@GenericInterfaceGenerateMTestFileOnFailure",
-             "@GenerateMTestFileOnFailure"}};
+             "@GenerateMTestFileOnFailure",
+             "@GenericInterfaceVectorisationWidth"}};
         throw_if(std::find(keys.begin(), keys.end(), k) == keys.end(),
                  "unsupported key '" + k + "'");
       } else {
@@ -1012,6 +1015,22 @@ namespace mfront {
           bd, this->readBooleanValue(k, current, end));
       return {true, current};
     }
+    if (k == "@GenericInterfaceVectorisationWidth") {
+      throw_if(bd.hasAttribute(BehaviourDescription::vectorisationWidth),
+               "the vectorisation width has already been defined");
+      throw_if(current == end, "unexpected end of file");
+      const auto w = CxxTokenizer::readUnsignedInt(current, end);
+      throw_if((w != 2) && (w != 4) && (w != 8) && (w != 16),
+               "invalid vectorisation width '" + std::to_string(w) +
+                   "' (expected 2, 4, 8 or 16)");
+      bd.setAttribute(BehaviourDescription::vectorisationWidth,
+                      static_cast<unsigned short>(w), false);
+      throw_if(current == end, "unexpected end of file");
+      throw_if(current->value != ";",
+               "expected ';', read '" + current->value + '\'');
+      ++(current);
+      return {true, current};
+    }
     if ((k == "@SelectedModellingHypothesis") ||
         (k == "@SelectedModellingHypotheses")) {
       if (current == end) {
@@ -1080,7 +1099,8 @@ namespace mfront {
   void GenericBehaviourInterface::writeInterfaceSpecificIncludes(
       std::ostream& os, const BehaviourDescription& bd) const {
     os << "#include \"MFront/GenericBehaviour/State.hxx\"\n"
-       << "#include \"MFront/GenericBehaviour/BehaviourData.hxx\"\n";
+       << "#include \"MFront/GenericBehaviour/BehaviourData.hxx\"\n"
+       << "#include \"MFront/GenericBehaviour/Parameters.hxx\"\n";
     if (bd.getAttribute(BehaviourDescription::requiresStiffnessTensor, false)) {
       os << "#include \"MFront/GenericBehaviour/ComputeStiffnessTensor.hxx\"\n";
     }
@@ -1127,6 +1147,26 @@ namespace mfront {
         (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
         (bd.isStrainMeasureDefined()) &&
         (bd.getStrainMeasure() != BehaviourDescription::LINEARISED);
+    const auto vectorisation_width =
+        bd.hasAttribute(BehaviourDescription::vectorisationWidth)
+            ? bd.getAttribute<unsigned short>(
+                  BehaviourDescription::vectorisationWidth)
+            : static_cast<unsigned short>(0);
+    if (vectorisation_width != 0) {
+      if ((type != BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) ||
+          (is_finite_strain_through_strain_measure)) {
+        raise("vectorisation is only supported for small strain behaviours");
+      }
+      if (bd.getIntegrationScheme() == BehaviourDescription::IMPLICITSCHEME) {
+        raise("vectorisation is not supported by implicit schemes");
+      }
+      if (bd.useQt()) {
+        raise("vectorisation is not supported when quantities are used");
+      }
+      if (bd.getAttribute(BehaviourData::profiling, false)) {
+        raise("vectorisation is not compatible with profiling");
+      }
+    }
     std::ofstream out("include/MFront/GenericBehaviour/" + header);
     if (!out) {
       raise("could not open file '" + header + "'");
@@ -1143,7 +1183,8 @@ namespace mfront {
     out << "#ifndef " << hg << "\n"
         << "#define " << hg << "\n\n"
         << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
-        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n\n";
+        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n"
+        << "#include\"MFront/GenericBehaviour/BatchBehaviourData.h\"\n\n";
 
     this->writeVisibilityDefines(out);
     out << "#ifdef __cplusplus\n"
@@ -1172,6 +1213,35 @@ namespace mfront {
           << " */\n"
           << "MFRONT_SHAREDOBJ int " << f
           << "(mfront_gb_BehaviourData* const);\n\n";
+      out << "/*!\n"
+          << " * \\brief integrate the behaviour over a batch of integration "
+          << "points\n"
+          << " * \\param[in,out] d: material data\n"
+          << " */\n"
+          << "MFRONT_SHAREDOBJ int " << f
+          << "_integrateBatch(mfront_gb_BatchBehaviourData* const);\n\n";
+      if (!areParametersTreatedAsStaticVariables(bd)) {
+        out << "/*!\n"
+            << " * \\brief integrate the behaviour using the given values of "
+            << "the parameters\n"
+            << " * \\param[in,out] d: material data\n"
+            << " * \\param[in] parameters: values of the parameters, ordered "
+            << "as the\n"
+            << " * names exported by the `" << f << "_Parameters` symbol\n"
+            << " */\n"
+            << "MFRONT_SHAREDOBJ int " << f
+            << "_integrateWithParameters(mfront_gb_BehaviourData* const,\n"
+            << "const mfront_gb_real* const);\n\n";
+        out << "/*!\n"
+            << " * \\brief get the values of the parameters shared by all "
+            << "the callers\n"
+            << " * \\param[out] values: values of the parameters, ordered "
+            << "as the\n"
+            << " * names exported by the `" << f << "_Parameters` symbol\n"
+            << " */\n"
+            << "MFRONT_SHAREDOBJ void " << f
+            << "_getParameters(mfront_gb_real* const);\n\n";
+      }
       // postprocessings
       for (const auto& p : d.getPostProcessings()) {
         out << "/*!\n"
@@ -1189,6 +1259,67 @@ namespace mfront {
     out << "#endif /* " << hg << " */\n";
     out.close();
 
+    // sizes of the gradients, thermodynamic forces, material properties,
+    // internal state variables, external state variables and stiffness
+    // matrix at one integration point, used by the `integrateBatch` functions
+    auto get_batch_buffers_sizes = [this, &bd, type,
+                                    is_finite_strain_through_strain_measure](
+                                       const Hypothesis h) {
+      auto get_size = [h](const SupportedTypes::TypeSize& s) {
+        return s.getValueForModellingHypothesis(h);
+      };
+      const auto& d = bd.getBehaviourData(h);
+      const auto fs =
+          (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) ||
+          (is_finite_strain_through_strain_measure);
+      auto gs = SupportedTypes::TypeSize{};
+      auto ths = SupportedTypes::TypeSize{};
+      if (fs) {
+        // the gradient is the deformation gradient and the buffers of the
+        // thermodynamic forces must be able to hold the largest supported
+        // stress measure, i.e. the first Piola-Kirchhoff stress
+        gs = SupportedTypes::getTypeSize("DeformationGradientTensor", 1u);
+        ths = SupportedTypes::getTypeSize("StressTensor", 1u);
+      } else {
+        for (const auto& mv : bd.getMainVariables()) {
+          gs += SupportedTypes::getTypeSize(mv.first.type, mv.first.arraySize);
+          ths +=
+              SupportedTypes::getTypeSize(mv.second.type, mv.second.arraySize);
+        }
+      }
+      auto mps = SupportedTypes::TypeSize{};
+      for (const auto& mp : this->buildMaterialPropertiesList(bd, h).first) {
+        mps += SupportedTypes::getTypeSize(mp.type, mp.arraySize);
+      }
+      auto isvs = SupportedTypes::TypeSize{};
+      for (const auto& v : d.getPersistentVariables()) {
+        isvs += SupportedTypes::getTypeSize(v.type, v.arraySize);
+      }
+      auto esvs = SupportedTypes::TypeSize{};
+      for (const auto& v : d.getExternalStateVariables()) {
+        esvs += SupportedTypes::getTypeSize(v.type, v.arraySize);
+      }
+      auto Ks = 0;
+      if (fs) {
+        // size of the largest supported tangent operator, i.e. the
+        // derivative of the first Piola-Kirchhoff stress with respect to
+        // the deformation gradient
+        Ks = get_size(SupportedTypes::getTypeSize("StressTensor", 1u)) *
+             get_size(
+                 SupportedTypes::getTypeSize("DeformationGradientTensor", 1u));
+      } else {
+        for (const auto& b : bd.getTangentOperatorBlocks()) {
+          Ks += get_size(
+                    SupportedTypes::getTypeSize(b.first.type, b.first.arraySize)) *
+                get_size(SupportedTypes::getTypeSize(b.second.type,
+                                                     b.second.arraySize));
+        }
+      }
+      return std::array<int, 6u>{get_size(gs),   get_size(ths),
+                                 get_size(mps),  get_size(isvs),
+                                 get_size(esvs), std::max(Ks, 1)};
+    };
+
     const auto src = name + "-generic.cxx";
     out.open("src/" + src);
     if (!out) {
@@ -1267,6 +1398,10 @@ namespace mfront {
       raise("unsupported behaviour type");
     }
 
+    out << "#include\"MFront/GenericBehaviour/IntegrateBatch.hxx\"\n";
+    if (vectorisation_width != 0) {
+      out << "#include\"MFront/GenericBehaviour/IntegrateVectorised.hxx\"\n";
+    }
     out << "#include\"MFront/GenericBehaviour/" << header << "\"\n\n";
 
     this->writeGetOutOfBoundsPolicyFunctionImplementation(out, bd, name);
@@ -1463,6 +1598,83 @@ namespace mfront {
       }
       out << "return r;\n"
           << "} // end of " << f << "\n\n";
+      // integration over a batch of integration points
+      out << "MFRONT_SHAREDOBJ int " << f
+          << "_integrateBatch(mfront_gb_BatchBehaviourData* const d){\n";
+      if (vectorisation_width != 0) {
+        // integration points are treated by blocks integrated in lock-step
+        // by the behaviour instantiated on packs
+        out << "using namespace tfel::material;\n"
+            << "using real = mfront::gb::real;\n"
+            << "constexpr auto h = ModellingHypothesis::"
+            << ModellingHypothesis::toUpperCaseString(h) << ";\n"
+            << "constexpr unsigned short w = " << vectorisation_width << ";\n"
+            << "using Behaviour = " << bd.getClassName() << "<h,real,false>;\n"
+            << "using VectorisedBehaviour = " << bd.getClassName()
+            << "<h,tfel::math::SIMDPack<real, w>,false>;\n"
+            << "return mfront::gb::integrateVectorisedBatch<Behaviour, "
+            << "VectorisedBehaviour, w, ";
+      } else {
+        out << "return mfront::gb::integrateBatch<";
+      }
+      const auto sizes = get_batch_buffers_sizes(h);
+      for (auto p = sizes.begin(); p != sizes.end(); ++p) {
+        if (p != sizes.begin()) {
+          out << ", ";
+        }
+        out << *p;
+      }
+      out << ">(*d, [](mfront_gb_BehaviourData* const pd) {\n"
+          << "return " << f << "(pd);\n";
+      if (vectorisation_width != 0) {
+        out << "}, Behaviour::STANDARDTANGENTOPERATOR, " << name
+            << "_getOutOfBoundsPolicy());\n";
+      } else {
+        out << "});\n";
+      }
+      out << "} // end of " << f << "_integrateBatch\n\n";
+      // integration using a block of parameters given by the caller
+      if (!areParametersTreatedAsStaticVariables(bd)) {
+        out << "MFRONT_SHAREDOBJ int " << f
+            << "_integrateWithParameters(mfront_gb_BehaviourData* const d,\n"
+            << "const mfront_gb_real* const parameters){\n"
+            << "const mfront::gb::ThreadLocalParametersScope "
+            << "mgb_parameters_scope(parameters);\n"
+            << "return " << f << "(d);\n"
+            << "} // end of " << f << "_integrateWithParameters\n\n";
+        // current values of the parameters, ordered as the block of
+        // parameters expected by the previous function
+        const auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+        out << "MFRONT_SHAREDOBJ void " << f
+            << "_getParameters(mfront_gb_real* const values){\n";
+        auto idx = std::size_t{};
+        for (const auto& p : bd.getBehaviourData(h).getParameters()) {
+          const auto getter = [&bd, &p, h, uh] {
+            if ((!bd.hasSpecialisedMechanicalData(h)) ||
+                (bd.hasParameter(uh, p.name))) {
+              return "tfel::material::" + bd.getClassName() +
+                     "ParametersInitializer::get()." + p.name;
+            }
+            return "tfel::material::" + bd.getClassName() +
+                   ModellingHypothesis::toString(h) +
+                   "ParametersInitializer::get()." + p.name;
+          }();
+          if (p.arraySize == 1u) {
+            out << "values[" << idx << "] = static_cast<mfront_gb_real>("
+                << getter << ");\n";
+            ++idx;
+          } else {
+            for (unsigned short i = 0; i != p.arraySize; ++i, ++idx) {
+              out << "values[" << idx << "] = static_cast<mfront_gb_real>("
+                  << getter << "[" << i << "]);\n";
+            }
+          }
+        }
+        if (idx == 0) {
+          out << "static_cast<void>(values);\n";
+        }
+        out << "} // end of " << f << "_getParameters\n\n";
+      }
     }
     // postprocessings
     for (const auto h : mhs) {
@@ -1984,6 +2196,43 @@ namespace mfront {
     }
   }  // end of writeBehaviourConstructorBody
 
+  void GenericBehaviourInterface::writeBehaviourConstructorParametersOverrides(
+      std::ostream& os,
+      const BehaviourDescription& bd,
+      const Hypothesis h) const {
+    if (areParametersTreatedAsStaticVariables(bd)) {
+      return;
+    }
+    const auto& parameters = bd.getBehaviourData(h).getParameters();
+    if (parameters.empty()) {
+      return;
+    }
+    // the values of the block of parameters are ordered as the names
+    // exported by the `_Parameters` symbol
+    os << "if (const auto* const mgb_parameters = "
+       << "mfront::gb::getThreadLocalParameters();\n"
+       << "mgb_parameters != nullptr) {\n";
+    auto idx = std::size_t{};
+    for (const auto& p : parameters) {
+      if ((p.type == "int") || (p.type == "ushort")) {
+        const auto type = p.type == "int" ? "int" : "unsigned short";
+        os << "this->" << p.name << " = static_cast<" << type
+           << ">(mgb_parameters[" << idx << "]);\n";
+        ++idx;
+      } else if (p.arraySize == 1u) {
+        os << "this->" << p.name << " = " << p.type << "(mgb_parameters["
+           << idx << "]);\n";
+        ++idx;
+      } else {
+        for (unsigned short i = 0; i != p.arraySize; ++i, ++idx) {
+          os << "this->" << p.name << "[" << i << "] = " << p.type
+             << "(mgb_parameters[" << idx << "]);\n";
+        }
+      }
+    }
+    os << "}\n";
+  }  // end of writeBehaviourConstructorParametersOverrides
+
   void GenericBehaviourInterface::writeBehaviourDataConstructor(
       std::ostream& os,
       const Hypothesis h,
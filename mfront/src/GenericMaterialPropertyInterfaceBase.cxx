@@ -104,136 +104,239 @@ namespace mfront {
     return name + "-" + i + ".cxx";
   }
 
+  /*!
+   * \brief write the checks of the physical bounds of a variable
+   * \param[out] os: output stream
+   * \param[in] v: variable
+   * \param[in] i: position of the variable
+   * \param[in] useQuantities: boolean stating if quantities are used
+   * \param[in] lv: value compared to the lower bound
+   * \param[in] uv: value compared to the upper bound
+   * \param[in] r: statement returning from the function on failure
+   */
   static void writePhysicalBounds(std::ostream& os,
                                   const VariableDescription& v,
                                   const size_t i,
-                                  const bool useQuantities) {
+                                  const bool useQuantities,
+                                  const std::string& lv,
+                                  const std::string& uv,
+                                  const std::string& r) {
     if (!v.hasPhysicalBounds()) {
       return;
     }
     const auto& b = v.getPhysicalBounds();
-    const auto to_string = useQuantities
-                               ? "std::to_string(" + v.name + ".getValue())"
-                               : "std::to_string(" + v.name + ")";
+    auto to_string = [useQuantities](const std::string& value) {
+      return useQuantities ? "std::to_string(" + value + ".getValue())"
+                           : "std::to_string(" + value + ")";
+    };
     if (b.boundsType == VariableBoundsDescription::LOWER) {
-      os << "if(" << v.name << " < " << v.type << "(" << b.lowerBound << ")){\n"
+      os << "if(" << lv << " < " << v.type << "(" << b.lowerBound << ")){\n"
          << "mfront_report(\"" << v.name
-         << " is below its physical lower bound (\" + " << to_string << " + \"<"
-         << b.lowerBound << ").\\n\");\n"
+         << " is below its physical lower bound (\" + "
+         << to_string(lv) << " + \"<" << b.lowerBound << ").\\n\");\n"
          << "mfront_output_status->status = -1;\n"
          << "mfront_output_status->bounds_status = -" << i << ";\n"
          << "errno = mfront_errno_old;\n"
-         << "return std::nan(\"\");\n"
+         << r << "\n"
          << "}\n";
     } else if (b.boundsType == VariableBoundsDescription::UPPER) {
-      os << "if(" << v.name << " > " << v.type << "(" << b.upperBound << ")){\n"
+      os << "if(" << uv << " > " << v.type << "(" << b.upperBound << ")){\n"
          << "mfront_report(\"" << v.name
-         << " is below its physical upper bound (\" + " << to_string << " + \">"
-         << b.upperBound << ").\\n\");\n"
+         << " is below its physical upper bound (\" + "
+         << to_string(uv) << " + \">" << b.upperBound << ").\\n\");\n"
          << "mfront_output_status->status = -1;\n"
          << "mfront_output_status->bounds_status = -" << i << ";\n"
          << "errno = mfront_errno_old;\n"
-         << "return std::nan(\"\");\n"
+         << r << "\n"
          << "}\n";
     } else {
-      os << "if((" << v.name << " < " << v.type << "(" << b.lowerBound << "))||"
-         << "(" << v.name << " > " << v.type << "(" << b.upperBound << "))){\n"
-         << "if(" << v.name << " < " << v.type << "(" << b.lowerBound << ")){\n"
+      os << "if((" << lv << " < " << v.type << "(" << b.lowerBound << "))||"
+         << "(" << uv << " > " << v.type << "(" << b.upperBound << "))){\n"
+         << "if(" << lv << " < " << v.type << "(" << b.lowerBound << ")){\n"
          << "mfront_report(\"" << v.name
-         << " is below its physical lower bound (\" + " << to_string << " + \"<"
-         << b.lowerBound << ").\\n\");\n"
+         << " is below its physical lower bound (\" + "
+         << to_string(lv) << " + \"<" << b.lowerBound << ").\\n\");\n"
          << "} else {\n"
          << "mfront_report(\"" << v.name
-         << " is over its physical upper bound (\" + " << to_string << " + \">"
-         << b.upperBound << ").\\n\");\n"
+         << " is over its physical upper bound (\" + "
+         << to_string(uv) << " + \">" << b.upperBound << ").\\n\");\n"
          << "}\n"
          << "mfront_output_status->status = -1;\n"
          << "mfront_output_status->bounds_status = -" << i << ";\n"
          << "errno = mfront_errno_old;\n"
-         << "return std::nan(\"\");\n"
+         << r << "\n"
          << "}\n";
     }
   }  // end of writePhysicalBounds
 
+  /*!
+   * \brief write the checks of the standard bounds of a variable
+   * \param[out] os: output stream
+   * \param[in] iucname: prefix of the out of bounds policies
+   * \param[in] v: variable
+   * \param[in] i: position of the variable
+   * \param[in] useQuantities: boolean stating if quantities are used
+   * \param[in] lv: value compared to the lower bound
+   * \param[in] uv: value compared to the upper bound
+   * \param[in] r: statement returning from the function on failure
+   */
   static void writeBounds(std::ostream& os,
                           const std::string& iucname,
                           const VariableDescription& v,
                           const size_t i,
-                          const bool useQuantities) {
+                          const bool useQuantities,
+                          const std::string& lv,
+                          const std::string& uv,
+                          const std::string& r) {
     if (!v.hasBounds()) {
       return;
     }
-    const auto to_string = useQuantities
-                               ? "std::to_string(" + v.name + ".getValue())"
-                               : "std::to_string(" + v.name + ")";
+    auto to_string = [useQuantities](const std::string& value) {
+      return useQuantities ? "std::to_string(" + value + ".getValue())"
+                           : "std::to_string(" + value + ")";
+    };
     const auto& b = v.getBounds();
     if (b.boundsType == VariableBoundsDescription::LOWER) {
-      os << "if(" << v.name << " < " << v.type << "(" << b.lowerBound << ")){\n"
+      os << "if(" << lv << " < " << v.type << "(" << b.lowerBound << ")){\n"
          << "if(mfront_out_of_bounds_policy==" << iucname
          << "_STRICT_POLICY){\n"
          << "mfront_report(\"" << v.name << " is out of bounds.\");\n"
          << "mfront_output_status->status = -1;\n"
          << "mfront_output_status->bounds_status = -" << i << ";\n"
          << "errno = mfront_errno_old;\n"
-         << "return std::nan(\"\");\n"
+         << r << "\n"
          << "} else if (mfront_out_of_bounds_policy==" << iucname
          << "_WARNING_POLICY){\n"
          << "mfront_output_status->status = 1;\n"
          << "mfront_output_status->bounds_status = " << i << ";\n"
          << "mfront_report(\"" << v.name << " is below its lower bound (\" + "
-         << to_string << " + \"<" << b.lowerBound << ").\\n\");\n"
+         << to_string(lv) << " + \"<" << b.lowerBound << ").\\n\");\n"
          << "}\n"
          << "}\n";
     } else if (b.boundsType == VariableBoundsDescription::UPPER) {
-      os << "if(" << v.name << " > " << v.type << "(" << b.upperBound << ")){\n"
+      os << "if(" << uv << " > " << v.type << "(" << b.upperBound << ")){\n"
          << "if(mfront_out_of_bounds_policy==" << iucname
          << "_STRICT_POLICY){\n"
          << "mfront_report(\"" << v.name << " is over its upper bound (\" + "
-         << to_string << " + \">" << b.upperBound << ").\\n\");\n"
+         << to_string(uv) << " + \">" << b.upperBound << ").\\n\");\n"
          << "mfront_output_status->status = -1;\n"
          << "mfront_output_status->bounds_status = -" << i << ";\n"
-         << "return std::nan(\"\");\n"
+         << r << "\n"
          << "} else if (mfront_out_of_bounds_policy==" << iucname
          << "_WARNING_POLICY){\n"
          << "mfront_output_status->status = 1;\n"
          << "mfront_output_status->bounds_status = " << i << ";\n"
          << "mfront_report(\"" << v.name << " is over its upper bound (\" + "
-         << to_string << " + \">" << b.upperBound << ").\\n\");\n"
+         << to_string(uv) << " + \">" << b.upperBound << ").\\n\");\n"
          << "}\n"
          << "}\n";
     } else {
-      os << "if((" << v.name << " < " << v.type << "(" << b.lowerBound << "))||"
-         << "(" << v.name << " > " << v.type << "(" << b.upperBound << "))){\n"
+      os << "if((" << lv << " < " << v.type << "(" << b.lowerBound << "))||"
+         << "(" << uv << " > " << v.type << "(" << b.upperBound << "))){\n"
          << "if(mfront_out_of_bounds_policy==" << iucname
          << "_STRICT_POLICY){\n"
-         << "if(" << v.name << " < " << v.type << "(" << b.lowerBound << ")){\n"
+         << "if(" << lv << " < " << v.type << "(" << b.lowerBound << ")){\n"
          << "mfront_report(\"" << v.name << " is below its lower bound (\" + "
-         << to_string << " + \"<" << b.lowerBound << ").\\n\");\n"
+         << to_string(lv) << " + \"<" << b.lowerBound << ").\\n\");\n"
          << "} else {\n"
          << "mfront_report(\"" << v.name << " is over its upper bound (\" + "
-         << to_string << " + \">" << b.upperBound << ").\\n\");\n"
+         << to_string(uv) << " + \">" << b.upperBound << ").\\n\");\n"
          << "}\n"
          << "mfront_output_status->status = -1;\n"
          << "mfront_output_status->bounds_status = -" << i << ";\n"
          << "errno = mfront_errno_old;\n"
-         << "return std::nan(\"\");\n"
+         << r << "\n"
          << "} else if (mfront_out_of_bounds_policy==" << iucname
          << "_WARNING_POLICY){\n"
          << "mfront_output_status->status = 1;\n"
-         << "if(" << v.name << " < " << v.type << "(" << b.lowerBound << ")){\n"
+         << "if(" << lv << " < " << v.type << "(" << b.lowerBound << ")){\n"
          << "mfront_output_status->bounds_status = " << i << ";\n"
          << "mfront_report(\"" << v.name << " is below its lower bound (\" + "
-         << to_string << " + \"<" << b.lowerBound << ").\\n\");\n"
+         << to_string(lv) << " + \"<" << b.lowerBound << ").\\n\");\n"
          << "} else {\n"
          << "mfront_output_status->bounds_status = " << i << ";\n"
          << "mfront_report(\"" << v.name << " is over its upper bound (\" + "
-         << to_string << " + \">" << b.upperBound << ").\\n\");\n"
+         << to_string(uv) << " + \">" << b.upperBound << ").\\n\");\n"
          << "}\n"
          << "}\n"
          << "}\n";
     }
   }  // end of writeBounds
 
+  /*!
+   * \brief write the checks of the bounds of the inputs
+   * \param[out] os: output stream
+   * \param[in] mpd: material property description
+   * \param[in] iucname: interface name in upper case
+   * \param[in] prefix: prefix of the out of bounds policies
+   * \param[in] ls: suffix of the values compared to the lower bounds
+   * \param[in] us: suffix of the values compared to the upper bounds
+   * \param[in] r: statement returning from the function on failure
+   */
+  static void writeInputsBoundsChecks(std::ostream& os,
+                                      const MaterialPropertyDescription& mpd,
+                                      const std::string& iucname,
+                                      const std::string& prefix,
+                                      const std::string& ls,
+                                      const std::string& us,
+                                      const std::string& r) {
+    const auto qt = useQuantities(mpd);
+    if ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs))) {
+      os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
+    }
+    if (hasPhysicalBounds(mpd.inputs)) {
+      os << "// treating physical bounds\n";
+      for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+        const auto& v = mpd.inputs[i];
+        writePhysicalBounds(os, v, i + 1, qt, v.name + ls, v.name + us, r);
+      }
+    }
+    if (hasBounds(mpd.inputs)) {
+      os << "// treating standard bounds\n";
+      for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+        const auto& v = mpd.inputs[i];
+        writeBounds(os, prefix, v, i + 1, qt, v.name + ls, v.name + us, r);
+      }
+    }
+    if ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs))) {
+      os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+    }
+  }  // end of writeInputsBoundsChecks
+
+  /*!
+   * \brief write the checks of the bounds of the output
+   * \param[out] os: output stream
+   * \param[in] mpd: material property description
+   * \param[in] iucname: interface name in upper case
+   * \param[in] prefix: prefix of the out of bounds policies
+   * \param[in] lv: value compared to the lower bound
+   * \param[in] uv: value compared to the upper bound
+   * \param[in] r: statement returning from the function on failure
+   */
+  static void writeOutputBoundsChecks(std::ostream& os,
+                                      const MaterialPropertyDescription& mpd,
+                                      const std::string& iucname,
+                                      const std::string& prefix,
+                                      const std::string& lv,
+                                      const std::string& uv,
+                                      const std::string& r) {
+    const auto& v = mpd.output;
+    const auto i = mpd.inputs.size() + 1;
+    if ((!v.hasPhysicalBounds()) && (!v.hasBounds())) {
+      return;
+    }
+    os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
+    if (v.hasPhysicalBounds()) {
+      os << "// treating physical bounds\n";
+      writePhysicalBounds(os, v, i, useQuantities(mpd), lv, uv, r);
+    }
+    if (v.hasBounds()) {
+      os << "// treating bounds\n";
+      writeBounds(os, prefix, v, i, useQuantities(mpd), lv, uv, r);
+    }
+    os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+  }  // end of writeOutputBoundsChecks
+
   void GenericMaterialPropertyInterfaceBase::writeOutputFiles(
       const MaterialPropertyDescription& mpd, const FileDescription& fd) const {
     this->writeHeaderFile(mpd, fd);
@@ -285,6 +388,12 @@ namespace mfront {
        << "const " << types.real_type << "* const,"
        << "const " << types.integer_type << ","
        << "const " << types.out_of_bounds_policy_type << ");\n\n";
+    os << "MFRONT_SHAREDOBJ void\n"
+       << name << "_array(" << types.output_status_type << "* const,"
+       << "const " << types.real_type << "* const* const,"
+       << types.real_type << "* const,"
+       << "const " << types.integer_type << ","
+       << "const " << types.out_of_bounds_policy_type << ");\n\n";
     if (!mpd.parameters.empty()) {
       os << "MFRONT_SHAREDOBJ int\n"
          << name << "_setParameter(const char *const,"
@@ -436,8 +545,6 @@ namespace mfront {
        << "mfront_output_status->bounds_status = 0;\n"
        << "mfront_output_status->c_error_number = 0;\n";
     if (!areRuntimeChecksDisabled(mpd)) {
-      // C-error handling
-      os << "errno = 0;\n";
       // check number of arguments
       os << "if(mfront_nargs!= " << mpd.inputs.size() << "){\n"
          << "mfront_output_status->status = -5;\n"
@@ -461,6 +568,10 @@ namespace mfront {
            << "MaterialPropertyHandler().msg.c_str());\n"
            << "}\n";
       }
+      // C-error handling. This must be done after the first call to the
+      // parameters handler which may modify errno while looking for
+      // the parameters file.
+      os << "errno = 0;\n";
     }
     writeAssignMaterialPropertyParameters(os, mpd, name, "real", iname);
     //
@@ -481,41 +592,13 @@ namespace mfront {
     os << "auto " << mpd.output.name << " = " << mpd.output.type << "{};\n";
     os << "try{\n";
     if (!areRuntimeChecksDisabled(mpd)) {
-      if ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs))) {
-        os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
-      }
-      if (hasPhysicalBounds(mpd.inputs)) {
-        os << "// treating physical bounds\n";
-        for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
-          writePhysicalBounds(os, mpd.inputs[i], i + 1, useQuantities(mpd));
-        }
-      }
-      if (hasBounds(mpd.inputs)) {
-        os << "// treating standard bounds\n";
-        for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
-          writeBounds(os, prefix, mpd.inputs[i], i + 1, useQuantities(mpd));
-        }
-      }
-      if ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs))) {
-        os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
-      }
+      writeInputsBoundsChecks(os, mpd, iucname, prefix, "", "",
+                              "return std::nan(\"\");");
     }
     os << function.body;
     if (!areRuntimeChecksDisabled(mpd)) {
-      if ((mpd.output.hasPhysicalBounds()) || (mpd.output.hasBounds())) {
-        os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
-        if (mpd.output.hasPhysicalBounds()) {
-          os << "// treating physical bounds\n";
-          writePhysicalBounds(os, mpd.output, mpd.inputs.size() + 1,
-                              useQuantities(mpd));
-        }
-        if (mpd.output.hasBounds()) {
-          os << "// treating bounds\n";
-          writeBounds(os, prefix, mpd.output, mpd.inputs.size() + 1,
-                      useQuantities(mpd));
-        }
-        os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
-      }
+      writeOutputBoundsChecks(os, mpd, iucname, prefix, mpd.output.name,
+                              mpd.output.name, "return std::nan(\"\");");
     }
     os << "} catch(std::exception& e){\n"
        << "mfront_output_status->status = -2;\n"
@@ -548,13 +631,206 @@ namespace mfront {
     } else {
       os << "return " << mpd.output.name << ";\n";
     }
-    os << "} // end of " << name << "\n\n"
-       << "#ifdef __cplusplus\n"
+    os << "} // end of " << name << "\n\n";
+    this->writeArrayFunction(os, mpd, fd);
+    os << "#ifdef __cplusplus\n"
        << "} // end of extern \"C\"\n"
        << "#endif /* __cplusplus */\n\n";
     os.close();
   }  // end of writeSrcFile()
 
+  void GenericMaterialPropertyInterfaceBase::writeArrayFunction(
+      std::ostream& os,
+      const MaterialPropertyDescription& mpd,
+      const FileDescription& fd) const {
+    const auto types = this->getTypesDescription();
+    const auto iucname = this->getInterfaceNameInUpperCase();
+    const auto iname = this->getInterfaceName();
+    const auto prefix = this->getOutOfBoundsPolicyEnumerationPrefix();
+    const auto name = this->getFunctionName(mpd);
+    const auto& params = mpd.parameters;
+    const auto checks = !areRuntimeChecksDisabled(mpd);
+    // conversion of a value to the type of a variable
+    auto cast = [&mpd](const VariableDescription& v, const std::string& e) {
+      return useQuantities(mpd) ? v.type + "(" + e + ")" : e;
+    };
+    // loop over the values of the array
+    const auto loop = "for(" + types.integer_type +
+                      " mfront_i = 0; mfront_i != mfront_n; ++mfront_i){\n";
+    const auto failure = std::string{"mfront_report_failure();\nreturn;"};
+    const auto use_policy = hasBounds(mpd.inputs) || hasBounds(mpd.output);
+    os << "MFRONT_SHAREDOBJ void\n"
+       << name << "_array(" << types.output_status_type
+       << "* const mfront_output_status,\n";
+    if (!mpd.inputs.empty()) {
+      os << "const " << types.real_type << "* const* const mfront_args,\n";
+    } else {
+      os << "const " << types.real_type << "* const* const,\n";
+    }
+    os << types.real_type << "* const mfront_values,\n"
+       << "const " << types.integer_type << " mfront_n,\n";
+    if (use_policy) {
+      os << "const " << types.out_of_bounds_policy_type
+         << " mfront_out_of_bounds_policy";
+    } else {
+      os << "const " << types.out_of_bounds_policy_type;
+    }
+    os << ")\n{\n";
+    writeBeginningOfMaterialPropertyBody(os, mpd, fd, "double", true);
+    os << "auto mfront_report = "
+       << "[&mfront_output_status](const std::string& "
+       << "mfront_error_message){\n"
+       << "if(mfront_error_message.empty()){\n"
+       << "return;\n"
+       << "}\n"
+       << "std::strncpy(mfront_output_status->msg,"
+       << "mfront_error_message.c_str(),511);\n"
+       << "mfront_output_status->msg[511]='\\0';\n"
+       << "};\n"
+       << "[[maybe_unused]] auto mfront_report_failure = "
+       << "[mfront_values, mfront_n]{\n"
+       << "std::fill(mfront_values, mfront_values + mfront_n, "
+       << "std::nan(\"\"));\n"
+       << "};\n";
+    if (checks) {
+      os << "const int mfront_errno_old = errno;\n";
+    }
+    os << "mfront_output_status->status = 0;\n"
+       << "mfront_output_status->bounds_status = 0;\n"
+       << "mfront_output_status->c_error_number = 0;\n"
+       << "if(mfront_n == 0){\n"
+       << "return;\n"
+       << "}\n";
+    if (checks) {
+      if ((!areParametersTreatedAsStaticVariables(mpd)) && (!params.empty())) {
+        const auto hn = getMaterialPropertyParametersHandlerClassName(name);
+        os << "if(!" << iname << "::" << hn << "::get" << hn << "().ok){\n"
+           << "mfront_output_status->status = -6;\n"
+           << "mfront_report(" << iname << "::" << hn << "::get" << hn
+           << "().msg);\n"
+           << "errno = mfront_errno_old;\n"
+           << failure << "\n"
+           << "}\n";
+      }
+      os << "errno = 0;\n";
+    }
+    writeAssignMaterialPropertyParameters(os, mpd, name, "real", iname);
+    // extremal values of an array, used to check the bounds once for
+    // the whole array
+    auto write_extremal_values = [&os, &cast, &types](
+                                     const VariableDescription& v,
+                                     const std::string& values) {
+      auto has_bound = [&v](const bool lower) {
+        auto check = [lower](const VariableBoundsDescription& b) {
+          if (b.boundsType == VariableBoundsDescription::LOWERANDUPPER) {
+            return true;
+          }
+          return lower ? b.boundsType == VariableBoundsDescription::LOWER
+                       : b.boundsType == VariableBoundsDescription::UPPER;
+        };
+        return ((v.hasBounds()) && (check(v.getBounds()))) ||
+               ((v.hasPhysicalBounds()) && (check(v.getPhysicalBounds())));
+      };
+      const auto bmin = has_bound(true);
+      const auto bmax = has_bound(false);
+      const auto vmin = "mfront_" + v.name + "_min";
+      const auto vmax = "mfront_" + v.name + "_max";
+      if (bmin) {
+        os << "auto " << vmin << " = " << values << "[0];\n";
+      }
+      if (bmax) {
+        os << "auto " << vmax << " = " << values << "[0];\n";
+      }
+      os << "for(" << types.integer_type
+         << " mfront_i = 1; mfront_i != mfront_n; ++mfront_i){\n";
+      if (bmin) {
+        os << vmin << " = std::min(" << vmin << ", " << values
+           << "[mfront_i]);\n";
+      }
+      if (bmax) {
+        os << vmax << " = std::max(" << vmax << ", " << values
+           << "[mfront_i]);\n";
+      }
+      os << "}\n";
+      if (bmin) {
+        os << "const auto " << v.name << "_min = " << cast(v, vmin) << ";\n";
+      }
+      if (bmax) {
+        os << "const auto " << v.name << "_max = " << cast(v, vmax) << ";\n";
+      }
+    };
+    os << "try{\n";
+    if ((checks) &&
+        ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs)))) {
+      os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n"
+         << "// the bounds are checked once using the extremal values\n";
+      for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+        const auto& v = mpd.inputs[i];
+        if ((v.hasBounds()) || (v.hasPhysicalBounds())) {
+          write_extremal_values(v, "mfront_args[" + std::to_string(i) + "]");
+        }
+      }
+      os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+      writeInputsBoundsChecks(os, mpd, iucname, prefix, "_min", "_max",
+                              failure);
+    }
+    // the loop body is free of any check, so that it can be vectorized
+    os << loop;
+    for (decltype(mpd.inputs.size()) i = 0; i != mpd.inputs.size(); ++i) {
+      const auto& v = mpd.inputs[i];
+      const auto value = "mfront_args[" + std::to_string(i) + "][mfront_i]";
+      os << "const auto " << v.name << " = " << cast(v, value) << ";\n";
+    }
+    os << "auto " << mpd.output.name << " = " << mpd.output.type << "{};\n"
+       << mpd.f.body << "\n";
+    if (useQuantities(mpd)) {
+      os << "mfront_values[mfront_i] = " << mpd.output.name
+         << ".getValue();\n";
+    } else {
+      os << "mfront_values[mfront_i] = " << mpd.output.name << ";\n";
+    }
+    os << "}\n";
+    if ((checks) &&
+        ((mpd.output.hasPhysicalBounds()) || (mpd.output.hasBounds()))) {
+      os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n";
+      write_extremal_values(mpd.output, "mfront_values");
+      os << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+      const auto& o = mpd.output.name;
+      writeOutputBoundsChecks(os, mpd, iucname, prefix, o + "_min",
+                              o + "_max", failure);
+    }
+    os << "} catch(std::exception& e){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(e.what());\n";
+    if (checks) {
+      os << "errno = mfront_errno_old;\n";
+    }
+    os << failure << "\n"
+       << "} catch(...){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(\"unknown C++ exception\");\n";
+    if (checks) {
+      os << "errno = mfront_errno_old;\n";
+    }
+    os << failure << "\n"
+       << "}\n";
+    if (checks) {
+      os << "if (errno != 0) {\n"
+         << "mfront_output_status->status = -3;\n"
+         << "mfront_output_status->c_error_number = errno;\n"
+         << "mfront_report(strerror(errno));\n"
+         << "}\n"
+         << "errno = mfront_errno_old;\n"
+         << loop
+         << "if(!tfel::math::ieee754::isfinite(mfront_values[mfront_i])){\n"
+         << "mfront_output_status->status = -4;\n"
+         << "break;\n"
+         << "}\n"
+         << "}\n";
+    }
+    os << "} // end of " << name << "_array\n\n";
+  }  // end of writeArrayFunction
+
   GenericMaterialPropertyInterfaceBase::
       ~GenericMaterialPropertyInterfaceBase() = default;
 
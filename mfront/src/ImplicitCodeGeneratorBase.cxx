@@ -11,8 +11,11 @@
  * project under specific licensing conditions.
  */
 
+#include <string>
+#include <vector>
 #include <ostream>
 #include <sstream>
+#include <algorithm>
 #include "TFEL/Glossary/Glossary.hxx"
 #include "TFEL/Glossary/GlossaryEntry.hxx"
 #include "MFront/DSLUtilities.hxx"
@@ -94,6 +97,12 @@ namespace mfront {
        << this->solver.getExternalAlgorithmClassName(this->bd, h);
   }  // end of writeBehaviourParserSpecificInheritanceRelationship
 
+  bool ImplicitCodeGeneratorBase::requiresNumericTypeConversions() const {
+    return this->bd.getAttribute<std::string>(
+               BehaviourData::jacobianComputation, "CentralDifferences") ==
+           "AutomaticDifferentiation";
+  }  // end of requiresNumericTypeConversions
+
   void ImplicitCodeGeneratorBase::writeBehaviourFriends(
       std::ostream& os, const Hypothesis h) const {
     BehaviourCodeGeneratorBase::writeBehaviourFriends(os, h);
@@ -280,6 +289,11 @@ namespace mfront {
   void ImplicitCodeGeneratorBase::writeBehaviourParserSpecificIncludes(
       std::ostream& os) const {
     this->checkBehaviourFile(os);
+    if (this->requiresNumericTypeConversions()) {
+      // the dual numbers must be declared before the solvers
+      os << "#include<memory>\n"
+         << "#include\"TFEL/Math/General/DualNumber.hxx\"\n";
+    }
     os << "#include\"TFEL/Math/Array/ViewsArray.hxx\"\n"
        << "#include\"TFEL/Math/tvector.hxx\"\n"
        << "#include\"TFEL/Math/Vector/tvectorIO.hxx\"\n"
@@ -509,6 +523,9 @@ namespace mfront {
     this->solver.writeSpecificMembers(os, this->bd, h);
     os << "SMType stiffness_matrix_type;\n";
     //
+    if (this->requiresNumericTypeConversions()) {
+      this->writeNumericTypeConversionConstructor(os, h);
+    }
     if (this->solver.usesJacobian()) {
       // compute the numerical part of the jacobian.  This method is
       // used to compute a numerical approximation of the jacobian for
@@ -986,50 +1003,381 @@ namespace mfront {
     }
   }  // end of writeComputePartialJacobianInvert
 
+  /*!
+   * \brief write the copy of a local variable from the behaviour
+   * associated with another numeric type.
+   *
+   * Local data structures, such as the one declared by the
+   * `StandardElasticity` brick, are anonymous structures which are
+   * copied member by member.
+   *
+   * \param[out] os: output stream
+   * \param[in] v: local variable
+   */
+  static void writeLocalVariableConversion(std::ostream& os,
+                                           const VariableDescription& v) {
+    auto copy = [&os](const std::string& n, const unsigned short s) {
+      if (s == 1u) {
+        os << "this->" << n << " = src." << n << ";\n";
+      } else {
+        os << "for(ushort mfront_idx = 0; mfront_idx != " << s
+           << "; ++mfront_idx){\n"
+           << "this->" << n << "[mfront_idx] = src." << n
+           << "[mfront_idx];\n"
+           << "}\n";
+      }
+    };
+    if (v.type.rfind("struct{", 0) != 0) {
+      copy(v.name, v.arraySize);
+      return;
+    }
+    // members are declared as `type name;` or `type name[size];`
+    const auto members = v.type.substr(7, v.type.size() - 8);
+    auto pos = std::string::size_type{};
+    while (true) {
+      const auto pe = members.find(';', pos);
+      if (pe == std::string::npos) {
+        break;
+      }
+      const auto m = members.substr(pos, pe - pos);
+      pos = pe + 1;
+      const auto pn = m.find_last_of(" \n");
+      auto n = m.substr(pn + 1);
+      auto s = static_cast<unsigned short>(1);
+      const auto pb = n.find('[');
+      if (pb != std::string::npos) {
+        s = static_cast<unsigned short>(std::stoi(n.substr(pb + 1)));
+        n = n.substr(0, pb);
+      }
+      copy(v.name + '.' + n, s);
+    }
+  }  // end of writeLocalVariableConversion
+
+  void ImplicitCodeGeneratorBase::writeNumericTypeConversionConstructor(
+      std::ostream& os, const Hypothesis h) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto& cn = this->bd.getClassName();
+    this->checkBehaviourFile(os);
+    os << "template<ModellingHypothesis::Hypothesis,typename,bool>\n"
+       << "friend struct " << cn << ";\n\n"
+       << "/*!\n"
+       << "* \\brief constructor from the behaviour associated with another "
+       << "numeric type\n"
+       << "*/\n"
+       << "template<typename OtherNumericType>\n"
+       << "explicit " << cn << "(const " << cn
+       << "<hypothesis, OtherNumericType, false>& src)\n"
+       << ": " << cn << "(" << cn
+       << "BehaviourData<hypothesis, NumericType, false>(src),\n"
+       << cn << "IntegrationData<hypothesis, NumericType, false>(src))\n"
+       << "{\n"
+       << "this->copyLocalVariables(src);\n"
+       << "}\n\n"
+       << "/*!\n"
+       << "* \\brief copy the iteration number and the local variables of "
+       << "the behaviour associated with another numeric type\n"
+       << "*/\n"
+       << "template<typename OtherNumericType>\n"
+       << "void copyLocalVariables(const " << cn
+       << "<hypothesis, OtherNumericType, false>& src)\n"
+       << "{\n"
+       << "this->iter = src.iter;\n";
+    for (const auto& v : d.getLocalVariables()) {
+      writeLocalVariableConversion(os, v);
+    }
+    os << "}\n\n";
+  }  // end of writeNumericTypeConversionConstructor
+
+  /*!
+   * \brief colouring of the columns of the jacobian.
+   *
+   * The columns associated with an integration variable have the same
+   * sparsity pattern, given by the list of integration variables whose
+   * derivatives with respect to this variable are not null. Two
+   * integration variables can be given the same colour if their
+   * sparsity patterns are disjoint.
+   */
+  struct JacobianColouring {
+    //! \brief for each integration variable, the list of non null rows
+    std::vector<std::vector<std::size_t>> rows;
+    //! \brief list of integration variables per colour
+    std::vector<std::vector<std::size_t>> colours;
+  };
+
+  /*!
+   * \brief greedy colouring of the columns of the jacobian
+   * \param[in] ivs: integration variables
+   * \param[in] nblocks: null jacobian blocks
+   */
+  static JacobianColouring computeJacobianColouring(
+      const VariableDescriptionContainer& ivs,
+      const std::vector<std::string>& nblocks) {
+    auto r = JacobianColouring{};
+    r.rows.resize(ivs.size());
+    for (std::size_t j = 0; j != ivs.size(); ++j) {
+      for (std::size_t i = 0; i != ivs.size(); ++i) {
+        const auto b = "df" + ivs[i].name + "_dd" + ivs[j].name;
+        if (std::find(nblocks.begin(), nblocks.end(), b) == nblocks.end()) {
+          r.rows[j].push_back(i);
+        }
+      }
+    }
+    auto are_disjoint = [&r](const std::size_t j1, const std::size_t j2) {
+      for (const auto i : r.rows[j1]) {
+        if (std::find(r.rows[j2].begin(), r.rows[j2].end(), i) !=
+            r.rows[j2].end()) {
+          return false;
+        }
+      }
+      return true;
+    };
+    for (std::size_t j = 0; j != ivs.size(); ++j) {
+      auto c = std::find_if(r.colours.begin(), r.colours.end(),
+                            [&are_disjoint, j](const auto& vars) {
+                              for (const auto v : vars) {
+                                if (!are_disjoint(v, j)) {
+                                  return false;
+                                }
+                              }
+                              return true;
+                            });
+      if (c == r.colours.end()) {
+        r.colours.push_back({j});
+      } else {
+        c->push_back(j);
+      }
+    }
+    return r;
+  }  // end of computeJacobianColouring
+
   void ImplicitCodeGeneratorBase::writeComputeNumericalJacobian(
       std::ostream& os, const Hypothesis h) const {
     const auto& d = this->bd.getBehaviourData(h);
     const auto n = d.getIntegrationVariables().getTypeSize();
     this->checkBehaviourFile(os);
+    if (this->requiresNumericTypeConversions()) {
+      os << "//! \\brief numeric type used by the automatic differentiation\n"
+         << "using MFrontDualNumberType = std::conditional_t<\n"
+         << "std::is_floating_point_v<NumericType>,\n"
+         << "tfel::math::DualNumber<NumericType, " << n << ">,\n"
+         << "NumericType>;\n"
+         << "//! \\brief behaviour instantiated with dual numbers\n"
+         << "using MFrontDualBehaviour = " << this->bd.getClassName()
+         << "<hypothesis, MFrontDualNumberType, false>;\n"
+         << "/*!\n"
+         << "* \\brief behaviour used to compute the jacobian by automatic "
+         << "differentiation.\n"
+         << "*\n"
+         << "* This behaviour is allocated at the first evaluation of the "
+         << "jacobian and reused by the following iterations.\n"
+         << "*/\n"
+         << "std::unique_ptr<MFrontDualBehaviour> mfront_ad;\n";
+    }
     os << "TFEL_HOST_DEVICE void computeNumericalJacobian("
        << "tfel::math::tmatrix<" << n << "," << n
        << ", NumericType>& njacobian)\n"
        << "{\n"
        << "using namespace std;\n"
-       << "using namespace tfel::math;\n"
-       << "tvector<" << n << ", NumericType> tzeros(this->zeros);\n"
+       << "using namespace tfel::math;\n";
+    if (this->requiresNumericTypeConversions()) {
+      // the residual is evaluated once on dual numbers whose derivatives
+      // are seeded by the identity matrix. The behaviour instantiated
+      // with dual numbers uses central differences, which stops the
+      // recursive instantiation of the behaviour.
+      os << "if constexpr (std::is_floating_point_v<NumericType>) {\n"
+         << "if (this->mfront_ad == nullptr) {\n"
+         << "// the converting constructor is private\n"
+         << "this->mfront_ad.reset(new MFrontDualBehaviour(*this));\n"
+         << "} else {\n"
+         << "// only the integration variables, the iteration number and\n"
+         << "// the local variables are modified during the iterations\n"
+         << "this->mfront_ad->copyLocalVariables(*this);\n"
+         << "}\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "this->mfront_ad->zeros(mfront_idx) = "
+         << "tfel::math::makeVariable<NumericType, " << n
+         << ">(this->zeros(mfront_idx), mfront_idx);\n"
+         << "}\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->mfront_ad->computeThermodynamicForces();\n";
+      }
+      os << "static_cast<void>(this->mfront_ad->computeFdF(true));\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << n
+         << "; ++mfront_idx2){\n"
+         << "njacobian(mfront_idx, mfront_idx2) = "
+         << "this->mfront_ad->fzeros(mfront_idx).derivatives[mfront_idx2];\n"
+         << "}\n"
+         << "}\n"
+         << "} else {\n";
+    }
+    if (this->bd.hasAttribute(h, BehaviourData::nullJacobianBlocks)) {
+      this->writeColouredNumericalJacobian(os, h);
+    } else {
+      os << "tvector<" << n << ", NumericType> tzeros(this->zeros);\n"
+         << "tvector<" << n << ", NumericType> tfzeros(this->fzeros);\n"
+         << "tmatrix<" << n << "," << n
+         << ", NumericType> tjacobian(this->jacobian);\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "this->zeros(mfront_idx) -= this->numerical_jacobian_epsilon;\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->zeros = tzeros;\n"
+         << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n"
+         << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->fzeros = "
+            "(this->fzeros-tfzeros2) / (2 * "
+            "(this->numerical_jacobian_epsilon));\n"
+         << "for(ushort mfront_idx2 = 0; mfront_idx2!= " << n
+         << "; ++mfront_idx2){\n"
+         << "njacobian(mfront_idx2,mfront_idx) = this->fzeros(mfront_idx2);\n"
+         << "}\n"
+         << "this->zeros    = tzeros;\n"
+         << "this->fzeros   = tfzeros;\n"
+         << "}\n"
+         << "if(&njacobian!=&(this->jacobian)){\n"
+         << "this->jacobian = tjacobian;\n"
+         << "}\n";
+    }
+    if (this->requiresNumericTypeConversions()) {
+      os << "}\n";
+    }
+    os << "}\n\n";
+  }  // end of writeComputeNumericalJacobian
+
+  void ImplicitCodeGeneratorBase::writeColouredNumericalJacobian(
+      std::ostream& os, const Hypothesis h) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto& ivs = d.getIntegrationVariables();
+    const auto n = ivs.getTypeSize();
+    const auto colouring = computeJacobianColouring(
+        ivs, d.getAttribute<std::vector<std::string>>(
+                 BehaviourData::nullJacobianBlocks));
+    // offsets and sizes of the integration variables
+    auto offsets = std::vector<SupportedTypes::TypeSize>{};
+    auto sizes = std::vector<SupportedTypes::TypeSize>{};
+    auto o = SupportedTypes::TypeSize{};
+    for (const auto& v : ivs) {
+      offsets.push_back(o);
+      sizes.push_back(v.getTypeSize());
+      o += v.getTypeSize();
+    }
+    auto perturb = [&os, &offsets, &sizes](const std::vector<std::size_t>& c,
+                                           const char* const op) {
+      for (const auto j : c) {
+        if (c.size() != 1) {
+          os << "if(mfront_idx < " << sizes[j] << "){\n";
+        }
+        os << "this->zeros(" << offsets[j] << " + mfront_idx) " << op
+           << " this->numerical_jacobian_epsilon;\n";
+        if (c.size() != 1) {
+          os << "}\n";
+        }
+      }
+    };
+    os << "tvector<" << n << ", NumericType> tzeros(this->zeros);\n"
        << "tvector<" << n << ", NumericType> tfzeros(this->fzeros);\n"
        << "tmatrix<" << n << "," << n
        << ", NumericType> tjacobian(this->jacobian);\n"
-       << "for(ushort mfront_idx = 0; mfront_idx != " << n
-       << "; ++mfront_idx){\n"
-       << "this->zeros(mfront_idx) -= this->numerical_jacobian_epsilon;\n";
-    if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
-      os << "this->computeThermodynamicForces();\n";
-    }
-    os << "this->computeFdF(true);\n"
-       << "this->zeros = tzeros;\n"
-       << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n"
-       << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
-    if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
-      os << "this->computeThermodynamicForces();\n";
+       << "std::fill(njacobian.begin(), njacobian.end(), NumericType(0));\n";
+    for (const auto& c : colouring.colours) {
+      os << "// colour of the columns associated with:";
+      for (const auto j : c) {
+        os << " " << ivs[j].name;
+      }
+      os << "\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != ";
+      if (c.size() == 1) {
+        os << sizes[c[0]];
+      } else {
+        os << "std::max({";
+        for (const auto j : c) {
+          os << (j == c.front() ? "" : ", ") << "static_cast<ushort>("
+             << sizes[j] << ")";
+        }
+        os << "})";
+      }
+      os << "; ++mfront_idx){\n";
+      perturb(c, "-=");
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->zeros = tzeros;\n"
+         << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n";
+      perturb(c, "+=");
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->fzeros = "
+            "(this->fzeros-tfzeros2) / (2 * "
+            "(this->numerical_jacobian_epsilon));\n";
+      for (const auto j : c) {
+        if (c.size() != 1) {
+          os << "if(mfront_idx < " << sizes[j] << "){\n";
+        }
+        for (const auto i : colouring.rows[j]) {
+          os << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << sizes[i]
+             << "; ++mfront_idx2){\n"
+             << "njacobian(" << offsets[i] << " + mfront_idx2, " << offsets[j]
+             << " + mfront_idx) = this->fzeros(" << offsets[i]
+             << " + mfront_idx2);\n"
+             << "}\n";
+        }
+        if (c.size() != 1) {
+          os << "}\n";
+        }
+      }
+      os << "this->zeros    = tzeros;\n"
+         << "this->fzeros   = tfzeros;\n"
+         << "}\n";
     }
-    os << "this->computeFdF(true);\n"
-       << "this->fzeros = "
-          "(this->fzeros-tfzeros2) / (2 * "
-          "(this->numerical_jacobian_epsilon));\n"
-       << "for(ushort mfront_idx2 = 0; mfront_idx2!= " << n
-       << "; ++mfront_idx2){\n"
-       << "njacobian(mfront_idx2,mfront_idx) = this->fzeros(mfront_idx2);\n"
-       << "}\n"
-       << "this->zeros    = tzeros;\n"
-       << "this->fzeros   = tfzeros;\n"
-       << "}\n"
-       << "if(&njacobian!=&(this->jacobian)){\n"
+    os << "if(&njacobian!=&(this->jacobian)){\n"
        << "this->jacobian = tjacobian;\n"
-       << "}\n"
-       << "}\n\n";
-  }  // end of writeComputeNumericalJacobian
+       << "}\n";
+    // report on the compression achieved
+    if (getVerboseMode() >= VERBOSE_LEVEL2) {
+      const auto dime = [h]() -> std::pair<bool, unsigned short> {
+        if (h == ModellingHypothesis::UNDEFINEDHYPOTHESIS) {
+          return {false, 3u};
+        }
+        return {true, tfel::material::getSpaceDimension(h)};
+      }();
+      auto value = [h, &dime](const SupportedTypes::TypeSize& s) {
+        return dime.first ? s.getValueForModellingHypothesis(h)
+                          : s.getValueForDimension(dime.second);
+      };
+      auto ne = 0;
+      for (const auto& c : colouring.colours) {
+        auto m = 0;
+        for (const auto j : c) {
+          m = std::max(m, value(sizes[j]));
+        }
+        ne += m;
+      }
+      auto& log = getLogStream();
+      log << this->bd.getClassName() << ": the numerical jacobian ";
+      if (dime.first) {
+        log << "for the '" << ModellingHypothesis::toString(h)
+            << "' modelling hypothesis ";
+      } else {
+        log << "in 3D ";
+      }
+      log << "requires " << ne << " pairs of evaluations of the residual "
+          << "instead of " << value(n) << " (" << colouring.colours.size()
+          << " colours for " << ivs.size() << " integration variables)\n";
+    }
+  }  // end of writeColouredNumericalJacobian
 
   void ImplicitCodeGeneratorBase::writeBehaviourIntegrator(
       std::ostream& os, const Hypothesis h) const {
@@ -1083,7 +1431,14 @@ namespace mfront {
                                              BehaviourData::Integrator);
     }
     this->solver.initializeNumericalParameters(os, this->bd, h);
-    os << "if(!this->solveNonLinearSystem()){\n";
+    if (this->bd.getAttribute(BehaviourData::profiling, false)) {
+      os << "const auto mfront_converged = this->solveNonLinearSystem();\n"
+         << this->bd.getClassName() << "Profiler::getProfiler()"
+         << ".reportNewtonIterations(this->iter, mfront_converged);\n"
+         << "if(!mfront_converged){\n";
+    } else {
+      os << "if(!this->solveNonLinearSystem()){\n";
+    }
     if (this->bd.useQt()) {
       os << "return MechanicalBehaviour<" << btype
          << ",hypothesis, NumericType, use_qt>::FAILURE;\n";
@@ -125,6 +125,8 @@ namespace mfront {
     this->registerNewCallBack(
         "@JacobianComparisonCriterium",
         &ImplicitDSLBase::treatJacobianComparisonCriterion);
+    this->registerNewCallBack("@JacobianComputation",
+                              &ImplicitDSLBase::treatJacobianComputation);
     this->registerNewCallBack(
         "@MaximumIncrementValuePerIteration",
         &ImplicitDSLBase::treatMaximumIncrementValuePerIteration);
@@ -137,6 +139,8 @@ namespace mfront {
     this->registerNewCallBack(
         "@NumericallyComputedJacobianBlocks",
         &ImplicitDSLBase::treatNumericallyComputedJacobianBlocks);
+    this->registerNewCallBack("@NullJacobianBlocks",
+                              &ImplicitDSLBase::treatNullJacobianBlocks);
     this->registerNewCallBack("@HillTensor", &ImplicitDSLBase::treatHillTensor);
     this->disableCallBack("@ComputedVar");
     //    this->disableCallBack("@UseQt");
@@ -465,6 +469,24 @@ namespace mfront {
                              ";");
   }  // end of treatCompareToNumericalJacobian
 
+  void ImplicitDSLBase::treatJacobianComputation() {
+    this->checkNotEndOfFile(
+        "ImplicitDSLBase::treatJacobianComputation",
+        "Expected 'CentralDifferences' or 'AutomaticDifferentiation'.");
+    const auto m = this->current->value;
+    if ((m != "CentralDifferences") && (m != "AutomaticDifferentiation")) {
+      this->throwRuntimeError(
+          "ImplicitDSLBase::treatJacobianComputation",
+          "Expected to read 'CentralDifferences' or "
+          "'AutomaticDifferentiation' instead of '" +
+              m + "'.");
+    }
+    ++(this->current);
+    this->readSpecifiedToken("ImplicitDSLBase::treatJacobianComputation",
+                             ";");
+    this->mb.setAttribute(BehaviourData::jacobianComputation, m, false);
+  }  // end of treatJacobianComputation
+
   void ImplicitDSLBase::treatJacobianComparisonCriterion() {
     const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     if (!this->mb.getAttribute(h, BehaviourData::compareToNumericalJacobian,
@@ -1058,8 +1080,18 @@ namespace mfront {
   }  // end of treatMaximumIncrementValuePerIteration
 
   void ImplicitDSLBase::treatNumericallyComputedJacobianBlocks() {
-    const std::string m =
-        "ImplicitDSLBase::treatNumericallyComputedJacobianBlocks";
+    this->readJacobianBlocks(
+        "ImplicitDSLBase::treatNumericallyComputedJacobianBlocks",
+        BehaviourData::numericallyComputedJacobianBlocks);
+  }  // end of treatNumericallyComputedJacobianBlocks
+
+  void ImplicitDSLBase::treatNullJacobianBlocks() {
+    this->readJacobianBlocks("ImplicitDSLBase::treatNullJacobianBlocks",
+                             BehaviourData::nullJacobianBlocks);
+  }  // end of treatNullJacobianBlocks
+
+  void ImplicitDSLBase::readJacobianBlocks(const std::string& m,
+                                           const char* const a) {
     auto throw_if = [this, m](const bool b, const std::string& msg) {
       if (b) {
         this->throwRuntimeError(m, msg);
@@ -1094,23 +1126,19 @@ namespace mfront {
         throw_if(std::count(jbs.begin(), jbs.end(), jb) > 1,
                  "jacobian block '" + jb + "' multiply delcared");
       }
-      if (this->mb.hasAttribute(
-              h, BehaviourData::numericallyComputedJacobianBlocks)) {
-        auto cjbs = this->mb.getAttribute<std::vector<std::string>>(
-            h, BehaviourData::numericallyComputedJacobianBlocks);
+      if (this->mb.hasAttribute(h, a)) {
+        auto cjbs = this->mb.getAttribute<std::vector<std::string>>(h, a);
         for (const auto& jb : jbs) {
           throw_if(std::find(cjbs.begin(), cjbs.end(), jb) != cjbs.end(),
                    "jacobian block '" + jb + "' multiply delcared");
           cjbs.push_back(jb);
         }
-        this->mb.updateAttribute(
-            h, BehaviourData::numericallyComputedJacobianBlocks, cjbs);
+        this->mb.updateAttribute(h, a, cjbs);
       } else {
-        this->mb.setAttribute(
-            h, BehaviourData::numericallyComputedJacobianBlocks, jbs);
+        this->mb.setAttribute(h, a, jbs);
       }
     }
-  }  // end of treatNumericallyComputedJacobianBlocks
+  }  // end of readJacobianBlocks
 
   void ImplicitDSLBase::completeVariableDeclaration() {
     using namespace tfel::glossary;
@@ -1350,10 +1378,65 @@ namespace mfront {
                "@CompareToNumericalJacobian can only be used with solver using "
                "an analytical jacobian (or an approximation of it");
     }
+    if (this->mb.getAttribute<std::string>(BehaviourData::jacobianComputation,
+                                           "CentralDifferences") ==
+        "AutomaticDifferentiation") {
+      throw_if(!this->solver->usesJacobian(),
+               "the jacobian can only be computed by automatic "
+               "differentiation with solvers using the jacobian");
+      throw_if(this->mb.useQt(),
+               "the jacobian can't be computed by automatic "
+               "differentiation when quantities are used");
+    }
     // create the compute final stress code is necessary
     this->setComputeFinalThermodynamicForcesFromComputeFinalThermodynamicForcesCandidateIfNecessary();
+    auto decompose =
+        [throw_if](
+            const std::string& jb) -> std::pair<std::string, std::string> {
+      throw_if(jb.empty(), "empty jacobian block");
+      throw_if(jb.size() < 6, "invalid jacobian block '" + jb + "'");
+      throw_if(jb[0] != 'd', "invalid jacobian block '" + jb + "'");
+      throw_if(jb[1] != 'f', "invalid jacobian block '" + jb + "'");
+      const auto p = jb.find('_');
+      throw_if(p == std::string::npos,
+               "invalid jacobian block '" + jb + "'");
+      throw_if(p + 2 >= jb.size(), "invalid jacobian block '" + jb + "'");
+      throw_if(jb[p + 1] != 'd', "invalid jacobian block '" + jb + "'");
+      throw_if(jb[p + 2] != 'd', "invalid jacobian block '" + jb + "'");
+      const auto n = jb.substr(2, p - 2);
+      const auto d = jb.substr(p + 3);
+      throw_if(n.empty(), "invalid jacobian block '" + jb + "'");
+      throw_if(d.empty(), "invalid jacobian block '" + jb + "'");
+      return {n, d};
+    };
+    auto check_jacobian_blocks = [this, throw_if, decompose](
+                                     const Hypothesis h,
+                                     const std::vector<std::string>& jbs) {
+      for (const auto& jb : jbs) {
+        const auto nd = decompose(jb);
+        throw_if(!this->mb.isIntegrationVariableName(h, nd.first),
+                 "invalid jacobian block '" + jb + "', '" + nd.first +
+                     "' is not an integration variable");
+        throw_if(!this->mb.isIntegrationVariableName(h, nd.second),
+                 "invalid jacobian block '" + jb + "', '" + nd.second +
+                     "' is not an integration variable");
+      }
+    };
     // correct prediction to take into account normalisation factors
     for (const auto& h : mh) {
+      if (this->mb.hasAttribute(h, BehaviourData::nullJacobianBlocks)) {
+        throw_if(!this->solver->requiresNumericalJacobian(),
+                 "null jacobian blocks can only be declared for solvers "
+                 "using a numerical jacobian");
+        throw_if(this->mb.getAttribute<std::string>(
+                     BehaviourData::jacobianComputation,
+                     "CentralDifferences") != "CentralDifferences",
+                 "null jacobian blocks can only be declared if the jacobian "
+                 "is computed by central differences");
+        check_jacobian_blocks(
+            h, this->mb.getAttribute<std::vector<std::string>>(
+                   h, BehaviourData::nullJacobianBlocks));
+      }
       if (this->mb.hasAttribute(
               h, BehaviourData::numericallyComputedJacobianBlocks)) {
         throw_if((!this->solver->usesJacobian()) ||
@@ -1361,40 +1444,9 @@ namespace mfront {
                  "numerically computed jacobian blocks can only be "
                  "used with solver using an analytical jacobian "
                  "(or an approximation of it");
-        auto decompose =
-            [throw_if](
-                const std::string& jb) -> std::pair<std::string, std::string> {
-          throw_if(jb.empty(), "empty jacobian block");
-          throw_if(jb.size() < 6, "invalid jacobian block '" + jb + "'");
-          throw_if(jb[0] != 'd', "invalid jacobian block '" + jb + "'");
-          throw_if(jb[1] != 'f', "invalid jacobian block '" + jb + "'");
-          const auto p = jb.find('_');
-          throw_if(p == std::string::npos,
-                   "invalid jacobian block '" + jb + "'");
-          throw_if(p + 2 >= jb.size(), "invalid jacobian block '" + jb + "'");
-          throw_if(jb[p + 1] != 'd', "invalid jacobian block '" + jb + "'");
-          throw_if(jb[p + 2] != 'd', "invalid jacobian block '" + jb + "'");
-          const auto n = jb.substr(2, p - 2);
-          const auto d = jb.substr(p + 3);
-          throw_if(n.empty(), "invalid jacobian block '" + jb + "'");
-          throw_if(d.empty(), "invalid jacobian block '" + jb + "'");
-          return {n, d};
-        };
-        const auto& jbs = this->mb.getAttribute<std::vector<std::string>>(
-            h, BehaviourData::numericallyComputedJacobianBlocks);
-        for (const auto& jb : jbs) {
-          const auto nd = decompose(jb);
-          throw_if(!this->mb.isIntegrationVariableName(h, nd.first),
-                   "invalid jacobian block '" + jb +
-                       "', "
-                       "'" +
-                       nd.first + "' is not an integration variable");
-          throw_if(!this->mb.isIntegrationVariableName(h, nd.second),
-                   "invalid jacobian block '" + jb +
-                       "', "
-                       "'" +
-                       nd.second + "' is not an integration variable");
-        }
+        check_jacobian_blocks(
+            h, this->mb.getAttribute<std::vector<std::string>>(
+                   h, BehaviourData::numericallyComputedJacobianBlocks));
       }
       if (this->mb.hasCode(h, BehaviourData::ComputePredictor)) {
         CodeBlock predictor;
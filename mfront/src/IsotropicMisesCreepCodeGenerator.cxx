@@ -86,7 +86,8 @@ namespace mfront {
          << "<< iter << \" : \" << tfel::math::abs(newton_f) "
             "<< '\\n';\n";
     }
-    os << "converged = (tfel::math::abs(newton_f) < (this->epsilon));\n"
+    os << "converged = static_cast<bool>(tfel::math::abs(newton_f) < "
+          "(this->epsilon));\n"
        << "} else {\n";
     if (getDebugMode()) {
       os << "std::cout << \"" << this->bd.getClassName()
@@ -96,7 +96,8 @@ namespace mfront {
          << "::NewtonIntegration() : iteration \" "
          << "<< iter << \" : \" << tfel::math::abs(newton_f) << std::endl;\n";
     }
-    os << "converge = tfel::math::abs(newton_f) < this->epsilon;\n"
+    os << "converge = static_cast<bool>(tfel::math::abs(newton_f) < "
+          "this->epsilon);\n"
        << "} else {\n";
     if (getDebugMode()) {
       os << "std::cout << \"" << this->bd.getClassName()
@@ -46,6 +46,8 @@
 #include "MFront/ModelInterfaceFactory.hxx"
 #include "MFront/MFrontLock.hxx"
 #include "MFront/MFrontDebugMode.hxx"
+#include "MFront/CompilationCache.hxx"
+#include "MFront/SearchPathsHandler.hxx"
 #include "MFront/MFrontUtilities.hxx"
 #include "MFront/CMakeGenerator.hxx"
 #include "MFront/MakefileGenerator.hxx"
@@ -482,6 +484,36 @@ namespace mfront {
                               "generate build file and clean libraries");
     this->registerNewCallBack("--generator", "-G", &MFront::treatGenerator,
                               "choose build system", true);
+    this->registerCallBack(
+        "--jobs", "-j",
+        CallBack(
+            "set the number of compilations run in parallel while building "
+            "the libraries (by default, the number of available cores)",
+            [this] {
+              const auto& o = this->currentArgument->getOption();
+              try {
+                const auto n = std::stoi(o);
+                tfel::raise_if((n <= 0) || (n > 1024),
+                               "invalid number of jobs");
+                this->opts.jobs = static_cast<unsigned short>(n);
+              } catch (std::exception&) {
+                tfel::raise(
+                    "MFront::registerArgumentCallBacks: "
+                    "invalid number of jobs '" +
+                    o + "'");
+              }
+            },
+            true));
+    this->registerCallBack(
+        "--cache-directory",
+        CallBack(
+            "specify a directory used to cache generated sources and object "
+            "files (see also the MFRONT_CACHE_DIRECTORY environment variable)",
+            [this] {
+              CompilationCache::getCompilationCache().setDirectory(
+                  this->currentArgument->getOption());
+            },
+            true));
 
     this->registerCallBack("--list-material-property-interfaces",
                            CallBack(
@@ -768,7 +800,54 @@ namespace mfront {
   }  // end of void MFront::treatDefFile
 #endif /* (defined _WIN32 || defined _WIN64 ||defined __CYGWIN__) */
 
+  std::string MFront::getCompilationCacheOptionsDescription() const {
+    auto d = std::string{};
+    for (const auto& a : this->args) {
+      const auto& n = static_cast<const std::string&>(a);
+      // input files and options which do not affect the generated files
+      if ((n.empty()) || (n[0] != '-') || (n == "--verbose") ||
+          (n == "--cache-directory")) {
+        continue;
+      }
+      d += n + '=' + a.getOption() + '\n';
+    }
+    for (const auto& p : SearchPathsHandler::getSearchPaths()) {
+      d += "search path: " + p + '\n';
+    }
+    return d;
+  }  // end of getCompilationCacheOptionsDescription
+
   TargetsDescription MFront::treatFile(const std::string& f) const {
+    auto& cache = CompilationCache::getCompilationCache();
+    const auto k =
+        cache.getKey(f, this->getCompilationCacheOptionsDescription());
+    if (k.empty()) {
+      return this->generateOutputFiles(f);
+    }
+    {
+      auto td = TargetsDescription{};
+      if (cache.restore(td, k)) {
+        if (getVerboseMode() >= VERBOSE_LEVEL2) {
+          getLogStream() << "File '" << f << "' restored from cache"
+                         << std::endl;
+        }
+        return td;
+      }
+    }
+    cache.startRecording();
+    const auto td = [this, &cache, &f] {
+      try {
+        return this->generateOutputFiles(f);
+      } catch (...) {
+        cache.stopRecording();
+        throw;
+      }
+    }();
+    cache.store(k, td);
+    return td;
+  }  // end of MFront::treatFile()
+
+  TargetsDescription MFront::generateOutputFiles(const std::string& f) const {
     if (getVerboseMode() >= VERBOSE_LEVEL2) {
       getLogStream() << "Treating file: '" << f << "'" << std::endl;
     }
@@ -789,7 +868,7 @@ namespace mfront {
       }
     }
     return td;
-  }  // end of MFront::treatFile()
+  }  // end of MFront::generateOutputFiles()
 
   void MFront::analyseTargetsFile() {
     using tfel::system::dirStringSeparator;
@@ -819,7 +898,8 @@ namespace mfront {
     if (this->generator == CMAKE) {
       callCMake(target);
     } else {
-      callMake(target);
+      compileObjectFiles(this->targets, target, this->opts);
+      callMake(target, "src", "Makefile.mfront", this->opts.jobs);
     }
   }  // end of MFront::buildLibraries
 
@@ -949,12 +1029,23 @@ namespace mfront {
     if ((this->buildLibs) &&
         ((has_libs) || (!this->targets.specific_targets.empty()))) {
       auto& log = getLogStream();
+      // object files are only cached with the make generator
+      auto& cache = CompilationCache::getCompilationCache();
+      const auto use_cache = cache.isEnabled() && (this->generator == MAKE);
+      const auto ok =
+          use_cache ? cache.getObjectsKey(this->targets, this->opts) : "";
+      if (use_cache) {
+        cache.restoreObjects(ok);
+      }
       for (const auto& t : this->specifiedTargets) {
         if (getVerboseMode() >= VERBOSE_LEVEL0) {
           log << "Treating target : " << t << std::endl;
         }
         this->buildLibraries(t);
       }
+      if (use_cache) {
+        cache.storeObjects(ok);
+      }
       if (getVerboseMode() >= VERBOSE_LEVEL0) {
         if (has_libs) {
           if (this->targets.libraries.end() - this->targets.libraries.begin() ==
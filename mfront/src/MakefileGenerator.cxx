@@ -11,11 +11,17 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
 #include <set>
 #include <cstring>
 #include <ostream>
 #include <sstream>
 #include <fstream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cerrno>
+#include <cstdlib>
 #include <iterator>
 #include <algorithm>
 
@@ -553,47 +559,247 @@ namespace mfront {
     m.close();
   }
 
-  void callMake(const std::string& t,
-                const std::string& d,
-                const std::string& f) {
-    const char* make = getMakeCommand();
-    const char* silent = getDebugMode() ? nullptr : "-s";
-    const char* const argv[] = {make,      "-C",      d.c_str(), "-f",
-                                f.c_str(), t.c_str(), silent,    nullptr};
-    auto error = [&argv, &t](const std::string& e) {
-      auto msg = "callMake: can't build target '" + t + "'\n";
+  //! \return true if a job server is provided by a parent `make` process
+  static bool hasJobServer() {
+    const auto flags = ::getenv("MAKEFLAGS");
+    return (flags != nullptr) &&
+           (std::strstr(flags, "--jobserver") != nullptr);
+  }  // end of hasJobServer
+
+  //! \return the number of jobs to be used
+  static unsigned short getNumberOfJobs(const unsigned short n) {
+    if (n != 0) {
+      return n;
+    }
+    const auto nc = std::thread::hardware_concurrency();
+    return nc == 0 ? 1 : static_cast<unsigned short>(std::min(nc, 1024u));
+  }  // end of getNumberOfJobs
+
+  /*!
+   * \return the arguments of the `make` command
+   * \param[in] t : targets
+   * \param[in] d : directory
+   * \param[in] f : file name
+   * \param[in] n : number of jobs
+   */
+  static std::vector<std::string> getMakeArguments(
+      const std::vector<std::string>& t,
+      const std::string& d,
+      const std::string& f,
+      const unsigned short n) {
+    auto args = std::vector<std::string>{getMakeCommand(), "-C", d, "-f", f};
+    if (!hasJobServer()) {
+      const auto nj = getNumberOfJobs(n);
+      if (nj != 1) {
+        args.push_back("-j" + std::to_string(nj));
+      }
+    }
+    args.insert(args.end(), t.begin(), t.end());
+    if (!getDebugMode()) {
+      args.push_back("-s");
+    }
+    return args;
+  }  // end of getMakeArguments
+
+  //! \return the command line associated with the given arguments
+  static std::string getCommandLine(const std::vector<std::string>& args) {
+    auto c = std::string{};
+    for (const auto& a : args) {
+      c += a + ' ';
+    }
+    return c;
+  }  // end of getCommandLine
+
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+  /*!
+   * \brief start a new `make` process
+   * \return the identifier of the process
+   * \param[in] args : arguments
+   */
+  static pid_t startMake(const std::vector<std::string>& args) {
+    auto argv = std::vector<const char*>{};
+    for (const auto& a : args) {
+      argv.push_back(a.c_str());
+    }
+    argv.push_back(nullptr);
+    const auto child_pid = fork();
+    if (child_pid == 0) {
+      execvp(argv[0], const_cast<char* const*>(argv.data()));
+      ::_exit(EXIT_FAILURE);
+    }
+    tfel::raise_if(child_pid == -1,
+                   "startMake: can't create a new process\n"
+                   "Command was: " +
+                       getCommandLine(args));
+    return child_pid;
+  }  // end of startMake
+
+  //! \return true if the given status denotes a successful process
+  static bool succeeded(const int status) {
+    return (WIFEXITED(status)) && (WEXITSTATUS(status) == 0);
+  }  // end of succeeded
+#endif
+
+  /*!
+   * \brief call the `make` utility
+   * \param[in] t : targets
+   * \param[in] d : directory
+   * \param[in] f : file name
+   * \param[in] n : number of jobs
+   */
+  static void runMake(const std::vector<std::string>& t,
+                      const std::string& d,
+                      const std::string& f,
+                      const unsigned short n) {
+    tfel::raise_if(::strlen(getMakeCommand()) == 0u,
+                   "callMake: empty make command");
+    const auto args = getMakeArguments(t, d, f, n);
+    auto error = [&args, &t](const std::string& e) {
+      auto msg = "callMake: can't build target '" + getCommandLine(t);
+      msg.back() = '\'';
+      msg += '\n';
       if (!e.empty()) {
         msg += e + '\n';
       }
-      msg += "Command was: ";
-      for (const char* const* a = argv; *a != nullptr; ++a) {
-        msg += *a;
-        msg += ' ';
-      }
+      msg += "Command was: " + getCommandLine(args);
       tfel::raise(msg);
     };
-    tfel::raise_if(::strlen(make) == 0u, "callMake: empty make command");
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    if (_spawnvp(_P_WAIT, make, argv) != 0) {
+    auto argv = std::vector<const char*>{};
+    for (const auto& a : args) {
+      argv.push_back(a.c_str());
+    }
+    argv.push_back(nullptr);
+    if (_spawnvp(_P_WAIT, argv[0], argv.data()) != 0) {
       error("");
     }
 #else
-    const auto child_pid = fork();
-    if (child_pid != 0) {
+    const auto child_pid = startMake(args);
+    int status;
+    if (::waitpid(child_pid, &status, 0) == -1) {
+      error(
+          "something went wrong while "
+          "waiting end of make process");
+    }
+    if (!succeeded(status)) {
+      error("libraries building went wrong");
+    }
+#endif
+  }  // end of runMake
+
+  void callMake(const std::string& t,
+                const std::string& d,
+                const std::string& f) {
+    runMake({t}, d, f, 1);
+  }  // end of callMake
+
+  void callMake(const std::string& t,
+                const std::string& d,
+                const std::string& f,
+                const unsigned short n) {
+    runMake({t}, d, f, n);
+  }  // end of callMake
+
+  void compileObjectFiles(const TargetsDescription& t,
+                          const std::string& n,
+                          const GeneratorOptions& o,
+                          const std::string& d,
+                          const std::string& f) {
+    using clock = std::chrono::steady_clock;
+    if (hasJobServer()) {
+      return;
+    }
+    auto objects = std::set<std::string>{};
+    auto makefiles = std::set<std::string>{};
+    for (const auto& l : t.libraries) {
+      if ((n != "all") && (n != l.name) && (n != getLibraryFullName(l))) {
+        continue;
+      }
+      for (const auto& src : l.sources) {
+        for (const auto ext : {".cxx", ".cpp", ".c"}) {
+          if (tfel::utilities::ends_with(src, ext)) {
+            const auto b = src.substr(0, src.size() - std::strlen(ext));
+            objects.insert(b + ".o");
+            makefiles.insert(b + ".d");
+            break;
+          }
+        }
+      }
+    }
+    if (objects.empty()) {
+      return;
+    }
+    const auto nj = getNumberOfJobs(o.jobs);
+    if (!o.nodeps) {
+      // the dependencies are updated once, so that the make processes
+      // launched below do not update them concurrently
+      runMake({makefiles.begin(), makefiles.end()}, d, f, nj);
+    }
+    auto report = [](const std::string& obj, const clock::duration dt) {
+      if (getVerboseMode() >= VERBOSE_LEVEL2) {
+        const auto s = std::chrono::duration<double>(dt).count();
+        getLogStream() << "compilation of '" << obj << "': " << s << "s\n";
+      }
+    };
+    auto failures = std::vector<std::string>{};
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    for (const auto& obj : objects) {
+      const auto start = clock::now();
+      try {
+        callMake(obj, d, f, 1);
+      } catch (std::exception&) {
+        failures.push_back(obj);
+        break;
+      }
+      report(obj, clock::now() - start);
+    }
+#else
+    using Process = std::pair<std::string, clock::time_point>;
+    auto running = std::map<pid_t, Process>{};
+    auto next = objects.begin();
+    while ((next != objects.end()) || (!running.empty())) {
+      // no new compilation is started after a failure
+      while ((failures.empty()) && (next != objects.end()) &&
+             (running.size() < nj)) {
+        const auto pid = startMake(getMakeArguments({*next}, d, f, 1));
+        running.insert({pid, {*next, clock::now()}});
+        ++next;
+      }
+      if (running.empty()) {
+        break;
+      }
       int status;
-      if (wait(&status) == -1) {
-        error(
-            "something went wrong while "
-            "waiting end of make process");
+      const auto pid = ::waitpid(-1, &status, 0);
+      if (pid == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        tfel::raise(
+            "compileObjectFiles: something went wrong while "
+            "waiting end of make processes");
       }
-      if (status != 0) {
-        error("libraries building went wrong");
+      const auto p = running.find(pid);
+      if (p == running.end()) {
+        continue;
       }
-    } else {
-      execvp(make, const_cast<char* const*>(argv));
-      ::exit(EXIT_FAILURE);
+      if (succeeded(status)) {
+        report(p->second.first, clock::now() - p->second.second);
+      } else {
+        failures.push_back(p->second.first);
+      }
+      running.erase(p);
     }
 #endif
-  }
+    if (!failures.empty()) {
+      auto msg = std::string{"compileObjectFiles: compilation of "};
+      for (auto pf = failures.begin(); pf != failures.end();) {
+        msg += "'" + *pf + "'";
+        if (++pf != failures.end()) {
+          msg += ", ";
+        }
+      }
+      tfel::raise(msg + " failed");
+    }
+  }  // end of compileObjectFiles
 
 }  // end of namespace mfront
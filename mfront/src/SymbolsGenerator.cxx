@@ -11,6 +11,8 @@
  * project under specific licensing conditions.
  */
 
+#include <vector>
+#include <string>
 #include <sstream>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetTFELVersion.h"
@@ -30,6 +32,34 @@ namespace mfront {
     return bd.isTemperatureDefinedAsTheFirstExternalStateVariable();
   }  // end of shallRemoveTemperatureFromExternalStateVariables
 
+  /*!
+   * \brief write a table listing the names and the addresses of the
+   * given symbols. This table allows the `ExternalLibraryManager` class to
+   * retrieve all those symbols at once.
+   * \param[out] out: output stream
+   * \param[in] n: name of the table
+   * \param[in] symbols: exported symbols
+   */
+  static void writeMetadataTable(std::ostream& out,
+                                 const std::string& n,
+                                 const std::vector<std::string>& symbols) {
+    if (symbols.empty()) {
+      return;
+    }
+    out << "#include \"TFEL/System/MetadataTable.h\"\n\n"
+        << "static const mfront_metadata_entry " << n << "_entries[] = {\n";
+    for (const auto& s : symbols) {
+      out << "  {\"" << s << "\", &" << s << "},\n";
+    }
+    // the table is not declared const, as the other exported symbols: the
+    // visibility attribute is ignored for const variables
+    out << "};\n\n"
+        << "MFRONT_EXPORT_SYMBOL(mfront_metadata_table, " << n << ",\n"
+        << "                     MFRONT_EXPORT_ARRAY_ARGUMENTS({"
+        << "MFRONT_METADATA_TABLE_VERSION, " << symbols.size() << "u, " << n
+        << "_entries}));\n\n";
+  }  // end of writeMetadataTable
+
   std::string SymbolsGenerator::getSymbolName(const BehaviourInterfaceBase& i,
                                               const std::string& n,
                                               const Hypothesis h) const {
@@ -45,26 +75,31 @@ namespace mfront {
                                                 const FileDescription& fd,
                                                 const std::set<Hypothesis>& mhs,
                                                 const std::string& name) const {
-    this->writeFileDescriptionSymbols(out, i, fd, name);
-    this->writeValidatorSymbol(out, i, bd, name);
-    this->writeBuildIdentifierSymbol(out, i, bd, name);
-    this->writeEntryPointSymbol(out, i, name);
-    this->writeTFELVersionSymbol(out, i, name);
-    this->writeUnitSystemSymbol(out, i, name, bd);
-    this->writeMaterialSymbol(out, i, bd, name);
-    this->writeMaterialKnowledgeTypeSymbol(out, i, name);
-    this->writeInterfaceNameSymbols(out, i, bd, fd, name);
-    this->writeSourceFileSymbols(out, i, bd, fd, name);
-    this->writeSupportedModellingHypothesis(out, i, bd, mhs, name);
-    this->writeMainVariablesSymbols(out, i, bd, name);
-    this->writeTangentOperatorSymbols(out, i, bd, name);
-    this->writeBehaviourTypeSymbols(out, i, bd, name);
-    this->writeBehaviourKinematicSymbols(out, i, bd, name);
-    this->writeSymmetryTypeSymbols(out, i, bd, name);
-    this->writeElasticSymmetryTypeSymbols(out, i, bd, name);
-    this->writeSpecificSymbols(out, i, bd, fd, name);
-    this->writeTemperatureRemovedFromExternalStateVariablesSymbol(out, i, bd,
+    auto os = SymbolsOutputStream{};
+    os.copyfmt(out);
+    this->writeFileDescriptionSymbols(os, i, fd, name);
+    this->writeValidatorSymbol(os, i, bd, name);
+    this->writeBuildIdentifierSymbol(os, i, bd, name);
+    this->writeEntryPointSymbol(os, i, name);
+    this->writeTFELVersionSymbol(os, i, name);
+    this->writeUnitSystemSymbol(os, i, name, bd);
+    this->writeMaterialSymbol(os, i, bd, name);
+    this->writeMaterialKnowledgeTypeSymbol(os, i, name);
+    this->writeInterfaceNameSymbols(os, i, bd, fd, name);
+    this->writeSourceFileSymbols(os, i, bd, fd, name);
+    this->writeSupportedModellingHypothesis(os, i, bd, mhs, name);
+    this->writeMainVariablesSymbols(os, i, bd, name);
+    this->writeTangentOperatorSymbols(os, i, bd, name);
+    this->writeBehaviourTypeSymbols(os, i, bd, name);
+    this->writeBehaviourKinematicSymbols(os, i, bd, name);
+    this->writeSymmetryTypeSymbols(os, i, bd, name);
+    this->writeElasticSymmetryTypeSymbols(os, i, bd, name);
+    this->writeSpecificSymbols(os, i, bd, fd, name);
+    this->writeTemperatureRemovedFromExternalStateVariablesSymbol(os, i, bd,
                                                                   name);
+    out << os.str();
+    writeMetadataTable(out, i.getFunctionNameBasis(name) + "_mfront_metadata",
+                       os.symbols);
   }
 
   void SymbolsGenerator::writeFileDescriptionSymbols(
@@ -315,20 +350,26 @@ namespace mfront {
                                          const FileDescription& fd,
                                          const std::string& name,
                                          const Hypothesis h) const {
-    this->writeIsUsableInPurelyImplicitResolutionSymbols(out, i, bd, name, h);
-    this->writeMaterialPropertiesSymbols(out, i, bd, name, h);
-    this->writeStateVariablesSymbols(out, i, bd, name, h);
-    this->writeExternalStateVariablesSymbols(out, i, bd, name, h);
-    this->writeParametersSymbols(out, i, bd, name, h);
-    this->writeParameterDefaultValueSymbols(out, i, bd, name, h);
-    this->writeBoundsSymbols(out, i, bd, name, h);
-    this->writePhysicalBoundsSymbols(out, i, bd, name, h);
-    this->writeRequirementsSymbols(out, i, bd, name, h);
-    this->writeInitializeFunctionsSymbols(out, i, bd, name, h);
-    this->writePostProcessingsSymbols(out, i, bd, name, h);
-    this->writeAdditionalSymbols(out, i, bd, fd, name, h);
-    this->writeComputesInternalEnergySymbol(out, i, bd, name, h);
-    this->writeComputesDissipatedEnergySymbol(out, i, bd, name, h);
+    auto os = SymbolsOutputStream{};
+    os.copyfmt(out);
+    this->writeIsUsableInPurelyImplicitResolutionSymbols(os, i, bd, name, h);
+    this->writeMaterialPropertiesSymbols(os, i, bd, name, h);
+    this->writeStateVariablesSymbols(os, i, bd, name, h);
+    this->writeExternalStateVariablesSymbols(os, i, bd, name, h);
+    this->writeParametersSymbols(os, i, bd, name, h);
+    this->writeParameterDefaultValueSymbols(os, i, bd, name, h);
+    this->writeBoundsSymbols(os, i, bd, name, h);
+    this->writePhysicalBoundsSymbols(os, i, bd, name, h);
+    this->writeRequirementsSymbols(os, i, bd, name, h);
+    this->writeInitializeFunctionsSymbols(os, i, bd, name, h);
+    this->writePostProcessingsSymbols(os, i, bd, name, h);
+    this->writeAdditionalSymbols(os, i, bd, fd, name, h);
+    this->writeComputesInternalEnergySymbol(os, i, bd, name, h);
+    this->writeComputesDissipatedEnergySymbol(os, i, bd, name, h);
+    out << os.str();
+    writeMetadataTable(
+        out, this->getSymbolName(i, name, h) + "_mfront_hypothesis_metadata",
+        os.symbols);
   }
 
   void SymbolsGenerator::writeComputesInternalEnergySymbol(
@@ -472,6 +513,8 @@ namespace mfront {
         }
         return s;
       }();
+      recordExportedSymbol(out, this->getSymbolName(i, name, h) + "_" +
+                                    variables_identifier + "Types");
       out << "MFRONT_EXPORT_ARRAY_OF_SYMBOLS(int, "
           << this->getSymbolName(i, name, h) << "_" << variables_identifier
           << "Types, " << size << ", MFRONT_EXPORT_ARRAY_ARGUMENTS(";
@@ -489,9 +532,10 @@ namespace mfront {
       }
       out << "));\n\n";
     } else {
-      out << "MFRONT_EXPORT_SYMBOL(const int *, "
-          << this->getSymbolName(i, name, h) << "_" << variables_identifier
-          << "Types, nullptr);\n\n";
+      exportSymbol(out, "const int *",
+                   this->getSymbolName(i, name, h) + "_" +
+                       variables_identifier + "Types",
+                   "nullptr");
     }
   }  // end of writeVariablesTypesSymbol
 
@@ -505,9 +549,9 @@ namespace mfront {
     const auto& persistentVarsHolder = d.getPersistentVariables();
     const unsigned short nStateVariables = static_cast<unsigned short>(
         persistentVarsHolder.getNumberOfVariables());
-    out << "MFRONT_EXPORT_SYMBOL(unsigned short, "
-        << this->getSymbolName(i, name, h) << "_nInternalStateVariables, "
-        << nStateVariables << "u);\n";
+    exportUnsignedShortSymbol(
+        out, this->getSymbolName(i, name, h) + "_nInternalStateVariables",
+        nStateVariables);
     std::vector<std::string> stateVariablesNames;
     mb.getExternalNames(stateVariablesNames, h, persistentVarsHolder);
     this->writeExternalNames(out, i, name, h, stateVariablesNames,
@@ -528,9 +572,9 @@ namespace mfront {
       // removing the temperature
       esvs.erase(esvs.begin());
     }
-    out << "MFRONT_EXPORT_SYMBOL(unsigned short, "
-        << this->getSymbolName(i, name, h) << "_nExternalStateVariables, "
-        << esvs.getNumberOfVariables() << "u);\n";
+    exportUnsignedShortSymbol(
+        out, this->getSymbolName(i, name, h) + "_nExternalStateVariables",
+        static_cast<unsigned short>(esvs.getNumberOfVariables()));
     this->writeExternalNames(out, i, name, h, mb.getExternalNames(h, esvs),
                              "ExternalStateVariables");
     this->writeVariablesTypesSymbol(out, i, name, h, esvs,
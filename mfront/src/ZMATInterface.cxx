@@ -832,6 +832,10 @@ namespace mfront {
     // handled by the constructors
   }
 
+  void ZMATInterface::writeBehaviourConstructorParametersOverrides(
+      std::ostream&, const BehaviourDescription&, const Hypothesis) const {
+  }  // end of writeBehaviourConstructorParametersOverrides
+
   void ZMATInterface::writeBehaviourInitializeFunctions(
       std::ostream&, const BehaviourDescription&, const Hypothesis) const {
   }  // end of writeBehaviourInitializeFunctions
@@ -0,0 +1,443 @@
+/*!
+ * \file   BehaviourIntegrationBenchmark.cxx
+ * \brief  This file measures the throughput of the integration of a
+ * representative set of behaviours through the `generic` interface.
+ *
+ * Each behaviour is integrated over one time step for a large set of
+ * points, starting from the same initial state and subjected to random
+ * gradient increments. The results are printed on the standard output
+ * and written in a `JSON` file, so that they can be compared between
+ * two versions of `TFEL`. The integration over the whole set of points
+ * through the `integrateBatch` function is also measured, which allows
+ * to assess the behaviours integrated by blocks of points in lock-step.
+ *
+ * Usage: BehaviourIntegrationBenchmark library [output file] [number of
+ * points]
+ *
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <map>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+#ifndef TFEL_GIT_HASH
+#define TFEL_GIT_HASH ""
+#endif /* TFEL_GIT_HASH */
+
+using size_type = std::size_t;
+
+//! \brief description of a benchmark
+struct BenchmarkCase {
+  //! \brief name of the behaviour
+  std::string behaviour;
+  //! \brief values of the material properties
+  std::map<std::string, double> material_properties;
+  //! \brief initial values of some internal state variables
+  std::map<std::string, std::vector<double>> internal_state_variables;
+  //! \brief amplitude of the random gradient increments
+  double amplitude;
+  //! \brief time increment
+  double dt;
+};
+
+//! \brief results of a benchmark
+struct BenchmarkResult {
+  //! \brief name of the behaviour
+  std::string behaviour;
+  //! \brief number of integrations per second
+  double integrations_per_second;
+  //! \brief time spent per point in nanoseconds
+  double ns_per_point;
+  //! \brief time spent per point in nanoseconds using the batch function
+  double batch_ns_per_point;
+  //! \brief mean number of iterations per integration (negative if unknown)
+  double iterations_per_call;
+  //! \brief number of failed integrations
+  size_type failures;
+};
+
+//! \return a pseudo-random number in [-1:1], independent of rand
+static double next_value(unsigned int& s) {
+  s = 1664525u * s + 1013904223u;
+  return 2 * static_cast<double>(s >> 8) / static_cast<double>(1u << 24) - 1;
+}  // end of next_value
+
+//! \return the size of a variable in 3D
+static size_type getVariableSize(const int t) {
+  if (t == 0) {
+    return 1;
+  } else if (t == 1) {
+    return 6;
+  } else if (t == 2) {
+    return 3;
+  } else if (t == 3) {
+    return 9;
+  }
+  tfel::raise("getVariableSize: unsupported variable type");
+}  // end of getVariableSize
+
+/*!
+ * \return the names of the material properties of a behaviour in 3D,
+ * including the material properties used to compute the stiffness
+ * tensor and the thermal expansion coefficients if required, as done by
+ * the `GenericBehaviour` class of `MTest`.
+ * \param[in] l: library
+ * \param[in] b: behaviour
+ */
+static std::vector<std::string> getMaterialPropertiesNames(
+    const std::string& l, const std::string& b) {
+  using tfel::system::ExternalLibraryManager;
+  auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+  const auto h = std::string{"Tridimensional"};
+  auto mps = std::vector<std::string>{};
+  if (elm.getUMATRequiresStiffnessTensor(l, b, h)) {
+    const auto etype = elm.getUMATElasticSymmetryType(l, b);
+    if (etype == 0u) {
+      mps.insert(mps.end(), {"YoungModulus", "PoissonRatio"});
+    } else if (etype == 1u) {
+      mps.insert(mps.end(),
+                 {"YoungModulus1", "YoungModulus2", "YoungModulus3",
+                  "PoissonRatio12", "PoissonRatio23", "PoissonRatio13",
+                  "ShearModulus12", "ShearModulus23", "ShearModulus13"});
+    } else {
+      tfel::raise("getMaterialPropertiesNames: unsupported symmetry type");
+    }
+  }
+  if (elm.getUMATRequiresThermalExpansionCoefficientTensor(l, b, h)) {
+    if (elm.getUMATSymmetryType(l, b) == 0u) {
+      mps.push_back("ThermalExpansion");
+    } else {
+      mps.insert(mps.end(), {"ThermalExpansion1", "ThermalExpansion2",
+                             "ThermalExpansion3"});
+    }
+  }
+  const auto names = elm.getUMATMaterialPropertiesNames(l, b, h);
+  mps.insert(mps.end(), names.begin(), names.end());
+  return mps;
+}  // end of getMaterialPropertiesNames
+
+static BenchmarkResult runBenchmark(const std::string& l,
+                                    const BenchmarkCase& c,
+                                    const size_type n) {
+  using tfel::system::ExternalLibraryManager;
+  auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+  const auto h = std::string{"Tridimensional"};
+  const auto fct = elm.getGenericBehaviourFunction(l, c.behaviour + '_' + h);
+  const auto bfct =
+      elm.getGenericBehaviourBatchFunction(l, c.behaviour + '_' + h);
+  const auto btype = elm.getUMATBehaviourType(l, c.behaviour);
+  tfel::raise_if((btype != 1) && (btype != 2),
+                 "runBenchmark: unsupported behaviour type for behaviour '" +
+                     c.behaviour + "'");
+  const auto ng = size_type{btype == 1 ? 6u : 9u};
+  // material properties
+  auto mps = std::vector<double>{};
+  for (const auto& mp : getMaterialPropertiesNames(l, c.behaviour)) {
+    const auto p = c.material_properties.find(mp);
+    tfel::raise_if(p == c.material_properties.end(),
+                   "runBenchmark: no value given for material property '" +
+                       mp + "' of behaviour '" + c.behaviour + "'");
+    mps.push_back(p->second);
+  }
+  // internal state variables
+  const auto ivnames =
+      elm.getUMATInternalStateVariablesNames(l, c.behaviour, h);
+  const auto ivtypes =
+      elm.getUMATInternalStateVariablesTypes(l, c.behaviour, h);
+  auto iv0 = std::vector<double>{};
+  auto niter = size_type{};
+  auto has_niter = false;
+  for (size_type i = 0; i != ivnames.size(); ++i) {
+    const auto s = getVariableSize(ivtypes[i]);
+    const auto p = c.internal_state_variables.find(ivnames[i]);
+    if (ivnames[i] == "NumberOfIterations") {
+      niter = iv0.size();
+      has_niter = true;
+    }
+    if (p == c.internal_state_variables.end()) {
+      iv0.insert(iv0.end(), s, 0.);
+    } else {
+      tfel::raise_if(p->second.size() != s,
+                     "runBenchmark: invalid initial value for internal "
+                     "state variable '" +
+                         ivnames[i] + "'");
+      iv0.insert(iv0.end(), p->second.begin(), p->second.end());
+    }
+  }
+  const auto nivs = iv0.size();
+  // external state variables, the temperature being the first one
+  const auto nesvs =
+      elm.getUMATExternalStateVariablesNames(l, c.behaviour, h).size();
+  const auto esvs = std::vector<double>(std::max(nesvs, size_type{1}), 293.15);
+  // initial state and random gradients at the end of the time step
+  auto g0 = std::vector<double>(ng, 0.);
+  if (btype == 2) {
+    std::fill(g0.begin(), g0.begin() + 3, 1.);
+  }
+  const auto s0 = std::vector<double>(6, 0.);
+  auto seed = 1u;
+  auto g1 = std::vector<double>(ng * n);
+  for (size_type k = 0; k != n; ++k) {
+    for (size_type i = 0; i != ng; ++i) {
+      g1[k * ng + i] = g0[i] + c.amplitude * next_value(seed);
+    }
+  }
+  auto s1 = std::vector<double>(6 * n, 0.);
+  auto iv1 = std::vector<double>(nivs * n);
+  for (size_type k = 0; k != n; ++k) {
+    std::copy(iv0.begin(), iv0.end(), iv1.begin() + k * nivs);
+  }
+  auto K = std::vector<double>(81);
+  auto rdt = double{};
+  auto speed_of_sound = double{};
+  auto se0 = double{}, de0 = double{};
+  auto se1 = double{}, de1 = double{};
+  char error_message[512];
+  mfront_gb_BehaviourData d;
+  d.error_message = error_message;
+  d.dt = c.dt;
+  d.K = K.data();
+  d.rdt = &rdt;
+  d.speed_of_sound = &speed_of_sound;
+  d.s0.gradients = g0.data();
+  d.s0.thermodynamic_forces = s0.data();
+  d.s0.mass_density = nullptr;
+  d.s0.material_properties = mps.data();
+  d.s0.internal_state_variables = iv0.data();
+  d.s0.stored_energy = &se0;
+  d.s0.dissipated_energy = &de0;
+  d.s0.external_state_variables = esvs.data();
+  d.s1.mass_density = nullptr;
+  d.s1.material_properties = mps.data();
+  d.s1.stored_energy = &se1;
+  d.s1.dissipated_energy = &de1;
+  d.s1.external_state_variables = esvs.data();
+  auto failures = size_type{};
+  const auto start = std::chrono::steady_clock::now();
+  for (size_type k = 0; k != n; ++k) {
+    // consistent tangent operator, Cauchy stress and its derivative with
+    // respect to the deformation gradient for finite strain behaviours
+    K[0] = 4;
+    K[1] = K[2] = 0;
+    rdt = 1;
+    d.s1.gradients = g1.data() + k * ng;
+    d.s1.thermodynamic_forces = s1.data() + k * 6;
+    d.s1.internal_state_variables = iv1.data() + k * nivs;
+    if (fct(&d) != 1) {
+      ++failures;
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto t = std::chrono::duration<double>(end - start).count();
+  // same integrations through the batch function, the buffers being
+  // stored using a structure-of-arrays layout
+  // for finite strain behaviours, the buffers of the thermodynamic forces
+  // and of the stiffness matrices are sized for the first Piola-Kirchhoff
+  // stress and its derivative with respect to the deformation gradient
+  const auto nth = size_type{btype == 1 ? 6u : 9u};
+  const auto nK = size_type{btype == 1 ? 36u : 81u};
+  auto bg0 = std::vector<double>(ng * n), bg1 = std::vector<double>(ng * n);
+  auto bs0 = std::vector<double>(nth * n, 0.);
+  auto bs1 = std::vector<double>(nth * n);
+  auto bmps = std::vector<double>(mps.size() * n);
+  auto biv0 = std::vector<double>(nivs * n);
+  auto biv1 = std::vector<double>(nivs * n);
+  auto besvs = std::vector<double>(esvs.size() * n, 293.15);
+  auto bK = std::vector<double>(nK * n, 0.);
+  auto brdt = std::vector<double>(n, 1.);
+  for (size_type k = 0; k != n; ++k) {
+    for (size_type i = 0; i != ng; ++i) {
+      bg0[i * n + k] = g0[i];
+      bg1[i * n + k] = g1[k * ng + i];
+    }
+    for (size_type i = 0; i != mps.size(); ++i) {
+      bmps[i * n + k] = mps[i];
+    }
+    for (size_type i = 0; i != nivs; ++i) {
+      biv0[i * n + k] = biv1[i * n + k] = iv0[i];
+    }
+    bK[k] = 4;
+  }
+  mfront_gb_BatchBehaviourData bd;
+  bd.error_message = error_message;
+  bd.dt = c.dt;
+  bd.n = n;
+  bd.K = bK.data();
+  bd.rdt = brdt.data();
+  bd.speed_of_sound = nullptr;
+  bd.status = nullptr;
+  bd.s0.gradients = bg0.data();
+  bd.s0.thermodynamic_forces = bs0.data();
+  bd.s0.mass_density = nullptr;
+  bd.s0.material_properties = bmps.data();
+  bd.s0.internal_state_variables = biv0.data();
+  bd.s0.stored_energy = nullptr;
+  bd.s0.dissipated_energy = nullptr;
+  bd.s0.external_state_variables = besvs.data();
+  bd.s1.gradients = bg1.data();
+  bd.s1.thermodynamic_forces = bs1.data();
+  bd.s1.mass_density = nullptr;
+  bd.s1.material_properties = bmps.data();
+  bd.s1.internal_state_variables = biv1.data();
+  bd.s1.stored_energy = nullptr;
+  bd.s1.dissipated_energy = nullptr;
+  bd.s1.external_state_variables = besvs.data();
+  const auto bstart = std::chrono::steady_clock::now();
+  bfct(&bd);
+  const auto bend = std::chrono::steady_clock::now();
+  const auto bt = std::chrono::duration<double>(bend - bstart).count();
+  auto iterations = -1.;
+  if ((has_niter) && (failures != n)) {
+    iterations = 0;
+    for (size_type k = 0; k != n; ++k) {
+      iterations += iv1[k * nivs + niter];
+    }
+    iterations /= static_cast<double>(n);
+  }
+  return {c.behaviour, static_cast<double>(n) / t,
+          1e9 * t / static_cast<double>(n), 1e9 * bt / static_cast<double>(n),
+          iterations, failures};
+}  // end of runBenchmark
+
+static void writeJSON(std::ostream& os,
+                      const std::vector<BenchmarkResult>& results,
+                      const size_type n) {
+  os.precision(10);
+  os << "{\n"
+     << "  \"git_hash\": \"" << TFEL_GIT_HASH << "\",\n"
+     << "  \"number_of_points\": " << n << ",\n"
+     << "  \"behaviours\": [";
+  for (size_type i = 0; i != results.size(); ++i) {
+    const auto& r = results[i];
+    os << (i == 0 ? "\n" : ",\n") << "    {\n"
+       << "      \"name\": \"" << r.behaviour << "\",\n"
+       << "      \"integrations_per_second\": " << r.integrations_per_second
+       << ",\n"
+       << "      \"ns_per_point\": " << r.ns_per_point << ",\n"
+       << "      \"batch_ns_per_point\": " << r.batch_ns_per_point << ",\n"
+       << "      \"newton_iterations_per_call\": ";
+    if (r.iterations_per_call < 0) {
+      os << "null";
+    } else {
+      os << r.iterations_per_call;
+    }
+    os << ",\n"
+       << "      \"failures\": " << r.failures << "\n"
+       << "    }";
+  }
+  os << "\n  ]\n"
+     << "}\n";
+}  // end of writeJSON
+
+int main(const int argc, const char* const* const argv) {
+  if ((argc < 2) || (argc > 4)) {
+    std::cerr << "usage: " << argv[0]
+              << " library [output file] [number of points]\n";
+    return EXIT_FAILURE;
+  }
+  const auto l = std::string{argv[1]};
+  const auto o = std::string{argc > 2 ? argv[2] : "benchmarks.json"};
+  const auto n = argc > 3 ? static_cast<size_type>(std::stoi(argv[3]))
+                          : size_type{100000};
+  // material properties are taken from the tests of those behaviours
+  const auto young = 208000.;
+  const auto cases = std::vector<BenchmarkCase>{
+      {"Norton",
+       {{"YoungModulus", 150e9},
+        {"PoissonRatio", 0.3},
+        {"NortonCoefficient", 8e-67},
+        {"NortonExponent", 8.2}},
+       {},
+       1e-3,
+       3600},
+      {"Plasticity2",
+       {{"YoungModulus", 150e9},
+        {"PoissonRatio", 0.3},
+        {"H", 102e9},
+        {"s0", 102e6}},
+       {},
+       5e-3,
+       1},
+      {"Chaboche",
+       {{"YoungModulus", 145200.},
+        {"PoissonRatio", 0.3},
+        {"R_inf", 151.},
+        {"R_0", 87.},
+        {"b", 2.3},
+        {"k", 0.43},
+        {"w", 6.09},
+        {"C_inf[0]", 63767.},
+        {"C_inf[1]", 498336.},
+        {"g_0[0]", 341.},
+        {"g_0[1]", 17184.},
+        {"a_inf", 1.}},
+       {},
+       5e-3,
+       1},
+      {"FiniteStrainSingleCrystal",
+       {{"YoungModulus1", young},
+        {"YoungModulus2", young},
+        {"YoungModulus3", young},
+        {"PoissonRatio12", 0.3},
+        {"PoissonRatio13", 0.3},
+        {"PoissonRatio23", 0.3},
+        {"ShearModulus12", young},
+        {"ShearModulus13", young},
+        {"ShearModulus23", young},
+        {"m", 10.0},
+        {"K", 25.0},
+        {"C", 14363.},
+        {"R0", 66.62},
+        {"Q", 11.43},
+        {"b", 2.1},
+        {"d1", 494.0}},
+       {{"Fe", {1., 1., 1., 0., 0., 0., 0., 0., 0.}}},
+       2e-3,
+       2e-3},
+      {"GursonTvergaardNeedleman1982",
+       {},
+       {{"Porosity", {1e-3}}},
+       2e-3,
+       1}};
+  auto results = std::vector<BenchmarkResult>{};
+  std::cout << "# number of points: " << n << '\n'
+            << "# behaviour | integrations/s | ns/point | "
+            << "ns/point (batch) | iterations/call | failures\n";
+  for (const auto& c : cases) {
+    results.push_back(runBenchmark(l, c, n));
+    const auto& r = results.back();
+    std::cout << r.behaviour << " " << r.integrations_per_second << " "
+              << r.ns_per_point << " " << r.batch_ns_per_point << " ";
+    if (r.iterations_per_call < 0) {
+      std::cout << "-";
+    } else {
+      std::cout << r.iterations_per_call;
+    }
+    std::cout << " " << r.failures << '\n';
+  }
+  std::ofstream out(o);
+  if (!out) {
+    std::cerr << "can't open file '" << o << "'\n";
+    return EXIT_FAILURE;
+  }
+  writeJSON(out, results, n);
+  return EXIT_SUCCESS;
+}  // end of main
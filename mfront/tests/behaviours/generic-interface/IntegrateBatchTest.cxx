@@ -0,0 +1,291 @@
+/*!
+ * \file   IntegrateBatchTest.cxx
+ * \brief  This file checks that the `integrateBatch` functions generated
+ * by the `generic` interface give the same results than the integration
+ * of the behaviour at each integration point, for a small strain
+ * behaviour and for a finite strain behaviour using all the supported
+ * stress measures and tangent operators.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <map>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+#ifndef MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY
+#error "MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY shall be defined"
+#endif /* MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY */
+
+struct IntegrateBatchTest final : public tfel::tests::TestCase {
+  IntegrateBatchTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "IntegrateBatchTest") {
+  }  // end of IntegrateBatchTest
+
+  tfel::tests::TestResult execute() override {
+    const auto svk = BatchTestCase{
+        "SaintVenantKirchhoffElasticity", {70e3, 0.3}, {}, 2e-2, 1};
+    // small strain behaviour
+    this->check({"Norton", {8e-67, 8.2, 150e9, 0.3}, {}, 1e-3, 3600}, 0, 0);
+    // Cauchy stress and its derivative with respect to the deformation
+    // gradient
+    this->check(svk, 0, 0);
+    // second Piola-Kirchhoff stress and its derivative with respect to
+    // the Green-Lagrange strain
+    this->check(svk, 1, 1);
+    // first Piola-Kirchhoff stress and its derivative with respect to the
+    // deformation gradient
+    this->check(svk, 2, 2);
+    return this->result;
+  }  // end of execute
+
+ private:
+  using size_type = std::size_t;
+  //! \brief description of a test case
+  struct BatchTestCase {
+    //! \brief name of the behaviour
+    std::string behaviour;
+    //! \brief values of the material properties
+    std::vector<double> material_properties;
+    //! \brief initial values of some internal state variables
+    std::map<std::string, std::vector<double>> internal_state_variables;
+    //! \brief amplitude of the random gradient increments
+    double amplitude;
+    //! \brief time increment
+    double dt;
+  };
+  //! \brief number of integration points
+  static constexpr size_type n = 7;
+  //! \return a pseudo-random number in [-1:1]
+  static double next_value(unsigned int& s) {
+    s = 1664525u * s + 1013904223u;
+    return 2 * static_cast<double>(s >> 8) / static_cast<double>(1u << 24) -
+           1;
+  }  // end of next_value
+  //! \return the size of a variable in 3D
+  static size_type getVariableSize(const int t) {
+    return t == 0 ? 1 : (t == 1 ? 6 : (t == 2 ? 3 : 9));
+  }  // end of getVariableSize
+  /*!
+   * \brief compare the results of the batch function to the results of
+   * the integration at each integration point
+   * \param[in] c: test case
+   * \param[in] sm: stress measure (finite strain behaviours only)
+   * \param[in] to: tangent operator (finite strain behaviours only)
+   */
+  void check(const BatchTestCase& c, const int sm, const int to) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto l = std::string{MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY};
+    const auto h = std::string{"Tridimensional"};
+    const auto fct = elm.getGenericBehaviourFunction(l, c.behaviour + '_' + h);
+    const auto bfct =
+        elm.getGenericBehaviourBatchFunction(l, c.behaviour + '_' + h);
+    const auto fs = elm.getUMATBehaviourType(l, c.behaviour) == 2;
+    const auto ng = size_type{fs ? 9u : 6u};
+    // sizes of the thermodynamic forces and of the stiffness matrix
+    // returned by the behaviour
+    const auto nth = size_type{(fs && (sm == 2)) ? 9u : 6u};
+    const auto nK = [fs, to]() -> size_type {
+      if (!fs) {
+        return 36;
+      }
+      return to == 0 ? 54 : (to == 1 ? 36 : 81);
+    }();
+    // sizes of the buffers used by the batch function, which are those
+    // of the largest supported stress measure and tangent operator
+    const auto bnth = size_type{fs ? 9u : 6u};
+    const auto bnK = size_type{fs ? 81u : 36u};
+    // internal state variables
+    const auto ivnames =
+        elm.getUMATInternalStateVariablesNames(l, c.behaviour, h);
+    const auto ivtypes =
+        elm.getUMATInternalStateVariablesTypes(l, c.behaviour, h);
+    auto iv0 = std::vector<double>{};
+    for (size_type i = 0; i != ivnames.size(); ++i) {
+      const auto p = c.internal_state_variables.find(ivnames[i]);
+      if (p == c.internal_state_variables.end()) {
+        iv0.insert(iv0.end(), getVariableSize(ivtypes[i]), 0.);
+      } else {
+        iv0.insert(iv0.end(), p->second.begin(), p->second.end());
+      }
+    }
+    const auto nivs = iv0.size();
+    const auto& mps = c.material_properties;
+    const auto nesvs = std::max(
+        elm.getUMATExternalStateVariablesNames(l, c.behaviour, h).size(),
+        size_type{1});
+    const auto esvs = std::vector<double>(nesvs, 293.15);
+    auto g0 = std::vector<double>(ng, 0.);
+    if (fs) {
+      std::fill(g0.begin(), g0.begin() + 3, 1.);
+    }
+    auto seed = 1u;
+    auto g1 = std::vector<double>(ng * n);
+    for (size_type k = 0; k != n; ++k) {
+      for (size_type i = 0; i != ng; ++i) {
+        g1[k * ng + i] = g0[i] + c.amplitude * next_value(seed);
+      }
+    }
+    // integration at each integration point
+    const auto th0 = std::vector<double>(9, 0.);
+    auto th1 = std::vector<double>(nth * n);
+    auto iv1 = std::vector<double>(nivs * n);
+    auto K = std::vector<double>(nK * n);
+    auto rdt = std::vector<double>(n, 1.);
+    auto status = std::vector<int>(n);
+    // stored and dissipated energies, which are computed by some
+    // behaviours
+    const auto e0 = 0.;
+    auto se1 = std::vector<double>(n), de1 = std::vector<double>(n);
+    for (size_type k = 0; k != n; ++k) {
+      auto Kk = std::vector<double>(81, 0.);
+      auto thk = std::vector<double>(9, 0.);
+      Kk[0] = 4;
+      Kk[1] = sm;
+      Kk[2] = to;
+      std::copy(iv0.begin(), iv0.end(), iv1.begin() + k * nivs);
+      mfront_gb_BehaviourData d;
+      d.error_message = nullptr;
+      d.dt = c.dt;
+      d.K = Kk.data();
+      d.rdt = &rdt[k];
+      d.speed_of_sound = nullptr;
+      d.s0.gradients = g0.data();
+      d.s0.thermodynamic_forces = th0.data();
+      d.s0.mass_density = nullptr;
+      d.s0.material_properties = mps.data();
+      d.s0.internal_state_variables = iv0.data();
+      d.s0.stored_energy = &e0;
+      d.s0.dissipated_energy = &e0;
+      d.s0.external_state_variables = esvs.data();
+      d.s1.gradients = g1.data() + k * ng;
+      d.s1.thermodynamic_forces = thk.data();
+      d.s1.mass_density = nullptr;
+      d.s1.material_properties = mps.data();
+      d.s1.internal_state_variables = iv1.data() + k * nivs;
+      d.s1.stored_energy = &se1[k];
+      d.s1.dissipated_energy = &de1[k];
+      d.s1.external_state_variables = esvs.data();
+      status[k] = fct(&d);
+      std::copy(thk.begin(), thk.begin() + nth, th1.begin() + k * nth);
+      std::copy(Kk.begin(), Kk.begin() + nK, K.begin() + k * nK);
+    }
+    // integration using the batch function. The buffers are stored using
+    // a structure-of-arrays layout. The values after the last component
+    // of each quantity are filled with a sentinel value to check that
+    // they are not overwritten.
+    const auto sentinel = 1234.5;
+    auto bg0 = std::vector<double>(ng * n), bg1 = std::vector<double>(ng * n);
+    auto bth0 = std::vector<double>(bnth * n, 0.);
+    auto bth1 = std::vector<double>(bnth * n + 1, sentinel);
+    auto bmps = std::vector<double>(mps.size() * n);
+    auto biv0 = std::vector<double>(nivs * n);
+    auto biv1 = std::vector<double>(nivs * n);
+    auto besvs = std::vector<double>(nesvs * n, 293.15);
+    auto bK = std::vector<double>(bnK * n + 1, sentinel);
+    auto brdt = std::vector<double>(n, 1.);
+    auto be0 = std::vector<double>(n, 0.);
+    auto bse1 = std::vector<double>(n), bde1 = std::vector<double>(n);
+    auto bstatus = std::vector<int>(n);
+    for (size_type k = 0; k != n; ++k) {
+      for (size_type i = 0; i != ng; ++i) {
+        bg0[i * n + k] = g0[i];
+        bg1[i * n + k] = g1[k * ng + i];
+      }
+      for (size_type i = 0; i != mps.size(); ++i) {
+        bmps[i * n + k] = mps[i];
+      }
+      for (size_type i = 0; i != nivs; ++i) {
+        biv0[i * n + k] = biv1[i * n + k] = iv0[i];
+      }
+    }
+    std::fill(bK.begin(), bK.begin() + bnK * n, 0.);
+    for (size_type k = 0; k != n; ++k) {
+      bK[k] = 4;
+      bK[n + k] = sm;
+      bK[2 * n + k] = to;
+    }
+    mfront_gb_BatchBehaviourData bd;
+    bd.error_message = nullptr;
+    bd.dt = c.dt;
+    bd.n = n;
+    bd.K = bK.data();
+    bd.rdt = brdt.data();
+    bd.speed_of_sound = nullptr;
+    bd.status = bstatus.data();
+    bd.s0.gradients = bg0.data();
+    bd.s0.thermodynamic_forces = bth0.data();
+    bd.s0.mass_density = nullptr;
+    bd.s0.material_properties = bmps.data();
+    bd.s0.internal_state_variables = biv0.data();
+    bd.s0.stored_energy = be0.data();
+    bd.s0.dissipated_energy = be0.data();
+    bd.s0.external_state_variables = besvs.data();
+    bd.s1.gradients = bg1.data();
+    bd.s1.thermodynamic_forces = bth1.data();
+    bd.s1.mass_density = nullptr;
+    bd.s1.material_properties = bmps.data();
+    bd.s1.internal_state_variables = biv1.data();
+    bd.s1.stored_energy = bse1.data();
+    bd.s1.dissipated_energy = bde1.data();
+    bd.s1.external_state_variables = besvs.data();
+    const auto r = bfct(&bd);
+    // comparison
+    auto check_value = [this](const double v1, const double v2) {
+      const auto eps = 1e-12 * std::max(std::abs(v1), 1.);
+      TFEL_TESTS_ASSERT(std::abs(v1 - v2) < eps);
+    };
+    TFEL_TESTS_ASSERT(r == *std::min_element(status.begin(), status.end()));
+    TFEL_TESTS_ASSERT(std::abs(bth1.back() - sentinel) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(bK.back() - sentinel) < 1e-14);
+    for (size_type k = 0; k != n; ++k) {
+      TFEL_TESTS_ASSERT(status[k] == 1);
+      TFEL_TESTS_ASSERT(bstatus[k] == status[k]);
+      check_value(brdt[k], rdt[k]);
+      check_value(bse1[k], se1[k]);
+      check_value(bde1[k], de1[k]);
+      for (size_type i = 0; i != nth; ++i) {
+        check_value(bth1[i * n + k], th1[k * nth + i]);
+      }
+      for (size_type i = 0; i != nivs; ++i) {
+        check_value(biv1[i * n + k], iv1[k * nivs + i]);
+      }
+      for (size_type i = 0; i != nK; ++i) {
+        check_value(bK[i * n + k], K[k * nK + i]);
+      }
+    }
+  }  // end of check
+};
+
+TFEL_TESTS_GENERATE_PROXY(IntegrateBatchTest, "IntegrateBatchTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("IntegrateBatchTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,213 @@
+/*!
+ * \file   IntegrateWithParametersTest.cxx
+ * \brief  This file checks that the `integrateWithParameters` functions
+ * generated by the `generic` interface give the same results than the
+ * modification of the parameters shared by all the callers followed by
+ * a standard integration, including when they are called concurrently.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+#ifndef MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY
+#error "MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY shall be defined"
+#endif /* MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY */
+
+struct IntegrateWithParametersTest final : public tfel::tests::TestCase {
+  IntegrateWithParametersTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "IntegrateWithParametersTest") {
+  }  // end of IntegrateWithParametersTest
+
+  tfel::tests::TestResult execute() override {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto fct = elm.getGenericBehaviourFunction(l, f);
+    const auto pfct = elm.getGenericBehaviourWithParametersFunction(l, f);
+    const auto gfct = elm.getGenericBehaviourGetParametersFunction(l, f);
+    const auto names = elm.getUMATParametersNames(l, b, h);
+    const auto types = elm.getUMATParametersTypes(l, b, h);
+    TFEL_TESTS_ASSERT(names.size() == types.size());
+    const auto pE = std::find(names.begin(), names.end(), "YoungModulus");
+    TFEL_TESTS_ASSERT(pE != names.end());
+    if ((names.size() != types.size()) || (pE == names.end())) {
+      return this->result;
+    }
+    const auto iE = static_cast<std::size_t>(pE - names.begin());
+    // the values returned by the `getParameters` function are the
+    // default values, since no parameter has been modified yet
+    auto p0 = std::vector<double>(names.size());
+    gfct(p0.data());
+    for (std::size_t i = 0; i != names.size(); ++i) {
+      if (types[i] == 0) {
+        check_value(p0[i],
+                    elm.getRealParameterDefaultValue(l, b, h, names[i]));
+      }
+    }
+    const auto s0 = integrate(
+        [fct](mfront_gb_BehaviourData* const d) { return fct(d); });
+    // integration with a block of parameters
+    auto p1 = p0;
+    p1[iE] = 2 * p0[iE];
+    const auto s1 = integrate([pfct, &p1](mfront_gb_BehaviourData* const d) {
+      return pfct(d, p1.data());
+    });
+    // the values shared by all the callers are unchanged
+    const auto s0b = integrate(
+        [fct](mfront_gb_BehaviourData* const d) { return fct(d); });
+    TFEL_TESTS_ASSERT((s0.size() == 6) && (s1.size() == 6) &&
+                      (s0b.size() == 6));
+    if ((s0.size() != 6) || (s1.size() != 6) || (s0b.size() != 6)) {
+      return this->result;
+    }
+    TFEL_TESTS_ASSERT(std::abs(s1[0] - s0[0]) > 1e-3 * std::abs(s0[0]));
+    for (std::size_t i = 0; i != s0.size(); ++i) {
+      check_value(s0b[i], s0[i]);
+    }
+    // modification of the values shared by all the callers
+    elm.setParameter(l, b, "YoungModulus", p1[iE]);
+    auto p2 = std::vector<double>(names.size());
+    gfct(p2.data());
+    for (std::size_t i = 0; i != names.size(); ++i) {
+      check_value(p2[i], p1[i]);
+    }
+    const auto s2 = integrate(
+        [fct](mfront_gb_BehaviourData* const d) { return fct(d); });
+    TFEL_TESTS_ASSERT(s2.size() == s1.size());
+    for (std::size_t i = 0; (i != s1.size()) && (i != s2.size()); ++i) {
+      check_value(s2[i], s1[i]);
+    }
+    // concurrent integrations with different blocks of parameters
+    constexpr std::size_t nthreads = 8;
+    auto blocks = std::vector<std::vector<double>>(nthreads, p0);
+    auto results = std::vector<std::vector<double>>(nthreads);
+    for (std::size_t i = 0; i != nthreads; ++i) {
+      blocks[i][iE] = p0[iE] * (1 + 0.1 * static_cast<double>(i));
+    }
+    {
+      auto threads = std::vector<std::thread>{};
+      for (std::size_t i = 0; i != nthreads; ++i) {
+        threads.emplace_back([this, pfct, &blocks, &results, i] {
+          const auto& p = blocks[i];
+          auto integrate_with_parameters =
+              [pfct, &p](mfront_gb_BehaviourData* const d) {
+                return pfct(d, p.data());
+              };
+          for (int k = 0; k != 100; ++k) {
+            results[i] = integrate(integrate_with_parameters);
+          }
+        });
+      }
+      for (auto& t : threads) {
+        t.join();
+      }
+    }
+    for (std::size_t i = 0; i != nthreads; ++i) {
+      elm.setParameter(l, b, "YoungModulus", blocks[i][iE]);
+      const auto r = integrate(
+          [fct](mfront_gb_BehaviourData* const d) { return fct(d); });
+      TFEL_TESTS_ASSERT(results[i].size() == r.size());
+      for (std::size_t j = 0; (j != r.size()) && (j != results[i].size());
+           ++j) {
+        check_value(results[i][j], r[j]);
+      }
+    }
+    elm.setParameter(l, b, "YoungModulus", p0[iE]);
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief library
+  const std::string l = MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY;
+  //! \brief behaviour
+  const std::string b = "ParameterTest2";
+  //! \brief modelling hypothesis
+  const std::string h = "Tridimensional";
+  //! \brief function
+  const std::string f = b + '_' + h;
+  /*!
+   * \brief compare two values
+   * \param[in] v1: first value
+   * \param[in] v2: second value
+   */
+  void check_value(const double v1, const double v2) {
+    const auto eps = 1e-12 * std::max(std::abs(v1), 1.);
+    TFEL_TESTS_ASSERT(std::abs(v1 - v2) < eps);
+  }  // end of check_value
+  /*!
+   * \return the stress computed for an uniaxial strain using the given
+   * integration function
+   * \param[in] i: integration function
+   */
+  std::vector<double> integrate(
+      const std::function<int(mfront_gb_BehaviourData* const)>& i) const {
+    auto K = std::vector<double>(36, 0.);
+    auto rdt = 1.;
+    const auto e0 = std::vector<double>(6, 0.);
+    const auto e1 = std::vector<double>{1e-3, 0, 0, 0, 0, 0};
+    const auto sig0 = std::vector<double>(6, 0.);
+    auto sig1 = std::vector<double>(6, 0.);
+    const auto T = 293.15;
+    mfront_gb_BehaviourData d;
+    d.error_message = nullptr;
+    d.dt = 1;
+    d.K = K.data();
+    d.rdt = &rdt;
+    d.speed_of_sound = nullptr;
+    d.s0.gradients = e0.data();
+    d.s0.thermodynamic_forces = sig0.data();
+    d.s0.mass_density = nullptr;
+    d.s0.material_properties = nullptr;
+    d.s0.internal_state_variables = nullptr;
+    d.s0.stored_energy = nullptr;
+    d.s0.dissipated_energy = nullptr;
+    d.s0.external_state_variables = &T;
+    d.s1.gradients = e1.data();
+    d.s1.thermodynamic_forces = sig1.data();
+    d.s1.mass_density = nullptr;
+    d.s1.material_properties = nullptr;
+    d.s1.internal_state_variables = nullptr;
+    d.s1.stored_energy = nullptr;
+    d.s1.dissipated_energy = nullptr;
+    d.s1.external_state_variables = &T;
+    if (i(&d) != 1) {
+      return {};
+    }
+    return sig1;
+  }  // end of integrate
+};
+
+TFEL_TESTS_GENERATE_PROXY(IntegrateWithParametersTest,
+                          "IntegrateWithParametersTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("IntegrateWithParametersTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
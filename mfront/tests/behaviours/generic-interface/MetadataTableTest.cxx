@@ -0,0 +1,167 @@
+/*!
+ * \file   MetadataTableTest.cxx
+ * \brief  This file checks the metadata tables generated by `MFront` and
+ * their use by the `ExternalLibraryManager` class.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <set>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <dlfcn.h>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/MetadataTable.h"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+
+#ifndef MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY
+#error "MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY shall be defined"
+#endif /* MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY */
+
+struct MetadataTableTest final : public tfel::tests::TestCase {
+  MetadataTableTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour", "MetadataTableTest") {
+  }  // end of MetadataTableTest
+
+  tfel::tests::TestResult execute() override {
+    const auto l = std::string{MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY};
+    this->lib = ::dlopen(l.c_str(), RTLD_NOW);
+    TFEL_TESTS_ASSERT(this->lib != nullptr);
+    if (this->lib == nullptr) {
+      return this->result;
+    }
+    for (const auto b : {"Norton", "SaintVenantKirchhoffElasticity"}) {
+      this->checkTables(b);
+      this->checkExternalLibraryManager(l, b);
+    }
+    ::dlclose(this->lib);
+    return this->result;
+  }  // end of execute
+
+ private:
+  /*!
+   * \brief check that the entries of the metadata tables associated with
+   * the given behaviour match the symbols exported by the library
+   * \param[in] b: behaviour
+   */
+  void checkTables(const std::string& b) {
+    const auto g = this->checkTable(b + "_mfront_metadata");
+    // the general table lists the descriptions of the behaviour
+    for (const auto s : {"_mfront_ept", "_tfel_version", "_BehaviourType",
+                         "_nModellingHypotheses", "_ModellingHypotheses"}) {
+      TFEL_TESTS_ASSERT(g.count(b + s) == 1);
+    }
+    // the tested behaviours have the same description for all modelling
+    // hypotheses, so the variables are described by one table
+    const auto h = this->checkTable(b + "_mfront_hypothesis_metadata");
+    // this table lists the descriptions of the variables, including the
+    // arrays of symbols
+    for (const auto s :
+         {"_nMaterialProperties", "_MaterialProperties",
+          "_nInternalStateVariables", "_InternalStateVariables",
+          "_InternalStateVariablesTypes", "_nExternalStateVariables",
+          "_ExternalStateVariablesTypes", "_nParameters", "_Parameters",
+          "_ParametersTypes"}) {
+      TFEL_TESTS_ASSERT(h.count(b + s) == 1);
+    }
+  }  // end of checkTables
+  /*!
+   * \brief check that each entry of the given table matches the address
+   * returned by the dynamic loader.
+   * \return the names of the symbols listed in the table
+   * \param[in] n: name of the table
+   */
+  std::set<std::string> checkTable(const std::string& n) {
+    auto names = std::set<std::string>{};
+    const auto t = static_cast<const mfront_metadata_table*>(
+        ::dlsym(this->lib, n.c_str()));
+    TFEL_TESTS_ASSERT(t != nullptr);
+    if (t == nullptr) {
+      return names;
+    }
+    TFEL_TESTS_ASSERT(t->version == MFRONT_METADATA_TABLE_VERSION);
+    TFEL_TESTS_ASSERT(t->size != 0);
+    for (unsigned int i = 0; i != t->size; ++i) {
+      const auto& e = t->entries[i];
+      TFEL_TESTS_ASSERT(e.name != nullptr);
+      TFEL_TESTS_ASSERT(e.address != nullptr);
+      TFEL_TESTS_ASSERT(e.address == ::dlsym(this->lib, e.name));
+      // each symbol is listed once
+      TFEL_TESTS_ASSERT(names.insert(e.name).second);
+    }
+    return names;
+  }  // end of checkTable
+  /*!
+   * \brief check that the information returned by the
+   * `ExternalLibraryManager` class, which uses the metadata tables,
+   * matches the exported symbols.
+   * \param[in] l: library
+   * \param[in] b: behaviour
+   */
+  void checkExternalLibraryManager(const std::string& l,
+                                   const std::string& b) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto bh = b + "_Tridimensional";
+    // material properties
+    const auto mps =
+        elm.getUMATMaterialPropertiesNames(l, b, "Tridimensional");
+    const auto nmps = static_cast<const unsigned short*>(
+        ::dlsym(this->lib, (b + "_nMaterialProperties").c_str()));
+    const auto mpnames = static_cast<const char* const*>(
+        ::dlsym(this->lib, (b + "_MaterialProperties").c_str()));
+    TFEL_TESTS_ASSERT(nmps != nullptr);
+    TFEL_TESTS_ASSERT(mpnames != nullptr);
+    if ((nmps == nullptr) || (mpnames == nullptr)) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(mps.size() == *nmps);
+    for (std::size_t i = 0; (i != mps.size()) && (i != *nmps); ++i) {
+      TFEL_TESTS_ASSERT(mps[i] == mpnames[i]);
+    }
+    // behaviour type and version
+    const auto btype = static_cast<const unsigned short*>(
+        ::dlsym(this->lib, (b + "_BehaviourType").c_str()));
+    TFEL_TESTS_ASSERT(btype != nullptr);
+    if (btype != nullptr) {
+      TFEL_TESTS_ASSERT(elm.getUMATBehaviourType(l, b) == *btype);
+    }
+    const auto v = static_cast<const char* const*>(
+        ::dlsym(this->lib, (b + "_tfel_version").c_str()));
+    TFEL_TESTS_ASSERT(v != nullptr);
+    if (v != nullptr) {
+      TFEL_TESTS_ASSERT(elm.getTFELVersion(l, b) == *v);
+    }
+    // the functions are not listed in the metadata tables and are
+    // retrieved using the dynamic loader
+    TFEL_TESTS_ASSERT(elm.getGenericBehaviourFunction(l, bh) ==
+                      reinterpret_cast<tfel::system::GenericBehaviourFctPtr>(
+                          ::dlsym(this->lib, bh.c_str())));
+  }  // end of checkExternalLibraryManager
+  //! \brief library
+  void* lib = nullptr;
+};
+
+TFEL_TESTS_GENERATE_PROXY(MetadataTableTest, "MetadataTableTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("MetadataTableTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
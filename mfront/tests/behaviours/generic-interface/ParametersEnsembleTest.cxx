@@ -0,0 +1,131 @@
+/*!
+ * \file   ParametersEnsembleTest.cxx
+ * \brief  This file checks the concurrent sampling of the parameters of a
+ * behaviour generated by the `generic` interface in ensemble runs.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MTest/MTestEnsemble.hxx"
+
+#ifndef MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY
+#error "MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY shall be defined"
+#endif /* MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY */
+
+#ifndef MFRONT_GENERIC_INTERFACE_TESTS_DIRECTORY
+#error "MFRONT_GENERIC_INTERFACE_TESTS_DIRECTORY shall be defined"
+#endif /* MFRONT_GENERIC_INTERFACE_TESTS_DIRECTORY */
+
+struct ParametersEnsembleTest final : public tfel::tests::TestCase {
+  ParametersEnsembleTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "ParametersEnsembleTest") {
+  }  // end of ParametersEnsembleTest
+
+  tfel::tests::TestResult execute() override {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    // the Poisson ratio is modified for all the callers before the
+    // ensemble run. The blocks of parameters used by each test must take
+    // this value into account.
+    const auto nu0 = elm.getRealParameterDefaultValue(
+        this->l, this->b, "Tridimensional", "PoissonRatio");
+    const auto nu = 0.2;
+    elm.setParameter(this->l, this->b, "PoissonRatio", nu);
+    auto samples = std::vector<std::vector<mtest::real>>{};
+    for (int i = 0; i != 32; ++i) {
+      samples.push_back({100e9 * (1 + 0.05 * i)});
+    }
+    const auto r1 = this->run(samples, 1);
+    const auto r4 = this->run(samples, 4);
+    TFEL_TESTS_ASSERT(r1.size() == samples.size());
+    TFEL_TESTS_ASSERT(r4.size() == samples.size());
+    for (std::size_t i = 0;
+         (i != samples.size()) && (i != r1.size()) && (i != r4.size());
+         ++i) {
+      TFEL_TESTS_ASSERT(r1[i].size() == 2);
+      TFEL_TESTS_ASSERT(r4[i].size() == 2);
+      if ((r1[i].size() != 2) || (r4[i].size() != 2)) {
+        continue;
+      }
+      // uniaxial tension
+      const auto E = samples[i][0];
+      TFEL_TESTS_ASSERT(std::abs(r1[i][0] - E * this->eps) <
+                        1e-10 * E * this->eps);
+      TFEL_TESTS_ASSERT(std::abs(r1[i][1] + nu * this->eps) <
+                        1e-10 * this->eps);
+      // the concurrent run gives the results of the sequential one
+      for (std::size_t j = 0; j != 2; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(r4[i][j] - r1[i][j]) <=
+                          1e-14 * std::abs(r1[i][j]));
+      }
+    }
+    // the sampled values are not shared by the callers
+    const auto E0 = elm.getRealParameterDefaultValue(
+        this->l, this->b, "Tridimensional", "YoungModulus");
+    const auto r = this->run({{E0}}, 1);
+    TFEL_TESTS_ASSERT((r.size() == 1) && (r[0].size() == 2));
+    if ((r.size() == 1) && (r[0].size() == 2)) {
+      TFEL_TESTS_ASSERT(std::abs(r[0][0] - E0 * this->eps) <
+                        1e-10 * E0 * this->eps);
+    }
+    elm.setParameter(this->l, this->b, "PoissonRatio", nu0);
+    return this->result;
+  }  // end of execute
+
+ private:
+  /*!
+   * \return the axial stress and the transverse strain at the end of the
+   * loading path for each sample of the Young modulus
+   * \param[in] samples: samples
+   * \param[in] n: number of threads
+   */
+  std::vector<std::vector<mtest::real>> run(
+      const std::vector<std::vector<mtest::real>>& samples,
+      const std::size_t n) const {
+    const auto f = std::string{MFRONT_GENERIC_INTERFACE_TESTS_DIRECTORY} +
+                   "/ParameterTest2.mtest";
+    auto e = mtest::MTestEnsemble(f, {}, {{"@library@", '"' + l + '"'}});
+    e.setSampledVariables({"YoungModulus"});
+    e.setOutputs({"SXX", "EYY"});
+    e.setNumberOfThreads(n);
+    return e.execute(samples);
+  }  // end of run
+  //! \brief library
+  const std::string l = MFRONT_GENERIC_INTERFACE_BEHAVIOURS_LIBRARY;
+  //! \brief behaviour
+  const std::string b = "ParameterTest2";
+  //! \brief axial strain at the end of the loading path
+  const mtest::real eps = 1e-3;
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParametersEnsembleTest, "ParametersEnsembleTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ParametersEnsembleTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
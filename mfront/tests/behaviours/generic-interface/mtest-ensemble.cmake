@@ -0,0 +1,94 @@
+# This script checks the ensemble runs of `mtest`:
+#
+# - the lines of the result file are written in the order of the samples.
+# - the result file does not depend on the number of threads.
+# - failed samples are reported and counted.
+
+# arguments checking
+foreach(v TEST_PROGRAM TEST_LIBRARY TEST_INPUT TEST_DIRECTORY)
+  if(NOT ${v})
+    message(FATAL_ERROR "Require ${v} to be defined")
+  endif(NOT ${v})
+endforeach(v)
+
+file(REMOVE_RECURSE ${TEST_DIRECTORY})
+file(MAKE_DIRECTORY ${TEST_DIRECTORY})
+
+# the sample 5 has a null Young modulus which leads to a singular
+# stiffness matrix
+set(nsamples 16)
+set(failed_sample 5)
+set(samples "# YoungModulus\n")
+foreach(i RANGE 1 ${nsamples})
+  math(EXPR s "${i} - 1")
+  if(s EQUAL failed_sample)
+    string(APPEND samples "0\n")
+  else(s EQUAL failed_sample)
+    string(APPEND samples "${i}00e9\n")
+  endif(s EQUAL failed_sample)
+endforeach(i)
+file(WRITE ${TEST_DIRECTORY}/samples.txt "${samples}")
+
+# run an ensemble using the given number of threads
+# \param[in] jobs: number of threads
+function(run_ensemble jobs)
+  execute_process(
+    COMMAND ${TEST_PROGRAM} --verbose=level1
+    --@library@="${TEST_LIBRARY}"
+    --ensemble=samples.txt --ensemble-outputs=SXX --jobs=${jobs}
+    ${TEST_INPUT}
+    WORKING_DIRECTORY ${TEST_DIRECTORY}
+    OUTPUT_VARIABLE TEST_OUTPUT
+    ERROR_VARIABLE TEST_ERROR
+    RESULT_VARIABLE TEST_RESULT
+    TIMEOUT 120)
+  if(NOT TEST_RESULT)
+    message(FATAL_ERROR "Failed: the failed sample is not reported by the exit status.\n${TEST_OUTPUT}\n${TEST_ERROR}")
+  endif(NOT TEST_RESULT)
+  math(EXPR nsuccesses "${nsamples} - 1")
+  string(FIND "${TEST_OUTPUT}"
+    "${nsuccesses} samples treated successfully over ${nsamples}" pos)
+  if(pos LESS 0)
+    message(FATAL_ERROR "Failed: invalid number of failures.\n${TEST_OUTPUT}\n${TEST_ERROR}")
+  endif(pos LESS 0)
+  file(RENAME ${TEST_DIRECTORY}/ParameterTest2-ensemble.res
+    ${TEST_DIRECTORY}/ParameterTest2-ensemble-${jobs}.res)
+endfunction(run_ensemble)
+
+run_ensemble(1)
+run_ensemble(4)
+
+# the lines are written in the order of the samples
+file(STRINGS ${TEST_DIRECTORY}/ParameterTest2-ensemble-4.res lines)
+set(expected 0)
+foreach(l ${lines})
+  if(l MATCHES "^# sample ([0-9]+) failed$")
+    if(NOT CMAKE_MATCH_1 EQUAL failed_sample)
+      message(FATAL_ERROR "Failed: unexpected failure of sample ${CMAKE_MATCH_1}")
+    endif(NOT CMAKE_MATCH_1 EQUAL failed_sample)
+    set(index ${CMAKE_MATCH_1})
+  elseif(l MATCHES "^#")
+    continue()
+  elseif(l MATCHES "^([0-9]+) ")
+    set(index ${CMAKE_MATCH_1})
+  else()
+    message(FATAL_ERROR "Failed: invalid line '${l}'")
+  endif()
+  if(NOT index EQUAL expected)
+    message(FATAL_ERROR "Failed: results not written in the order of the samples (expected sample ${expected}, read '${l}')")
+  endif(NOT index EQUAL expected)
+  math(EXPR expected "${expected} + 1")
+endforeach(l)
+if(NOT expected EQUAL nsamples)
+  message(FATAL_ERROR "Failed: results of ${expected} samples written instead of ${nsamples}")
+endif(NOT expected EQUAL nsamples)
+
+# the results do not depend on the number of threads
+execute_process(
+  COMMAND ${CMAKE_COMMAND} -E compare_files
+  ${TEST_DIRECTORY}/ParameterTest2-ensemble-1.res
+  ${TEST_DIRECTORY}/ParameterTest2-ensemble-4.res
+  RESULT_VARIABLE TEST_RESULT)
+if(TEST_RESULT)
+  message(FATAL_ERROR "Failed: the results depend on the number of threads")
+endif(TEST_RESULT)
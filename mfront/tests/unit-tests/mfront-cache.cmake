@@ -0,0 +1,142 @@
+# This script checks the compilation cache of `mfront`:
+#
+# - a file treated twice is restored from the cache the second time.
+# - a file is treated again if one of the files it imports is modified.
+# - a file is treated again if one of the files imported by a material
+#   law that it uses is modified.
+# - a file is treated again if one of the files imported by a file that
+#   it treats through the `@MFront` keyword is modified, even if this
+#   file has been restored from the cache.
+
+# arguments checking
+foreach(v TEST_PROGRAM TEST_DIRECTORY)
+  if(NOT ${v})
+    message(FATAL_ERROR "Require ${v} to be defined")
+  endif(NOT ${v})
+endforeach(v)
+
+file(REMOVE_RECURSE ${TEST_DIRECTORY})
+file(MAKE_DIRECTORY ${TEST_DIRECTORY})
+
+file(WRITE ${TEST_DIRECTORY}/YoungModulusParameters.mfront
+  "@Parameter E0 = 150e9;\n")
+file(WRITE ${TEST_DIRECTORY}/YoungModulus.mfront
+"@DSL MaterialProperty;
+@Law CacheTestYoungModulus;
+@Import \"YoungModulusParameters.mfront\";
+@Output E;
+@Function{
+  E = E0;
+}
+")
+file(WRITE ${TEST_DIRECTORY}/Behaviour.mfront
+"@DSL Default;
+@Behaviour CacheTestBehaviour;
+@MaterialLaw \"YoungModulus.mfront\";
+@ProvidesSymmetricTangentOperator;
+@Integrator{
+  const auto E = CacheTestYoungModulus();
+  const auto lambda = computeLambda(E, 0.3);
+  const auto mu = computeMu(E, 0.3);
+  sig = lambda * trace(eto + deto) * Stensor::Id() + 2 * mu * (eto + deto);
+  if (computeTangentOperator_) {
+    Dt = lambda * Stensor4::IxI() + 2 * mu * Stensor4::Id();
+  }
+}
+")
+
+file(WRITE ${TEST_DIRECTORY}/Wrapper.mfront
+"@DSL MaterialProperty;
+@Law CacheTestWrapper;
+@MFront{\"YoungModulus.mfront\", \"generic\"};
+@Output v;
+@Function{
+  v = 1;
+}
+")
+
+# treat the given file and check if it has been restored from the cache
+# \param[in] f: file
+# \param[in] restored: expected result
+function(check_mfront f restored)
+  execute_process(
+    COMMAND ${TEST_PROGRAM} --cache-directory=cache --verbose=level2
+            --interface=generic ${f}
+    WORKING_DIRECTORY ${TEST_DIRECTORY}
+    OUTPUT_VARIABLE TEST_OUTPUT
+    ERROR_VARIABLE TEST_ERROR
+    RESULT_VARIABLE TEST_RESULT)
+  if(TEST_RESULT)
+    message(FATAL_ERROR "Failed: Test program ${TEST_PROGRAM} exited != 0.\n${TEST_OUTPUT}\n${TEST_ERROR}")
+  endif(TEST_RESULT)
+  string(FIND "${TEST_OUTPUT}${TEST_ERROR}"
+    "File '${f}' restored from cache" pos)
+  if(restored AND (pos EQUAL -1))
+    message(FATAL_ERROR "Failed: file '${f}' shall be restored from the cache")
+  endif(restored AND (pos EQUAL -1))
+  if((NOT restored) AND (NOT (pos EQUAL -1)))
+    message(FATAL_ERROR "Failed: file '${f}' shall not be restored from the cache")
+  endif((NOT restored) AND (NOT (pos EQUAL -1)))
+endfunction(check_mfront)
+
+# check that the sources generated by the given interface contains the
+# given value of the Young modulus
+# \param[in] i: interface
+# \param[in] v: value
+function(check_young_modulus i v)
+  file(READ ${TEST_DIRECTORY}/src/CacheTestYoungModulus-${i}.cxx src)
+  string(FIND "${src}" "E0(${v})" pos)
+  if(pos EQUAL -1)
+    string(FIND "${src}" "E0 = real(${v})" pos)
+  endif(pos EQUAL -1)
+  if(pos EQUAL -1)
+    message(FATAL_ERROR "Failed: the generated sources do not use the value '${v}'")
+  endif(pos EQUAL -1)
+endfunction(check_young_modulus)
+
+# hit
+check_mfront(YoungModulus.mfront OFF)
+check_mfront(YoungModulus.mfront ON)
+check_young_modulus(generic 1.5e+11)
+# miss after modifying an imported file
+file(WRITE ${TEST_DIRECTORY}/YoungModulusParameters.mfront
+  "@Parameter E0 = 200e9;\n")
+check_mfront(YoungModulus.mfront OFF)
+check_young_modulus(generic 2e+11)
+check_mfront(YoungModulus.mfront ON)
+# nested imports
+check_mfront(Behaviour.mfront OFF)
+check_mfront(Behaviour.mfront ON)
+check_young_modulus(mfront 2e+11)
+file(WRITE ${TEST_DIRECTORY}/YoungModulusParameters.mfront
+  "@Parameter E0 = 180e9;\n")
+check_mfront(Behaviour.mfront OFF)
+check_young_modulus(mfront 1.8e+11)
+check_mfront(Behaviour.mfront ON)
+# the material law used by the behaviour is restored from the cache while
+# the behaviour is treated again. The files imported by the material law
+# shall still be dependencies of the behaviour.
+file(APPEND ${TEST_DIRECTORY}/Behaviour.mfront "// modified\n")
+check_mfront(Behaviour.mfront OFF)
+check_mfront(Behaviour.mfront ON)
+file(WRITE ${TEST_DIRECTORY}/YoungModulusParameters.mfront
+  "@Parameter E0 = 210e9;\n")
+check_mfront(Behaviour.mfront OFF)
+check_young_modulus(mfront 2.1e+11)
+check_mfront(Behaviour.mfront ON)
+
+# files treated through the `@MFront` keyword
+check_mfront(Wrapper.mfront OFF)
+check_mfront(Wrapper.mfront ON)
+# the material law is restored from the cache while treating the wrapper
+file(APPEND ${TEST_DIRECTORY}/Wrapper.mfront "// modified\n")
+check_mfront(Wrapper.mfront OFF)
+check_mfront(Wrapper.mfront ON)
+file(WRITE ${TEST_DIRECTORY}/YoungModulusParameters.mfront
+  "@Parameter E0 = 230e9;\n")
+check_mfront(Wrapper.mfront OFF)
+check_young_modulus(generic 2.3e+11)
+check_mfront(Wrapper.mfront ON)
+
+# everything went fine...
+message(STATUS "Passed: the compilation cache is consistent")
@@ -0,0 +1,62 @@
+# This script checks that `mfront` builds the libraries using the number
+# of jobs given by the `--jobs` option.
+#
+# `mfront` calls the `tfel-config` utility to retrieve the compilation
+# flags. The `tfel-config` utility of the build tree reports the
+# installation paths, so a script mimicking `tfel-config` for the build
+# tree is generated.
+
+# arguments checking
+foreach(v TEST_PROGRAM TEST_JOBS MFRONT_FILE TEST_DIRECTORY TEST_LIBRARY
+    TFEL_SOURCE_DIR TFEL_BINARY_DIR CXX_COMPILER)
+  if(NOT ${v})
+    message(FATAL_ERROR "Require ${v} to be defined")
+  endif(NOT ${v})
+endforeach(v)
+
+file(REMOVE_RECURSE ${TEST_DIRECTORY})
+file(MAKE_DIRECTORY ${TEST_DIRECTORY}/bin)
+
+file(WRITE ${TEST_DIRECTORY}/tfel-config.sh
+"#!/bin/sh
+for a in \"$@\"; do
+  case \"$a\" in
+    --cppflags)
+      printf '%s ' '-I${TFEL_BINARY_DIR}/include' \\
+        '-I${TFEL_SOURCE_DIR}/mfront/include' ;;
+    --compiler-flags) printf '%s ' '-std=c++20 -fvisibility=hidden' ;;
+    --include-path) printf '%s ' '${TFEL_SOURCE_DIR}/include' ;;
+    --oflags) printf '%s ' '-O0' ;;
+    --library-path) printf '%s ' '${TEST_DIRECTORY}' ;;
+  esac
+done
+echo
+")
+file(COPY ${TEST_DIRECTORY}/tfel-config.sh
+  DESTINATION ${TEST_DIRECTORY}/bin
+  FILE_PERMISSIONS OWNER_READ OWNER_WRITE OWNER_EXECUTE)
+file(RENAME ${TEST_DIRECTORY}/bin/tfel-config.sh
+  ${TEST_DIRECTORY}/bin/tfel-config)
+
+set(ENV{PATH} "${TEST_DIRECTORY}/bin:$ENV{PATH}")
+set(ENV{CXX} "${CXX_COMPILER}")
+
+execute_process(
+  COMMAND ${TEST_PROGRAM} --obuild --jobs=${TEST_JOBS} --interface=generic
+  ${MFRONT_FILE}
+  WORKING_DIRECTORY ${TEST_DIRECTORY}
+  OUTPUT_VARIABLE TEST_OUTPUT
+  ERROR_VARIABLE TEST_ERROR
+  RESULT_VARIABLE TEST_RESULT)
+
+# if the return value is !=0 bail out
+if(TEST_RESULT)
+  message(FATAL_ERROR "Failed: Test program ${TEST_PROGRAM} exited != 0.\n${TEST_OUTPUT}\n${TEST_ERROR}")
+endif(TEST_RESULT)
+
+if(NOT EXISTS ${TEST_DIRECTORY}/src/${TEST_LIBRARY})
+  message(FATAL_ERROR "Failed: library '${TEST_LIBRARY}' has not been built")
+endif(NOT EXISTS ${TEST_DIRECTORY}/src/${TEST_LIBRARY})
+
+# everything went fine...
+message(STATUS "Passed: library '${TEST_LIBRARY}' has been built")
@@ -17,10 +17,10 @@
 #include <map>
 #include <memory>
 #include <string>
-#include "TFEL/Math/Evaluator.hxx"
 #include "TFEL/Tests/TestResult.hxx"
 #include "MTest/Config.hxx"
 #include "MTest/MTest.hxx"
+#include "MTest/Formula.hxx"
 
 namespace mtest {
 
@@ -61,7 +61,7 @@ namespace mtest {
     AnalyticalTest& operator=(const AnalyticalTest&) = delete;
     AnalyticalTest& operator=(AnalyticalTest&&) = delete;
     //! analytical solution
-    tfel::math::Evaluator f;
+    Formula f;
     //! results of the test
     tfel::tests::TestResult results;
     //! variable name
@@ -294,6 +294,21 @@ namespace mtest {
      */
     virtual void setUnsignedIntegerParameter(const std::string&,
                                              const unsigned short) const = 0;
+    /*!
+     * \return true if the values of the parameters can be changed for this
+     * object only (see the `setInstanceParameter` method). Otherwise, the
+     * values of the parameters are shared by all the objects associated
+     * with the same behaviour.
+     */
+    virtual bool hasInstanceParameters() const = 0;
+    /*!
+     * \brief set the value of a parameter for this object only. The values
+     * of the other parameters are the default ones, unless they have been
+     * changed through this object.
+     * \param[in] n : name of the parameter
+     * \param[in] v : value
+     */
+    virtual void setInstanceParameter(const std::string&, const real) = 0;
     /*!
      * \brief allocate workspace
      * \param[out] wk : behaviour workspace
@@ -64,6 +64,8 @@ namespace mtest {
     void setIntegerParameter(const std::string&, const int) const override;
     void setUnsignedIntegerParameter(const std::string&,
                                      const unsigned short) const override;
+    bool hasInstanceParameters() const override;
+    void setInstanceParameter(const std::string&, const real) override;
     //! \brief destructor
     ~BehaviourWrapperBase() override;
 
@@ -0,0 +1,119 @@
+/*!
+ * \file   BorderedBandedLUSolver.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_BORDEREDBANDEDLUSOLVER_HXX
+#define LIB_MTEST_BORDEREDBANDEDLUSOLVER_HXX
+
+#include <vector>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a linear solver dedicated to matrices of the form:
+   *
+   * \f[
+   * \left(
+   * \begin{array}{cc}
+   * A   & b \\
+   * c^T & d
+   * \end{array}
+   * \right)
+   * \f]
+   *
+   * where \f$A\f$ is a banded matrix of half bandwidth \f$p\f$, i.e.
+   * \f$A_{ij}=0\f$ if \f$|i-j|>p\f$, and \f$b\f$ and \f$c\f$ are dense
+   * vectors.
+   *
+   * Such matrices arise in the `PipeTest` class: the radial
+   * displacements of the nodes are only coupled to their neighbours
+   * while the axial strain, which is the last unknown, is coupled to
+   * all the nodes.
+   *
+   * The block \f$A\f$ is factorised using an LU decomposition with
+   * partial pivoting restricted to the band, which requires
+   * \f$O(n\,p^{2})\f$ operations. The last unknown is eliminated using
+   * the Schur complement \f$d-c^{T}\,A^{-1}\,b\f$.
+   */
+  struct MTEST_VISIBILITY_EXPORT BorderedBandedLUSolver {
+    //! \brief a simple alias
+    using size_type = tfel::math::matrix<real>::size_type;
+    /*!
+     * \brief constructor
+     * \param[in] n: size of the linear system, including the border
+     * \param[in] p: half bandwidth of the banded block
+     */
+    BorderedBandedLUSolver(const size_type, const size_type);
+    //! \return the size of the linear system
+    size_type size() const;
+    //! \return the half bandwidth of the banded block
+    size_type getHalfBandwidth() const;
+    /*!
+     * \brief factorise the given matrix.
+     *
+     * Only the terms of the matrix lying in the band and in the
+     * last row and last column are read. The other terms are assumed
+     * to be null.
+     *
+     * \param[in] m: matrix
+     */
+    void factorize(const tfel::math::matrix<real>&);
+    /*!
+     * \brief solve the linear system using the last factorised matrix.
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    void solve(tfel::math::vector<real>&) const;
+    /*!
+     * \brief factorise the given matrix and solve the linear system
+     * \param[in] m: matrix
+     * \param[in,out] x: right hand side on input, solution on output
+     */
+    void exe(const tfel::math::matrix<real>&, tfel::math::vector<real>&);
+
+   private:
+    //! \return a reference to the term `(i, j)` of the banded block
+    real& get(const size_type, const size_type);
+    //! \return the term `(i, j)` of the banded block
+    real get(const size_type, const size_type) const;
+    //! \brief solve \f$A\,x=y\f$ using the factorised banded block
+    void solveBandedBlock(real* const) const;
+    //! \brief size of the banded block
+    size_type m;
+    //! \brief half bandwidth
+    size_type p;
+    /*!
+     * \brief number of terms stored per row of the banded block.
+     *
+     * Partial pivoting increases the upper bandwidth of the factorised
+     * matrix up to \f$2\,p\f$. Each row thus stores the columns
+     * \f$i-p\f$ to \f$i+2\,p\f$.
+     */
+    size_type w;
+    //! \brief banded block, stored row by row
+    std::vector<real> ab;
+    //! \brief row interchanges performed during the factorisation
+    std::vector<size_type> pivots;
+    //! \brief last row of the matrix, excluding the last term
+    std::vector<real> c;
+    //! \brief \f$A^{-1}\,b\f$
+    std::vector<real> z;
+    //! \brief Schur complement associated with the last unknown
+    real s = real(0);
+  };  // end of struct BorderedBandedLUSolver
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_BORDEREDBANDEDLUSOLVER_HXX */
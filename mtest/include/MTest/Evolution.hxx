@@ -15,6 +15,8 @@
 #define LIB_MTEST_MTESTEVOLUTION_HXX
 
 #include <map>
+#include <span>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include "MTest/Config.hxx"
@@ -82,8 +84,17 @@ namespace mtest {
     real value;
   };
 
-  //! \brief a linear per interval evolution
+  /*!
+   * \brief a linear per interval evolution
+   *
+   * Times and values are stored in contiguous sorted arrays. The index
+   * of the last interval used is kept so that successive evaluations at
+   * increasing times, which are the most common case, do not require a
+   * binary search.
+   */
   struct MTEST_VISIBILITY_EXPORT LPIEvolution final : public Evolution {
+    //! \brief a simple alias
+    using size_type = std::vector<real>::size_type;
     /*!
      * \return the interpolation in a set of values
      * \param[in] values: values use to create the interpolation
@@ -98,6 +109,12 @@ namespace mtest {
     LPIEvolution(const std::vector<real>&, const std::vector<real>&);
     //
     real operator()(const real) const override;
+    /*!
+     * \brief evaluate the evolution at the given times
+     * \param[out] r: values of the evolution
+     * \param[in] t: times
+     */
+    void evaluate(std::span<real>, std::span<const real>) const;
     bool isConstant() const override;
     void setValue(const real) override;
     void setValue(const real, const real) override;
@@ -105,7 +122,25 @@ namespace mtest {
     ~LPIEvolution() override;
 
    private:
-    std::map<real, real> values;
+    /*!
+     * \return the interpolation at the given time
+     * \param[in,out] i: index of the upper bound of the interval used
+     * for the previous evaluation on input, and of the interval used on
+     * output
+     * \param[in] t: time
+     */
+    TFEL_VISIBILITY_LOCAL real interpolate(size_type&, const real) const;
+    //! \brief times, sorted in increasing order
+    std::vector<real> times;
+    //! \brief values
+    std::vector<real> values;
+    /*!
+     * \brief index of the upper bound of the last interval used.
+     *
+     * This member is atomic since evolutions may be evaluated
+     * concurrently.
+     */
+    mutable std::atomic<size_type> hint = 1;
   };  // end of struct LPIEvolution
 
   /*!
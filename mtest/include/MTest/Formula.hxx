@@ -0,0 +1,76 @@
+/*!
+ * \file   Formula.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_FORMULA_HXX
+#define LIB_MTEST_FORMULA_HXX
+
+#include <string>
+#include <vector>
+#include "TFEL/Math/Evaluator.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+#include "MTest/Evolution.hxx"
+#include "MTest/FormulaCompiler.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a formula defined by the user.
+   *
+   * Constant evolutions are replaced by their values. If the compilation
+   * of formulas is enabled (see the `FormulaCompiler` class), the
+   * formula is evaluated by a native function. Otherwise, the formula is
+   * interpreted by the `tfel::math::Evaluator` class.
+   */
+  struct MTEST_VISIBILITY_EXPORT Formula {
+    //! \brief a simple alias
+    using size_type = std::vector<real>::size_type;
+    /*!
+     * \brief constructor
+     * \param[in] f: formula
+     * \param[in] evm: evolution manager
+     */
+    Formula(const std::string&, const EvolutionManager&);
+    //! \brief move constructor
+    Formula(Formula&&);
+    //! \brief copy constructor
+    Formula(const Formula&);
+    //! \return the names of the variables, sorted by positions
+    const std::vector<std::string>& getVariablesNames() const;
+    /*!
+     * \brief set the value of a variable
+     * \param[in] i: position of the variable
+     * \param[in] v: value
+     */
+    void setVariableValue(const size_type, const real);
+    //! \return the value of the formula
+    real getValue();
+    //! \return if the formula is evaluated by a native function
+    bool isCompiled() const;
+    //! \brief destructor
+    ~Formula();
+
+   private:
+    //! \brief interpreted formula
+    tfel::math::Evaluator evaluator;
+    //! \brief names of the variables, sorted by positions
+    std::vector<std::string> variables;
+    //! \brief values of the variables, used by the native function
+    std::vector<real> values;
+    //! \brief native function
+    FormulaCompiler::FunctionPtr fct = nullptr;
+  };  // end of struct Formula
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_FORMULA_HXX */
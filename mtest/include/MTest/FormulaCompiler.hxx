@@ -0,0 +1,104 @@
+/*!
+ * \file   FormulaCompiler.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_FORMULACOMPILER_HXX
+#define LIB_MTEST_FORMULACOMPILER_HXX
+
+#include <map>
+#include <mutex>
+#include <string>
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace tfel::math {
+  // forward declaration
+  struct Evaluator;
+}  // end of namespace tfel::math
+
+namespace mtest {
+
+  /*!
+   * \brief a class translating formulas into native functions.
+   *
+   * The formula is translated into a `C++` function which is compiled in
+   * a shared library stored in a cache directory. The name of the
+   * library is built from a hash of the generated sources, so that the
+   * cache directory can be shared by successive runs: a library is only
+   * compiled once. This hash also takes into account the compiler, the
+   * compilation flags, the version of `TFEL` and a description of the
+   * binary interface, so that a library built in another context is not
+   * reused.
+   *
+   * The compilation is disabled by default. It is enabled by defining a
+   * cache directory, either explicitly or through the
+   * `MTEST_FORMULAS_CACHE_DIRECTORY` environment variable. The compiler
+   * is given by the `CXX` environment variable (`c++` by default).
+   * Additional compilation flags can be given by the `CXXFLAGS`
+   * environment variable.
+   *
+   * \note contrary to the `Evaluator` class, native functions do not
+   * check the validity of the operations (division by zero, domain of
+   * the mathematical functions, etc.).
+   */
+  struct MTEST_VISIBILITY_EXPORT FormulaCompiler {
+    //! \brief a simple alias
+    using FunctionPtr = real (*)(const real*);
+    //! \return the unique instance of this class
+    static FormulaCompiler& getFormulaCompiler();
+    /*!
+     * \brief set the cache directory and enable the compilation of
+     * formulas
+     * \param[in] d: directory
+     */
+    void setCacheDirectory(const std::string&);
+    //! \return the cache directory
+    const std::string& getCacheDirectory() const;
+    //! \return if the compilation of formulas is enabled
+    bool isEnabled() const;
+    /*!
+     * \return a native function computing the value of the given
+     * formula or a null pointer if the compilation is disabled or if the
+     * formula can't be compiled. The native function takes the values
+     * of the variables, sorted by positions.
+     * \param[in] e: formula
+     */
+    FunctionPtr compile(const tfel::math::Evaluator&);
+
+   private:
+    //! \brief default constructor
+    FormulaCompiler();
+    FormulaCompiler(FormulaCompiler&&) = delete;
+    FormulaCompiler(const FormulaCompiler&) = delete;
+    FormulaCompiler& operator=(FormulaCompiler&&) = delete;
+    FormulaCompiler& operator=(const FormulaCompiler&) = delete;
+    /*!
+     * \brief compile the given sources in a shared library, unless the
+     * library is already available in the cache directory.
+     * \return the path to the library or an empty string if the
+     * compilation failed.
+     * \param[in] n: name of the function
+     * \param[in] src: sources
+     */
+    TFEL_VISIBILITY_LOCAL std::string buildLibrary(const std::string&,
+                                                   const std::string&) const;
+    //! \brief functions already loaded, sorted by names
+    std::map<std::string, FunctionPtr> functions;
+    //! \brief cache directory
+    std::string directory;
+    //! \brief mutex protecting the functions and the cache directory
+    std::mutex m;
+  };  // end of struct FormulaCompiler
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_FORMULACOMPILER_HXX */
@@ -14,11 +14,10 @@
 #ifndef LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 #define LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 
-#include "TFEL/Math/Evaluator.hxx"
-
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
 #include "MTest/Evolution.hxx"
+#include "MTest/Formula.hxx"
 
 namespace mtest {
 
@@ -39,8 +38,8 @@ namespace mtest {
    private:
     //! \brief externally defined evolutions
     const EvolutionManager& evm;
-    //! \brief Evaluator
-    mutable tfel::math::Evaluator f;
+    //! \brief formula
+    mutable Formula f;
   };
 
 }  // end of namespace mtest
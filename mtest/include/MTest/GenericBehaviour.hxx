@@ -14,6 +14,8 @@
 #ifndef LIB_MTEST_GENERICBEHAVIOUR_HXX
 #define LIB_MTEST_GENERICBEHAVIOUR_HXX
 
+#include <string>
+#include <vector>
 #include "TFEL/System/ExternalFunctionsPrototypes.hxx"
 #include "MFront/GenericBehaviour/BehaviourData.hxx"
 #include "MTest/StandardBehaviourBase.hxx"
@@ -66,10 +68,24 @@ namespace mtest {
         const tfel::math::tmatrix<3u, 3u, real>&) const override;
 
     void allocateWorkSpace(BehaviourWorkSpace&) const override;
+
+    void setParameter(const std::string&, const real) const override;
+    void setIntegerParameter(const std::string&, const int) const override;
+    void setUnsignedIntegerParameter(const std::string&,
+                                     const unsigned short) const override;
+    bool hasInstanceParameters() const override;
+    void setInstanceParameter(const std::string&, const real) override;
     //! destructor
     ~GenericBehaviour() override;
 
    protected:
+    /*!
+     * \brief update the value of a parameter in the block of parameters
+     * associated with this object, if any.
+     * \param[in] n : name of the parameter
+     * \param[in] v : value
+     */
+    virtual void updateInstanceParameter(const std::string&, const real) const;
     /*!
      * \brief integrate the mechanical behaviour over the time step
      * \return a pair. The first member is true if the integration was
@@ -104,6 +120,32 @@ namespace mtest {
 
     //! \brief pointer to the function
     tfel::system::GenericBehaviourFctPtr fct;
+    /*!
+     * \brief pointer to the function integrating the behaviour using a block
+     * of parameters. This pointer is null if the library does not export
+     * this function.
+     */
+    tfel::system::GenericBehaviourWithParametersFctPtr fct_with_parameters =
+        nullptr;
+    /*!
+     * \brief names of the parameters, ordered as in the block of parameters
+     * passed to `fct_with_parameters`
+     */
+    std::vector<std::string> instance_parameters_names;
+    /*!
+     * \brief block of parameters, initialized using the default values of
+     * the parameters and updated by all the parameters' setters.
+     *
+     * \note this member is mutable since the `setParameter`,
+     * `setIntegerParameter` and `setUnsignedIntegerParameter` methods are
+     * `const`.
+     */
+    mutable std::vector<real> instance_parameters;
+    /*!
+     * \brief boolean stating if the block of parameters shall be used, i.e.
+     * if the `setInstanceParameter` method has been called.
+     */
+    bool use_instance_parameters = false;
     /*!
      * \brief pointer to the function in charge of rotating the gradients from
      * the global frame to the material frame
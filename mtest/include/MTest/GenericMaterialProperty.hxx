@@ -27,12 +27,25 @@ namespace mtest {
     GenericMaterialProperty(const std::string&, const std::string&);
     //
     real getValue() const override;
+    /*!
+     * \brief evaluate the material property on arrays of values of the
+     * variables using the `_array` function generated by the `generic`
+     * interface, if available.
+     */
+    void getValues(real* const,
+                   const real* const* const,
+                   const std::size_t) override;
     //! \brief destructor
     ~GenericMaterialProperty() override;
 
    private:
     //! \brief the castem function
     ::mfront_gmp_MaterialPropertyPtr fct;
+    /*!
+     * \brief function evaluating the material property on arrays of
+     * values, if available
+     */
+    ::mfront_gmp_MaterialPropertyArrayPtr array_fct = nullptr;
   };  // end of struct GenericMaterialProperty
 
 }  // end of namespace mtest
@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
 #include <fstream>
 
 #include "TFEL/Config/TFELConfig.hxx"
@@ -163,6 +164,23 @@ namespace mtest {
                          SolverWorkSpace&,
                          const real,
                          const real);
+    /*!
+     * \brief integrate the behaviour over the whole loading path
+     * without writing any output nor checking the tests.
+     *
+     * This method does not modify the test once initialised, so that
+     * many loading paths can be computed using different states and
+     * workspaces. Events are not supported.
+     *
+     * \param[out] s: current structure state
+     * \param[out] wk: workspace
+     * \param[in] f: function called at the beginning of the loading path
+     * and at the end of each time step
+     */
+    virtual void executeLoadingPath(
+        StudyCurrentState&,
+        SolverWorkSpace&,
+        const std::function<void(const real, const StudyCurrentState&)>&);
     /*!
      * \brief ask the comparison to the numerical tangent operator
      * \param[in] bo : boolean
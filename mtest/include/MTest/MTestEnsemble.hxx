@@ -0,0 +1,140 @@
+/*!
+ * \file   mtest/include/MTest/MTestEnsemble.hxx
+ * \brief  This file declares the `MTestEnsemble` class
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_MTESTENSEMBLE_HXX
+#define LIB_MTEST_MTESTENSEMBLE_HXX
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+#include "MTest/MTestParser.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief class used to run the same `MTest` input file for a table of
+   * samples of some of its variables (ensemble or parameter sweep).
+   *
+   * The input file is read once. For each sample, a test is filled from
+   * the tokens read and integrated by one of the worker threads, each
+   * worker having its own state and its own workspace. Only the
+   * requested outputs are kept: no result file is written and the
+   * tests declared in the input file are not checked.
+   *
+   * A sampled variable can either be a constant evolution (a material
+   * property, an external state variable or a real value declared by
+   * the `@Real` keyword) or a parameter of the behaviour. The values
+   * of the sampled constant evolutions override the ones given in the
+   * input file before the test is filled, so that the formulas
+   * evaluated while reading the input file use them. The values of
+   * the sampled parameters are set for the behaviour of each test only
+   * if the behaviour supports it (see the `hasInstanceParameters`
+   * method of the `Behaviour` class). Otherwise, the parameters of a
+   * behaviour are shared by all its instances and sampling a parameter
+   * forces a sequential execution.
+   */
+  struct MTEST_VISIBILITY_EXPORT MTestEnsemble {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief outputs kept for each sample
+    enum OutputMode {
+      //! \brief the values of the outputs at the end of the loading path
+      FINALVALUES,
+      //! \brief the time and the values of the outputs at each time step
+      HISTORY
+    };  // end of OutputMode
+    /*!
+     * \brief function called once per sample, as soon as its results are
+     * available. The samples are thus not treated in order. Calls are
+     * serialized.
+     *
+     * The arguments are the index of the sample, a boolean stating if the
+     * computation succeeded and the values of the outputs. In the
+     * `HISTORY` mode, those values are stored line by line, each line
+     * starting with the time. If the computation failed, the values are
+     * empty.
+     */
+    using OutputHandler = std::function<void(
+        const size_type, const bool, const std::vector<real>&)>;
+    /*!
+     * \brief constructor
+     * \param[in] f:     file name
+     * \param[in] ecmds: external commands
+     * \param[in] s:     substitutions patterns
+     */
+    MTestEnsemble(const std::string&,
+                  const std::vector<std::string>& = {},
+                  const std::map<std::string, std::string>& = {});
+    /*!
+     * \brief set the names of the sampled variables
+     * \param[in] n: names
+     */
+    void setSampledVariables(const std::vector<std::string>&);
+    /*!
+     * \brief set the names of the outputs. An output can be any
+     * component of the gradients or of the thermodynamic forces, an
+     * internal state variable or an external state variable.
+     * \param[in] n: names
+     */
+    void setOutputs(const std::vector<std::string>&);
+    //! \brief set the output mode
+    void setOutputMode(const OutputMode);
+    /*!
+     * \brief set the maximal number of threads used.
+     * \param[in] n: number of threads
+     */
+    void setNumberOfThreads(const size_type);
+    /*!
+     * \brief run the computations associated with the given samples
+     * \return the number of failed computations
+     * \param[in] samples: values of the sampled variables, one vector per
+     * sample
+     * \param[in] h: output handler
+     */
+    size_type execute(const std::vector<std::vector<real>>&,
+                      const OutputHandler&);
+    /*!
+     * \return the outputs associated with the given samples, in the
+     * order of the samples. The outputs of a failed sample are empty.
+     * \param[in] samples: values of the sampled variables, one vector per
+     * sample
+     */
+    std::vector<std::vector<real>> execute(
+        const std::vector<std::vector<real>>&);
+    //! \brief destructor
+    ~MTestEnsemble();
+
+   private:
+    MTestEnsemble(MTestEnsemble&&) = delete;
+    MTestEnsemble(const MTestEnsemble&) = delete;
+    MTestEnsemble& operator=(MTestEnsemble&&) = delete;
+    MTestEnsemble& operator=(const MTestEnsemble&) = delete;
+    //! \brief parser, holding the tokens of the input file
+    MTestParser parser;
+    //! \brief names of the sampled variables
+    std::vector<std::string> sampled_variables;
+    //! \brief names of the outputs
+    std::vector<std::string> outputs;
+    //! \brief output mode
+    OutputMode mode = FINALVALUES;
+    //! \brief maximal number of threads
+    size_type nthreads = 1;
+  };  // end of struct MTestEnsemble
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_MTESTENSEMBLE_HXX */
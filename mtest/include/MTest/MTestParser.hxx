@@ -55,6 +55,23 @@ namespace mtest {
      * \param[in] s : string
      */
     void parseString(MTest&, const std::string&);
+    /*!
+     * \brief read a file, apply the substitutions and insert the
+     * external commands without filling any test. The `execute(MTest&)`
+     * method can then be called to fill as many tests as needed.
+     * \param[in] f:     file name
+     * \param[in] ecmds: external commands
+     * \param[in] s:     substitutions patterns inserted
+     */
+    void parseFile(const std::string&,
+                   const std::vector<std::string>&,
+                   const std::map<std::string, std::string>&);
+    /*!
+     * \brief fill a test using the tokens read by the `parseFile` or
+     * `parseString` methods.
+     * \param[out] t : structure to be filled
+     */
+    void execute(MTest&);
     //! \return the list of keywords
     virtual std::vector<std::string> getKeyWordsList() const;
     //! \brief display the list of keywords
@@ -69,11 +86,6 @@ namespace mtest {
    protected:
     //! a simple alias
     using CallBack = void (MTestParser::*)(MTest&, tokens_iterator&);
-    /*!
-     * execute mtest parser after reading a file or parsing a string
-     * \param[out] t : structure to be filled
-     */
-    void execute(MTest& t);
     /*!
      * register the call backs associated with each command
      */
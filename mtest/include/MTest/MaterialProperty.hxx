@@ -53,6 +53,20 @@ namespace mtest {
     virtual void setVariableValue(const std::size_t, const real) = 0;
     //! \brief return the value of the material property
     virtual real getValue() const = 0;
+    /*!
+     * \brief evaluate the material property on arrays of values of the
+     * variables.
+     * \param[out] values: values of the material property
+     * \param[in] args: arrays of values of the variables, in the order
+     * given by the `getVariablesNames` method
+     * \param[in] n: size of the arrays
+     *
+     * \note the default implementation calls the `setVariableValue` and
+     * `getValue` methods for each element of the arrays.
+     */
+    virtual void getValues(real* const,
+                           const real* const* const,
+                           const std::size_t);
     /*!
      * \brief set the value of a parameter
      * \param[in] n: name of the variable
@@ -90,6 +104,15 @@ namespace mtest {
    * \param[in] mp: material property
    */
   MTEST_VISIBILITY_EXPORT real getValue(MaterialProperty&);
+  /*!
+   * \return the values of a material property for the given arrays of
+   * values of the arguments
+   * \param[in] mp: material property
+   * \param[in] args: arrays of values of the arguments. All arrays
+   * must have the same size.
+   */
+  MTEST_VISIBILITY_EXPORT std::vector<real> getValues(
+      MaterialProperty&, const std::vector<std::vector<real>>&);
 
 }  // namespace mtest
 
@@ -29,6 +29,10 @@ namespace mtest {
   struct Behaviour;
   // forward declaration
   struct StructureCurrentState;
+  // forward declaration
+  struct BehaviourWorkSpace;
+  // forward declaration
+  struct PipeElementContribution;
 
   /*!
    * \brief structure describing a cubic element for pipes
@@ -108,6 +112,42 @@ namespace mtest {
         const real,
         const StiffnessMatrixType,
         const size_t);
+    /*!
+     * \brief compute the contribution of the element to the stiffness
+     * matrix and the residual.
+     *
+     * Contrary to the previous overload, this method does not modify
+     * the global stiffness matrix and residual and uses the given
+     * behaviour workspace. It can thus be called concurrently on
+     * different elements.
+     *
+     * \return a pair containing:
+     * - a boolean syaing if the behaviour integration shall be
+     *   performed
+     * - a scaling factor that can be used to:
+     *     - increase the time step if the integration was successfull
+     *     - decrease the time step if the integration failed or if the
+     *       results were not reliable (time step too large).
+     * \param[out] c:   contribution of the element
+     * \param[out] scs: structure current state
+     * \param[out] bwk: behaviour workspace
+     * \param[in]  b:   behaviour
+     * \param[in]  u1:  current displacement estimation
+     * \param[in]  m:   pipe mesh
+     * \param[in]  dt:  time increment
+     * \param[in]  mt:  stiffness matrix type
+     * \param[in]  i:   element number
+     */
+    static std::pair<bool, real> updateStiffnessMatrixAndInnerForces(
+        PipeElementContribution&,
+        StructureCurrentState&,
+        BehaviourWorkSpace&,
+        const Behaviour&,
+        const tfel::math::vector<real>&,
+        const PipeMesh&,
+        const real,
+        const StiffnessMatrixType,
+        const size_t);
 
    private:
     static constexpr real one_third = real{1} / real{3};
@@ -123,6 +163,23 @@ namespace mtest {
     static constexpr inline real dsf2(const real);
     static constexpr inline real sf3(const real);
     static constexpr inline real dsf3(const real);
+    /*!
+     * \brief implementation of the `updateStiffnessMatrixAndInnerForces`
+     * methods.
+     */
+    template <typename StiffnessMatrix, typename InnerForces>
+    static std::pair<bool, real>
+    updateStiffnessMatrixAndInnerForcesImplementation(
+        StiffnessMatrix&,
+        InnerForces&,
+        StructureCurrentState&,
+        BehaviourWorkSpace&,
+        const Behaviour&,
+        const tfel::math::vector<real>&,
+        const PipeMesh&,
+        const real,
+        const StiffnessMatrixType,
+        const size_t);
   };  // end of struct PipeCubicElement
 
 }  // end of namespace mtest
@@ -0,0 +1,99 @@
+/*!
+ * \file   PipeElementContribution.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_PIPEELEMENTCONTRIBUTION_HXX
+#define LIB_MTEST_PIPEELEMENTCONTRIBUTION_HXX
+
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief contribution of an element to the residual and to the
+   * stiffness matrix of a pipe.
+   *
+   * The unknowns of an element are the radial displacements of its
+   * nodes, which are numbered consecutively, and the axial strain.
+   * Terms are accessed using the global numbering of the unknowns, so
+   * that the elements can fill either the global stiffness matrix and
+   * residual or an object of this type.
+   *
+   * This class allows the contributions of the elements to be computed
+   * concurrently, and then assembled in a deterministic order.
+   */
+  struct MTEST_VISIBILITY_EXPORT PipeElementContribution {
+    //! \brief a simple alias
+    using size_type = tfel::math::matrix<real>::size_type;
+    //! \brief maximum number of nodes of an element
+    static constexpr size_type maximum_number_of_nodes = 4;
+    /*!
+     * \brief initialize the contribution and set all terms to zero
+     * \param[in] f: index of the first node of the element
+     * \param[in] n: number of nodes of the element
+     * \param[in] a: index of the axial strain
+     */
+    void initialize(const size_type, const size_type, const size_type);
+    /*!
+     * \return the term of the residual associated with the given unknown
+     * \param[in] i: global index of the unknown
+     */
+    real& operator[](const size_type i) { return this->r(this->local(i)); }
+    /*!
+     * \return the term of the stiffness matrix associated with the given
+     * unknowns
+     * \param[in] i: global index of the row
+     * \param[in] j: global index of the column
+     */
+    real& operator()(const size_type i, const size_type j) {
+      return this->k(this->local(i), this->local(j));
+    }
+    /*!
+     * \brief add the contribution to the global residual and, if
+     * requested, to the global stiffness matrix.
+     * \param[in,out] K: global stiffness matrix
+     * \param[in,out] R: global residual
+     * \param[in] bk: if true, update the global stiffness matrix
+     */
+    void assemble(tfel::math::matrix<real>&,
+                  tfel::math::vector<real>&,
+                  const bool) const;
+
+   private:
+    //! \return the local index of the given unknown
+    size_type local(const size_type i) const {
+      return i == this->axial_strain_index ? this->number_of_nodes
+                                           : i - this->first_node;
+    }
+    //! \brief index of the first node of the element
+    size_type first_node = 0;
+    //! \brief number of nodes
+    size_type number_of_nodes = 0;
+    //! \brief index of the axial strain
+    size_type axial_strain_index = 0;
+    //! \brief contribution to the residual
+    tfel::math::tvector<maximum_number_of_nodes + 1, real> r;
+    //! \brief contribution to the stiffness matrix
+    tfel::math::tmatrix<maximum_number_of_nodes + 1,
+                        maximum_number_of_nodes + 1,
+                        real>
+        k;
+  };  // end of struct PipeElementContribution
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_PIPEELEMENTCONTRIBUTION_HXX */
@@ -29,6 +29,11 @@ namespace tfel::utilities {
   struct TextData;
 }  // namespace tfel::utilities
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
 namespace mtest {
 
   // forward declarations
@@ -79,6 +84,19 @@ namespace mtest {
                                         * optimizing material parameters.
                                         */
     };  // end of FailurePolicy
+    //! \brief linear solver used to solve the global equilibrium
+    enum LinearSolver {
+      DEFAULTLINEARSOLVER,
+      DENSELINEARSOLVER, /*!<
+                          * \brief the stiffness matrix is factorised using
+                          * a dense LU decomposition.
+                          */
+      BANDEDLINEARSOLVER /*!<
+                          * \brief the stiffness matrix is factorised
+                          * taking into account its banded structure. See
+                          * the `BorderedBandedLUSolver` class for details.
+                          */
+    };  // end of LinearSolver
     //! \brief base class for tests
     struct UTest {
       /*!
@@ -161,6 +179,27 @@ namespace mtest {
     virtual void setAxialLoading(const AxialLoading);
     //! \brief \return the axial loading
     virtual AxialLoading getAxialLoading() const;
+    /*!
+     * \brief set the linear solver
+     * \param[in] ls: linear solver
+     */
+    virtual void setLinearSolver(const LinearSolver);
+    //! \brief \return the linear solver
+    virtual LinearSolver getLinearSolver() const;
+    /*!
+     * \brief set the number of threads used to integrate the behaviour
+     * over the elements.
+     *
+     * If more than one thread is used, the contributions of the
+     * elements to the stiffness matrix and to the residual are computed
+     * concurrently, and then assembled sequentially in the order of the
+     * elements. The results thus do not depend on the number of threads.
+     *
+     * \param[in] n: number of threads
+     */
+    virtual void setNumberOfThreads(const size_type);
+    //! \brief \return the number of threads
+    virtual size_type getNumberOfThreads() const;
     /*!
      * \brief set the evolution of the radius of the mandrel
      * \param[in] r : evolution of the mandrel' radius
@@ -490,12 +529,31 @@ namespace mtest {
      */
     void setGaussPointPositionForEvolutionsEvaluation(
         const CurrentState&) const override;
+    /*!
+     * \brief integrate the behaviour over all elements using the thread
+     * pool and update the stiffness matrix and the residual.
+     * \return a pair containing a boolean stating if all integrations
+     * succeeded and a scaling factor for the time step
+     * \param[out] k: stiffness matrix
+     * \param[out] r: residual
+     * \param[out] scs: structure current state
+     * \param[in]  u1: current displacement estimation
+     * \param[in]  dt: time increment
+     * \param[in]  mt: stiffness matrix type
+     */
+    std::pair<bool, real> updateStiffnessMatrixAndInnerForcesConcurrently(
+        tfel::math::matrix<real>&,
+        tfel::math::vector<real>&,
+        StructureCurrentState&,
+        const tfel::math::vector<real>&,
+        const real,
+        const StiffnessMatrixType) const;
     //! \brief description of an additional
     struct AdditionalOutput {
       //! \brief description
       std::string d;
       //! \brief functor
-      std::function<void(std::ostream&, const StudyCurrentState&)> f;
+      std::function<real(const StudyCurrentState&)> f;
     };
     //! \brief additional outputs
     std::vector<AdditionalOutput> aoutputs;
@@ -543,6 +601,12 @@ namespace mtest {
     AxialLoading al = DEFAULTAXIALLOADING;
     //! \brief failure policy
     FailurePolicy failure_policy = REPORTONLY;
+    //! \brief linear solver
+    LinearSolver linear_solver = DEFAULTLINEARSOLVER;
+    //! \brief number of threads (0 means unspecified)
+    size_type number_of_threads = 0;
+    //! \brief thread pool used if more than one thread is requested
+    std::shared_ptr<tfel::system::ThreadPool> thread_pool;
     //! \brief element type
     //! \brief small strain hypothesis
     bool hpp = false;
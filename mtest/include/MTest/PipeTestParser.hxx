@@ -221,6 +221,18 @@ namespace mtest {
      * \param[in,out] p: position in the input file
      */
     virtual void handleOxidationModel(PipeTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@LinearSolver` keyword
+     * \param[out]    t: test
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleLinearSolver(PipeTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@NumberOfThreads` keyword
+     * \param[out]    t: test
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleNumberOfThreads(PipeTest&, tokens_iterator&);
     //! \brief a simple alias
     typedef void (PipeTestParser::*CallBack)(PipeTest&, tokens_iterator&);
     /*!
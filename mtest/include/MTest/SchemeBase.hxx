@@ -14,6 +14,7 @@
 #ifndef LIB_MTEST_SCHEMEBASE_HXX
 #define LIB_MTEST_SCHEMEBASE_HXX
 
+#include <map>
 #include <vector>
 #include <string>
 #include <memory>
@@ -28,6 +29,13 @@
 #include "MTest/Scheme.hxx"
 #include "MTest/SolverOptions.hxx"
 
+namespace tfel::utilities {
+
+  // forward declaration
+  struct BinaryResultFileWriter;
+
+}  // end of namespace tfel::utilities
+
 namespace mtest {
 
   // forward declaration
@@ -39,6 +47,11 @@ namespace mtest {
       USERDEFINEDTIMES,
       EVERYPERIOD
     };  // end of enum OutputFrequency
+    //! \brief format of the output file
+    enum OutputFileFormat {
+      TEXTFILEFORMAT,
+      BINARYFILEFORMAT
+    };  // end of enum OutputFileFormat
     //! a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
@@ -75,11 +88,24 @@ namespace mtest {
     virtual void setOutputFileName(const std::string&);
     //! \return true if the output file name has been defined
     virtual bool isOutputFileNameDefined() const;
+    /*!
+     * \brief disable the output file and the residual file, even if
+     * their names have been defined.
+     */
+    virtual void disableOutputFiles();
     /*!
      * \brief set the output file precision
      * \param[in] p : precision
      */
     virtual void setOutputFilePrecision(const unsigned int);
+    /*!
+     * \brief set the format of the output file
+     * \param[in] f: format
+     *
+     * In the binary format, the output file is written by the
+     * `tfel::utilities::BinaryResultFileWriter` class.
+     */
+    virtual void setOutputFileFormat(const OutputFileFormat);
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -129,6 +155,15 @@ namespace mtest {
      * \note the evolution *must* be of type LPIEvolution
      */
     virtual void setEvolutionValue(const std::string&, const real, const real);
+    /*!
+     * \brief override the values of some constant evolutions. Those
+     * values replace the ones given by the input file when the
+     * evolutions are added, so that the formulas evaluated while
+     * reading the input file use them.
+     * \param[in] v: values of the overridden evolutions
+     * \note this method must be called before reading the input file
+     */
+    virtual void overrideConstantEvolutions(const std::map<std::string, real>&);
     /*!
      * \brief set the description
      * \param[in] d : description
@@ -239,6 +274,17 @@ namespace mtest {
    protected:
     //! \return the default stiffness matrix type
     virtual StiffnessMatrixType getDefaultStiffnessMatrixType() const = 0;
+    //! \return true if the output file is written in the binary format
+    bool isBinaryOutputFile() const;
+    /*!
+     * \brief open the output file in the binary format. This method
+     * does nothing if no output file has been defined or if the output
+     * file is written in the text format.
+     * \param[in] l: legends of the columns
+     */
+    void openBinaryOutputFile(const std::vector<std::string>&);
+    //! \brief flush the output file
+    void flushOutputFile() const;
     /*!
      * \brief declare a new variable
      * \param[in] v : variable name
@@ -251,6 +297,8 @@ namespace mtest {
     void declareVariables(const std::vector<std::string>&, const bool);
     //! declared variable names
     std::vector<std::string> vnames;
+    //! \brief values of the overridden constant evolutions
+    std::map<std::string, real> overridden_evolutions;
     //! initilisation stage
     bool initialisationFinished = false;
     //! solver options
@@ -272,6 +320,12 @@ namespace mtest {
     std::string output;
     //! output file
     mutable std::ofstream out;
+    //! \brief output file in the binary format
+    mutable std::unique_ptr<tfel::utilities::BinaryResultFileWriter> bout;
+    //! \brief legends of the columns of the output file in the binary format
+    std::vector<std::string> bout_legends;
+    //! \brief format of the output file
+    OutputFileFormat output_file_format = TEXTFILEFORMAT;
     //! residual file name
     std::string residualFileName;
     //! xml file name
@@ -14,12 +14,14 @@
 #ifndef LIB_MTEST_SOLVERWORKSPACE_HXX
 #define LIB_MTEST_SOLVERWORKSPACE_HXX
 
+#include <memory>
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/matrix.hxx"
 #include "TFEL/Math/LUSolve.hxx"
 
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
+#include "MTest/BorderedBandedLUSolver.hxx"
 
 namespace mtest {
 
@@ -39,6 +41,12 @@ namespace mtest {
     tfel::math::Permutation<size_type> p_lu;
     // temporary vector used by the LUSolve::exe function
     tfel::math::vector<real> x;
+    /*!
+     * \brief solver dedicated to bordered banded stiffness matrices. If
+     * this pointer is null, the stiffness matrix is factorised using a
+     * dense LU decomposition.
+     */
+    std::shared_ptr<BorderedBandedLUSolver> bbsolver;
   };  // end of struct SolverWorkSpace
 
   /*!
@@ -47,6 +55,20 @@ namespace mtest {
    */
   MTEST_VISIBILITY_EXPORT void initialize(SolverWorkSpace&,
                                           const SolverWorkSpace::size_type);
+  /*!
+   * \brief factorise the stiffness matrix and solve the linear system
+   * \f$K\,\Delta\,u=\Delta\,u\f$
+   * \param[in,out] wk: workspace
+   */
+  MTEST_VISIBILITY_EXPORT void solveLinearSystem(SolverWorkSpace&);
+  /*!
+   * \brief solve a linear system using the stiffness matrix factorised
+   * by the last call to `solveLinearSystem`
+   * \param[in,out] wk: workspace
+   * \param[in,out] x: right hand side on input, solution on output
+   */
+  MTEST_VISIBILITY_EXPORT void backSubstitute(SolverWorkSpace&,
+                                              tfel::math::vector<real>&);
 
 }  // namespace mtest
 
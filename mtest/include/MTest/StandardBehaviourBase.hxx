@@ -122,6 +122,8 @@ namespace mtest {
     void setIntegerParameter(const std::string&, const int) const override;
     void setUnsignedIntegerParameter(const std::string&,
                                      const unsigned short) const override;
+    bool hasInstanceParameters() const override;
+    void setInstanceParameter(const std::string&, const real) override;
     std::vector<std::string> getOptionalMaterialProperties() const override;
     void setOptionalMaterialPropertiesDefaultValues(
         EvolutionManager&, const EvolutionManager&) const override;
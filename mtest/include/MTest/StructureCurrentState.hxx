@@ -71,6 +71,22 @@ namespace mtest {
     void setModellingHypothesis(const Hypothesis);
     //! \return the behaviour workspace associated to the current thread.
     BehaviourWorkSpace &getBehaviourWorkSpace() const;
+    /*!
+     * \brief allocate the given number of behaviour workspaces.
+     *
+     * This method must be called before accessing the workspaces
+     * concurrently using the `getBehaviourWorkSpace(const size_t)`
+     * method.
+     *
+     * \param[in] n: number of workspaces
+     */
+    void allocateBehaviourWorkSpaces(const size_t) const;
+    /*!
+     * \return the i-th behaviour workspace. Each thread performing
+     * behaviour integrations concurrently must use its own workspace.
+     * \param[in] i: index of the workspace
+     */
+    BehaviourWorkSpace &getBehaviourWorkSpace(const size_t) const;
     //! \return the behaviour associated to the structure
     const Behaviour &getBehaviour() const;
     /*!
@@ -11,7 +11,7 @@
 #include <memory>
 #include <vector>
 #include <fstream>
-#include "TFEL/Math/Evaluator.hxx"
+#include "MTest/Formula.hxx"
 
 namespace mtest {
 
@@ -42,7 +42,7 @@ namespace mtest {
 
    private:
     //! list of post-processings
-    std::vector<std::shared_ptr<tfel::math::Evaluator>> postprocessings;
+    std::vector<Formula> postprocessings;
     //! list of function object used to retrieve values from the current state
     std::map<std::string, std::function<real(const CurrentState&)>> extractors;
     //! evolution manager
@@ -26,7 +26,7 @@ namespace mtest {
       const std::function<real(const CurrentState&)>& g,
       const EvolutionManager& evm_,
       const real eps_)
-      : f(f_, buildExternalFunctionManagerFromConstantEvolutions(evm_)),
+      : f(f_, evm_),
         name(v),
         get(g),
         evm(evm_),
@@ -39,15 +39,17 @@ namespace mtest {
     auto throw_if = [](const bool c, const std::string& m) {
       tfel::raise_if(c, "AnalyticalTest::check:" + m);
     };
-    for (const auto& vn : this->f.getVariablesNames()) {
+    const auto& vns = this->f.getVariablesNames();
+    for (std::vector<std::string>::size_type i = 0; i != vns.size(); ++i) {
+      const auto& vn = vns[i];
       if (vn == "t") {
-        this->f.setVariableValue("t", t + dt);
+        this->f.setVariableValue(i, t + dt);
       } else {
         auto pev = this->evm.find(vn);
         throw_if(pev == this->evm.end(),
                  "no evolution named '" + vn + "' defined");
         const auto& ev = *(pev->second);
-        this->f.setVariableValue(vn, ev(t + dt));
+        this->f.setVariableValue(i, ev(t + dt));
       }
     }
     const real v = get(s);
@@ -153,6 +153,15 @@ namespace mtest {
     this->b->setUnsignedIntegerParameter(n, v);
   }  // end of setUnsignedIntegerParameter
 
+  bool BehaviourWrapperBase::hasInstanceParameters() const {
+    return this->b->hasInstanceParameters();
+  }  // end of hasInstanceParameters
+
+  void BehaviourWrapperBase::setInstanceParameter(const std::string& n,
+                                                  const real v) {
+    this->b->setInstanceParameter(n, v);
+  }  // end of setInstanceParameter
+
   BehaviourWrapperBase::~BehaviourWrapperBase() = default;
 
 }  // end of namespace mtest
@@ -0,0 +1,171 @@
+/*!
+ * \file   BorderedBandedLUSolver.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "MTest/BorderedBandedLUSolver.hxx"
+
+namespace mtest {
+
+  //! \brief value used to detect null pivots
+  static constexpr real BorderedBandedLUSolver_eps =
+      100 * std::numeric_limits<real>::min();
+
+  BorderedBandedLUSolver::BorderedBandedLUSolver(const size_type n,
+                                                 const size_type hb)
+      : m(n == 0 ? 0 : n - 1), p(hb), w(3 * hb + 1) {
+    if (n == 0) {
+      tfel::raise<tfel::math::LUInvalidMatrixSize>();
+    }
+    this->ab.resize(this->m * this->w);
+    this->pivots.resize(this->m);
+    this->c.resize(this->m);
+    this->z.resize(this->m);
+  }  // end of BorderedBandedLUSolver
+
+  BorderedBandedLUSolver::size_type BorderedBandedLUSolver::size() const {
+    return this->m + 1;
+  }  // end of size
+
+  BorderedBandedLUSolver::size_type BorderedBandedLUSolver::getHalfBandwidth()
+      const {
+    return this->p;
+  }  // end of getHalfBandwidth
+
+  real& BorderedBandedLUSolver::get(const size_type i, const size_type j) {
+    return this->ab[i * this->w + this->p + j - i];
+  }  // end of get
+
+  real BorderedBandedLUSolver::get(const size_type i, const size_type j) const {
+    return this->ab[i * this->w + this->p + j - i];
+  }  // end of get
+
+  void BorderedBandedLUSolver::factorize(const tfel::math::matrix<real>& k) {
+    const auto n = this->m;
+    const auto hb = this->p;
+    if ((k.getNbRows() != n + 1) || (k.getNbCols() != n + 1)) {
+      tfel::raise<tfel::math::LUUnmatchedSize>();
+    }
+    // copy of the banded block
+    std::fill(this->ab.begin(), this->ab.end(), real(0));
+    for (size_type i = 0; i != n; ++i) {
+      const auto jb = i > hb ? i - hb : size_type(0);
+      const auto je = std::min(i + hb + 1, n);
+      for (size_type j = jb; j != je; ++j) {
+        this->get(i, j) = k(i, j);
+      }
+    }
+    // LU decomposition with partial pivoting
+    const auto ue = 2 * hb;
+    for (size_type i = 0; i != n; ++i) {
+      const auto le = std::min(i + hb + 1, n);
+      const auto ce = std::min(i + ue + 1, n);
+      auto piv = i;
+      auto vmax = std::abs(this->get(i, i));
+      for (size_type l = i + 1; l != le; ++l) {
+        if (std::abs(this->get(l, i)) > vmax) {
+          vmax = std::abs(this->get(l, i));
+          piv = l;
+        }
+      }
+      if (vmax < BorderedBandedLUSolver_eps) {
+        tfel::raise<tfel::math::LUNullPivot>();
+      }
+      this->pivots[i] = piv;
+      if (piv != i) {
+        for (size_type j = i; j != ce; ++j) {
+          std::swap(this->get(i, j), this->get(piv, j));
+        }
+      }
+      const auto d = this->get(i, i);
+      for (size_type l = i + 1; l != le; ++l) {
+        auto& lli = this->get(l, i);
+        if (lli == real(0)) {
+          continue;
+        }
+        lli /= d;
+        for (size_type j = i + 1; j != ce; ++j) {
+          this->get(l, j) -= lli * this->get(i, j);
+        }
+      }
+    }
+    // border
+    for (size_type i = 0; i != n; ++i) {
+      this->z[i] = k(i, n);
+      this->c[i] = k(n, i);
+    }
+    this->solveBandedBlock(this->z.data());
+    this->s = k(n, n);
+    for (size_type i = 0; i != n; ++i) {
+      this->s -= this->c[i] * this->z[i];
+    }
+    if (std::abs(this->s) < BorderedBandedLUSolver_eps) {
+      tfel::raise<tfel::math::LUNullPivot>();
+    }
+  }  // end of factorize
+
+  void BorderedBandedLUSolver::solveBandedBlock(real* const x) const {
+    const auto n = this->m;
+    const auto hb = this->p;
+    const auto ue = 2 * hb;
+    // forward substitution
+    for (size_type i = 0; i != n; ++i) {
+      const auto piv = this->pivots[i];
+      if (piv != i) {
+        std::swap(x[i], x[piv]);
+      }
+      const auto le = std::min(i + hb + 1, n);
+      for (size_type l = i + 1; l != le; ++l) {
+        x[l] -= this->get(l, i) * x[i];
+      }
+    }
+    // backward substitution
+    for (size_type i = n; i != 0; --i) {
+      const auto r = i - 1;
+      const auto ce = std::min(r + ue + 1, n);
+      auto v = x[r];
+      for (size_type j = r + 1; j != ce; ++j) {
+        v -= this->get(r, j) * x[j];
+      }
+      x[r] = v / this->get(r, r);
+    }
+  }  // end of solveBandedBlock
+
+  void BorderedBandedLUSolver::solve(tfel::math::vector<real>& x) const {
+    const auto n = this->m;
+    if (x.size() != n + 1) {
+      tfel::raise<tfel::math::LUUnmatchedSize>();
+    }
+    this->solveBandedBlock(x.data());
+    auto xn = x[n];
+    for (size_type i = 0; i != n; ++i) {
+      xn -= this->c[i] * x[i];
+    }
+    xn /= this->s;
+    for (size_type i = 0; i != n; ++i) {
+      x[i] -= this->z[i] * xn;
+    }
+    x[n] = xn;
+  }  // end of solve
+
+  void BorderedBandedLUSolver::exe(const tfel::math::matrix<real>& k,
+                                   tfel::math::vector<real>& x) {
+    this->factorize(k);
+    this->solve(x);
+  }  // end of exe
+
+}  // end of namespace mtest
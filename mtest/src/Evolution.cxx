@@ -12,6 +12,8 @@
  */
 
 #include <string>
+#include <numeric>
+#include <algorithm>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -49,12 +51,22 @@ namespace mtest {
                    "LPIEvolution::LPIEvolution : "
                    "the number of values of the times don't match "
                    "the number of values of the evolution");
-    auto pt = t.begin();
-    auto pv = v.begin();
-    while (pt != t.end()) {
-      this->values.insert({*pt, *pv});
-      ++pt;
-      ++pv;
+    // sort the times. If a time is given more than once, the first
+    // value is kept
+    auto indexes = std::vector<size_type>(t.size());
+    std::iota(indexes.begin(), indexes.end(), size_type{});
+    std::stable_sort(indexes.begin(), indexes.end(),
+                     [&t](const size_type i, const size_type j) {
+                       return t[i] < t[j];
+                     });
+    this->times.reserve(t.size());
+    this->values.reserve(t.size());
+    for (const auto i : indexes) {
+      if ((!this->times.empty()) && (!(this->times.back() < t[i]))) {
+        continue;
+      }
+      this->times.push_back(t[i]);
+      this->values.push_back(v[i]);
     }
   }
 
@@ -66,13 +78,68 @@ namespace mtest {
   }
 
   void LPIEvolution::setValue(const real t, const real v) {
-    this->values[t] = v;
+    const auto p = std::lower_bound(this->times.begin(), this->times.end(), t);
+    const auto i = static_cast<size_type>(p - this->times.begin());
+    if ((p != this->times.end()) && (!(t < *p))) {
+      this->values[i] = v;
+      return;
+    }
+    this->times.insert(p, t);
+    this->values.insert(this->values.begin() + i, v);
   }
 
   real LPIEvolution::operator()(const real t) const {
-    return LPIEvolution::interpolate(this->values, t);
+    auto i = this->hint.load(std::memory_order_relaxed);
+    const auto r = this->interpolate(i, t);
+    this->hint.store(i, std::memory_order_relaxed);
+    return r;
   }  // end of operator()
 
+  void LPIEvolution::evaluate(std::span<real> r,
+                              std::span<const real> t) const {
+    tfel::raise_if(r.size() != t.size(),
+                   "LPIEvolution::evaluate: "
+                   "unmatched number of times and values");
+    auto i = this->hint.load(std::memory_order_relaxed);
+    for (size_type j = 0; j != t.size(); ++j) {
+      r[j] = this->interpolate(i, t[j]);
+    }
+    this->hint.store(i, std::memory_order_relaxed);
+  }  // end of evaluate
+
+  real LPIEvolution::interpolate(size_type& i, const real t) const {
+    const auto n = this->times.size();
+    tfel::raise_if(n == 0,
+                   "LPIEvolution::interpolate: "
+                   "no values specified");
+    if ((n == 1u) || (!(t > this->times.front()))) {
+      return this->values.front();
+    }
+    if (!(t <= this->times.back())) {
+      return this->values.back();
+    }
+    // here, times[0] < t <= times[n-1]. The interval [times[i-1], times[i]]
+    // containing t is first searched around the previous one.
+    auto contains = [this, n](const size_type j, const real x) {
+      return (j != 0) && (j < n) && (this->times[j - 1] < x) &&
+             (x <= this->times[j]);
+    };
+    if (!contains(i, t)) {
+      if (contains(i + 1, t)) {
+        ++i;
+      } else {
+        const auto p =
+            std::lower_bound(this->times.begin(), this->times.end(), t);
+        i = static_cast<size_type>(p - this->times.begin());
+      }
+    }
+    const auto x0 = this->times[i - 1];
+    const auto y0 = this->values[i - 1];
+    const auto x1 = this->times[i];
+    const auto y1 = this->values[i];
+    return (y1 - y0) / (x1 - x0) * (t - x0) + y0;
+  }  // end of interpolate
+
   real LPIEvolution::interpolate(const std::map<real, real>& values,
                                  const real t) {
     tfel::raise_if(values.empty(),
@@ -0,0 +1,57 @@
+/*!
+ * \file   Formula.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "MTest/Formula.hxx"
+
+namespace mtest {
+
+  Formula::Formula(const std::string& f, const EvolutionManager& evm)
+      : evaluator(f, buildExternalFunctionManagerFromConstantEvolutions(evm)) {
+    const auto n = this->evaluator.getNumberOfVariables();
+    this->variables.resize(n);
+    this->values.resize(n, real(0));
+    for (const auto& v : this->evaluator.getVariablesNames()) {
+      this->variables[this->evaluator.getVariablePosition(v)] = v;
+    }
+    this->fct = FormulaCompiler::getFormulaCompiler().compile(this->evaluator);
+  }  // end of Formula
+
+  Formula::Formula(Formula&&) = default;
+  Formula::Formula(const Formula&) = default;
+
+  const std::vector<std::string>& Formula::getVariablesNames() const {
+    return this->variables;
+  }  // end of getVariablesNames
+
+  void Formula::setVariableValue(const size_type i, const real v) {
+    if (this->fct != nullptr) {
+      this->values[i] = v;
+    } else {
+      this->evaluator.setVariableValue(i, v);
+    }
+  }  // end of setVariableValue
+
+  real Formula::getValue() {
+    if (this->fct != nullptr) {
+      return this->fct(this->values.data());
+    }
+    return this->evaluator.getValue();
+  }  // end of getValue
+
+  bool Formula::isCompiled() const {
+    return this->fct != nullptr;
+  }  // end of isCompiled
+
+  Formula::~Formula() = default;
+
+}  // end of namespace mtest
@@ -0,0 +1,266 @@
+/*!
+ * \file   FormulaCompiler.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdio>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+#include <type_traits>
+#include <system_error>
+
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Config/GetTFELVersion.h"
+#include "TFEL/Math/Evaluator.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/MFrontLogStream.hxx"
+#include "MTest/FormulaCompiler.hxx"
+
+namespace mtest {
+
+  static_assert(std::is_same_v<real, double>,
+                "the generated functions assume that real is double");
+
+  /*!
+   * \return a description of the context in which the formulas are
+   * compiled, i.e. the compiler, the compilation flags, the version of
+   * `TFEL` and the binary interface.
+   */
+  static std::string getCompilationContext() {
+    auto r = std::string{};
+    for (const auto v : {"CXX", "CXXFLAGS"}) {
+      const auto e = ::getenv(v);
+      r += std::string(v) + '=' + ((e == nullptr) ? "" : e) + '\n';
+    }
+    r += std::string("TFEL=") + ::getTFELVersion() + '\n';
+    r += "ABI=" + std::to_string(sizeof(real)) + '-' +
+         std::to_string(sizeof(void*));
+#ifdef __VERSION__
+    r += std::string("-") + __VERSION__;
+#endif /* __VERSION__ */
+    return r + '\n';
+  }  // end of getCompilationContext
+
+  //! \brief declarations of the functions supported by the `Evaluator`
+  static const char* const formula_preamble =
+      "#include <cmath>\n"
+      "#include <algorithm>\n"
+      "namespace mtest_formulas {\n"
+      "  using std::exp; using std::exp2; using std::expm1;\n"
+      "  using std::cbrt; using std::sqrt; using std::log;\n"
+      "  using std::log10; using std::log2; using std::log1p;\n"
+      "  using std::cosh; using std::sinh; using std::tanh;\n"
+      "  using std::acosh; using std::asinh; using std::atanh;\n"
+      "  using std::sin; using std::cos; using std::tan;\n"
+      "  using std::acos; using std::asin; using std::atan;\n"
+      "  using std::erf; using std::erfc; using std::tgamma;\n"
+      "  using std::lgamma; using std::hypot; using std::atan2;\n"
+      "  inline double abs(const double x) { return std::fabs(x); }\n"
+      "  inline double ln(const double x) { return std::log(x); }\n"
+      "  inline double H(const double x) { return x < 0 ? 0 : 1; }\n"
+      "  inline double max(const double a, const double b) {\n"
+      "    return std::max(a, b);\n"
+      "  }\n"
+      "  inline double min(const double a, const double b) {\n"
+      "    return std::min(a, b);\n"
+      "  }\n"
+      "  namespace tfel::math {\n"
+      "    template <int N>\n"
+      "    double power(const double x) {\n"
+      "      if constexpr (N < 0) {\n"
+      "        return 1 / power<-N>(x);\n"
+      "      } else if constexpr (N == 0) {\n"
+      "        return 1;\n"
+      "      } else {\n"
+      "        const auto y = power<N / 2>(x);\n"
+      "        return (N % 2 == 0) ? y * y : x * y * y;\n"
+      "      }\n"
+      "    }\n"
+      "  }  // end of namespace tfel::math\n";
+
+  FormulaCompiler& FormulaCompiler::getFormulaCompiler() {
+    static FormulaCompiler c;
+    return c;
+  }  // end of getFormulaCompiler
+
+  FormulaCompiler::FormulaCompiler() {
+    const auto d = ::getenv("MTEST_FORMULAS_CACHE_DIRECTORY");
+    if ((d != nullptr) && (*d != '\0')) {
+      this->setCacheDirectory(d);
+    }
+  }  // end of FormulaCompiler
+
+  void FormulaCompiler::setCacheDirectory(const std::string& d) {
+    tfel::raise_if(d.empty(),
+                   "FormulaCompiler::setCacheDirectory: "
+                   "empty directory name");
+    auto e = std::error_code{};
+    std::filesystem::create_directories(d, e);
+    tfel::raise_if(static_cast<bool>(e) || !std::filesystem::is_directory(d),
+                   "FormulaCompiler::setCacheDirectory: "
+                   "can't create directory '" +
+                       d + "'");
+    auto lock = std::lock_guard<std::mutex>(this->m);
+    this->directory = std::filesystem::absolute(d).string();
+  }  // end of setCacheDirectory
+
+  const std::string& FormulaCompiler::getCacheDirectory() const {
+    return this->directory;
+  }  // end of getCacheDirectory
+
+  bool FormulaCompiler::isEnabled() const {
+    return !this->directory.empty();
+  }  // end of isEnabled
+
+  FormulaCompiler::FunctionPtr FormulaCompiler::compile(
+      const tfel::math::Evaluator& e) {
+    if (!this->isEnabled()) {
+      return nullptr;
+    }
+    auto src = std::string{};
+    try {
+      auto vn = std::map<std::string, std::string>{};
+      for (const auto& n : e.getVariablesNames()) {
+        vn[n] = "v[" + std::to_string(e.getVariablePosition(n)) + "]";
+      }
+      src = e.getCxxFormula(vn);
+    } catch (std::exception&) {
+      // some formulas, for instance formulas calling external
+      // functions, can't be translated in C++
+      return nullptr;
+    }
+    const auto body = "  static double eval(const double* const v) {\n"
+                      "    return " +
+                      src +
+                      ";\n"
+                      "  }\n"
+                      "}  // end of namespace mtest_formulas\n";
+    const auto n = "mtest_formula_" +
+                   tfel::utilities::getStableHash(
+                       getCompilationContext() + formula_preamble + body);
+    auto lock = std::lock_guard<std::mutex>(this->m);
+    const auto p = this->functions.find(n);
+    if (p != this->functions.end()) {
+      return p->second;
+    }
+    auto f = FunctionPtr{};
+    const auto lib = this->buildLibrary(
+        n, formula_preamble + body + "extern \"C\" double " + n +
+               "(const double* const v) {\n"
+               "  return mtest_formulas::eval(v);\n"
+               "}\n");
+    if (!lib.empty()) {
+      try {
+        auto& elm =
+            tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+        f = elm.getFunction<FunctionPtr>(lib, n);
+      } catch (std::exception& ex) {
+        if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL2) {
+          mfront::getLogStream() << "FormulaCompiler::compile: " << ex.what()
+                                 << '\n';
+        }
+      }
+    }
+    this->functions.insert({n, f});
+    return f;
+  }  // end of compile
+
+  std::string FormulaCompiler::buildLibrary(const std::string& n,
+                                            const std::string& src) const {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    static_cast<void>(n);
+    static_cast<void>(src);
+    return "";
+#else
+    auto report = [](const std::string& msg) {
+      if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL2) {
+        mfront::getLogStream() << "FormulaCompiler::buildLibrary: " << msg
+                               << '\n';
+      }
+      return std::string{};
+    };
+    const auto lib = this->directory + "/lib" + n + ".so";
+    if (std::filesystem::exists(lib)) {
+      return lib;
+    }
+    // temporary files are specific to this process, so that concurrent
+    // runs sharing the cache directory do not interfere
+    const auto pid = std::to_string(::getpid());
+    const auto tsrc = this->directory + '/' + n + '-' + pid + ".cxx";
+    const auto tlib = lib + '.' + pid;
+    {
+      std::ofstream out(tsrc);
+      if (!out) {
+        return report("can't open file '" + tsrc + "'");
+      }
+      out << src;
+    }
+    const auto env_cxx = ::getenv("CXX");
+    const auto env_cxxflags = ::getenv("CXXFLAGS");
+    const auto cxx = (env_cxx == nullptr) ? "c++" : env_cxx;
+    const auto cxxflags = tfel::utilities::tokenize(
+        (env_cxxflags == nullptr) ? "" : env_cxxflags, ' ');
+    auto argv = std::vector<const char*>{cxx, "-std=c++17", "-O2"};
+    for (const auto& flag : cxxflags) {
+      if (!flag.empty()) {
+        argv.push_back(flag.c_str());
+      }
+    }
+    for (const auto a : {"-fPIC", "-shared", "-o"}) {
+      argv.push_back(a);
+    }
+    argv.push_back(tlib.c_str());
+    argv.push_back(tsrc.c_str());
+    argv.push_back(nullptr);
+    if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL2) {
+      mfront::getLogStream() << "FormulaCompiler::buildLibrary: "
+                             << "compiling '" << tsrc << "'\n";
+    }
+    const auto child_pid = fork();
+    if (child_pid == 0) {
+      if (mfront::getVerboseMode() < mfront::VERBOSE_DEBUG) {
+        const auto null = ::open("/dev/null", O_WRONLY);
+        if (null != -1) {
+          ::dup2(null, STDOUT_FILENO);
+          ::dup2(null, STDERR_FILENO);
+        }
+      }
+      execvp(cxx, const_cast<char* const*>(argv.data()));
+      ::_exit(EXIT_FAILURE);
+    }
+    auto status = int{};
+    const auto success = (child_pid != -1) &&
+                         (::waitpid(child_pid, &status, 0) == child_pid) &&
+                         (WIFEXITED(status)) && (WEXITSTATUS(status) == 0);
+    std::remove(tsrc.c_str());
+    if (!success) {
+      std::remove(tlib.c_str());
+      return report("compilation of '" + n + "' failed");
+    }
+    // renaming is atomic
+    if (std::rename(tlib.c_str(), lib.c_str()) != 0) {
+      std::remove(tlib.c_str());
+      return report("can't rename '" + tlib + "'");
+    }
+    return lib;
+#endif
+  }  // end of buildLibrary
+
+}  // end of namespace mtest
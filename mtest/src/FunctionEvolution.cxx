@@ -20,7 +20,7 @@ namespace mtest {
   FunctionEvolution::FunctionEvolution(const std::string& f_,
                                        const EvolutionManager& evm_)
       : evm(evm_),
-        f(f_, buildExternalFunctionManagerFromConstantEvolutions(evm_)) {
+        f(f_, evm_) {
   }  // end of FunctionEvolution::FunctionEvolution
 
   real FunctionEvolution::operator()(const real t) const {
@@ -28,7 +28,7 @@ namespace mtest {
     std::vector<std::string>::size_type i;
     for (i = 0; i != args.size(); ++i) {
       if (args[i] == "t") {
-        this->f.setVariableValue("t", t);
+        this->f.setVariableValue(i, t);
       } else {
         auto pev = evm.find(args[i]);
         tfel::raise_if(pev == evm.end(),
@@ -36,7 +36,7 @@ namespace mtest {
                        "can't evaluate argument '" +
                            args[i] + "'");
         const auto& ev = *(pev->second);
-        this->f.setVariableValue(args[i], ev(t));
+        this->f.setVariableValue(i, ev(t));
       }
     }
     return this->f.getValue();
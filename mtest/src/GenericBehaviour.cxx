@@ -13,6 +13,7 @@
 
 #include <cmath>
 #include <limits>
+#include <cstddef>
 #include <cstring>
 #include <ostream>
 #include <algorithm>
@@ -139,6 +140,20 @@ namespace mtest {
     auto& elm = ExternalLibraryManager::getExternalLibraryManager();
     const auto f = b + "_" + ModellingHypothesis::toString(h);
     this->fct = elm.getGenericBehaviourFunction(l, f);
+    if (elm.contains(l, f + "_integrateWithParameters")) {
+      this->fct_with_parameters =
+          elm.getGenericBehaviourWithParametersFunction(l, f);
+      const auto hn = ModellingHypothesis::toString(h);
+      this->instance_parameters_names = elm.getUMATParametersNames(l, b, hn);
+      // the block of parameters is initialised with the current values of
+      // the parameters shared by all the callers, which may have been
+      // modified since the library was loaded
+      this->instance_parameters.resize(
+          this->instance_parameters_names.size());
+      const auto get_parameters =
+          elm.getGenericBehaviourGetParametersFunction(l, f);
+      get_parameters(this->instance_parameters.data());
+    }
     if (this->stype == 1u) {
       // load the rotation functions
       this->rg_fct = elm.getGenericBehaviourRotateGradientsFunction(
@@ -266,6 +281,54 @@ namespace mtest {
     }
   }  // end of GenericBehaviour
 
+  void GenericBehaviour::updateInstanceParameter(const std::string& n,
+                                                 const real v) const {
+    const auto p = std::find(this->instance_parameters_names.begin(),
+                             this->instance_parameters_names.end(), n);
+    if (p == this->instance_parameters_names.end()) {
+      return;
+    }
+    const auto i = p - this->instance_parameters_names.begin();
+    this->instance_parameters[static_cast<std::size_t>(i)] = v;
+  }  // end of updateInstanceParameter
+
+  void GenericBehaviour::setParameter(const std::string& n,
+                                      const real v) const {
+    StandardBehaviourBase::setParameter(n, v);
+    this->updateInstanceParameter(n, v);
+  }  // end of setParameter
+
+  void GenericBehaviour::setIntegerParameter(const std::string& n,
+                                             const int v) const {
+    StandardBehaviourBase::setIntegerParameter(n, v);
+    this->updateInstanceParameter(n, static_cast<real>(v));
+  }  // end of setIntegerParameter
+
+  void GenericBehaviour::setUnsignedIntegerParameter(
+      const std::string& n, const unsigned short v) const {
+    StandardBehaviourBase::setUnsignedIntegerParameter(n, v);
+    this->updateInstanceParameter(n, static_cast<real>(v));
+  }  // end of setUnsignedIntegerParameter
+
+  bool GenericBehaviour::hasInstanceParameters() const {
+    return this->fct_with_parameters != nullptr;
+  }  // end of hasInstanceParameters
+
+  void GenericBehaviour::setInstanceParameter(const std::string& n,
+                                              const real v) {
+    tfel::raise_if(this->fct_with_parameters == nullptr,
+                   "GenericBehaviour::setInstanceParameter: "
+                   "the behaviour does not support instance parameters");
+    tfel::raise_if(std::find(this->instance_parameters_names.begin(),
+                             this->instance_parameters_names.end(),
+                             n) == this->instance_parameters_names.end(),
+                   "GenericBehaviour::setInstanceParameter: "
+                   "no parameter named '" +
+                       n + "'");
+    this->updateInstanceParameter(n, v);
+    this->use_instance_parameters = true;
+  }  // end of setInstanceParameter
+
   void GenericBehaviour::allocateWorkSpace(BehaviourWorkSpace& wk) const {
     const auto ndv = this->getGradientsSize();
     const auto nth = this->getThermodynamicForcesSize();
@@ -544,7 +607,10 @@ namespace mtest {
       this->executeFiniteStrainBehaviourTangentOperatorPreProcessing(d, ktype);
     }
     // calling the behaviour
-    const auto r = (this->fct)(&d);
+    const auto r = this->use_instance_parameters
+                       ? (this->fct_with_parameters)(
+                             &d, this->instance_parameters.data())
+                       : (this->fct)(&d);
     if (r != 1) {
       mfront::getLogStream() << error_message << '\n';
       return {false, rdt};
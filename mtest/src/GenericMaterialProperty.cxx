@@ -31,6 +31,11 @@ namespace mtest {
     }
     auto& elm = ELM::getExternalLibraryManager();
     this->fct = elm.getGenericMaterialProperty(l, f);
+    // libraries generated by previous versions of `MFront` do not
+    // export the array function
+    if (elm.contains(l, f + "_array")) {
+      this->array_fct = elm.getGenericMaterialPropertyArrayFunction(l, f);
+    }
   }  // end of GenericMaterialProperty
 
   real GenericMaterialProperty::getValue() const {
@@ -47,6 +52,23 @@ namespace mtest {
     return v;
   }  // end of getValue
 
+  void GenericMaterialProperty::getValues(real* const values,
+                                          const real* const* const args,
+                                          const std::size_t n) {
+    if (this->array_fct == nullptr) {
+      MaterialPropertyBase::getValues(values, args, n);
+      return;
+    }
+    ::mfront_gmp_OutputStatus s;
+    (*this->array_fct)(&s, args, values, static_cast<mfront_gmp_size_type>(n),
+                       GENERIC_MATERIALPROPERTY_NONE_POLICY);
+    if (s.status != 0) {
+      auto e = std::string{s.msg, ::strnlen(s.msg, 512)};
+      tfel::raise("GenericMaterialProperty::getValues: evaluation failed (" +
+                  e + ")");
+    }
+  }  // end of getValues
+
   GenericMaterialProperty::~GenericMaterialProperty() = default;
 
 }  // end of namespace mtest
@@ -123,7 +123,7 @@ namespace mtest {
               .first) {
         wk.du = wk.r;
         setRoundingMode();
-        LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+        solveLinearSystem(wk);
         setRoundingMode();
         u1 -= wk.du;
       } else {
@@ -181,7 +181,7 @@ namespace mtest {
       }
       wk.du = wk.r;
       setRoundingMode();
-      LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+      solveLinearSystem(wk);
       setRoundingMode();
       u1 -= wk.du;
       converged =
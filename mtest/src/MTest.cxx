@@ -23,6 +23,7 @@
 #include <stdexcept>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryResultFile.hxx"
 #include "TFEL/Utilities/TextData.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
 #include "TFEL/Utilities/TerminalColors.hxx"
@@ -297,7 +298,21 @@ namespace mtest {
     unsigned short cnbr = 2;
     const char* dvn;
     const char* thn;
-    if (this->out) {
+    if (this->isBinaryOutputFile()) {
+      auto legends = std::vector<std::string>{"t"};
+      for (const auto& c : this->b->getGradientsComponents()) {
+        legends.push_back(c);
+      }
+      for (const auto& c : this->b->getThermodynamicForcesComponents()) {
+        legends.push_back(c);
+      }
+      for (const auto& n : this->b->expandInternalStateVariablesNames()) {
+        legends.push_back(n);
+      }
+      legends.push_back("StoredEnergy");
+      legends.push_back("DissipatedEnergy");
+      this->openBinaryOutputFile(legends);
+    } else if (this->out) {
       this->out << "# first column: time\n";
       if (this->b->getBehaviourType() ==
           MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) {
@@ -520,15 +535,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
-    this->out.flush();
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -936,13 +951,51 @@ namespace mtest {
     }
   }  // end of execute
 
+  void MTest::executeLoadingPath(
+      StudyCurrentState& state,
+      SolverWorkSpace& wk,
+      const std::function<void(const real, const StudyCurrentState&)>& f) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "MTest::executeLoadingPath: " + m);
+    };
+    throw_if(!this->initialisationFinished, "object not initialised");
+    throw_if(this->times.size() < 2, "invalid number of times defined");
+    throw_if(!this->events.empty(), "events are not supported");
+    this->initializeCurrentState(state);
+    state.period = 1u;
+    state.iterations = 0u;
+    state.subSteps = 0u;
+    auto pt = this->times.begin();
+    auto pt2 = pt + 1;
+    f(*pt, state);
+    while (pt2 != this->times.end()) {
+      GenericSolver().execute(state, wk, *this, this->options, *pt, *pt2);
+      f(*pt2, state);
+      ++pt;
+      ++pt2;
+    }
+  }  // end of executeLoadingPath
+
   void MTest::printOutput(const real t,
                           const StudyCurrentState& s,
                           const bool o) const {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
+    if (this->bout != nullptr) {
+      const auto& cs = s.getStructureCurrentState("").istates[0];
+      const auto ndv = this->b->getGradientsSize();
+      const auto nth = this->b->getThermodynamicForcesSize();
+      auto values = std::vector<real>{};
+      values.reserve(ndv + nth + cs.iv0.size() + 3);
+      values.push_back(t);
+      values.insert(values.end(), s.u0.begin(), s.u0.begin() + ndv);
+      values.insert(values.end(), cs.s0.begin(), cs.s0.begin() + nth);
+      values.insert(values.end(), cs.iv0.begin(), cs.iv0.end());
+      values.push_back(cs.se0);
+      values.push_back(cs.de0);
+      this->bout->addLine(values);
+    } else if (this->out) {
       auto& cs = s.getStructureCurrentState("").istates[0];
       // number of components of the driving variables and the thermodynamic
       // forces
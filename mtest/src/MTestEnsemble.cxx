@@ -0,0 +1,234 @@
+/*!
+ * \file   mtest/src/MTestEnsemble.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "MFront/MFrontLogStream.hxx"
+#include "MTest/Evolution.hxx"
+#include "MTest/Behaviour.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/SolverWorkSpace.hxx"
+#include "MTest/StudyCurrentState.hxx"
+#include "MTest/StructureCurrentState.hxx"
+#include "MTest/MTest.hxx"
+#include "MTest/MTestEnsemble.hxx"
+
+namespace mtest {
+
+  MTestEnsemble::MTestEnsemble(const std::string& f,
+                               const std::vector<std::string>& ecmds,
+                               const std::map<std::string, std::string>& s) {
+    this->parser.parseFile(f, ecmds, s);
+  }  // end of MTestEnsemble
+
+  void MTestEnsemble::setSampledVariables(const std::vector<std::string>& n) {
+    this->sampled_variables = n;
+  }  // end of setSampledVariables
+
+  void MTestEnsemble::setOutputs(const std::vector<std::string>& n) {
+    this->outputs = n;
+  }  // end of setOutputs
+
+  void MTestEnsemble::setOutputMode(const OutputMode m) {
+    this->mode = m;
+  }  // end of setOutputMode
+
+  void MTestEnsemble::setNumberOfThreads(const size_type n) {
+    tfel::raise_if(n == 0,
+                   "MTestEnsemble::setNumberOfThreads: "
+                   "invalid number of threads");
+    this->nthreads = n;
+  }  // end of setNumberOfThreads
+
+  MTestEnsemble::size_type MTestEnsemble::execute(
+      const std::vector<std::vector<real>>& samples, const OutputHandler& h) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "MTestEnsemble::execute: " + m);
+    };
+    throw_if(this->outputs.empty(), "no output defined");
+    for (const auto& sample : samples) {
+      throw_if(sample.size() != this->sampled_variables.size(),
+               "invalid sample size (" + std::to_string(sample.size()) +
+                   " values given, " +
+                   std::to_string(this->sampled_variables.size()) +
+                   " expected)");
+    }
+    if (samples.empty()) {
+      return 0;
+    }
+    // a first test is filled to check the sampled variables and to
+    // build the objects extracting the outputs from the current state
+    auto parameters = std::vector<bool>{};
+    auto extractors = std::vector<std::function<real(const CurrentState&)>>{};
+    // if true, the values of the sampled parameters are only changed for
+    // the behaviour of the current test
+    auto use_instance_parameters = false;
+    {
+      MTest t;
+      this->parser.execute(t);
+      const auto b = t.getBehaviour();
+      const auto pnames = b->getParametersNames();
+      const auto& evm = t.getEvolutions();
+      for (const auto& n : this->sampled_variables) {
+        if (std::find(pnames.begin(), pnames.end(), n) != pnames.end()) {
+          parameters.push_back(true);
+          continue;
+        }
+        const auto pev = evm.find(n);
+        throw_if(pev == evm.end(),
+                 "'" + n + "' is neither an evolution nor a parameter");
+        throw_if(!pev->second->isConstant(),
+                 "evolution '" + n + "' is not constant");
+        parameters.push_back(false);
+      }
+      for (const auto& o : this->outputs) {
+        extractors.push_back(buildValueExtractor(*b, o));
+      }
+      use_instance_parameters = b->hasInstanceParameters();
+    }
+    auto nworkers = std::min(this->nthreads, samples.size());
+    if ((std::find(parameters.begin(), parameters.end(), true) !=
+         parameters.end()) &&
+        (!use_instance_parameters) && (nworkers > 1)) {
+      if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
+        mfront::getLogStream()
+            << "MTestEnsemble::execute: sampling parameters of a "
+               "behaviour which does not support instance parameters "
+               "forces a sequential execution\n";
+      }
+      nworkers = 1;
+    }
+    // treatment of the samples
+    auto next = std::atomic<size_type>{0};
+    auto parser_mutex = std::mutex{};
+    auto output_mutex = std::mutex{};
+    auto failures = size_type{};
+    auto error = std::exception_ptr{};
+    auto run = [this, &samples, &h, &parameters, use_instance_parameters,
+                &extractors, &next, &parser_mutex, &output_mutex, &failures,
+                &error] {
+      auto wk = SolverWorkSpace{};
+      auto values = std::vector<real>{};
+      auto extract = [&extractors, &values](const StudyCurrentState& s) {
+        const auto& cs = s.getStructureCurrentState("").istates[0];
+        for (const auto& e : extractors) {
+          values.push_back(e(cs));
+        }
+      };
+      auto record = [this, &values, &extract](const real t,
+                                              const StudyCurrentState& s) {
+        if (this->mode == HISTORY) {
+          values.push_back(t);
+          extract(s);
+        }
+      };
+      while (true) {
+        const auto i = next++;
+        if (i >= samples.size()) {
+          break;
+        }
+        auto success = true;
+        values.clear();
+        try {
+          const auto& sample = samples[i];
+          MTest t;
+          {
+            // the parser is not thread-safe
+            auto lock = std::lock_guard<std::mutex>{parser_mutex};
+            auto evolutions = std::map<std::string, real>{};
+            for (size_type j = 0; j != sample.size(); ++j) {
+              if (!parameters[j]) {
+                evolutions[this->sampled_variables[j]] = sample[j];
+              }
+            }
+            t.overrideConstantEvolutions(evolutions);
+            this->parser.execute(t);
+            const auto b = t.getBehaviour();
+            for (size_type j = 0; j != sample.size(); ++j) {
+              if (!parameters[j]) {
+                continue;
+              }
+              if (use_instance_parameters) {
+                b->setInstanceParameter(this->sampled_variables[j],
+                                        sample[j]);
+              } else {
+                b->setParameter(this->sampled_variables[j], sample[j]);
+              }
+            }
+            t.disableOutputFiles();
+            t.completeInitialisation();
+          }
+          t.initializeWorkSpace(wk);
+          auto state = StudyCurrentState{};
+          t.executeLoadingPath(state, wk, record);
+          if (this->mode == FINALVALUES) {
+            extract(state);
+          }
+        } catch (...) {
+          success = false;
+          values.clear();
+        }
+        auto lock = std::lock_guard<std::mutex>{output_mutex};
+        if (error) {
+          break;
+        }
+        if (!success) {
+          ++failures;
+        }
+        try {
+          h(i, success, values);
+        } catch (...) {
+          error = std::current_exception();
+          break;
+        }
+      }
+    };
+    // the logging stream is shared by all the threads and the messages
+    // of the solver are meaningless when treating many samples
+    const auto verbose = mfront::getVerboseMode();
+    mfront::setVerboseMode(mfront::VERBOSE_QUIET);
+    if (nworkers == 1) {
+      run();
+    } else {
+      auto threads = std::vector<std::thread>{};
+      for (size_type i = 0; i != nworkers; ++i) {
+        threads.emplace_back(run);
+      }
+      for (auto& t : threads) {
+        t.join();
+      }
+    }
+    mfront::setVerboseMode(verbose);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return failures;
+  }  // end of execute
+
+  std::vector<std::vector<real>> MTestEnsemble::execute(
+      const std::vector<std::vector<real>>& samples) {
+    auto r = std::vector<std::vector<real>>(samples.size());
+    this->execute(samples, [&r](const size_type i, const bool,
+                                const std::vector<real>& values) {
+      r[i] = values;
+    });
+    return r;
+  }  // end of execute
+
+  MTestEnsemble::~MTestEnsemble() = default;
+
+}  // end of namespace mtest
@@ -11,13 +11,18 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
 #include <cfenv>
 #include <regex>
 #include <string>
 #include <vector>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include <utility>
 #include <iostream>
+#include <algorithm>
 
 #if defined _WIN32 || defined _WIN64
 #ifndef NOMINMAX
@@ -27,6 +32,12 @@
 #ifdef small
 #undef small
 #endif /* small */
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #endif
 
 #ifdef MTEST_HAVE_MADNEX
@@ -41,6 +52,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Tests/TestManager.hxx"
 #include "TFEL/Tests/XMLTestOutput.hxx"
+#include "TFEL/Utilities/TextData.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
 
@@ -50,11 +62,13 @@
 
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
+#include "MTest/FormulaCompiler.hxx"
 #include "MTest/Constraint.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/MTest.hxx"
 #include "MTest/PipeTest.hxx"
 #include "MTest/MTestParser.hxx"
+#include "MTest/MTestEnsemble.hxx"
 #include "MTest/PipeTestParser.hxx"
 
 namespace mtest {
@@ -77,6 +91,8 @@ namespace mtest {
     void treatScheme();
     void treatXMLOutput();
     void treatResultFileOutput();
+    //! treat the `--result-file-format` option
+    void treatResultFileFormat();
     void treatResidualFileOutput();
     [[noreturn]] void treatHelpCommandsList();
     [[noreturn]] void treatHelpCommands();
@@ -85,6 +101,16 @@ namespace mtest {
     void treatEnableFloatingPointExceptions();
     //! treat the `--rounding-direction-mode` option
     void treatRoundingDirectionMode();
+    //! treat the `--formulas-cache-directory` option
+    void treatFormulasCacheDirectory();
+    //! treat the `--jobs` option
+    void treatJobs();
+    //! treat the `--ensemble` option
+    void treatEnsemble();
+    //! treat the `--ensemble-outputs` option
+    void treatEnsembleOutputs();
+    //! treat the `--ensemble-output-mode` option
+    void treatEnsembleOutputMode();
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
     //! treat the `--backtrace` option
     void treatBacktrace();
@@ -92,12 +118,52 @@ namespace mtest {
     std::string getVersionDescription() const override;
     std::string getUsageDescription() const override;
     void registerArgumentCallBacks();
+    //! \brief description of a test
+    struct TestDescription {
+      //! \brief name of the test
+      std::string name;
+      //! \brief path to the input file
+      std::string path;
+      //! \brief boolean stating if the test is a pipe test
+      bool ptest;
+    };
+    /*!
+     * \brief declare a test, which will be created and executed latter
+     * \param[in] n: name of the test
+     * \param[in] p: path to the input file
+     * \param[in] b: boolean stating if the test is a pipe test
+     */
+    void declareTest(const std::string&, const std::string&, const bool);
+    //! \return the test described by the given description
+    std::shared_ptr<SchemeBase> createTest(const TestDescription&);
     /*!
      * \brief add a single test and defines the output files
      * \param[in] t: pointer to the test
      * \param[in] n: name of the test
      */
     void addTest(std::shared_ptr<SchemeBase>, const std::string&);
+#if !(defined _WIN32 || defined _WIN64)
+    /*!
+     * \brief execute the declared tests using at most `jobs` processes.
+     *
+     * Each test is created and executed in a child process, which has
+     * its own `MTest` or `PipeTest` state and redirects its standard
+     * and error outputs in a temporary file. Those files are displayed
+     * in the order of the sequential execution once all the previous
+     * tests are finished, so that the output does not depend on the
+     * number of processes.
+     *
+     * \return true if all tests succeeded
+     */
+    bool executeInParallel();
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    /*!
+     * \brief run each declared test for all the samples given by the
+     * `--ensemble` option, using at most `jobs` threads. The outputs
+     * of the test `name` are written in the file `name-ensemble.res`.
+     * \return true if all computations succeeded
+     */
+    bool executeEnsembles();
     std::shared_ptr<SchemeBase> createMTestTest(const std::string&);
     std::shared_ptr<SchemeBase> createPTestTest(const std::string&);
     void treatMadnexInputFile(const std::string&);
@@ -118,6 +184,8 @@ namespace mtest {
 
     //! \brief input files
     std::vector<std::string> inputs;
+    //! \brief declared tests
+    std::vector<TestDescription> tests;
     //! \brief external commands
     std::vector<std::string> ecmds;
     //! \brief substitutions
@@ -134,8 +202,20 @@ namespace mtest {
     bool xml_output = false;
     // generate result file
     bool result_file_output = true;
+    //! \brief format of the result file
+    SchemeBase::OutputFileFormat result_file_format =
+        SchemeBase::TEXTFILEFORMAT;
     // generate residual file
     bool residual_file_output = false;
+    //! \brief number of tests executed simultaneously
+    unsigned int jobs = 1;
+    //! \brief file containing the samples of an ensemble run
+    std::string ensemble_samples;
+    //! \brief outputs of an ensemble run
+    std::vector<std::string> ensemble_outputs;
+    //! \brief output mode of an ensemble run
+    MTestEnsemble::OutputMode ensemble_output_mode =
+        MTestEnsemble::FINALVALUES;
   };
 
   MTestMain::MTestMain(const int argc, const char* const* const argv)
@@ -157,6 +237,11 @@ namespace mtest {
     this->registerNewCallBack("--result-file-output",
                               &MTestMain::treatResultFileOutput,
                               "control result output (default yes)", true);
+    this->registerNewCallBack(
+        "--result-file-format", &MTestMain::treatResultFileFormat,
+        "set the format of the result file. Valid values are 'text' "
+        "(default) and 'binary'",
+        true);
     this->registerNewCallBack("--residual-file-output",
                               &MTestMain::treatResidualFileOutput,
                               "control residual output (default no)", true);
@@ -199,6 +284,38 @@ namespace mtest {
         "Random:     Rounding mode is randomly changed at various "
         "stage of the compution.",
         true);
+    this->registerNewCallBack(
+        "--formulas-cache-directory",
+        &MTestMain::treatFormulasCacheDirectory,
+        "compile the formulas (evolutions, analytical tests and "
+        "user defined post-processings) in shared libraries stored "
+        "in the given directory. This directory can be reused by "
+        "subsequent runs.",
+        true);
+    this->registerNewCallBack(
+        "--jobs", "-j", &MTestMain::treatJobs,
+        "set the number of tests executed simultaneously, each test "
+        "being executed in a dedicated process. In ensemble runs, "
+        "set the number of threads used.",
+        true);
+    this->registerNewCallBack(
+        "--ensemble", &MTestMain::treatEnsemble,
+        "run each test for all the samples given in the specified file. "
+        "The legends of this file give the names of the sampled "
+        "variables, which may be constant evolutions or parameters of "
+        "the behaviour. Each line defines a sample.",
+        true);
+    this->registerNewCallBack(
+        "--ensemble-outputs", &MTestMain::treatEnsembleOutputs,
+        "comma separated list of the variables written for each sample "
+        "in an ensemble run",
+        true);
+    this->registerNewCallBack(
+        "--ensemble-output-mode", &MTestMain::treatEnsembleOutputMode,
+        "set the outputs written for each sample in an ensemble run. "
+        "Valid values are 'final' (default), the values at the end of "
+        "the loading path, and 'history', the values at each time step.",
+        true);
 #ifdef MTEST_HAVE_MADNEX
     auto treatBehaviour = [this] {
       if (!this->behaviour.empty()) {
@@ -309,6 +426,63 @@ namespace mtest {
     mtest::setRoundingMode(o);
   }  // end of MTestMain::setRoundingDirectionMode
 
+  void MTestMain::treatFormulasCacheDirectory() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatFormulasCacheDirectory: "
+                   "no option given");
+    FormulaCompiler::getFormulaCompiler().setCacheDirectory(o);
+  }  // end of MTestMain::treatFormulasCacheDirectory
+
+  void MTestMain::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    try {
+      const auto n = std::stoi(o);
+      tfel::raise_if(n <= 0, "invalid number of jobs");
+      this->jobs = static_cast<unsigned int>(n);
+    } catch (std::exception&) {
+      tfel::raise(
+          "MTestMain::treatJobs: "
+          "invalid number of jobs '" +
+          o + "'");
+    }
+  }  // end of MTestMain::treatJobs
+
+  void MTestMain::treatEnsemble() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatEnsemble: "
+                   "no option given");
+    tfel::raise_if(!this->ensemble_samples.empty(),
+                   "MTestMain::treatEnsemble: "
+                   "samples already defined");
+    this->ensemble_samples = o;
+  }  // end of MTestMain::treatEnsemble
+
+  void MTestMain::treatEnsembleOutputs() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatEnsembleOutputs: "
+                   "no option given");
+    for (const auto& v : tfel::utilities::tokenize(o, ',')) {
+      this->ensemble_outputs.push_back(v);
+    }
+  }  // end of MTestMain::treatEnsembleOutputs
+
+  void MTestMain::treatEnsembleOutputMode() {
+    const auto& option = this->currentArgument->getOption();
+    if (option == "final") {
+      this->ensemble_output_mode = MTestEnsemble::FINALVALUES;
+    } else if (option == "history") {
+      this->ensemble_output_mode = MTestEnsemble::HISTORY;
+    } else {
+      tfel::raise(
+          "MTestMain::treatEnsembleOutputMode: "
+          "unknown mode '" +
+          option + "' (valid values are 'final' and 'history')");
+    }
+  }  // end of MTestMain::treatEnsembleOutputMode
+
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
   void MTestMain::treatBacktrace() {
     using namespace tfel::system;
@@ -370,6 +544,20 @@ namespace mtest {
     }
   }  // end of MTestMain::treatResultFileOutput
 
+  void MTestMain::treatResultFileFormat() {
+    const auto& option = this->currentArgument->getOption();
+    if (option == "text") {
+      this->result_file_format = SchemeBase::TEXTFILEFORMAT;
+    } else if (option == "binary") {
+      this->result_file_format = SchemeBase::BINARYFILEFORMAT;
+    } else {
+      tfel::raise(
+          "MTestMain::treatResultFileFormat: "
+          "unknown format '" +
+          option + "' (valid values are 'text' and 'binary')");
+    }
+  }  // end of MTestMain::treatResultFileFormat
+
   void MTestMain::treatResidualFileOutput() {
     if (this->currentArgument->getOption().empty()) {
       this->residual_file_output = true;
@@ -507,11 +695,236 @@ namespace mtest {
         }
       }
     }
+    // the test manager executes the tests by alphabetical order
+    std::stable_sort(this->tests.begin(), this->tests.end(),
+                     [](const TestDescription& t1, const TestDescription& t2) {
+                       return t1.name < t2.name;
+                     });
+    if (!this->ensemble_samples.empty()) {
+      return this->executeEnsembles() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+#if !(defined _WIN32 || defined _WIN64)
+    if ((this->jobs > 1) && (this->tests.size() > 1)) {
+      return this->executeInParallel() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    for (const auto& t : this->tests) {
+      this->addTest(this->createTest(t), t.name);
+    }
     auto& tm = tfel::tests::TestManager::getTestManager();
     const auto r = tm.execute();
     return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
   }  // end of execute
 
+#if !(defined _WIN32 || defined _WIN64)
+
+  bool MTestMain::executeInParallel() {
+    struct Job {
+      //! \brief temporary output file
+      std::string output;
+      //! \brief process id
+      pid_t pid = -1;
+      //! \brief flag stating if the job is finished
+      bool finished = false;
+      //! \brief result
+      bool success = false;
+    };
+    const auto prefix = ".mtest-" + std::to_string(::getpid());
+    auto pjobs = std::vector<Job>(this->tests.size());
+    auto status = true;
+    auto next = std::vector<Job>::size_type{};
+    auto reported = std::vector<Job>::size_type{};
+    auto running = 0u;
+    while (reported != pjobs.size()) {
+      // launching new jobs
+      while ((running < this->jobs) && (next != pjobs.size())) {
+        auto& j = pjobs[next];
+        j.output = prefix + "-" + std::to_string(next) + ".log";
+        // pending outputs must not be written twice
+        std::cout.flush();
+        std::cerr.flush();
+        mfront::getLogStream().flush();
+        j.pid = ::fork();
+        if (j.pid == 0) {
+          const auto fd = ::open(j.output.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                                 S_IRUSR | S_IWUSR);
+          if (fd != -1) {
+            ::dup2(fd, STDOUT_FILENO);
+            ::dup2(fd, STDERR_FILENO);
+            ::close(fd);
+          }
+          auto success = false;
+          try {
+            const auto& t = this->tests[next];
+            this->addTest(this->createTest(t), t.name);
+            auto& tm = tfel::tests::TestManager::getTestManager();
+            success = tm.execute().success();
+          } catch (std::exception& e) {
+            std::cerr << e.what() << std::endl;
+          }
+          std::cout.flush();
+          std::cerr.flush();
+          // exit normally so that the result files are closed
+          std::exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        if (j.pid == -1) {
+          std::cerr << "mtest: can't launch test '" << this->tests[next].name
+                    << "'\n";
+          j.output.clear();
+          j.finished = true;
+        } else {
+          ++running;
+        }
+        ++next;
+      }
+      // waiting for the end of a job
+      if (running != 0) {
+        auto s = int{};
+        const auto pid = ::waitpid(-1, &s, 0);
+        if (pid == -1) {
+          if (errno == EINTR) {
+            continue;
+          }
+          tfel::raise("MTestMain::executeInParallel: waitpid failed");
+        }
+        for (auto& j : pjobs) {
+          if ((j.pid == pid) && (!j.finished)) {
+            j.finished = true;
+            j.success = WIFEXITED(s) && (WEXITSTATUS(s) == EXIT_SUCCESS);
+            --running;
+          }
+        }
+      }
+      // reporting the finished jobs in order
+      while ((reported != pjobs.size()) && (pjobs[reported].finished)) {
+        auto& j = pjobs[reported];
+        if (!j.output.empty()) {
+          std::ifstream in(j.output);
+          if (in) {
+            std::cout << in.rdbuf();
+            std::cout.flush();
+          }
+          in.close();
+          std::remove(j.output.c_str());
+        }
+        if (!j.success) {
+          status = false;
+        }
+        ++reported;
+      }
+    }
+    return status;
+  }  // end of executeInParallel
+
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
+  void MTestMain::declareTest(const std::string& n,
+                              const std::string& p,
+                              const bool b) {
+    this->tests.push_back(TestDescription{n, p, b});
+  }  // end of declareTest
+
+  std::shared_ptr<SchemeBase> MTestMain::createTest(
+      const TestDescription& t) {
+    if (t.ptest) {
+      return this->createPTestTest(t.path);
+    }
+    return this->createMTestTest(t.path);
+  }  // end of createTest
+
+  bool MTestMain::executeEnsembles() {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "MTestMain::executeEnsembles: " + m);
+    };
+    throw_if(this->ensemble_outputs.empty(), "no output defined");
+    // reading the samples
+    const auto data = tfel::utilities::TextData(this->ensemble_samples);
+    const auto& variables = data.getLegends();
+    throw_if(variables.empty(), "no sampled variable defined in file '" +
+                                    this->ensemble_samples + "'");
+    auto columns = std::vector<std::vector<real>>{};
+    for (std::vector<std::string>::size_type c = 0; c != variables.size();
+         ++c) {
+      columns.push_back(data.getColumn(c + 1));
+    }
+    auto samples = std::vector<std::vector<real>>(columns.front().size());
+    for (decltype(samples.size()) i = 0; i != samples.size(); ++i) {
+      for (const auto& c : columns) {
+        samples[i].push_back(c[i]);
+      }
+    }
+    auto success = true;
+    for (const auto& t : this->tests) {
+      throw_if(t.ptest, "ensemble runs are not supported by ptest");
+      auto e = MTestEnsemble(t.path, this->ecmds, this->substitutions);
+      e.setSampledVariables(variables);
+      e.setOutputs(this->ensemble_outputs);
+      e.setOutputMode(this->ensemble_output_mode);
+      e.setNumberOfThreads(this->jobs);
+      const auto f = t.name + "-ensemble.res";
+      std::ofstream out(f);
+      throw_if(!out, "can't open file '" + f + "'");
+      out.precision(14);
+      auto column = 1;
+      out << "# column " << column++ << ": sample index\n";
+      for (const auto& v : variables) {
+        out << "# column " << column++ << ": " << v << '\n';
+      }
+      if (this->ensemble_output_mode == MTestEnsemble::HISTORY) {
+        out << "# column " << column++ << ": time\n";
+      }
+      for (const auto& o : this->ensemble_outputs) {
+        out << "# column " << column++ << ": " << o << '\n';
+      }
+      const auto nvalues = this->ensemble_outputs.size() +
+                           (this->ensemble_output_mode ==
+                                    MTestEnsemble::HISTORY
+                                ? 1
+                                : 0);
+      // the results of a sample are written once the results of all the
+      // previous samples have been written, so that the output file does
+      // not depend on the number of threads
+      auto pending = std::map<MTestEnsemble::size_type, std::string>{};
+      auto next = MTestEnsemble::size_type{};
+      const auto nfailures = e.execute(
+          samples, [&out, &samples, &nvalues, &pending, &next](
+                       const MTestEnsemble::size_type i, const bool s,
+                       const std::vector<real>& values) {
+            std::ostringstream r;
+            r.precision(14);
+            if (!s) {
+              r << "# sample " << i << " failed\n";
+            }
+            for (decltype(values.size()) l = 0; l != values.size();
+                 l += nvalues) {
+              r << i;
+              for (const auto& v : samples[i]) {
+                r << ' ' << v;
+              }
+              for (decltype(values.size()) c = 0; c != nvalues; ++c) {
+                r << ' ' << values[l + c];
+              }
+              r << '\n';
+            }
+            pending[i] = r.str();
+            auto p = pending.find(next);
+            while (p != pending.end()) {
+              out << p->second;
+              pending.erase(p);
+              p = pending.find(++next);
+            }
+          });
+      if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
+        mfront::getLogStream()
+            << "* " << t.name << ": " << samples.size() - nfailures
+            << " samples treated successfully over " << samples.size()
+            << " (results written in '" << f << "')\n";
+      }
+      success = success && (nfailures == 0);
+    }
+    return success;
+  }  // end of executeEnsembles
+
   std::shared_ptr<SchemeBase> MTestMain::createMTestTest(
       const std::string& path) {
     auto t = std::make_shared<MTest>();
@@ -534,7 +947,7 @@ namespace mtest {
     const auto path = "madnex:" +                              //
                       file_name + ":" + material_name + ":" +  //
                       behaviour_name + ":" + test_name;
-    auto t = std::shared_ptr<SchemeBase>{};
+    auto ptest = false;
     const auto test_scheme = madnex::getMTestTestScheme(
         file_name, material_name, behaviour_name, test_name);
     if (!test_scheme.empty()) {
@@ -548,14 +961,13 @@ namespace mtest {
             "MTestMain::appendTestFromMadnexFile: the scheme specified on the "
             "command line does not match the scheme declared by the test");
       }
-      t = this->createMTestTest(path);
     } else if (this->scheme == PTEST) {
       if ((!test_scheme.empty()) && (test_scheme != "ptest")) {
         tfel::raise(
             "MTestMain::appendTestFromMadnexFile: the scheme specified on the "
             "command line does not match the scheme declared by the test");
       }
-      t = this->createPTestTest(path);
+      ptest = true;
     } else {
       if (test_scheme.empty()) {
         tfel::raise(
@@ -563,13 +975,9 @@ namespace mtest {
             "the scheme must be specified using the --scheme command "
             "line argument when using a madnex file");
       }
-      if (test_scheme == "mtest") {
-        t = this->createMTestTest(path);
-      } else {
-        t = this->createPTestTest(path);
-      }
+      ptest = test_scheme == "ptest";
     }
-    this->addTest(t, test_name);
+    this->declareTest(test_name, path, ptest);
   }  // end of appendTestFromMadnexFile
 #endif /* MADNEX_MTEST_TEST_SUPPORT */
 
@@ -668,9 +1076,9 @@ namespace mtest {
                    "invalid input file name '" +
                        i + "'");
     if (this->scheme == MTEST) {
-      this->addTest(this->createMTestTest(i), tname);
+      this->declareTest(tname, i, false);
     } else if (this->scheme == PTEST) {
-      this->addTest(this->createPTestTest(i), tname);
+      this->declareTest(tname, i, true);
     } else if (this->scheme == DEFAULT) {
       const auto ext = [&i, &pos]() -> std::string {
         if (pos != std::string::npos) {
@@ -678,11 +1086,7 @@ namespace mtest {
         }
         return "";
       }();
-      if (ext == ".ptest") {
-        this->addTest(this->createPTestTest(i), tname);
-      } else {
-        this->addTest(this->createMTestTest(i), tname);
-      }
+      this->declareTest(tname, i, ext == ".ptest");
     }
   }  // end of treatStandardInputFile
 
@@ -692,6 +1096,7 @@ namespace mtest {
       if (!t->isOutputFileNameDefined()) {
         t->setOutputFileName(n + ".res");
       }
+      t->setOutputFileFormat(this->result_file_format);
     }
     if (this->residual_file_output) {
       if (!t->isResidualFileNameDefined()) {
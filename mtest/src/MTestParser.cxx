@@ -72,6 +72,13 @@ namespace mtest {
                             const std::string& f,
                             const std::vector<std::string>& ecmds,
                             const std::map<std::string, std::string>& s) {
+    this->parseFile(f, ecmds, s);
+    this->execute(t);
+  }  // end of execute
+
+  void MTestParser::parseFile(const std::string& f,
+                              const std::vector<std::string>& ecmds,
+                              const std::map<std::string, std::string>& s) {
     this->openFile(f);
     this->stripComments();
     // substitutions
@@ -102,10 +109,12 @@ namespace mtest {
       this->tokens.insert(this->tokens.begin(), tokenizer.begin(),
                           tokenizer.end());
     }
-    this->execute(t);
-  }  // end of execute
+  }  // end of parseFile
 
   void MTestParser::execute(MTest& t) {
+    // the external functions declared while filling a previous test
+    // are discarded
+    this->externalFunctions = std::make_shared<ExternalFunctionManager>();
     auto p = this->tokens.cbegin();
     while (p != tokens.end()) {
       if (MTestParser::treatKeyword(t, p)) {
@@ -34,6 +34,18 @@ namespace mtest {
         i + "'");
   }  // end of getMaterialProperty
 
+  void MaterialProperty::getValues(real* const values,
+                                   const real* const* const args,
+                                   const std::size_t n) {
+    const auto nv = this->getNumberOfVariables();
+    for (std::size_t i = 0; i != n; ++i) {
+      for (std::size_t v = 0; v != nv; ++v) {
+        this->setVariableValue(v, args[v][i]);
+      }
+      values[i] = this->getValue();
+    }
+  }  // end of getValues
+
   MaterialProperty::~MaterialProperty() = default;
 
   real getValue(MaterialProperty& mp,
@@ -75,4 +87,25 @@ namespace mtest {
     return mp.getValue();
   }
 
+  std::vector<real> getValues(MaterialProperty& mp,
+                              const std::vector<std::vector<real>>& args) {
+    if (args.size() != mp.getNumberOfVariables()) {
+      tfel::raise("mtest::getValues: invalid number of arguments");
+    }
+    if (args.empty()) {
+      tfel::raise("mtest::getValues: no argument given");
+    }
+    const auto n = args.front().size();
+    auto ptrs = std::vector<const real*>{};
+    for (const auto& a : args) {
+      if (a.size() != n) {
+        tfel::raise("mtest::getValues: inconsistent sizes of the arguments");
+      }
+      ptrs.push_back(a.data());
+    }
+    auto values = std::vector<real>(n);
+    mp.getValues(values.data(), ptrs.data(), n);
+    return values;
+  }  // end of getValues
+
 }  // end of namespace mtest
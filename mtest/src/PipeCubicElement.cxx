@@ -19,6 +19,7 @@
 #include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
+#include "MTest/PipeElementContribution.hxx"
 #include "MTest/PipeCubicElement.hxx"
 
 namespace mtest {
@@ -195,10 +196,13 @@ namespace mtest {
     }
   }  // end of PipeCubicElement::computeStrain
 
-  std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+  template <typename StiffnessMatrix, typename InnerForces>
+  std::pair<bool, real>
+  PipeCubicElement::updateStiffnessMatrixAndInnerForcesImplementation(
+      StiffnessMatrix& k,
+      InnerForces& r,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -226,7 +230,6 @@ namespace mtest {
     // radial position of the fourth node
     const auto r3 = r0 + dr;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     // loop over Gauss point
@@ -247,11 +250,6 @@ namespace mtest {
       setRoundingMode();
       r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
       if (!rb.first) {
-        if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
-          auto& log = mfront::getLogStream();
-          log << "PipeCubicElement::computeStiffnessMatrixAndResidual : "
-              << "behaviour intregration failed" << std::endl;
-        }
         return {false, r_dt};
       }
       // stress tensor
@@ -291,4 +289,41 @@ namespace mtest {
     return {true, r_dt};
   }
 
+  std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    auto& bwk = scs.getBehaviourWorkSpace();
+    const auto rb = updateStiffnessMatrixAndInnerForcesImplementation(
+        k, r, scs, bwk, b, u1, m, dt, mt, i);
+    if (!rb.first) {
+      if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
+        auto& log = mfront::getLogStream();
+        log << "PipeCubicElement::computeStiffnessMatrixAndResidual : "
+            << "behaviour intregration failed" << std::endl;
+      }
+    }
+    return rb;
+  }  // end of updateStiffnessMatrixAndInnerForces
+
+  std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
+      PipeElementContribution& c,
+      StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(c, c, scs, bwk, b,
+                                                             u1, m, dt, mt, i);
+  }  // end of updateStiffnessMatrixAndInnerForces
+
 }  // end of namespace mtest
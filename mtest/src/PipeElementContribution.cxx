@@ -0,0 +1,53 @@
+/*!
+ * \file   PipeElementContribution.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "MTest/PipeElementContribution.hxx"
+
+namespace mtest {
+
+  void PipeElementContribution::initialize(const size_type f,
+                                           const size_type n,
+                                           const size_type a) {
+    tfel::raise_if(n > maximum_number_of_nodes,
+                   "PipeElementContribution::initialize: "
+                   "invalid number of nodes");
+    this->first_node = f;
+    this->number_of_nodes = n;
+    this->axial_strain_index = a;
+    std::fill(this->r.begin(), this->r.end(), real(0));
+    std::fill(this->k.begin(), this->k.end(), real(0));
+  }  // end of initialize
+
+  void PipeElementContribution::assemble(tfel::math::matrix<real>& K,
+                                         tfel::math::vector<real>& R,
+                                         const bool bk) const {
+    const auto n = this->number_of_nodes;
+    const auto f = this->first_node;
+    const auto a = this->axial_strain_index;
+    auto global = [n, f, a](const size_type i) { return i == n ? a : f + i; };
+    for (size_type i = 0; i != n + 1; ++i) {
+      R[global(i)] += this->r(i);
+    }
+    if (!bk) {
+      return;
+    }
+    for (size_type i = 0; i != n + 1; ++i) {
+      for (size_type j = 0; j != n + 1; ++j) {
+        K(global(i), global(j)) += this->k(i, j);
+      }
+    }
+  }  // end of assemble
+
+}  // end of namespace mtest
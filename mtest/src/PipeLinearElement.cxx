@@ -19,6 +19,7 @@
 #include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
+#include "MTest/PipeElementContribution.hxx"
 #include "MTest/PipeLinearElement.hxx"
 
 namespace mtest {
@@ -138,10 +139,13 @@ namespace mtest {
     }
   }  // end of PipeLinearElement::computeStrain
 
-  std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+  template <typename StiffnessMatrix, typename InnerForces>
+  std::pair<bool, real>
+  PipeLinearElement::updateStiffnessMatrixAndInnerForcesImplementation(
+      StiffnessMatrix& k,
+      InnerForces& r,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -167,7 +171,6 @@ namespace mtest {
     // jacobian of the transformation
     const auto J = dr / 2;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     auto r_dt = real{};
@@ -184,11 +187,6 @@ namespace mtest {
       setRoundingMode();
       r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
       if (!rb.first) {
-        if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
-          auto& log = mfront::getLogStream();
-          log << "PipeLinearElement::computeStiffnessMatrixAndResidual : "
-              << "behaviour intregration failed" << std::endl;
-        }
         return {false, r_dt};
       }
       // stress tensor
@@ -235,4 +233,41 @@ namespace mtest {
     return {true, r_dt};
   }
 
+  std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    auto& bwk = scs.getBehaviourWorkSpace();
+    const auto rb = updateStiffnessMatrixAndInnerForcesImplementation(
+        k, r, scs, bwk, b, u1, m, dt, mt, i);
+    if (!rb.first) {
+      if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
+        auto& log = mfront::getLogStream();
+        log << "PipeLinearElement::computeStiffnessMatrixAndResidual : "
+            << "behaviour intregration failed" << std::endl;
+      }
+    }
+    return rb;
+  }  // end of updateStiffnessMatrixAndInnerForces
+
+  std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      PipeElementContribution& c,
+      StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(c, c, scs, bwk, b,
+                                                             u1, m, dt, mt, i);
+  }  // end of updateStiffnessMatrixAndInnerForces
+
 }  // end of namespace mtest
@@ -12,14 +12,17 @@
  */
 
 #include <memory>
+#include <vector>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryResultFile.hxx"
 #include "TFEL/Math/General/IEEE754.hxx"
-#include "TFEL/Math/LUSolve.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Evolution.hxx"
@@ -33,6 +36,7 @@
 #include "MTest/PipeLinearElement.hxx"
 #include "MTest/PipeQuadraticElement.hxx"
 #include "MTest/PipeCubicElement.hxx"
+#include "MTest/PipeElementContribution.hxx"
 #include "MTest/OxidationStatusEvolution.hxx"
 #include "MTest/PipeProfile.hxx"
 #include "MTest/PipeProfileHandler.hxx"
@@ -584,7 +588,40 @@ namespace mtest {
                      "PipeTest::completeInitialisation: "
                      "filling temperature not set");
     }
-    if (this->out) {
+    if (this->isBinaryOutputFile()) {
+      auto legends = std::vector<std::string>{
+          "t",
+          "InnerRadius",
+          "OuterRadius",
+          "InnerRadiusDisplacement",
+          "OuterRadiusDisplacement",
+          "AxialDisplacement"};
+      if ((this->rl == IMPOSEDINNERRADIUS) ||
+          (this->rl == IMPOSEDOUTERRADIUS) || (this->rl == TIGHTPIPE) ||
+          (this->mandrel_radius_evolution != nullptr)) {
+        legends.push_back("InnerPressure");
+      }
+      if ((this->al == IMPOSEDAXIALGROWTH) ||
+          (this->mandrel_axial_growth_evolution != nullptr)) {
+        legends.push_back("AxialForce");
+      }
+      if (this->mandrel_radius_evolution != nullptr) {
+        legends.push_back("MandrelContactIndicator");
+      }
+      for (const auto& ao : this->aoutputs) {
+        legends.push_back(ao.d);
+      }
+      if (this->inner_boundary_oxidation_model.model != nullptr) {
+        legends.push_back("InnerBoundaryOxidationLength");
+      }
+      if (this->outer_boundary_oxidation_model.model != nullptr) {
+        legends.push_back("OuterBoundaryOxidationLength");
+      }
+      for (const auto& fc : this->failure_criteria) {
+        legends.push_back(fc->getName() + "FailureCriterionStatus");
+      }
+      this->openBinaryOutputFile(legends);
+    } else if (this->out) {
       auto c = 7u;
       this->out << "# first  column : time\n"
                    "# second column : inner radius\n"
@@ -875,11 +912,11 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
@@ -942,6 +979,25 @@ namespace mtest {
     wk.x.resize(psz);
     wk.r.resize(psz, 0.);
     wk.du.resize(psz, 0.);
+    // banded solver
+    wk.bbsolver.reset();
+    if (this->getLinearSolver() == BANDEDLINEARSOLVER) {
+      // the nodes of an element are coupled together, and the axial
+      // strain, which is the last unknown, is coupled to all nodes.
+      const auto hb = [this]() -> size_type {
+        if (this->mesh.etype == PipeMesh::LINEAR) {
+          return 1;
+        } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
+          return 2;
+        } else if (this->mesh.etype != PipeMesh::CUBIC) {
+          tfel::raise(
+              "PipeTest::initializeWorkSpace: "
+              "unknown element type");
+        }
+        return 3;
+      }();
+      wk.bbsolver = std::make_shared<BorderedBandedLUSolver>(psz, hb);
+    }
   }  // end of initializeWorkSpace
 
   std::pair<bool, real> PipeTest::prepare(StudyCurrentState& state,
@@ -1235,6 +1291,10 @@ namespace mtest {
       }
     }
     // loop over the elements
+    if (this->thread_pool != nullptr) {
+      return this->updateStiffnessMatrixAndInnerForcesConcurrently(
+          k, r, scs, state.u1, dt, mt);
+    }
     auto r_dt = real{};
     for (size_type i = 0; i != ne; ++i) {
       auto ri = std::pair<bool, real>{};
@@ -1263,6 +1323,73 @@ namespace mtest {
     return {true, r_dt};
   }  // end of computeStiffnessMatrixAndResidual
 
+  std::pair<bool, real>
+  PipeTest::updateStiffnessMatrixAndInnerForcesConcurrently(
+      tfel::math::matrix<real>& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const tfel::math::vector<real>& u1,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    using LE = PipeLinearElement;
+    using QE = PipeQuadraticElement;
+    using CE = PipeCubicElement;
+    // number of elements
+    const auto ne = size_type(this->mesh.number_of_elements);
+    // number of nodes, which is also the index of the axial strain
+    const auto n = this->getNumberOfNodes();
+    // number of nodes per element
+    const auto nn = (n - 1) / ne + 1;
+    // the elements are split in chunks. Each chunk is treated by one
+    // thread and uses its own behaviour workspace. The number of chunks
+    // is greater than the number of threads to balance the load.
+    const auto nchunks =
+        std::min(ne, 4 * (this->thread_pool->getNumberOfThreads() + 1));
+    const auto csize = (ne + nchunks - 1) / nchunks;
+    scs.allocateBehaviourWorkSpaces(nchunks);
+    auto contributions = std::vector<PipeElementContribution>(ne);
+    auto results = std::vector<std::pair<bool, real>>(ne);
+    this->thread_pool->parallel_for(0, nchunks, 1, [&](const size_type c) {
+      auto& bwk = scs.getBehaviourWorkSpace(c);
+      const auto eb = c * csize;
+      const auto ee = std::min(eb + csize, ne);
+      for (auto i = eb; i < ee; ++i) {
+        auto& ci = contributions[i];
+        ci.initialize((nn - 1) * i, nn, n);
+        if (this->mesh.etype == PipeMesh::LINEAR) {
+          results[i] = LE::updateStiffnessMatrixAndInnerForces(
+              ci, scs, bwk, *(this->b), u1, this->mesh, dt, mt, i);
+        } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
+          results[i] = QE::updateStiffnessMatrixAndInnerForces(
+              ci, scs, bwk, *(this->b), u1, this->mesh, dt, mt, i);
+        } else if (this->mesh.etype == PipeMesh::CUBIC) {
+          results[i] = CE::updateStiffnessMatrixAndInnerForces(
+              ci, scs, bwk, *(this->b), u1, this->mesh, dt, mt, i);
+        } else {
+          tfel::raise(
+              "PipeTest::updateStiffnessMatrixAndInnerForcesConcurrently: "
+              "unknown element type");
+        }
+      }
+    });
+    // assembly, in the order of the elements
+    auto r_dt = real{};
+    for (size_type i = 0; i != ne; ++i) {
+      r_dt = (i == 0) ? results[i].second : std::min(r_dt, results[i].second);
+      if (!results[i].first) {
+        if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
+          auto& log = mfront::getLogStream();
+          log << "PipeTest::computeStiffnessMatrixAndResidual : "
+              << "behaviour intregration failed in element " << i
+              << std::endl;
+        }
+        return {false, r_dt};
+      }
+      contributions[i].assemble(k, r, mt != StiffnessMatrixType::NOSTIFFNESS);
+    }
+    return {true, r_dt};
+  }  // end of updateStiffnessMatrixAndInnerForcesConcurrently
+
   void PipeTest::checkBehaviourConsistency(
       const std::shared_ptr<Behaviour>& bp) {
     using tfel::material::MechanicalBehaviourBase;
@@ -1531,7 +1658,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      backSubstitute(wk, du);
       setRoundingMode();
       const real due_dp = *(du.rbegin() + 1);
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1554,7 +1681,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      backSubstitute(wk, du);
       setRoundingMode();
       const real du_dp = du[0];
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1580,7 +1707,7 @@ namespace mtest {
       std::fill(du.begin(), du.end(), real(0));
       du(n) = 1;
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      backSubstitute(wk, du);
       setRoundingMode();
       const real dezz_dF = du(n);
       auto& F = state.getEvolution("AxialForce");
@@ -1689,40 +1816,40 @@ namespace mtest {
     if (t == "minimum_value") {
       this->aoutputs.push_back(
           {"minimum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMinimumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMinimumValue(s, n);
            }});
     } else if (t == "maximum_value") {
       this->aoutputs.push_back(
           {"maximum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMaximumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMaximumValue(s, n);
            }});
     } else if (t == "integral_value_initial_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(s, n);
            }});
     } else if (t == "integral_value_current_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(
                  s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else if (t == "mean_value_initial_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n);
            }});
     } else if (t == "mean_value_current_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n,
-                                          Configuration::CURRENT_CONFIGURATION);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(
+                 s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else {
       tfel::raise(
@@ -1999,6 +2126,42 @@ namespace mtest {
     return this->al;
   }  // end of setAxialLoading
 
+  void PipeTest::setLinearSolver(const PipeTest::LinearSolver ls) {
+    tfel::raise_if(this->linear_solver != DEFAULTLINEARSOLVER,
+                   "PipeTest::setLinearSolver: "
+                   "linear solver already defined");
+    tfel::raise_if(ls == DEFAULTLINEARSOLVER,
+                   "PipeTest::setLinearSolver: "
+                   "invalid linear solver");
+    this->linear_solver = ls;
+  }  // end of setLinearSolver
+
+  void PipeTest::setNumberOfThreads(const size_type n) {
+    tfel::raise_if(this->number_of_threads != 0,
+                   "PipeTest::setNumberOfThreads: "
+                   "number of threads already defined");
+    tfel::raise_if(n == 0,
+                   "PipeTest::setNumberOfThreads: "
+                   "invalid number of threads");
+    this->number_of_threads = n;
+    if (n > 1) {
+      // the thread calling the `parallel_for` method also treats
+      // elements
+      this->thread_pool = std::make_shared<tfel::system::ThreadPool>(n - 1);
+    }
+  }  // end of setNumberOfThreads
+
+  PipeTest::size_type PipeTest::getNumberOfThreads() const {
+    return this->number_of_threads == 0 ? 1 : this->number_of_threads;
+  }  // end of getNumberOfThreads
+
+  PipeTest::LinearSolver PipeTest::getLinearSolver() const {
+    if (this->linear_solver == DEFAULTLINEARSOLVER) {
+      return DENSELINEARSOLVER;
+    }
+    return this->linear_solver;
+  }  // end of getLinearSolver
+
   void PipeTest::setRadialLoading(const PipeTest::RadialLoading t) {
     tfel::raise_if(this->rl != DEFAULTLOADINGTYPE,
                    "PipeTest::setRadialLoading: "
@@ -2141,7 +2304,7 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (!this->out) {
+    if ((this->bout == nullptr) && (!this->out)) {
       return;
     }
     const auto& u1 = state.u1;
@@ -2150,42 +2313,49 @@ namespace mtest {
     const auto Ri = this->mesh.inner_radius;
     // outer radius
     const auto Re = this->mesh.outer_radius;
-    this->out << t << " " << Ri + u1[0] << " " << Re + u1[n - 1] << " " << u1[0]
-              << " " << u1[n - 1] << " " << u1[n];
+    auto values = std::vector<real>{t,        Ri + u1[0], Re + u1[n - 1],
+                                    u1[0],    u1[n - 1],  u1[n]};
     if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
         (this->rl == TIGHTPIPE) ||
         (this->mandrel_radius_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("InnerPressure")(t);
+      values.push_back(state.getEvolution("InnerPressure")(t));
     }
     if ((this->al == IMPOSEDAXIALGROWTH) ||
         (this->mandrel_axial_growth_evolution != nullptr)) {
-      this->out << " " << state.getEvolution("AxialForce")(t);
+      values.push_back(state.getEvolution("AxialForce")(t));
     }
     if (this->mandrel_radius_evolution != nullptr) {
       if (state.containsParameter("MandrelContactStateAtEndOfTimeStep")) {
         if (state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep")) {
-          this->out << " " << 1;
+          values.push_back(1);
         } else {
-          this->out << " " << 0;
+          values.push_back(0);
         }
       } else {
-        this->out << " " << 0;
+        values.push_back(0);
       }
     }
     for (const auto& ao : this->aoutputs) {
-      this->out << " ";
-      ao.f(out, state);
+      values.push_back(ao.f(state));
     }
     if (this->inner_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->inner_boundary_oxidation_model);
+      values.push_back(
+          getOxidationLength(state, this->inner_boundary_oxidation_model));
     }
     if (this->outer_boundary_oxidation_model.model != nullptr) {
-      this->out << getOxidationLength(state,
-                                      this->outer_boundary_oxidation_model);
+      values.push_back(
+          getOxidationLength(state, this->outer_boundary_oxidation_model));
     }
     for (std::size_t i = 0; i != this->failure_criteria.size(); ++i) {
-      this->out << " " << (state.getFailureCriterionStatus(i) ? 1 : 0);
+      values.push_back(state.getFailureCriterionStatus(i) ? 1 : 0);
+    }
+    if (this->bout != nullptr) {
+      this->bout->addLine(values);
+      return;
+    }
+    this->out << values[0];
+    for (auto pv = values.begin() + 1; pv != values.end(); ++pv) {
+      this->out << " " << *pv;
     }
     this->out << '\n';
   }  // end of printOutput
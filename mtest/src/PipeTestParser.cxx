@@ -266,6 +266,10 @@ namespace mtest {
                            &PipeTestParser::handleFailureCriterion);
     this->registerCallBack("@OxidationModel",
                            &PipeTestParser::handleOxidationModel);
+    this->registerCallBack("@LinearSolver",
+                           &PipeTestParser::handleLinearSolver);
+    this->registerCallBack("@NumberOfThreads",
+                           &PipeTestParser::handleNumberOfThreads);
   }
 
   void PipeTestParser::registerCallBack(const std::string& k,
@@ -328,6 +332,38 @@ namespace mtest {
                              this->tokens.end());
   }  // end of PipeTestParser::handleAxialLoading
 
+  void PipeTestParser::handleLinearSolver(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleLinearSolver", p,
+                            this->tokens.end());
+    const auto& s = this->readString(p, this->tokens.end());
+    if (s == "Dense") {
+      t.setLinearSolver(mtest::PipeTest::DENSELINEARSOLVER);
+    } else if (s == "Banded") {
+      t.setLinearSolver(mtest::PipeTest::BANDEDLINEARSOLVER);
+    } else {
+      tfel::raise(
+          "PipeTestParser::handleLinearSolver: "
+          "invalid linear solver ('" +
+          s +
+          "').\n"
+          "Valid linear solvers are 'Dense' and 'Banded'");
+    }
+    this->checkNotEndOfLine("PipeTestParser::handleLinearSolver", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleLinearSolver", ";", p,
+                             this->tokens.end());
+  }  // end of PipeTestParser::handleLinearSolver
+
+  void PipeTestParser::handleNumberOfThreads(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    t.setNumberOfThreads(this->readUnsignedInt(p, this->tokens.end()));
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleNumberOfThreads", ";", p,
+                             this->tokens.end());
+  }  // end of PipeTestParser::handleNumberOfThreads
+
   void PipeTestParser::handleInnerRadius(PipeTest& t, tokens_iterator& p) {
     this->checkNotEndOfLine("PipeTestParser::handleInnerRadius", p,
                             this->tokens.end());
@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryResultFile.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/AccelerationAlgorithmFactory.hxx"
 #include "MTest/CastemAccelerationAlgorithm.hxx"
@@ -47,9 +48,29 @@ namespace mtest {
                      "evolution '" +
                          n + "' already defined");
     }
+    const auto po = this->overridden_evolutions.find(n);
+    if (po != this->overridden_evolutions.end()) {
+      tfel::raise_if(!p->isConstant(),
+                     "SchemeBase::addEvolution: "
+                     "evolution '" +
+                         n + "' is overridden but is not constant");
+      (*(this->evm))[n] = std::make_shared<ConstantEvolution>(po->second);
+      return;
+    }
     (*(this->evm))[n] = p;
   }  // end of SchemeBase::addEvolution
 
+  void SchemeBase::overrideConstantEvolutions(
+      const std::map<std::string, real>& v) {
+    for (const auto& ov : v) {
+      tfel::raise_if(this->evm->find(ov.first) != this->evm->end(),
+                     "SchemeBase::overrideConstantEvolutions: "
+                     "evolution '" +
+                         ov.first + "' already defined");
+      this->overridden_evolutions[ov.first] = ov.second;
+    }
+  }  // end of SchemeBase::overrideConstantEvolutions
+
   void SchemeBase::setEvolutionValue(const std::string& n,
                                      const real t,
                                      const real v) {
@@ -312,7 +333,13 @@ namespace mtest {
 
   void SchemeBase::resetOutputFile() {
     // output file
-    if (!this->output.empty()) {
+    if (this->isBinaryOutputFile()) {
+      this->bout.reset();
+      if (!this->bout_legends.empty()) {
+        this->bout = std::make_unique<tfel::utilities::BinaryResultFileWriter>(
+            this->output, this->bout_legends);
+      }
+    } else if (!this->output.empty()) {
       this->out.close();
       this->out.open(this->output.c_str());
       tfel::raise_if(!this->out,
@@ -438,6 +465,15 @@ namespace mtest {
     return !this->output.empty();
   }
 
+  void SchemeBase::disableOutputFiles() {
+    tfel::raise_if(this->initialisationFinished,
+                   "SchemeBase::disableOutputFiles: "
+                   "the output files can't be disabled after the "
+                   "initialisation");
+    this->output.clear();
+    this->residualFileName.clear();
+  }  // end of disableOutputFiles
+
   void SchemeBase::setOutputFilePrecision(const unsigned int p) {
     tfel::raise_if(this->oprec != -1,
                    "SchemeBase::setOutputFileName: "
@@ -445,6 +481,36 @@ namespace mtest {
     this->oprec = static_cast<int>(p);
   }
 
+  void SchemeBase::setOutputFileFormat(const OutputFileFormat f) {
+    tfel::raise_if(this->initialisationFinished,
+                   "SchemeBase::setOutputFileFormat: "
+                   "the output file format can't be changed after the "
+                   "initialisation");
+    this->output_file_format = f;
+  }  // end of setOutputFileFormat
+
+  bool SchemeBase::isBinaryOutputFile() const {
+    return (!this->output.empty()) &&
+           (this->output_file_format == BINARYFILEFORMAT);
+  }  // end of isBinaryOutputFile
+
+  void SchemeBase::openBinaryOutputFile(const std::vector<std::string>& l) {
+    if (!this->isBinaryOutputFile()) {
+      return;
+    }
+    this->bout_legends = l;
+    this->bout = std::make_unique<tfel::utilities::BinaryResultFileWriter>(
+        this->output, this->bout_legends);
+  }  // end of openBinaryOutputFile
+
+  void SchemeBase::flushOutputFile() const {
+    if (this->bout != nullptr) {
+      this->bout->flush();
+    } else {
+      this->out.flush();
+    }
+  }  // end of flushOutputFile
+
   void SchemeBase::setResidualFileName(const std::string& o) {
     tfel::raise_if(!this->residualFileName.empty(),
                    "SchemeBase::setResidualFileName : "
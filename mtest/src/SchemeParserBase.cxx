@@ -580,14 +580,15 @@ namespace mtest {
     tfel::raise_if(!this->isValidIdentifier(tfel::unicode::getMangledString(n)),
                    "SchemeParserBase::handleEvolution: '" + n +
                        "' is not a valid identifier");
-    const auto ev = this->parseEvolution(t, evt, p);
-    if (ev->isConstant()) {
+    t.addEvolution(n, this->parseEvolution(t, evt, p), true, true);
+    // the evolution may have been overridden
+    const auto& ev = *(t.getEvolutions().at(n));
+    if (ev.isConstant()) {
       const auto cste =
           std::make_shared<tfel::math::parser::ConstantExternalFunction>(
-              ev->operator()(0));
+              ev(0));
       this->externalFunctions->insert({n, cste});
     }
-    t.addEvolution(n, ev, true, true);
     this->readSpecifiedToken("SchemeParserBase::handleEvolution", ";", p,
                              this->tokens.end());
   }
@@ -761,6 +761,18 @@ namespace mtest {
     elm.setParameter(this->library, this->behaviour, this->hypothesis, n, v);
   }  // end of setUnsignedIntegerParameter
 
+  bool StandardBehaviourBase::hasInstanceParameters() const {
+    return false;
+  }  // end of hasInstanceParameters
+
+  void StandardBehaviourBase::setInstanceParameter(const std::string& n,
+                                                   const real) {
+    tfel::raise(
+        "StandardBehaviourBase::setInstanceParameter: "
+        "can't set the value of parameter '" +
+        n + "' for this object only (unsupported feature)");
+  }  // end of setInstanceParameter
+
   std::vector<std::string>
   StandardBehaviourBase::getOptionalMaterialProperties() const {
     return {};
@@ -61,18 +61,34 @@ namespace mtest {
   }
 
   BehaviourWorkSpace& StructureCurrentState::getBehaviourWorkSpace() const {
-    using tfel::material::ModellingHypothesis;
     if (this->bwks.empty()) {
+      this->allocateBehaviourWorkSpaces(1);
+    }
+    return *(this->bwks[0]);
+  }  // end of StructureCurrentState::getBehaviourWorkSpace
+
+  void StructureCurrentState::allocateBehaviourWorkSpaces(
+      const size_t n) const {
+    using tfel::material::ModellingHypothesis;
+    while (this->bwks.size() < n) {
       tfel::raise_if(this->b == nullptr,
-                     "StructureCurrentState::getBehaviourWorkSpace: "
+                     "StructureCurrentState::allocateBehaviourWorkSpaces: "
                      "behaviour not set");
       tfel::raise_if(this->h == ModellingHypothesis::UNDEFINEDHYPOTHESIS,
-                     "StructureCurrentState::getBehaviourWorkSpace: "
+                     "StructureCurrentState::allocateBehaviourWorkSpaces: "
                      "modelling hypothesis not set");
-      this->bwks.push_back(std::make_shared<BehaviourWorkSpace>());
-      this->b->allocateWorkSpace(*(this->bwks[0]));
+      auto wk = std::make_shared<BehaviourWorkSpace>();
+      this->b->allocateWorkSpace(*wk);
+      this->bwks.push_back(std::move(wk));
     }
-    return *(this->bwks[0]);
+  }  // end of StructureCurrentState::allocateBehaviourWorkSpaces
+
+  BehaviourWorkSpace& StructureCurrentState::getBehaviourWorkSpace(
+      const size_t i) const {
+    tfel::raise_if(i >= this->bwks.size(),
+                   "StructureCurrentState::getBehaviourWorkSpace: "
+                   "workspace not allocated");
+    return *(this->bwks[i]);
   }  // end of StructureCurrentState::getBehaviourWorkSpace
 
   CurrentState& StructureCurrentState::getModelCurrentState(const Model& m) {
@@ -24,10 +24,9 @@ namespace mtest {
           "can't open file '" +
           f + "'");
     }
-    auto cevs = buildExternalFunctionManagerFromConstantEvolutions(this->evm);
     for (const auto& p : ps) {
-      auto eval = std::make_shared<tfel::math::Evaluator>(p, cevs);
-      const auto& vns = eval->getVariablesNames();
+      auto formula = Formula(p, this->evm);
+      const auto& vns = formula.getVariablesNames();
       for (const auto& vn : vns) {
         if (isBehaviourVariable(b, vn)) {
           if (this->extractors.count(vn) == 0) {
@@ -42,7 +41,7 @@ namespace mtest {
           }
         }
       }
-      this->postprocessings.push_back(eval);
+      this->postprocessings.push_back(std::move(formula));
     }
     this->out << "# first column : time\n";
     auto cnbr = int{2};
@@ -56,12 +55,13 @@ namespace mtest {
                                       const real t,
                                       const real dt) {
     this->out << t + dt << " ";
-    for (const auto& p : this->postprocessings) {
-      const auto& vns = p->getVariablesNames();
-      for (const auto& vn : vns) {
+    for (auto& p : this->postprocessings) {
+      const auto& vns = p.getVariablesNames();
+      for (std::vector<std::string>::size_type i = 0; i != vns.size(); ++i) {
+        const auto& vn = vns[i];
         auto pe = this->extractors.find(vn);
         if (pe != this->extractors.end()) {
-          p->setVariableValue(vn, pe->second(s));
+          p.setVariableValue(i, pe->second(s));
         } else {
           const auto pev = this->evm.find(vn);
           if (pev == this->evm.end()) {
@@ -69,10 +69,10 @@ namespace mtest {
                         vn + "'");
           }
           const auto& ev = *(pev->second);
-          p->setVariableValue(vn, ev(t + dt));
+          p.setVariableValue(i, ev(t + dt));
         }
       }
-      this->out << " " << p->getValue();
+      this->out << " " << p.getValue();
     }
     this->out << std::endl;
   }  // end of UserDefinedPostProcessing::exe
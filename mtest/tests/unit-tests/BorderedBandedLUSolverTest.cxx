@@ -0,0 +1,130 @@
+/*!
+ * \file   BorderedBandedLUSolverTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "MTest/BorderedBandedLUSolver.hxx"
+
+struct BorderedBandedLUSolverTest final : public tfel::tests::TestCase {
+  BorderedBandedLUSolverTest()
+      : tfel::tests::TestCase("MTest", "BorderedBandedLUSolverTest") {
+  }  // end of BorderedBandedLUSolverTest
+
+  tfel::tests::TestResult execute() override {
+    for (const auto p : {size_type{1}, size_type{2}, size_type{3}}) {
+      for (const auto n : {size_type{1}, size_type{2}, size_type{5},
+                           size_type{13}, size_type{50}}) {
+        this->test1(n, p, false);
+        this->test1(n, p, true);
+      }
+    }
+    this->test2();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  using real = mtest::real;
+  using size_type = mtest::BorderedBandedLUSolver::size_type;
+  //! \brief a simple pseudo-random number generator
+  real random() {
+    this->seed = (this->seed * 1103515245u + 12345u) % 2147483648u;
+    return real(this->seed) / real(2147483648u) - real(1) / 2;
+  }
+  /*!
+   * \brief compare the banded solver to the dense LU solver
+   * \param[in] n: size of the linear system
+   * \param[in] p: half bandwidth
+   * \param[in] b: if true, the diagonal of the banded block is weak,
+   * which requires pivoting
+   */
+  void test1(const size_type n, const size_type p, const bool b) {
+    const auto eps = real(1e-10);
+    const auto m = n - 1;
+    auto k = tfel::math::matrix<real>(n, n, real(0));
+    for (size_type i = 0; i != m; ++i) {
+      for (size_type j = 0; j != m; ++j) {
+        if ((j + p >= i) && (i + p >= j)) {
+          k(i, j) = this->random();
+        }
+      }
+      if (!b) {
+        k(i, i) += 4;
+      }
+      k(i, m) = this->random();
+      k(m, i) = this->random();
+    }
+    k(m, m) = 4;
+    auto x = tfel::math::vector<real>(n);
+    for (auto& v : x) {
+      v = this->random();
+    }
+    // banded solver
+    auto x1 = x;
+    auto s = mtest::BorderedBandedLUSolver(n, p);
+    TFEL_TESTS_ASSERT(s.size() == n);
+    TFEL_TESTS_ASSERT(s.getHalfBandwidth() == p);
+    s.exe(k, x1);
+    // dense solver
+    auto x2 = x;
+    auto k2 = k;
+    tfel::math::LUSolve::exe(k2, x2);
+    for (size_type i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x1[i] - x2[i]) < eps * (1 + std::abs(x2[i])));
+    }
+    // back substitution with the same factorisation
+    auto x3 = x;
+    s.solve(x3);
+    for (size_type i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x3[i] - x1[i]) < eps * (1 + std::abs(x1[i])));
+    }
+  }  // end of test1
+  //! \brief check the detection of invalid inputs
+  void test2() {
+    TFEL_TESTS_CHECK_THROW(mtest::BorderedBandedLUSolver(0, 1),
+                           tfel::math::LUException);
+    auto s = mtest::BorderedBandedLUSolver(4, 1);
+    auto k = tfel::math::matrix<real>(3, 3, real(0));
+    auto x = tfel::math::vector<real>(4, real(0));
+    TFEL_TESTS_CHECK_THROW(s.factorize(k), tfel::math::LUException);
+    // singular matrix
+    auto k2 = tfel::math::matrix<real>(4, 4, real(0));
+    TFEL_TESTS_CHECK_THROW(s.exe(k2, x), tfel::math::LUException);
+  }  // end of test2
+  //! \brief seed of the pseudo-random number generator
+  unsigned long seed = 1;
+};
+
+TFEL_TESTS_GENERATE_PROXY(BorderedBandedLUSolverTest,
+                          "BorderedBandedLUSolverTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  using namespace tfel::tests;
+  auto& m = TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BorderedBandedLUSolverTest.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -16,6 +16,8 @@
 #endif /* NDEBUG */
 
 #include <cmath>
+#include <span>
+#include <vector>
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
@@ -32,6 +34,15 @@ struct EvolutionTestUnitTest final : public tfel::tests::TestCase {
   }  // end of EvolutionTestUnitTest
 
   tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute()
+  //! destructor
+  ~EvolutionTestUnitTest() override = default;
+
+ private:
+  void test1() {
     auto cev = mtest::make_evolution(12.);
     auto lev = mtest::make_evolution({{0., 2.}, {1., 3.}, {2., 4.}});
     auto lev2 = mtest::make_evolution({{0., 1.}});
@@ -51,10 +62,33 @@ struct EvolutionTestUnitTest final : public tfel::tests::TestCase {
     TFEL_TESTS_CHECK_THROW(lev->setValue(4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(cev->setValue(2., 4.), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(mtest::LPIEvolution({}, {})(2.), std::runtime_error);
-    return this->result;
-  }  // end of execute()
-  //! destructor
-  ~EvolutionTestUnitTest() override = default;
+  }  // end of test1
+  //! \brief lookup of the interval in non monotonic and batch evaluations
+  void test2() {
+    const auto eps = 1.e-14;
+    // unsorted times
+    auto lev = mtest::LPIEvolution({2., 0., 1.}, {4., 2., 3.});
+    auto f = [](const double t) { return t < 0 ? 2 : (t > 2 ? 4 : 2 + t); };
+    for (const auto t : {0.5, 1.5, 0.2, 1., 3., -1., 0.7, 1.7, 1.9}) {
+      TFEL_TESTS_ASSERT(std::abs(lev(t) - f(t)) < eps);
+    }
+    // batch evaluation
+    const auto t = std::vector<double>{-1, 0., 0.25, 0.5, 1.25, 2, 2.5};
+    auto r = std::vector<double>(t.size());
+    lev.evaluate(r, t);
+    for (std::size_t i = 0; i != t.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - f(t[i])) < eps);
+    }
+    TFEL_TESTS_CHECK_THROW(lev.evaluate(std::span<double>(r).subspan(1), t),
+                           std::runtime_error);
+    // modifications of the evolution
+    lev.setValue(0.5, 3.);
+    lev.setValue(2., 5.);
+    TFEL_TESTS_ASSERT(std::abs(lev(0.25) - 2.5) < eps);
+    TFEL_TESTS_ASSERT(std::abs(lev(0.75) - 3.) < eps);
+    TFEL_TESTS_ASSERT(std::abs(lev(1.5) - 4.) < eps);
+    TFEL_TESTS_ASSERT(std::abs(lev(3.) - 5.) < eps);
+  }  // end of test2
 };
 
 TFEL_TESTS_GENERATE_PROXY(EvolutionTestUnitTest, "EvolutionTestUnitTest");
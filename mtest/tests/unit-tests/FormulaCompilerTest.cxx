@@ -0,0 +1,171 @@
+/*!
+ * \file   FormulaCompilerTest.cxx
+ * \brief  This file checks the compilation of formulas in shared
+ * libraries by the `FormulaCompiler` class.
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <filesystem>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/Evaluator.hxx"
+#include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
+#include "MTest/Evolution.hxx"
+#include "MTest/Formula.hxx"
+#include "MTest/FormulaCompiler.hxx"
+
+struct FormulaCompilerTest final : public tfel::tests::TestCase {
+  FormulaCompilerTest()
+      : tfel::tests::TestCase("MTest", "FormulaCompilerTest") {
+  }  // end of FormulaCompilerTest
+
+  tfel::tests::TestResult execute() override {
+    std::filesystem::remove_all(this->directory);
+    auto& c = mtest::FormulaCompiler::getFormulaCompiler();
+    c.setCacheDirectory(this->directory);
+    TFEL_TESTS_ASSERT(c.isEnabled());
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief cache directory
+  const std::string directory = "FormulaCompilerTest-cache";
+  //! \return the number of libraries in the cache directory
+  std::size_t getNumberOfLibraries() const {
+    auto n = std::size_t{};
+    for (const auto& p : std::filesystem::directory_iterator(directory)) {
+      if (p.path().extension() == ".so") {
+        ++n;
+      }
+    }
+    return n;
+  }  // end of getNumberOfLibraries
+  /*!
+   * \brief compare the compiled function to the interpreter
+   * \param[in] f: compiled function
+   * \param[in] e: interpreted formula
+   */
+  void check(const mtest::FormulaCompiler::FunctionPtr f,
+             tfel::math::Evaluator& e) {
+    const auto px = e.getVariablePosition("x");
+    const auto py = e.getVariablePosition("y");
+    for (const auto x : {-1.2, 0.3, 2.}) {
+      for (const auto y : {0.1, 1.4}) {
+        auto v = std::vector<double>(2);
+        v[px] = x;
+        v[py] = y;
+        e.setVariableValue("x", x);
+        e.setVariableValue("y", y);
+        const auto r = e.getValue();
+        TFEL_TESTS_ASSERT(std::abs(f(v.data()) - r) <
+                          1e-14 * std::max(std::abs(r), 1.));
+      }
+    }
+  }  // end of check
+  //! \brief compilation of a formula
+  void test1() {
+    auto e = tfel::math::Evaluator("2*x+exp(y)*sin(x)-power<3>(y)");
+    const auto f =
+        mtest::FormulaCompiler::getFormulaCompiler().compile(e);
+    TFEL_TESTS_ASSERT(f != nullptr);
+    if (f == nullptr) {
+      return;
+    }
+    TFEL_TESTS_ASSERT(this->getNumberOfLibraries() == 1);
+    this->check(f, e);
+  }  // end of test1
+  //! \brief the same formula is not compiled twice
+  void test2() {
+    auto e = tfel::math::Evaluator("2*x+exp(y)*sin(x)-power<3>(y)");
+    auto& c = mtest::FormulaCompiler::getFormulaCompiler();
+    const auto f1 = c.compile(e);
+    const auto f2 = c.compile(e);
+    TFEL_TESTS_ASSERT(f1 != nullptr);
+    TFEL_TESTS_ASSERT(f1 == f2);
+    TFEL_TESTS_ASSERT(this->getNumberOfLibraries() == 1);
+  }  // end of test2
+  //! \brief formulas which can't be compiled are interpreted
+  void test3() {
+    using tfel::math::Evaluator;
+    using tfel::math::parser::ExternalFunctionManager;
+    auto& c = mtest::FormulaCompiler::getFormulaCompiler();
+    // external functions with arguments can't be compiled
+    auto m = std::make_shared<ExternalFunctionManager>();
+    m->insert({"f", std::make_shared<Evaluator>(
+                        std::vector<std::string>{"x"}, "2*x")});
+    auto e = Evaluator("f(x)+y", m);
+    TFEL_TESTS_ASSERT(c.compile(e) == nullptr);
+    // external functions without arguments, such as constant
+    // evolutions, are replaced by their values
+    auto evm = mtest::EvolutionManager{};
+    evm["E"] = mtest::make_evolution(150e9);
+    auto e2 = Evaluator(
+        std::vector<std::string>{"x"}, "E*x",
+        mtest::buildExternalFunctionManagerFromConstantEvolutions(evm));
+    e2.removeDependencies();
+    const auto f = c.compile(e2);
+    TFEL_TESTS_ASSERT(f != nullptr);
+    if (f == nullptr) {
+      return;
+    }
+    const auto x = 2e-3;
+    TFEL_TESTS_ASSERT(std::abs(f(&x) - 3e8) < 1e-14 * 3e8);
+  }  // end of test3
+  /*!
+   * \brief the compiler is part of the key identifying a library: if the
+   * compiler changes, the formula is compiled again. If this compilation
+   * fails, the formula is interpreted.
+   */
+  void test4() {
+    const auto cxx = ::getenv("CXX");
+    const auto cxx_value = std::string((cxx == nullptr) ? "" : cxx);
+    ::setenv("CXX", "FormulaCompilerTest-invalid-compiler", 1);
+    auto e = tfel::math::Evaluator("2*x+exp(y)*sin(x)-power<3>(y)");
+    TFEL_TESTS_ASSERT(
+        mtest::FormulaCompiler::getFormulaCompiler().compile(e) == nullptr);
+    auto evm = mtest::EvolutionManager{};
+    auto f = mtest::Formula("x*x+1", evm);
+    TFEL_TESTS_ASSERT(!f.isCompiled());
+    f.setVariableValue(0, 3);
+    TFEL_TESTS_ASSERT(std::abs(f.getValue() - 10) < 1e-14);
+    if (cxx == nullptr) {
+      ::unsetenv("CXX");
+    } else {
+      ::setenv("CXX", cxx_value.c_str(), 1);
+    }
+    TFEL_TESTS_ASSERT(this->getNumberOfLibraries() == 2);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(FormulaCompilerTest, "FormulaCompilerTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("FormulaCompilerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
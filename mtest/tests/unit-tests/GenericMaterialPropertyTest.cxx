@@ -0,0 +1,91 @@
+/*!
+ * \file   GenericMaterialPropertyTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MTest/MaterialProperty.hxx"
+
+struct GenericMaterialPropertyTest final : public tfel::tests::TestCase {
+  GenericMaterialPropertyTest()
+      : tfel::tests::TestCase("MTest", "GenericMaterialPropertyTest") {
+  }  // end of GenericMaterialPropertyTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \return the material property used by the tests
+  static std::shared_ptr<mtest::MaterialProperty> getMaterialProperty() {
+    const auto l = std::getenv("MTEST_GENERIC_MATERIAL_PROPERTIES_LIBRARY");
+    if (l == nullptr) {
+      throw(std::runtime_error("undefined library"));
+    }
+    return mtest::MaterialProperty::getMaterialProperty(
+        "generic", l, "VanadiumAlloy_YoungModulus_SRMA");
+  }  // end of getMaterialProperty
+  //! \brief comparison of the array evaluation to the scalar evaluation
+  void test1() {
+    auto mp = getMaterialProperty();
+    auto temperatures = std::vector<mtest::real>{};
+    // the last values are out of bounds, which is allowed by the
+    // default policy
+    for (unsigned short i = 0; i != 103; ++i) {
+      temperatures.push_back(200 + 10 * i);
+    }
+    const auto values = mtest::getValues(*mp, {temperatures});
+    TFEL_TESTS_ASSERT(values.size() == temperatures.size());
+    // default implementation based on the scalar evaluation
+    auto values2 = std::vector<mtest::real>(temperatures.size());
+    const auto* const args = temperatures.data();
+    mp->mtest::MaterialProperty::getValues(values2.data(), &args,
+                                           temperatures.size());
+    for (std::size_t i = 0; i != temperatures.size(); ++i) {
+      const auto v = mtest::getValue(*mp, temperatures[i]);
+      TFEL_TESTS_ASSERT(std::abs(values[i] - v) < 1e-14 * std::abs(v));
+      TFEL_TESTS_ASSERT(std::abs(values2[i] - v) < 1e-14 * std::abs(v));
+    }
+    // empty arrays
+    const auto empty = std::vector<std::vector<mtest::real>>(1);
+    TFEL_TESTS_ASSERT(mtest::getValues(*mp, empty).empty());
+  }  // end of test1
+  //! \brief physical bounds are checked for the whole array
+  void test2() {
+    auto mp = getMaterialProperty();
+    const auto temperatures = std::vector<mtest::real>{300, 400, -1, 500};
+    TFEL_TESTS_CHECK_THROW(mtest::getValues(*mp, {temperatures}),
+                           std::runtime_error);
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(GenericMaterialPropertyTest,
+                          "GenericMaterialPropertyTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("GenericMaterialPropertyTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
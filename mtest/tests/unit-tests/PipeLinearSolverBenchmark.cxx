@@ -0,0 +1,96 @@
+/*!
+ * \file   PipeLinearSolverBenchmark.cxx
+ * \brief  This file compares the dense LU solver to the
+ * `BorderedBandedLUSolver` class on matrices having the structure of the
+ * stiffness matrices assembled by the `PipeTest` class.
+ *
+ * Usage: PipeLinearSolverBenchmark [maximum number of elements]
+ *
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/BorderedBandedLUSolver.hxx"
+
+using real = mtest::real;
+using size_type = mtest::BorderedBandedLUSolver::size_type;
+
+/*!
+ * \brief assemble a matrix having the structure of the stiffness matrix
+ * of a pipe
+ * \param[in] ne: number of elements
+ * \param[in] p: number of nodes per element minus one
+ */
+static tfel::math::matrix<real> assemble(const size_type ne,
+                                         const size_type p) {
+  const auto nn = p * ne + 1;
+  auto k = tfel::math::matrix<real>(nn + 1, nn + 1, real(0));
+  for (size_type e = 0; e != ne; ++e) {
+    for (size_type i = 0; i != p + 1; ++i) {
+      for (size_type j = 0; j != p + 1; ++j) {
+        k(p * e + i, p * e + j) += (i == j) ? real(2) : real(-1) / real(p);
+      }
+      k(p * e + i, nn) += real(1) / real(ne);
+      k(nn, p * e + i) += real(1) / real(ne);
+    }
+  }
+  for (size_type i = 0; i != nn; ++i) {
+    k(i, i) += real(1) / real(nn);
+  }
+  k(nn, nn) = real(1);
+  return k;
+}  // end of assemble
+
+template <typename F>
+static double measure(F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(const int argc, const char* const* const argv) {
+  const auto nmax =
+      argc > 1 ? static_cast<size_type>(std::stoi(argv[1])) : size_type{1000};
+  std::cout << "# element type | number of elements | number of unknowns | "
+            << "dense LU (ms) | banded LU (ms) | maximum difference\n";
+  for (const auto p : {size_type{1}, size_type{2}, size_type{3}}) {
+    const auto etype =
+        p == 1 ? "Linear" : (p == 2 ? "Quadratic" : "Cubic");
+    for (size_type ne = 10; ne <= nmax; ne *= 2) {
+      const auto k = assemble(ne, p);
+      const auto n = k.getNbRows();
+      auto b = tfel::math::vector<real>(n, real(1));
+      auto x1 = b;
+      auto x2 = b;
+      const auto t1 = measure([&k, &x1] {
+        auto k2 = k;
+        tfel::math::LUSolve::exe(k2, x1);
+      });
+      const auto t2 = measure([&k, &x2, n, p] {
+        mtest::BorderedBandedLUSolver s(n, p);
+        s.exe(k, x2);
+      });
+      auto e = real(0);
+      for (size_type i = 0; i != n; ++i) {
+        e = std::max(e, std::abs(x1[i] - x2[i]));
+      }
+      std::cout << etype << " " << ne << " " << n << " " << t1 << " " << t2
+                << " " << e << std::endl;
+    }
+  }
+  return EXIT_SUCCESS;
+}
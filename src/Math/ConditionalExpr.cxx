@@ -16,6 +16,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/Number.hxx"
 #include "TFEL/Math/Parser/ConditionalExpr.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -44,6 +45,11 @@ namespace tfel::math::parser {
     return this->b->getValue();
   }  // end of ConditionalExpr::getValue() const
 
+  std::vector<double>::size_type ConditionalExpr::compile(
+      ExprProgram& p) const {
+    return p.addConditionalExpression(*(this->c), *(this->a), *(this->b));
+  }  // end of compile
+
   std::string ConditionalExpr::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "(" + this->c->getCxxFormula(m) + ") ? " + "(" +
@@ -1239,9 +1239,34 @@ namespace tfel::math {
     raise_if(this->expr == nullptr,
              "Evaluator::getValue: "
              "uninitialized expression.");
-    return this->expr->getValue();
+    return this->program.getValue(this->variables);
   }  // end of getValue
 
+  void Evaluator::getValues(std::span<double> r,
+                            std::span<const std::span<const double>> v) {
+    raise_if(this->expr == nullptr,
+             "Evaluator::getValues: "
+             "uninitialized expression.");
+    raise_if(v.size() != this->variables.size(),
+             "Evaluator::getValues: "
+             "invalid number of variables");
+    for (const auto& values : v) {
+      raise_if(values.size() != r.size(),
+               "Evaluator::getValues: "
+               "unmatched number of points");
+    }
+    if (this->program.isVectorizable()) {
+      this->program.getValues(r, v);
+      return;
+    }
+    for (std::span<double>::size_type i = 0; i != r.size(); ++i) {
+      for (std::vector<double>::size_type j = 0; j != v.size(); ++j) {
+        this->variables[j] = v[j][i];
+      }
+      r[i] = this->program.getValue(this->variables);
+    }
+  }  // end of getValues
+
   double Evaluator::operator()() const {
     return this->getValue();
   }  // end of operator()
@@ -1269,6 +1294,7 @@ namespace tfel::math {
       auto g = this->treatGroup(p, pe, b, "");
       g->reduce();
       this->expr = g->analyse();
+      this->compile();
     } catch (std::exception& e) {
       tfel::raise(
           "Evaluator::analyse: "
@@ -1300,6 +1326,7 @@ namespace tfel::math {
     if (src.expr != nullptr) {
       this->expr = src.expr->clone(this->variables);
     }
+    this->compile();
   }  // end of Evaluator
 
   Evaluator& Evaluator::operator=(const Evaluator& src) {
@@ -1312,6 +1339,7 @@ namespace tfel::math {
       } else {
         this->expr.reset();
       }
+      this->compile();
     }
     return *this;
   }  // end of Evaluator
@@ -1343,15 +1371,25 @@ namespace tfel::math {
     str.precision(15);
     str << v;
     this->expr = std::make_shared<parser::Number>(str.str(), v);
+    this->compile();
   }  // end of Evaluator
 
   void Evaluator::clear() {
     this->variables.clear();
     this->positions.clear();
     this->expr.reset();
+    this->program.clear();
     this->manager.reset();
   }
 
+  void Evaluator::compile() {
+    if (this->expr == nullptr) {
+      this->program.clear();
+      return;
+    }
+    this->program.compile(*(this->expr));
+  }  // end of compile
+
   void Evaluator::setFunction(const std::string& f) {
     this->clear();
     this->analyse(f, false);
@@ -1435,6 +1473,7 @@ namespace tfel::math {
       }
       pev->expr = this->expr->differentiate(pos, pev->variables);
     }
+    pev->compile();
     return pev;
   }  // end of differentiate
 
@@ -1448,12 +1487,14 @@ namespace tfel::math {
     this->checkCyclicDependency();
     auto f = std::make_shared<Evaluator>(*this);
     f->expr = f->expr->resolveDependencies(f->variables);
+    f->compile();
     return f;
   }  // end of resolveDependencies() const
 
   void Evaluator::removeDependencies() {
     this->checkCyclicDependency();
     this->expr = this->expr->resolveDependencies(this->variables);
+    this->compile();
   }  // end of removeDependencies() const
 
   std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
@@ -1523,6 +1564,7 @@ namespace tfel::math {
     pev->manager = this->manager;
     pev->expr = this->expr->createFunctionByChangingParametersIntoVariables(
         pev->variables, params, pev->positions);
+    pev->compile();
     return pev;
   }  // end of createFunctionByChangingParametersIntoVariables
 
@@ -0,0 +1,487 @@
+/*!
+ * \file   src/Math/ExprProgram.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <bit>
+#include <cmath>
+#include <array>
+#include <cerrno>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/LogicalExpr.hxx"
+#include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/BinaryFunction.hxx"
+#include "TFEL/Math/Parser/BinaryOperator.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
+
+namespace tfel::math::parser {
+
+  //! \return if the given value shall be interpreted as true
+  static bool isTrue(const double v) {
+    return tfel::math::ieee754::fpclassify(v) != FP_ZERO;
+  }  // end of isTrue
+
+  //! \return if the given operation uses its second argument
+  static bool usesSecondArgument(const ExprProgram::OpCode op) {
+    using OpCode = ExprProgram::OpCode;
+    return (op == OpCode::ADD) || (op == OpCode::SUB) ||
+           (op == OpCode::MUL) || (op == OpCode::DIV) ||
+           (op == OpCode::POW) || (op == OpCode::CALL2) ||
+           (op == OpCode::COMPARE) || (op == OpCode::AND) ||
+           (op == OpCode::OR);
+  }  // end of usesSecondArgument
+
+  /*!
+   * \return if the given operation can be evaluated at compile-time when
+   * its arguments are constant
+   */
+  static bool isFoldable(const ExprProgram::OpCode op) {
+    using OpCode = ExprProgram::OpCode;
+    return (op != OpCode::LOAD) && (op != OpCode::JUMP) &&
+           (op != OpCode::JUMPIFNOT) && (op != OpCode::EVALUATE) &&
+           (op != OpCode::EVALUATELOGICAL);
+  }  // end of isFoldable
+
+  //! \return if two instructions compute the same value
+  static bool areEquivalent(const ExprProgram::Instruction& i1,
+                            const ExprProgram::Instruction& i2) {
+    return (i1.op == i2.op) && (i1.a == i2.a) &&
+           ((!usesSecondArgument(i1.op)) || (i1.b == i2.b)) &&
+           (i1.f1 == i2.f1) && (i1.f2 == i2.f2) && (i1.c == i2.c) &&
+           (i1.e == i2.e) && (i1.l == i2.l) && (i1.n == i2.n);
+  }  // end of areEquivalent
+
+  /*!
+   * \brief evaluate an instruction which is neither a branch nor a load
+   * \param[in] i: instruction
+   * \param[in] a: value of the first argument
+   * \param[in] b: value of the second argument
+   */
+  static double apply(const ExprProgram::Instruction& i,
+                      const double a,
+                      const double b) {
+    using OpCode = ExprProgram::OpCode;
+    switch (i.op) {
+      case OpCode::COPY:
+        return a;
+      case OpCode::NEG:
+        return -a;
+      case OpCode::ADD:
+        return a + b;
+      case OpCode::SUB:
+        return a - b;
+      case OpCode::MUL:
+        return a * b;
+      case OpCode::DIV:
+        if (std::abs(b) < std::numeric_limits<double>::min()) {
+          // reports the error
+          return OpDiv::apply(a, b);
+        }
+        return a / b;
+      case OpCode::POW:
+        return std::pow(a, b);
+      case OpCode::CALL1: {
+        const auto old = errno;
+        errno = 0;
+        const auto v = i.f1(a);
+        if (errno != 0) {
+          const auto e = errno;
+          errno = old;
+          FunctionBase::throwInvalidCallException(a, e);
+        }
+        errno = old;
+        return v;
+      }
+      case OpCode::CALL2: {
+        const auto old = errno;
+        errno = 0;
+        const auto v = i.f2(a, b);
+        if (errno != 0) {
+          const auto e = errno;
+          errno = old;
+          StandardBinaryFunctionBase::throwInvalidCallException(e);
+        }
+        errno = old;
+        return v;
+      }
+      case OpCode::IPOW:
+        if ((i.n != 0) && (tfel::math::ieee754::fpclassify(a) == FP_ZERO)) {
+          FunctionBase::throwInvalidCallException(a, EINVAL);
+        }
+        return i.f1(a);
+      case OpCode::GPOW: {
+        const auto old = errno;
+        errno = 0;
+        const auto v = std::pow(a, i.n);
+        if (errno != 0) {
+          const auto e = errno;
+          errno = old;
+          FunctionBase::throwInvalidCallException(a, e);
+        }
+        errno = old;
+        return v;
+      }
+      case OpCode::COMPARE:
+        return i.c(a, b) ? 1 : 0;
+      case OpCode::AND:
+        return (isTrue(a) && isTrue(b)) ? 1 : 0;
+      case OpCode::OR:
+        return (isTrue(a) || isTrue(b)) ? 1 : 0;
+      case OpCode::NOT:
+        return isTrue(a) ? 0 : 1;
+      case OpCode::EVALUATE:
+        return i.e->getValue();
+      case OpCode::EVALUATELOGICAL:
+        return i.l->getValue() ? 1 : 0;
+      default:
+        break;
+    }
+    tfel::raise("ExprProgram::apply: unsupported instruction");
+  }  // end of apply
+
+  ExprProgram::ExprProgram() = default;
+  ExprProgram::ExprProgram(ExprProgram&&) = default;
+  ExprProgram::ExprProgram(const ExprProgram&) = default;
+  ExprProgram& ExprProgram::operator=(ExprProgram&&) = default;
+  ExprProgram& ExprProgram::operator=(const ExprProgram&) = default;
+
+  void ExprProgram::compile(const Expr& e) {
+    this->clear();
+    this->result = e.compile(*this);
+    this->compiled = true;
+    this->reusable.clear();
+  }  // end of compile
+
+  void ExprProgram::clear() {
+    this->code.clear();
+    this->registers.clear();
+    this->constants.clear();
+    this->reusable.clear();
+    this->result = 0;
+    this->compiled = false;
+  }  // end of clear
+
+  bool ExprProgram::empty() const {
+    return !this->compiled;
+  }  // end of empty
+
+  ExprProgram::size_type ExprProgram::getNumberOfInstructions() const {
+    return this->code.size();
+  }  // end of getNumberOfInstructions
+
+  ExprProgram::size_type ExprProgram::getNumberOfRegisters() const {
+    return this->registers.size();
+  }  // end of getNumberOfRegisters
+
+  bool ExprProgram::isVectorizable() const {
+    return std::none_of(
+        this->code.begin(), this->code.end(), [](const Instruction& i) {
+          return (i.op == OpCode::JUMP) || (i.op == OpCode::JUMPIFNOT) ||
+                 (i.op == OpCode::EVALUATE) ||
+                 (i.op == OpCode::EVALUATELOGICAL);
+        });
+  }  // end of isVectorizable
+
+  double ExprProgram::getValue(const std::vector<double>& v) const {
+    tfel::raise_if(!this->compiled,
+                   "ExprProgram::getValue: "
+                   "no expression compiled");
+    if (this->code.empty()) {
+      return this->registers[this->result];
+    }
+    constexpr auto nmax = size_type{64};
+    const auto nr = this->registers.size();
+    if (nr <= nmax) {
+      auto r = std::array<double, nmax>{};
+      std::copy(this->registers.begin(), this->registers.end(), r.begin());
+      return this->execute(r.data(), v);
+    }
+    auto r = this->registers;
+    return this->execute(r.data(), v);
+  }  // end of getValue
+
+  double ExprProgram::execute(double* const r,
+                              const std::vector<double>& v) const {
+    const auto ni = this->code.size();
+    auto pc = size_type{};
+    while (pc != ni) {
+      const auto& i = this->code[pc];
+      switch (i.op) {
+        case OpCode::LOAD:
+          r[i.r] = v[i.a];
+          break;
+        case OpCode::ADD:
+          r[i.r] = r[i.a] + r[i.b];
+          break;
+        case OpCode::SUB:
+          r[i.r] = r[i.a] - r[i.b];
+          break;
+        case OpCode::MUL:
+          r[i.r] = r[i.a] * r[i.b];
+          break;
+        case OpCode::JUMP:
+          pc = i.a;
+          continue;
+        case OpCode::JUMPIFNOT:
+          if (!isTrue(r[i.a])) {
+            pc = i.b;
+            continue;
+          }
+          break;
+        default:
+          r[i.r] = apply(i, r[i.a], r[i.b]);
+      }
+      ++pc;
+    }
+    return r[this->result];
+  }  // end of execute
+
+  void ExprProgram::getValues(
+      std::span<double> r, std::span<const std::span<const double>> v) const {
+    tfel::raise_if(!this->compiled,
+                   "ExprProgram::getValues: "
+                   "no expression compiled");
+    tfel::raise_if(!this->isVectorizable(),
+                   "ExprProgram::getValues: "
+                   "the program can't be evaluated on blocks of points");
+    for (const auto& values : v) {
+      tfel::raise_if(values.size() != r.size(),
+                     "ExprProgram::getValues: "
+                     "unmatched number of points");
+    }
+    for (const auto& i : this->code) {
+      tfel::raise_if((i.op == OpCode::LOAD) && (i.a >= v.size()),
+                     "ExprProgram::getValues: "
+                     "invalid number of variables");
+    }
+    if (this->code.empty()) {
+      std::fill(r.begin(), r.end(), this->registers[this->result]);
+      return;
+    }
+    // values of the registers are stored by blocks of points
+    constexpr auto bsize = size_type{64};
+    const auto nr = this->registers.size();
+    auto regs = std::vector<double>(nr * bsize);
+    for (size_type i = 0; i != nr; ++i) {
+      std::fill_n(regs.begin() + i * bsize, bsize, this->registers[i]);
+    }
+    auto reg = [&regs](const size_type i) { return regs.data() + i * bsize; };
+    for (size_type o = 0; o < r.size(); o += bsize) {
+      const auto n = std::min(bsize, r.size() - o);
+      for (const auto& i : this->code) {
+        auto* const out = reg(i.r);
+        if (i.op == OpCode::LOAD) {
+          std::copy_n(v[i.a].data() + o, n, out);
+          continue;
+        }
+        const auto* const a = reg(i.a);
+        const auto* const b = reg(i.b);
+        switch (i.op) {
+          case OpCode::ADD:
+            for (size_type k = 0; k != n; ++k) {
+              out[k] = a[k] + b[k];
+            }
+            break;
+          case OpCode::SUB:
+            for (size_type k = 0; k != n; ++k) {
+              out[k] = a[k] - b[k];
+            }
+            break;
+          case OpCode::MUL:
+            for (size_type k = 0; k != n; ++k) {
+              out[k] = a[k] * b[k];
+            }
+            break;
+          case OpCode::NEG:
+            for (size_type k = 0; k != n; ++k) {
+              out[k] = -a[k];
+            }
+            break;
+          default:
+            for (size_type k = 0; k != n; ++k) {
+              out[k] = apply(i, a[k], b[k]);
+            }
+        }
+      }
+      std::copy_n(reg(this->result), n, r.data() + o);
+    }
+  }  // end of getValues
+
+  ExprProgram::size_type ExprProgram::addRegister() {
+    this->registers.push_back(0);
+    this->constants.push_back(false);
+    return this->registers.size() - 1;
+  }  // end of addRegister
+
+  ExprProgram::size_type ExprProgram::add(Instruction i) {
+    // common sub-expression elimination
+    for (size_type k = 0; k != this->code.size(); ++k) {
+      if ((this->reusable[k]) && (areEquivalent(this->code[k], i))) {
+        return this->code[k].r;
+      }
+    }
+    // constant folding
+    if ((isFoldable(i.op)) && (this->constants[i.a]) &&
+        ((!usesSecondArgument(i.op)) || (this->constants[i.b]))) {
+      try {
+        const auto v = apply(i, this->registers[i.a], this->registers[i.b]);
+        return this->addConstant(v);
+      } catch (...) {
+        // the error will be reported at runtime, if the instruction is
+        // ever executed
+      }
+    }
+    i.r = this->addRegister();
+    this->code.push_back(i);
+    this->reusable.push_back(true);
+    return i.r;
+  }  // end of add
+
+  ExprProgram::size_type ExprProgram::addBranch(const Expr& e) {
+    const auto n = this->code.size();
+    const auto r = e.compile(*this);
+    std::fill(this->reusable.begin() + static_cast<std::ptrdiff_t>(n),
+              this->reusable.end(), false);
+    return r;
+  }  // end of addBranch
+
+  ExprProgram::size_type ExprProgram::addConstant(const double v) {
+    const auto bits = std::bit_cast<std::uint64_t>(v);
+    for (size_type i = 0; i != this->registers.size(); ++i) {
+      if ((this->constants[i]) &&
+          (std::bit_cast<std::uint64_t>(this->registers[i]) == bits)) {
+        return i;
+      }
+    }
+    const auto r = this->addRegister();
+    this->registers[r] = v;
+    this->constants[r] = true;
+    return r;
+  }  // end of addConstant
+
+  ExprProgram::size_type ExprProgram::addVariable(const size_type p) {
+    auto i = Instruction{OpCode::LOAD};
+    i.a = p;
+    return this->add(i);
+  }  // end of addVariable
+
+  ExprProgram::size_type ExprProgram::addOperation(const OpCode op,
+                                                   const size_type a,
+                                                   const size_type b) {
+    tfel::raise_if(
+        (op != OpCode::COPY) && (op != OpCode::NEG) && (op != OpCode::ADD) &&
+            (op != OpCode::SUB) && (op != OpCode::MUL) &&
+            (op != OpCode::DIV) && (op != OpCode::POW) &&
+            (op != OpCode::AND) && (op != OpCode::OR) && (op != OpCode::NOT),
+        "ExprProgram::addOperation: invalid operation");
+    auto i = Instruction{op};
+    i.a = a;
+    i.b = usesSecondArgument(op) ? b : 0;
+    return this->add(i);
+  }  // end of addOperation
+
+  ExprProgram::size_type ExprProgram::addFunctionCall(const UnaryFunctionPtr f,
+                                                      const size_type a) {
+    auto i = Instruction{OpCode::CALL1};
+    i.a = a;
+    i.f1 = f;
+    return this->add(i);
+  }  // end of addFunctionCall
+
+  ExprProgram::size_type ExprProgram::addFunctionCall(
+      const BinaryFunctionPtr f, const size_type a, const size_type b) {
+    auto i = Instruction{OpCode::CALL2};
+    i.a = a;
+    i.b = b;
+    i.f2 = f;
+    return this->add(i);
+  }  // end of addFunctionCall
+
+  ExprProgram::size_type ExprProgram::addIntegerPower(const UnaryFunctionPtr f,
+                                                      const bool b,
+                                                      const size_type a) {
+    auto i = Instruction{OpCode::IPOW};
+    i.a = a;
+    i.f1 = f;
+    i.n = b ? 1 : 0;
+    return this->add(i);
+  }  // end of addIntegerPower
+
+  ExprProgram::size_type ExprProgram::addGeneralPower(const int n,
+                                                      const size_type a) {
+    auto i = Instruction{OpCode::GPOW};
+    i.a = a;
+    i.n = n;
+    return this->add(i);
+  }  // end of addGeneralPower
+
+  ExprProgram::size_type ExprProgram::addComparison(const ComparisonPtr c,
+                                                    const size_type a,
+                                                    const size_type b) {
+    auto i = Instruction{OpCode::COMPARE};
+    i.a = a;
+    i.b = b;
+    i.c = c;
+    return this->add(i);
+  }  // end of addComparison
+
+  ExprProgram::size_type ExprProgram::addConditionalExpression(
+      const LogicalExpr& c, const Expr& a, const Expr& b) {
+    const auto rc = c.compile(*this);
+    if (this->constants[rc]) {
+      return isTrue(this->registers[rc]) ? a.compile(*this)
+                                         : b.compile(*this);
+    }
+    const auto r = this->addRegister();
+    auto branch = [this, r](const Expr& e) {
+      auto copy = Instruction{OpCode::COPY};
+      copy.a = this->addBranch(e);
+      copy.r = r;
+      this->code.push_back(copy);
+      this->reusable.push_back(false);
+    };
+    auto jump = [this](const OpCode op, const size_type target) {
+      auto i = Instruction{op};
+      i.a = target;
+      this->code.push_back(i);
+      this->reusable.push_back(false);
+      return this->code.size() - 1;
+    };
+    const auto j1 = jump(OpCode::JUMPIFNOT, rc);
+    branch(a);
+    const auto j2 = jump(OpCode::JUMP, 0);
+    this->code[j1].b = this->code.size();
+    branch(b);
+    this->code[j2].a = this->code.size();
+    return r;
+  }  // end of addConditionalExpression
+
+  ExprProgram::size_type ExprProgram::addExpression(const Expr& e) {
+    auto i = Instruction{OpCode::EVALUATE};
+    i.e = &e;
+    return this->add(i);
+  }  // end of addExpression
+
+  ExprProgram::size_type ExprProgram::addLogicalExpression(
+      const LogicalExpr& e) {
+    auto i = Instruction{OpCode::EVALUATELOGICAL};
+    i.l = &e;
+    return this->add(i);
+  }  // end of addLogicalExpression
+
+  ExprProgram::~ExprProgram() = default;
+
+}  // end of namespace tfel::math::parser
@@ -12,6 +12,7 @@
  * project under specific licensing conditions.
  */
 
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
@@ -66,9 +67,15 @@ namespace tfel::math::parser {
 
   std::string ExternalFunctionExpr2::getCxxFormula(
       const std::vector<std::string>&) const {
-    tfel::raise(
-        "ExternalFunctionExpr2::getCxxFormula: "
-        "unimplemented feature");
+    // functions without arguments, such as constants, are replaced by
+    // their values
+    tfel::raise_if(!this->args.empty(),
+                   "ExternalFunctionExpr2::getCxxFormula: "
+                   "unimplemented feature");
+    std::ostringstream value;
+    value.precision(std::numeric_limits<double>::max_digits10);
+    value << this->f->getValue();
+    return "(" + value.str() + ")";
   }  // end of getCxxFormula
 
   void ExternalFunctionExpr2::checkCyclicDependency(
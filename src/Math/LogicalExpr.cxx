@@ -15,6 +15,7 @@
 #include <limits>
 #include "TFEL/Math/General/IEEE754.hxx"
 #include "TFEL/Math/Parser/LogicalExpr.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -79,6 +80,10 @@ namespace tfel::math::parser {
     return '(' + a + ")||(" + b + ')';
   }  // end of OpOr::getCxxFormula
 
+  std::vector<double>::size_type LogicalExpr::compile(ExprProgram& p) const {
+    return p.addLogicalExpression(*this);
+  }  // end of compile
+
   LogicalExpr::~LogicalExpr() = default;
 
   NegLogicalExpression::NegLogicalExpression(
@@ -98,6 +103,11 @@ namespace tfel::math::parser {
     return !this->a->getValue();
   }  // end of getValue
 
+  std::vector<double>::size_type NegLogicalExpression::compile(
+      ExprProgram& p) const {
+    return p.addOperation(ExprProgram::OpCode::NOT, this->a->compile(p));
+  }  // end of compile
+
   std::string NegLogicalExpression::getCxxFormula(
       const std::vector<std::string>& m) const {
     return "!(" + this->a->getCxxFormula(m) + ")";
@@ -13,6 +13,7 @@
  */
 
 #include "TFEL/Math/Parser/Negation.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -36,6 +37,10 @@ namespace tfel::math::parser {
     return -(this->expr->getValue());
   }  // end of getValue()
 
+  std::vector<double>::size_type Negation::compile(ExprProgram& p) const {
+    return p.addOperation(ExprProgram::OpCode::NEG, this->expr->compile(p));
+  }  // end of compile
+
   void Negation::checkCyclicDependency(std::vector<std::string>& names) const {
     this->expr->checkCyclicDependency(names);
   }  // end of checkCyclicDependency
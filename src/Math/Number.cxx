@@ -13,6 +13,7 @@
  */
 
 #include "TFEL/Math/Parser/Number.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -39,6 +40,10 @@ namespace tfel::math::parser {
 
   double Number::getValue() const { return this->value; }  // end of getValue
 
+  std::vector<double>::size_type Number::compile(ExprProgram& p) const {
+    return p.addConstant(this->value);
+  }  // end of compile
+
   void Number::getParametersNames(std::set<std::string>&) const {
   }  // end of getParametersNames
 
@@ -13,6 +13,7 @@
 
 #include <cmath>
 #include "TFEL/Math/Parser/PowerFunction.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -35,6 +36,11 @@ namespace tfel::math::parser {
     return res;
   }  // end of getValue
 
+  std::vector<double>::size_type GeneralPowerFunction::compile(
+      ExprProgram& p) const {
+    return p.addGeneralPower(this->n, this->expr->compile(p));
+  }  // end of compile
+
   std::string GeneralPowerFunction::getCxxFormula(
       const std::vector<std::string>& m) const {
     const auto a = this->expr->getCxxFormula(m);
@@ -17,6 +17,7 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/Parser/Number.hxx"
 #include "TFEL/Math/Parser/Variable.hxx"
+#include "TFEL/Math/Parser/ExprProgram.hxx"
 
 namespace tfel::math::parser {
 
@@ -35,6 +36,10 @@ namespace tfel::math::parser {
     return this->v[this->pos];
   }  // end of Variable::getValue
 
+  std::vector<double>::size_type Variable::compile(ExprProgram& p) const {
+    return p.addVariable(this->pos);
+  }  // end of compile
+
   std::string Variable::getCxxFormula(const std::vector<std::string>& m) const {
     tfel::raise_if(this->pos >= m.size(),
                    "Variable::getCxxFormula: "
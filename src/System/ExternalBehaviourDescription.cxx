@@ -42,14 +42,10 @@ namespace tfel::system {
         "unsupported hypothesis");
     this->behaviour = f;
     this->hypothesis = h;
-    if (elm.contains(l, f + "_ElasticMaterialPropertiesEntryPoints")) {
-      this->elastic_material_properties_epts =
-          elm.getUMATElasticMaterialPropertiesEntryPoints(l, f);
-    }
-    if (elm.contains(l, f + "_LinearThermalExpansionCoefficientsEntryPoints")) {
-      this->linear_thermal_expansion_coefficients_epts =
-          elm.getUMATLinearThermalExpansionCoefficientsEntryPoints(l, f);
-    }
+    this->elastic_material_properties_epts =
+        elm.getUMATElasticMaterialPropertiesEntryPoints(l, f);
+    this->linear_thermal_expansion_coefficients_epts =
+        elm.getUMATLinearThermalExpansionCoefficientsEntryPoints(l, f);
     this->btype = elm.getUMATBehaviourType(l, f);
     this->kinematic = elm.getUMATBehaviourKinematic(l, f);
     this->stype = elm.getUMATSymmetryType(l, f);
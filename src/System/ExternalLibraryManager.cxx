@@ -28,6 +28,7 @@
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/System/getFunction.h"
+#include "TFEL/System/MetadataTable.h"
 #include "TFEL/System/LibraryInformation.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
 
@@ -68,6 +69,57 @@ namespace tfel::system {
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   }  // end of  getErrorMessage
 
+  /*!
+   * \brief version of the metadata tables generated by `MFront` which is
+   * supported
+   */
+  static constexpr unsigned int metadataTableVersion =
+      MFRONT_METADATA_TABLE_VERSION;
+
+  /*!
+   * \return the address of a symbol, as returned by the dynamic loader
+   * \param[in] lib: library
+   * \param[in] s: symbol
+   */
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+  static const void* getSymbolAddressFromLibrary(HINSTANCE__* const lib,
+                                                 const std::string& s) {
+    return reinterpret_cast<const void*>(::GetProcAddress(lib, s.c_str()));
+  }  // end of getSymbolAddressFromLibrary
+#else
+  static const void* getSymbolAddressFromLibrary(void* const lib,
+                                                 const std::string& s) {
+    return ::dlsym(lib, s.c_str());
+  }  // end of getSymbolAddressFromLibrary
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+
+  //! \return the value of an unsigned short symbol or -1 if undefined
+  static int readUnsignedShort(const void* const p) {
+    if (p == nullptr) {
+      return -1;
+    }
+    return static_cast<int>(*(static_cast<const unsigned short*>(p)));
+  }  // end of readUnsignedShort
+
+  //! \return the value of a symbol of the given type, if defined
+  template <typename T>
+  static T readValue(const void* const p) {
+    if (p == nullptr) {
+      return T{0};
+    }
+    return *(static_cast<const T*>(p));
+  }  // end of readValue
+
+  //! \return an array of strings, or a null pointer if undefined
+  static const char* const* readArrayOfStrings(const void* const p) {
+    return static_cast<const char* const*>(p);
+  }  // end of readArrayOfStrings
+
+  //! \return an array of integers, or a null pointer if undefined
+  static const int* readArrayOfInts(const void* const p) {
+    return static_cast<const int*>(p);
+  }  // end of readArrayOfInts
+
   static void ExternalLibraryManagerCheckModellingHypothesisName(
       const std::string& h) {
     tfel::raise_if(!((h == "AxisymmetricalGeneralisedPlaneStrain") ||
@@ -307,8 +359,8 @@ namespace tfel::system {
     auto throw_if = [l, f](const bool c, const std::string& m) {
       raise_if(c, "ExternalLibraryManager::getMaterialKnowledgeType: " + m);
     };
-    const auto lib = this->loadLibrary(l);
-    const int nb = ::tfel_getUnsignedShort(lib, (f + "_mfront_mkt").c_str());
+    const auto nb =
+        readUnsignedShort(this->getSymbolAddress(l, f, f + "_mfront_mkt"));
     throw_if(nb == -1,
              "the material knowledge type could not be read "
              "(" +
@@ -363,24 +415,99 @@ namespace tfel::system {
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   }  // end of ExternalLibraryManager::getStringIfDefined
 
+  std::string ExternalLibraryManager::getStringIfDefined(const std::string& l,
+                                                         const std::string& f,
+                                                         const std::string& s) {
+    const auto p = this->getSymbolAddress(l, f, s);
+    if (p == nullptr) {
+      return "";
+    }
+    return *(static_cast<const char* const*>(p));
+  }  // end of ExternalLibraryManager::getStringIfDefined
+
+  ExternalLibraryManager::EntryPointSymbols&
+  ExternalLibraryManager::getEntryPointSymbols(const std::string& l,
+                                               const std::string& f) {
+    const auto key = std::make_pair(l, f);
+    const auto pe = this->entry_points_symbols.find(key);
+    if (pe != this->entry_points_symbols.end()) {
+      return pe->second;
+    }
+    const auto lib = this->loadLibrary(l);
+    auto& eps = this->entry_points_symbols[key];
+    // returns true if the table has been read
+    auto read_table = [&lib, &eps](const std::string& n) {
+      const auto t = static_cast<const mfront_metadata_table*>(
+          getSymbolAddressFromLibrary(lib, n));
+      if ((t == nullptr) || (t->version != metadataTableVersion)) {
+        return false;
+      }
+      for (unsigned int i = 0; i != t->size; ++i) {
+        eps.addresses.insert({t->entries[i].name, t->entries[i].address});
+      }
+      return true;
+    };
+    if (!read_table(f + "_mfront_metadata")) {
+      // library generated without metadata tables
+      return eps;
+    }
+    read_table(f + "_mfront_hypothesis_metadata");
+    const auto pn = eps.addresses.find(f + "_nModellingHypotheses");
+    const auto ph = eps.addresses.find(f + "_ModellingHypotheses");
+    if ((pn == eps.addresses.end()) || (ph == eps.addresses.end()) ||
+        (pn->second == nullptr) || (ph->second == nullptr)) {
+      return eps;
+    }
+    const auto nh = readUnsignedShort(pn->second);
+    const auto hypotheses = readArrayOfStrings(ph->second);
+    for (int i = 0; i != nh; ++i) {
+      const auto fh = f + '_' + hypotheses[i];
+      if (!read_table(fh + "_mfront_hypothesis_metadata")) {
+        // the symbols specific to a modelling hypothesis are only
+        // generated along with their metadata table
+        eps.undefined_prefixes.push_back(fh + '_');
+      }
+    }
+    return eps;
+  }  // end of getEntryPointSymbols
+
+  const void* ExternalLibraryManager::getSymbolAddress(const std::string& l,
+                                                       const std::string& f,
+                                                       const std::string& s) {
+    auto& eps = this->getEntryPointSymbols(l, f);
+    const auto p = eps.addresses.find(s);
+    if (p != eps.addresses.end()) {
+      return p->second;
+    }
+    for (const auto& prefix : eps.undefined_prefixes) {
+      if (s.compare(0, prefix.size(), prefix) == 0) {
+        eps.addresses.insert({s, nullptr});
+        return nullptr;
+      }
+    }
+    const auto a = getSymbolAddressFromLibrary(this->loadLibrary(l), s);
+    eps.addresses.insert({s, a});
+    return a;
+  }  // end of getSymbolAddress
+
   std::string ExternalLibraryManager::getAuthor(const std::string& l,
                                                 const std::string& s) {
-    return this->getStringIfDefined(l, s + "_author");
+    return this->getStringIfDefined(l, s, s + "_author");
   }  // end of getAuthor
 
   std::string ExternalLibraryManager::getDate(const std::string& l,
                                               const std::string& s) {
-    return this->getStringIfDefined(l, s + "_date");
+    return this->getStringIfDefined(l, s, s + "_date");
   }  // end of getDate
 
   std::string ExternalLibraryManager::getDescription(const std::string& l,
                                                      const std::string& s) {
-    return this->getStringIfDefined(l, s + "_description");
+    return this->getStringIfDefined(l, s, s + "_description");
   }  // end of getDescription
 
   std::string ExternalLibraryManager::getValidator(const std::string& l,
                                                    const std::string& s) {
-    return this->getStringIfDefined(l, s + "_validator");
+    return this->getStringIfDefined(l, s, s + "_validator");
   }  // end of getValidator
 
   std::string ExternalLibraryManager::getBuildId(const std::string& l,
@@ -390,23 +517,17 @@ namespace tfel::system {
 
   std::string ExternalLibraryManager::getBuildIdentifier(const std::string& l,
                                                          const std::string& s) {
-    return this->getStringIfDefined(l, s + "_build_id");
+    return this->getStringIfDefined(l, s, s + "_build_id");
   }  // end of getBuildIdentifier
 
   std::string ExternalLibraryManager::getSource(const std::string& l,
                                                 const std::string& f) {
-    return this->getStringIfDefined(l, f + "_src");
+    return this->getStringIfDefined(l, f, f + "_src");
   }  // end of getSource
 
   std::string ExternalLibraryManager::getInterface(const std::string& l,
                                                    const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    const auto p = (const char* const*)::GetProcAddress(
-        lib, (f + "_mfront_interface").c_str());
-#else
-    const auto p = ::dlsym(lib, (f + "_mfront_interface").c_str());
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    const auto p = this->getSymbolAddress(l, f, f + "_mfront_interface");
     raise_if(p == nullptr,
              "ExternalLibraryManager::getInterface: "
              "no interface found for entry point '" +
@@ -414,11 +535,7 @@ namespace tfel::system {
                  "' "
                  "in library '" +
                  l + "'");
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    return *p;
-#else
     return *(static_cast<const char* const*>(p));
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   }  // end of getInterface
 
   std::string ExternalLibraryManager::getLaw(const std::string& l,
@@ -428,33 +545,32 @@ namespace tfel::system {
 
   std::string ExternalLibraryManager::getMaterial(const std::string& l,
                                                   const std::string& f) {
-    return this->getStringIfDefined(l, f + "_mfront_material");
+    return this->getStringIfDefined(l, f, f + "_mfront_material");
   }  // end of getMaterial
 
   std::string ExternalLibraryManager::getTFELVersion(const std::string& l,
                                                      const std::string& f) {
-    return this->getStringIfDefined(l, f + "_tfel_version");
+    return this->getStringIfDefined(l, f, f + "_tfel_version");
   }  // end of getTFELVersion
 
   std::string ExternalLibraryManager::getUnitSystem(const std::string& l,
                                                     const std::string& f) {
-    return this->getStringIfDefined(l, f + "_unit_system");
+    return this->getStringIfDefined(l, f, f + "_unit_system");
   }  // end of getUnitSystem
 
   std::vector<std::string>
   ExternalLibraryManager::getSupportedModellingHypotheses(
       const std::string& l, const std::string& f) {
     std::vector<std::string> h;
-    const auto lib = this->loadLibrary(l);
-    const auto nb =
-        ::tfel_getUnsignedShort(lib, (f + "_nModellingHypotheses").c_str());
-    char** res;
+    const auto nb = readUnsignedShort(
+        this->getSymbolAddress(l, f, f + "_nModellingHypotheses"));
     raise_if(nb == -1,
              "ExternalLibraryManager::"
              "getSupportedModellingHypotheses: "
              "number of modelling hypotheses could not be read (" +
                  getErrorMessage() + ")");
-    res = ::tfel_getArrayOfStrings(lib, (f + "_ModellingHypotheses").c_str());
+    const auto res = readArrayOfStrings(
+        this->getSymbolAddress(l, f, f + "_ModellingHypotheses"));
     raise_if(res == nullptr,
              "ExternalLibraryManager::"
              "getSupportedModellingHypotheses: "
@@ -618,18 +734,17 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& p) {
-    const auto lib = this->loadLibrary(l);
     const auto pn = decomposeVariableName(p);
     const auto n1 = f + "_" + h + "_" + pn + "_ParameterDefaultValue";
-    if (this->contains(l, n1)) {
-      return tfel_getDouble(lib, n1.c_str());
+    if (const auto a = this->getSymbolAddress(l, f, n1); a != nullptr) {
+      return readValue<double>(a);
     }
     const auto n2 = f + "_" + pn + "_ParameterDefaultValue";
-    raise_if(!this->contains(l, n2),
+    raise_if(this->getSymbolAddress(l, f, n2) == nullptr,
              "ExternalLibraryManager::getRealParameterDefaultValue: "
              "can't get default value for parameter '" +
                  p + "'");
-    return tfel_getDouble(lib, n2.c_str());
+    return readValue<double>(this->getSymbolAddress(l, f, n2));
   }  // end of getRealParameterDefaultValue
 
   int ExternalLibraryManager::getIntegerParameterDefaultValue(
@@ -637,18 +752,17 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& p) {
-    const auto lib = this->loadLibrary(l);
     const auto pn = decomposeVariableName(p);
     const auto n1 = f + "_" + h + "_" + pn + "_ParameterDefaultValue";
-    if (this->contains(l, n1)) {
-      return tfel_getInteger(lib, n1.c_str());
+    if (const auto a = this->getSymbolAddress(l, f, n1); a != nullptr) {
+      return readValue<int>(a);
     }
     const auto n2 = f + "_" + pn + "_ParameterDefaultValue";
-    raise_if(!this->contains(l, n2),
+    raise_if(this->getSymbolAddress(l, f, n2) == nullptr,
              "ExternalLibraryManager::getIntegerParameterDefaultValue: "
              "can't get default value for parameter '" +
                  p + "'");
-    return tfel_getInteger(lib, n2.c_str());
+    return readValue<int>(this->getSymbolAddress(l, f, n2));
   }  // end of getIntegerParameterDefaultValue
 
   unsigned short ExternalLibraryManager::getUnsignedShortParameterDefaultValue(
@@ -656,13 +770,12 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& p) {
-    const auto lib = this->loadLibrary(l);
     const auto pn = decomposeVariableName(p);
     const auto n1 = f + "_" + h + "_" + pn + "_ParameterDefaultValue";
-    auto res = ::tfel_getUnsignedShort(lib, n1.c_str());
+    auto res = readUnsignedShort(this->getSymbolAddress(l, f, n1));
     if (res < 0) {
-      res = ::tfel_getUnsignedShort(
-          lib, (f + "_" + pn + "_ParameterDefaultValue").c_str());
+      res = readUnsignedShort(this->getSymbolAddress(
+          l, f, f + "_" + pn + "_ParameterDefaultValue"));
       raise_if(res < 0,
                "ExternalLibraryManager::"
                "getUnsignedShortParameterDefaultValue: "
@@ -681,8 +794,10 @@ namespace tfel::system {
     const auto n2 = f + "_" + h + "_" + vn + "_UpperBound";
     const auto n3 = f + "_" + vn + "_LowerBound";
     const auto n4 = f + "_" + vn + "_UpperBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)) ||
-            (this->contains(l, n3)) || (this->contains(l, n4)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr) ||
+           (this->getSymbolAddress(l, f, n3) != nullptr) ||
+           (this->getSymbolAddress(l, f, n4) != nullptr);
   }  // end of hasBounds
 
   bool ExternalLibraryManager::hasLowerBound(const std::string& l,
@@ -692,7 +807,8 @@ namespace tfel::system {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_LowerBound";
     const auto n2 = f + "_" + vn + "_LowerBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr);
   }  // end of hasLowerBound
 
   bool ExternalLibraryManager::hasUpperBound(const std::string& l,
@@ -702,43 +818,42 @@ namespace tfel::system {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_UpperBound";
     const auto n2 = f + "_" + vn + "_UpperBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr);
   }  // end of hasUpperBound
 
   long double ExternalLibraryManager::getLowerBound(const std::string& l,
                                                     const std::string& f,
                                                     const std::string& h,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_LowerBound";
-    if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+    if (const auto a = this->getSymbolAddress(l, f, n1); a != nullptr) {
+      return readValue<long double>(a);
     }
     const auto n2 = f + "_" + vn + "_LowerBound";
-    raise_if(!this->contains(l, n2),
+    raise_if(this->getSymbolAddress(l, f, n2) == nullptr,
              "ExternalLibraryManager::getLowerBound: "
              "no lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n2));
   }  // end of getLowerBound
 
   long double ExternalLibraryManager::getUpperBound(const std::string& l,
                                                     const std::string& f,
                                                     const std::string& h,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_UpperBound";
-    if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+    if (const auto a = this->getSymbolAddress(l, f, n1); a != nullptr) {
+      return readValue<long double>(a);
     }
     const auto n2 = f + "_" + vn + "_UpperBound";
-    raise_if(!this->contains(l, n2),
+    raise_if(this->getSymbolAddress(l, f, n2) == nullptr,
              "ExternalLibraryManager::getUpperBound: "
              "no upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n2));
   }  // end of getUpperBound
 
   bool ExternalLibraryManager::hasPhysicalBounds(const std::string& l,
@@ -750,8 +865,10 @@ namespace tfel::system {
     const auto n2 = f + "_" + h + "_" + vn + "_UpperPhysicalBound";
     const auto n3 = f + "_" + vn + "_LowerPhysicalBound";
     const auto n4 = f + "_" + vn + "_UpperPhysicalBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)) ||
-            (this->contains(l, n3)) || (this->contains(l, n4)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr) ||
+           (this->getSymbolAddress(l, f, n3) != nullptr) ||
+           (this->getSymbolAddress(l, f, n4) != nullptr);
   }  // end of hasPhysicalBounds
 
   bool ExternalLibraryManager::hasLowerPhysicalBound(const std::string& l,
@@ -761,7 +878,8 @@ namespace tfel::system {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_LowerPhysicalBound";
     const auto n2 = f + "_" + vn + "_LowerPhysicalBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr);
   }  // end of hasLowerPhysicalBound
 
   bool ExternalLibraryManager::hasUpperPhysicalBound(const std::string& l,
@@ -771,7 +889,8 @@ namespace tfel::system {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_UpperPhysicalBound";
     const auto n2 = f + "_" + vn + "_UpperPhysicalBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr);
   }  // end of hasUpperPhysicalBound
 
   long double ExternalLibraryManager::getLowerPhysicalBound(
@@ -779,18 +898,17 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_LowerPhysicalBound";
-    if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+    if (const auto a = this->getSymbolAddress(l, f, n1); a != nullptr) {
+      return readValue<long double>(a);
     }
     const auto n2 = f + "_" + vn + "_LowerPhysicalBound";
-    raise_if(!this->contains(l, n2),
+    raise_if(this->getSymbolAddress(l, f, n2) == nullptr,
              "ExternalLibraryManager::getLowerPhysicalBound: "
              "no physical lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n2));
   }  // end of getLowerPhysicalBound
 
   long double ExternalLibraryManager::getUpperPhysicalBound(
@@ -798,18 +916,17 @@ namespace tfel::system {
       const std::string& f,
       const std::string& h,
       const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + h + "_" + vn + "_UpperPhysicalBound";
-    if (this->contains(l, n1)) {
-      return tfel_getLongDouble(lib, n1.c_str());
+    if (const auto a = this->getSymbolAddress(l, f, n1); a != nullptr) {
+      return readValue<long double>(a);
     }
     const auto n2 = f + "_" + vn + "_UpperPhysicalBound";
-    raise_if(!this->contains(l, n2),
+    raise_if(this->getSymbolAddress(l, f, n2) == nullptr,
              "ExternalLibraryManager::getUpperPhysicalBound: "
              "no physical upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n2.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n2));
   }  // end of getUpperPhysicalBound
 
   bool ExternalLibraryManager::hasBounds(const std::string& l,
@@ -818,7 +935,8 @@ namespace tfel::system {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerBound";
     const auto n2 = f + "_" + vn + "_UpperBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr);
   }  // end of hasBounds
 
   bool ExternalLibraryManager::hasLowerBound(const std::string& l,
@@ -826,7 +944,7 @@ namespace tfel::system {
                                              const std::string& n) {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerBound";
-    return ((this->contains(l, n1)));
+    return this->getSymbolAddress(l, f, n1) != nullptr;
   }  // end of hasLowerBound
 
   bool ExternalLibraryManager::hasUpperBound(const std::string& l,
@@ -834,33 +952,31 @@ namespace tfel::system {
                                              const std::string& n) {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_UpperBound";
-    return ((this->contains(l, n1)));
+    return this->getSymbolAddress(l, f, n1) != nullptr;
   }  // end of hasUpperBound
 
   long double ExternalLibraryManager::getLowerBound(const std::string& l,
                                                     const std::string& f,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerBound";
-    raise_if(!this->contains(l, n1),
+    raise_if(this->getSymbolAddress(l, f, n1) == nullptr,
              "ExternalLibraryManager::getLowerBound: "
              "no lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n1));
   }  // end of getLowerBound
 
   long double ExternalLibraryManager::getUpperBound(const std::string& l,
                                                     const std::string& f,
                                                     const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_UpperBound";
-    raise_if(!this->contains(l, n1),
+    raise_if(this->getSymbolAddress(l, f, n1) == nullptr,
              "ExternalLibraryManager::getUpperBound: "
              "no upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n1));
   }  // end of getUpperBound
 
   bool ExternalLibraryManager::hasPhysicalBounds(const std::string& l,
@@ -869,7 +985,8 @@ namespace tfel::system {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerPhysicalBound";
     const auto n2 = f + "_" + vn + "_UpperPhysicalBound";
-    return ((this->contains(l, n1)) || (this->contains(l, n2)));
+    return (this->getSymbolAddress(l, f, n1) != nullptr) ||
+           (this->getSymbolAddress(l, f, n2) != nullptr);
   }  // end of hasPhysicalBounds
 
   bool ExternalLibraryManager::hasLowerPhysicalBound(const std::string& l,
@@ -877,7 +994,7 @@ namespace tfel::system {
                                                      const std::string& n) {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerPhysicalBound";
-    return ((this->contains(l, n1)));
+    return this->getSymbolAddress(l, f, n1) != nullptr;
   }  // end of hasLowerPhysicalBound
 
   bool ExternalLibraryManager::hasUpperPhysicalBound(const std::string& l,
@@ -885,31 +1002,29 @@ namespace tfel::system {
                                                      const std::string& n) {
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_UpperPhysicalBound";
-    return ((this->contains(l, n1)));
+    return this->getSymbolAddress(l, f, n1) != nullptr;
   }  // end of hasUpperPhysicalBound
 
   long double ExternalLibraryManager::getLowerPhysicalBound(
       const std::string& l, const std::string& f, const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_LowerPhysicalBound";
-    raise_if(!this->contains(l, n1),
+    raise_if(this->getSymbolAddress(l, f, n1) == nullptr,
              "ExternalLibraryManager::getLowerPhysicalBound: "
              "no physical lower bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n1));
   }  // end of getLowerPhysicalBound
 
   long double ExternalLibraryManager::getUpperPhysicalBound(
       const std::string& l, const std::string& f, const std::string& n) {
-    const auto lib = this->loadLibrary(l);
     const auto vn = decomposeVariableName(n);
     const auto n1 = f + "_" + vn + "_UpperPhysicalBound";
-    raise_if(!this->contains(l, n1),
+    raise_if(this->getSymbolAddress(l, f, n1) == nullptr,
              "ExternalLibraryManager::getUpperPhysicalBound: "
              "no physical upper bound associated to variable '" +
                  vn + "'");
-    return tfel_getLongDouble(lib, n1.c_str());
+    return readValue<long double>(this->getSymbolAddress(l, f, n1));
   }  // end of getUpperPhysicalBound
 
   unsigned short ExternalLibraryManager::getCastemFunctionNumberOfVariables(
@@ -920,11 +1035,11 @@ namespace tfel::system {
   bool ExternalLibraryManager::getUMATRequiresStiffnessTensor(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    int res;
-    const auto lib = this->loadLibrary(l);
-    res = ::tfel_getUMATRequiresStiffnessTensor(lib, (f + "_" + h).c_str());
+    auto res = readUnsignedShort(
+        this->getSymbolAddress(l, f, f + "_" + h + "_requiresStiffnessTensor"));
     if (res < 0) {
-      res = ::tfel_getUMATRequiresStiffnessTensor(lib, f.c_str());
+      res = readUnsignedShort(
+          this->getSymbolAddress(l, f, f + "_requiresStiffnessTensor"));
     }
     raise_if(res < 0,
              "ExternalLibraryManager::getUMATRequiresStiffnessTensor: "
@@ -942,12 +1057,11 @@ namespace tfel::system {
   bool ExternalLibraryManager::getUMATRequiresThermalExpansionCoefficientTensor(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    auto lib = this->loadLibrary(l);
-    auto res = ::tfel_getUMATRequiresThermalExpansionCoefficientTensor(
-        lib, (f + "_" + h).c_str());
+    const auto n = std::string("_requiresThermalExpansionCoefficientTensor");
+    auto res =
+        readUnsignedShort(this->getSymbolAddress(l, f, f + "_" + h + n));
     if (res < 0) {
-      res = ::tfel_getUMATRequiresThermalExpansionCoefficientTensor(lib,
-                                                                    f.c_str());
+      res = readUnsignedShort(this->getSymbolAddress(l, f, f + n));
     }
     raise_if(res < 0,
              "ExternalLibraryManager::"
@@ -1070,6 +1184,20 @@ namespace tfel::system {
     return fct;
   }
 
+  GenericMaterialPropertyArrayPtr
+  ExternalLibraryManager::getGenericMaterialPropertyArrayFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericMaterialPropertyArrayFunction(
+        lib, (f + "_array").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::getGenericMaterialPropertyArrayFunction: "
+             "could not load the array function of the generic material "
+             "property '" +
+                 f + "' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericMaterialPropertyArrayFunction
+
   GenericBehaviourFctPtr ExternalLibraryManager::getGenericBehaviourFunction(
       const std::string& l, const std::string& f) {
     const auto lib = this->loadLibrary(l);
@@ -1081,6 +1209,47 @@ namespace tfel::system {
     return fct;
   }
 
+  GenericBehaviourBatchFctPtr
+  ExternalLibraryManager::getGenericBehaviourBatchFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourBatchFunction(
+        lib, (f + "_integrateBatch").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::getGenericBehaviourBatchFunction: "
+             "could not load generic behaviour function '" +
+                 f + "_integrateBatch' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourBatchFunction
+
+  GenericBehaviourWithParametersFctPtr
+  ExternalLibraryManager::getGenericBehaviourWithParametersFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourWithParametersFunction(
+        lib, (f + "_integrateWithParameters").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourWithParametersFunction: "
+             "could not load generic behaviour function '" +
+                 f + "_integrateWithParameters' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourWithParametersFunction
+
+  GenericBehaviourGetParametersFctPtr
+  ExternalLibraryManager::getGenericBehaviourGetParametersFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourGetParametersFunction(
+        lib, (f + "_getParameters").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourGetParametersFunction: "
+             "could not load generic behaviour function '" +
+                 f + "_getParameters' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourGetParametersFunction
+
   std::vector<std::string>
   ExternalLibraryManager::getGenericBehaviourInitializeFunctions(
       const std::string& l, const std::string& f, const std::string& h) {
@@ -1289,11 +1458,11 @@ namespace tfel::system {
   bool ExternalLibraryManager::isUMATBehaviourAbleToComputeInternalEnergy(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    auto b =
-        ::tfel_getBool(lib, (f + "_" + h + "_ComputesInternalEnergy").c_str());
+    auto b = readUnsignedShort(
+        this->getSymbolAddress(l, f, f + "_" + h + "_ComputesInternalEnergy"));
     if (b == -1) {
-      b = ::tfel_getBool(lib, (f + "_ComputesInternalEnergy").c_str());
+      b = readUnsignedShort(
+          this->getSymbolAddress(l, f, f + "_ComputesInternalEnergy"));
     }
     if (b == -1) {
       return false;
@@ -1304,11 +1473,11 @@ namespace tfel::system {
   bool ExternalLibraryManager::isUMATBehaviourAbleToComputeDissipatedEnergy(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    auto b = ::tfel_getBool(
-        lib, (f + "_" + h + "_ComputesDissipatedEnergy").c_str());
+    auto b = readUnsignedShort(this->getSymbolAddress(
+        l, f, f + "_" + h + "_ComputesDissipatedEnergy"));
     if (b == -1) {
-      b = ::tfel_getBool(lib, (f + "_ComputesDissipatedEnergy").c_str());
+      b = readUnsignedShort(
+          this->getSymbolAddress(l, f, f + "_ComputesDissipatedEnergy"));
     }
     if (b == -1) {
       return false;
@@ -1528,15 +1697,15 @@ namespace tfel::system {
 
   std::vector<std::string> ExternalLibraryManager::getArrayOfStrings(
       const std::string& l, const std::string& e, const std::string& n) {
-    const auto lib = this->loadLibrary(l);
-    auto nb = -1;
-    nb = ::tfel_getUnsignedShort(lib, (e + "_n" + n).c_str());
+    const auto nb =
+        readUnsignedShort(this->getSymbolAddress(l, e, e + "_n" + n));
     raise_if(nb == -1,
              "ExternalLibraryManager::getArrayOfStrings: "
              "number of variables names could not be read "
              "(" +
                  getErrorMessage() + ")");
-    const auto res = ::tfel_getArrayOfStrings(lib, (e + '_' + n).c_str());
+    const auto res =
+        readArrayOfStrings(this->getSymbolAddress(l, e, e + '_' + n));
     raise_if(res == nullptr,
              "ExternalLibraryManager::getArrayOfStrings: "
              "variables names could not be read "
@@ -1553,25 +1722,26 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
-    const auto lib = this->loadLibrary(l);
     auto nb = -1;
     if (!h.empty()) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_" + h + "_n" + n).c_str());
+      nb = readUnsignedShort(
+          this->getSymbolAddress(l, f, f + "_" + h + "_n" + n));
     }
     if (nb == -1) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_n" + n).c_str());
+      nb = readUnsignedShort(this->getSymbolAddress(l, f, f + "_n" + n));
     }
     raise_if(nb == -1,
              "ExternalLibraryManager::getUMATNames: "
              "number of variables names could not be read "
              "(" +
                  getErrorMessage() + ")");
-    char** res = nullptr;
+    const char* const* res = nullptr;
     if (!h.empty()) {
-      res = ::tfel_getArrayOfStrings(lib, (f + "_" + h + '_' + n).c_str());
+      res = readArrayOfStrings(
+          this->getSymbolAddress(l, f, f + "_" + h + '_' + n));
     }
     if (res == nullptr) {
-      res = ::tfel_getArrayOfStrings(lib, (f + '_' + n).c_str());
+      res = readArrayOfStrings(this->getSymbolAddress(l, f, f + '_' + n));
     }
     raise_if(res == nullptr,
              "ExternalLibraryManager::getUMATNames: "
@@ -1589,26 +1759,27 @@ namespace tfel::system {
     if (!h.empty()) {
       ExternalLibraryManagerCheckModellingHypothesisName(h);
     }
-    const auto lib = this->loadLibrary(l);
     auto nb = -1;
     if (!h.empty()) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_" + h + "_n" + n).c_str());
+      nb = readUnsignedShort(
+          this->getSymbolAddress(l, f, f + "_" + h + "_n" + n));
     }
     if (nb == -1) {
-      nb = ::tfel_getUnsignedShort(lib, (f + "_n" + n).c_str());
+      nb = readUnsignedShort(this->getSymbolAddress(l, f, f + "_n" + n));
     }
     raise_if(nb == -1,
              "ExternalLibraryManager::getUMATTypes: "
              "number of variables names could not be read "
              "(" +
                  getErrorMessage() + ")");
-    int* res = nullptr;
+    const int* res = nullptr;
     if (!h.empty()) {
-      res =
-          ::tfel_getArrayOfInts(lib, (f + "_" + h + '_' + n + "Types").c_str());
+      res = readArrayOfInts(
+          this->getSymbolAddress(l, f, f + "_" + h + '_' + n + "Types"));
     }
     if (res == nullptr) {
-      res = ::tfel_getArrayOfInts(lib, (f + '_' + n + "Types").c_str());
+      res = readArrayOfInts(
+          this->getSymbolAddress(l, f, f + '_' + n + "Types"));
     }
     raise_if(res == nullptr,
              "ExternalLibraryManager::getUMATTypes: "
@@ -1621,12 +1792,11 @@ namespace tfel::system {
   bool ExternalLibraryManager::isUMATBehaviourUsableInPurelyImplicitResolution(
       const std::string& l, const std::string& f, const std::string& h) {
     ExternalLibraryManagerCheckModellingHypothesisName(h);
-    const auto lib = this->loadLibrary(l);
-    int b = ::tfel_getBool(
-        lib, (f + "_" + h + "_UsableInPurelyImplicitResolution").c_str());
+    auto b = readUnsignedShort(this->getSymbolAddress(
+        l, f, f + "_" + h + "_UsableInPurelyImplicitResolution"));
     if (b == -1) {
-      b = ::tfel_getBool(lib,
-                         (f + "_UsableInPurelyImplicitResolution").c_str());
+      b = readUnsignedShort(this->getSymbolAddress(
+          l, f, f + "_UsableInPurelyImplicitResolution"));
     }
     if (b == -1) {
       return false;
@@ -1638,9 +1808,8 @@ namespace tfel::system {
   bool
   ExternalLibraryManager::checkIfUMATBehaviourUsesGenericPlaneStressAlgorithm(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto b =
-        ::tfel_getBool(lib, (f + "_UsesGenericPlaneStressAlgorithm").c_str());
+    const auto b = readUnsignedShort(
+        this->getSymbolAddress(l, f, f + "_UsesGenericPlaneStressAlgorithm"));
     if (b == -1) {
       return false;
     }
@@ -1650,8 +1819,8 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATBehaviourType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u = ::tfel_getUnsignedShort(lib, (f + "_BehaviourType").c_str());
+    const auto u =
+        readUnsignedShort(this->getSymbolAddress(l, f, f + "_BehaviourType"));
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATBehaviourType: "
              "behaviour type could not be read (" +
@@ -1661,9 +1830,8 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATBehaviourKinematic(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u =
-        ::tfel_getUnsignedShort(lib, (f + "_BehaviourKinematic").c_str());
+    const auto u = readUnsignedShort(
+        this->getSymbolAddress(l, f, f + "_BehaviourKinematic"));
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATBehaviourKinematic: "
              "behaviour type could not be read (" +
@@ -1673,8 +1841,8 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATSymmetryType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u = ::tfel_getUnsignedShort(lib, (f + "_SymmetryType").c_str());
+    const auto u =
+        readUnsignedShort(this->getSymbolAddress(l, f, f + "_SymmetryType"));
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATSymmetryType: "
              "symmetry type could not be read (" +
@@ -1684,9 +1852,8 @@ namespace tfel::system {
 
   unsigned short ExternalLibraryManager::getUMATElasticSymmetryType(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
-    const auto u =
-        ::tfel_getUnsignedShort(lib, (f + "_ElasticSymmetryType").c_str());
+    const auto u = readUnsignedShort(
+        this->getSymbolAddress(l, f, f + "_ElasticSymmetryType"));
     raise_if(u == -1,
              "ExternalLibraryManager::getUMATElasticSymmetryType: "
              "elastic symmetry type could not be read "
@@ -1698,7 +1865,8 @@ namespace tfel::system {
   std::vector<std::string>
   ExternalLibraryManager::getUMATElasticMaterialPropertiesEntryPoints(
       const std::string& l, const std::string& f) {
-    if (!this->contains(l, f + "_ElasticMaterialPropertiesEntryPoints")) {
+    if (this->getSymbolAddress(
+            l, f, f + "_ElasticMaterialPropertiesEntryPoints") == nullptr) {
       return {};
     }
     std::vector<std::string> names;
@@ -1709,8 +1877,9 @@ namespace tfel::system {
   std::vector<std::string>
   ExternalLibraryManager::getUMATLinearThermalExpansionCoefficientsEntryPoints(
       const std::string& l, const std::string& f) {
-    if (!this->contains(l,
-                        f + "_LinearThermalExpansionCoefficientsEntryPoints")) {
+    if (this->getSymbolAddress(
+            l, f, f + "_LinearThermalExpansionCoefficientsEntryPoints") ==
+        nullptr) {
       return {};
     }
     std::vector<std::string> names;
@@ -1802,9 +1971,8 @@ namespace tfel::system {
   bool
   ExternalLibraryManager::hasTemperatureBeenRemovedFromExternalStateVariables(
       const std::string& l, const std::string& f) {
-    const auto lib = this->loadLibrary(l);
     const auto s = f + "_TemperatureRemovedFromExternalStateVariables";
-    const auto u = ::tfel_getUnsignedShort(lib, s.c_str());
+    const auto u = readUnsignedShort(this->getSymbolAddress(l, f, s));
     if (u == -1) {
       tfel::raise(
           "ExternalLibraryManager::"
@@ -1858,6 +2026,17 @@ namespace tfel::system {
     return fct;
   }
 
+  ExternalLibraryManager::GenericFunctionPtr
+  ExternalLibraryManager::getFunctionAddress(const std::string& l,
+                                             const std::string& f) {
+    const auto a = getSymbolAddressFromLibrary(this->loadLibrary(l), f);
+    tfel::raise_if(a == nullptr,
+                   "ExternalLibraryManager::getFunctionAddress: "
+                   "could not load function '" +
+                       f + "' (" + getErrorMessage() + ")");
+    return reinterpret_cast<GenericFunctionPtr>(const_cast<void*>(a));
+  }  // end of getFunctionAddress
+
   CFunction0Ptr ExternalLibraryManager::getCFunction0(const std::string& l,
                                                       const std::string& f) {
     const auto lib = this->loadLibrary(l);
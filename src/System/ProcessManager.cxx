@@ -690,13 +690,7 @@ namespace tfel::system {
     auto pid = this->createProcess(cmd, in, out, e);
     const auto p = this->findProcess(pid);
     assert(p != this->processes.rend());
-    auto cond = p->isRunning;
-    while (cond) {
-      cond = p->isRunning;
-      if (cond) {
-        pause();
-      }
-    }
+    this->waitForTermination(*p);
     if (!p->exitStatus) {
       throw(
           SystemError("ProcessManager::execute : '"
@@ -710,6 +704,46 @@ namespace tfel::system {
     }
   }  // end of ProcessManager::execute
 
+  void ProcessManager::waitForTermination(const Process& p) {
+    // SIGCHLD is blocked while the state of the process is tested.
+    // Otherwise, the signal could be treated between this test and the
+    // call to `pause`, which would then wait forever. `sigsuspend`
+    // atomically unblocks SIGCHLD and waits for a signal.
+    sigset_t nSigSet;
+    sigset_t oSigSet;
+    sigemptyset(&nSigSet);
+    sigaddset(&nSigSet, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &nSigSet, &oSigSet);
+    auto wSigSet = oSigSet;
+    sigdelset(&wSigSet, SIGCHLD);
+    while (p.isRunning) {
+      sigsuspend(&wSigSet);
+    }
+    sigprocmask(SIG_SETMASK, &oSigSet, nullptr);
+  }  // end of ProcessManager::waitForTermination
+
+  void ProcessManager::join(const ProcessId pid) {
+    const auto p = this->findProcess(pid);
+    if (p == this->processes.rend()) {
+      std::ostringstream msg;
+      msg << "ProcessManager::join : process " << pid << " is not registred";
+      raise<SystemError>(msg.str());
+    }
+    this->waitForTermination(*p);
+    if (!p->exitStatus) {
+      std::ostringstream msg;
+      msg << "ProcessManager::join : process " << pid
+          << " exited du to a signal";
+      raise<SystemError>(msg.str());
+    }
+    if (p->exitValue != EXIT_SUCCESS) {
+      std::ostringstream msg;
+      msg << "ProcessManager::join : process " << pid
+          << " exited abnormally with value " << p->exitValue;
+      raise<SystemError>(msg.str());
+    }
+  }  // end of ProcessManager::join
+
   std::vector<ProcessManager::Process>::reverse_iterator
   ProcessManager::findProcess(const ProcessId pid) {
     auto p = this->processes.rbegin();
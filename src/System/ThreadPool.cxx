@@ -11,37 +11,50 @@
  * project under specific licensing conditions.
  */
 
+#include <deque>
 #include <memory>
 #include <stdexcept>
 #include "TFEL/System/ThreadPool.hxx"
 
 namespace tfel::system {
 
+  /*!
+   * \brief task queue associated with a worker.
+   *
+   * The structure is aligned on a cache line to avoid false sharing
+   * between the queues of different workers.
+   */
+  struct alignas(64) ThreadPool::WorkQueue {
+    //! \brief mutex protecting the queue
+    std::mutex m;
+    //! \brief tasks
+    std::deque<Task> tasks;
+    /*!
+     * \brief number of tasks in the queue, which can be read without
+     * locking the mutex to skip empty queues
+     */
+    std::atomic<size_type> size{0};
+  };  // end of ThreadPool::WorkQueue
+
   ThreadPool::ThreadPool(const size_t n) {
-    this->statuses.resize(n, ThreadPool::Status::IDLE);
+    const auto nq = n == 0 ? size_t{1} : n;
+    for (size_t i = 0; i != nq; ++i) {
+      this->queues.push_back(std::make_unique<WorkQueue>());
+    }
     for (size_t i = 0; i < n; ++i) {
       auto f = [this, i] {
         for (;;) {
-          std::function<void()> task;
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            while (!(this->stop || !this->tasks.empty())) {
-              this->c.wait(
-                  lock, [this] { return this->stop || !this->tasks.empty(); });
-            }
-            if (this->stop && this->tasks.empty()) {
-              return;
-            }
-            task = std::move(this->tasks.front());
-            this->tasks.pop();
-            this->statuses[i] = ThreadPool::Status::WORKING;
-            this->c.notify_all();
+          if (this->tryExecuteTask(i)) {
+            continue;
           }
-          task();
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            this->statuses[i] = ThreadPool::Status::IDLE;
-            this->c.notify_all();
+          std::unique_lock<std::mutex> lock(this->m);
+          ++(this->sleeping);
+          this->c.wait(lock, [this] {
+            return this->stop || (this->pending.load() > 0);
+          });
+          --(this->sleeping);
+          if ((this->stop) && (this->pending.load() <= 0)) {
+            return;
           }
         }
       };
@@ -53,17 +66,70 @@ namespace tfel::system {
     return this->workers.size();
   }  // end of ThreadPool::getNumberOfThreads
 
-  void ThreadPool::wait() {
-    std::unique_lock<std::mutex> lock(this->m);
-    while (!this->tasks.empty()) {
-      this->c.wait(lock, [this] { return this->tasks.empty(); });
+  ThreadPool::size_type ThreadPool::getNextQueueIndex() {
+    return this->next_queue.fetch_add(1, std::memory_order_relaxed) %
+           this->queues.size();
+  }  // end of ThreadPool::getNextQueueIndex
+
+  void ThreadPool::push(const Task& t) {
+    ++(this->unfinished);
+    auto& q = *(this->queues[this->getNextQueueIndex()]);
+    {
+      std::lock_guard<std::mutex> lock(q.m);
+      q.tasks.push_back(t);
+      ++(q.size);
     }
-    for (size_t i = 0; i != this->statuses.size(); ++i) {
-      while (this->statuses[i] != Status::IDLE) {
-        this->c.wait(lock,
-                     [this, i] { return this->statuses[i] == Status::IDLE; });
+    ++(this->pending);
+    if (this->sleeping.load() != 0) {
+      {
+        std::lock_guard<std::mutex> lock(this->m);
       }
+      this->c.notify_one();
     }
+  }  // end of ThreadPool::push
+
+  bool ThreadPool::tryExecuteTask(const size_type i) {
+    const auto nq = this->queues.size();
+    auto t = Task{};
+    auto found = false;
+    for (size_type k = 0; (k != nq) && (!found); ++k) {
+      auto& q = *(this->queues[(i + k) % nq]);
+      if (q.size.load(std::memory_order_relaxed) == 0) {
+        continue;
+      }
+      std::lock_guard<std::mutex> lock(q.m);
+      if (q.tasks.empty()) {
+        continue;
+      }
+      if (k == 0) {
+        // the owner of the queue treats the most recent task
+        t = q.tasks.back();
+        q.tasks.pop_back();
+      } else {
+        // other threads steal the oldest task
+        t = q.tasks.front();
+        q.tasks.pop_front();
+      }
+      --(q.size);
+      found = true;
+    }
+    if (!found) {
+      return false;
+    }
+    --(this->pending);
+    t.execute(t.data, t.first, t.last);
+    if (--(this->unfinished) == 0) {
+      {
+        std::lock_guard<std::mutex> lock(this->m);
+      }
+      this->done.notify_all();
+    }
+    return true;
+  }  // end of ThreadPool::tryExecuteTask
+
+  void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(this->m);
+    this->done.wait(lock, [this] { return this->unfinished.load() == 0; });
   }  // end of ThreadPool::wait()
 
   ThreadPool::~ThreadPool() {
@@ -0,0 +1,201 @@
+/*!
+ * \file   src/Utilities/BinaryResultFile.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryResultFile.hxx"
+
+namespace tfel::utilities {
+
+  //! \brief magic string at the beginning of the file
+  static constexpr char binaryResultFileMagic[8] = {'T', 'F', 'E', 'L',
+                                                    'R', 'E', 'S', '\0'};
+  //! \brief version of the format
+  static constexpr std::uint32_t binaryResultFileVersion = 1;
+  //! \brief byte order mark
+  static constexpr std::uint32_t binaryResultFileByteOrderMark = 0x01020304;
+  //! \brief encoding of a column in a block
+  enum BinaryResultFileColumnEncoding : std::uint8_t {
+    //! \brief all the values are stored
+    RAWCOLUMN = 0,
+    //! \brief all the values are equal and stored once
+    CONSTANTCOLUMN = 1
+  };
+
+  template <typename T>
+  static void writeBinaryValue(std::ofstream& f, const T& v) {
+    f.write(reinterpret_cast<const char*>(&v), sizeof(T));
+  }  // end of writeBinaryValue
+
+  BinaryResultFileWriter::BinaryResultFileWriter(
+      const std::string& f,
+      const std::vector<std::string>& l,
+      const size_type n)
+      : file(f, std::ios::binary), ncolumns(l.size()), block_size(n) {
+    raise_if(!this->file,
+             "BinaryResultFileWriter::BinaryResultFileWriter: "
+             "can't open file '" +
+                 f + "'");
+    raise_if(this->block_size == 0,
+             "BinaryResultFileWriter::BinaryResultFileWriter: "
+             "invalid block size");
+    this->file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    this->file.write(binaryResultFileMagic, sizeof(binaryResultFileMagic));
+    writeBinaryValue(this->file, binaryResultFileVersion);
+    writeBinaryValue(this->file, binaryResultFileByteOrderMark);
+    writeBinaryValue(this->file, static_cast<std::uint64_t>(this->ncolumns));
+    for (const auto& legend : l) {
+      writeBinaryValue(this->file, static_cast<std::uint64_t>(legend.size()));
+      this->file.write(legend.data(),
+                       static_cast<std::streamsize>(legend.size()));
+    }
+    this->values.reserve(this->ncolumns * this->block_size);
+  }  // end of BinaryResultFileWriter::BinaryResultFileWriter
+
+  BinaryResultFileWriter::size_type
+  BinaryResultFileWriter::getNumberOfColumns() const noexcept {
+    return this->ncolumns;
+  }  // end of BinaryResultFileWriter::getNumberOfColumns
+
+  void BinaryResultFileWriter::addLine(const std::vector<double>& v) {
+    raise_if(v.size() != this->ncolumns,
+             "BinaryResultFileWriter::addLine: "
+             "invalid number of values (" +
+                 std::to_string(v.size()) + " given, " +
+                 std::to_string(this->ncolumns) + " expected)");
+    this->values.insert(this->values.end(), v.begin(), v.end());
+    if (this->values.size() == this->ncolumns * this->block_size) {
+      this->writeBlock();
+    }
+  }  // end of BinaryResultFileWriter::addLine
+
+  void BinaryResultFileWriter::writeBlock() {
+    if ((this->values.empty()) || (this->ncolumns == 0)) {
+      this->values.clear();
+      return;
+    }
+    const auto nlines = this->values.size() / this->ncolumns;
+    writeBinaryValue(this->file, static_cast<std::uint64_t>(nlines));
+    auto column = std::vector<double>(nlines);
+    for (size_type c = 0; c != this->ncolumns; ++c) {
+      for (size_type l = 0; l != nlines; ++l) {
+        column[l] = this->values[l * this->ncolumns + c];
+      }
+      // values are compared bitwise, so that -0 and NaNs are preserved
+      const auto is_constant =
+          std::all_of(column.begin(), column.end(), [&column](const double x) {
+            return std::memcmp(&x, &column[0], sizeof(double)) == 0;
+          });
+      if (is_constant) {
+        writeBinaryValue(this->file, CONSTANTCOLUMN);
+        writeBinaryValue(this->file, column[0]);
+      } else {
+        writeBinaryValue(this->file, RAWCOLUMN);
+        this->file.write(reinterpret_cast<const char*>(column.data()),
+                         static_cast<std::streamsize>(nlines * sizeof(double)));
+      }
+    }
+    this->values.clear();
+  }  // end of BinaryResultFileWriter::writeBlock
+
+  void BinaryResultFileWriter::flush() {
+    this->writeBlock();
+    this->file.flush();
+  }  // end of BinaryResultFileWriter::flush
+
+  BinaryResultFileWriter::~BinaryResultFileWriter() noexcept {
+    try {
+      this->writeBlock();
+    } catch (...) {
+    }
+  }  // end of BinaryResultFileWriter::~BinaryResultFileWriter
+
+  bool isBinaryResultFile(const std::string_view d) noexcept {
+    return (d.size() >= sizeof(binaryResultFileMagic)) &&
+           (std::memcmp(d.data(), binaryResultFileMagic,
+                        sizeof(binaryResultFileMagic)) == 0);
+  }  // end of isBinaryResultFile
+
+  BinaryResultFileContent readBinaryResultFile(const std::string_view d) {
+    auto pos = std::size_t{};
+    auto read = [&d, &pos](void* const v, const std::size_t s) {
+      raise_if(d.size() - pos < s,
+               "readBinaryResultFile: unexpected end of data");
+      std::memcpy(v, d.data() + pos, s);
+      pos += s;
+    };
+    auto read_size = [&read]() {
+      auto s = std::uint64_t{};
+      read(&s, sizeof(s));
+      raise_if(s > std::numeric_limits<std::size_t>::max(),
+               "readBinaryResultFile: invalid size");
+      return static_cast<std::size_t>(s);
+    };
+    raise_if(!isBinaryResultFile(d),
+             "readBinaryResultFile: invalid header");
+    pos = sizeof(binaryResultFileMagic);
+    auto version = std::uint32_t{};
+    auto bom = std::uint32_t{};
+    read(&version, sizeof(version));
+    read(&bom, sizeof(bom));
+    raise_if(bom != binaryResultFileByteOrderMark,
+             "readBinaryResultFile: the data were written on a machine "
+             "with a different byte order");
+    raise_if(version != binaryResultFileVersion,
+             "readBinaryResultFile: unsupported version '" +
+                 std::to_string(version) + "'");
+    auto r = BinaryResultFileContent{};
+    const auto nc = read_size();
+    r.legends.resize(nc);
+    for (auto& legend : r.legends) {
+      const auto s = read_size();
+      raise_if(d.size() - pos < s,
+               "readBinaryResultFile: unexpected end of data");
+      legend.assign(d.data() + pos, s);
+      pos += s;
+    }
+    while (pos != d.size()) {
+      const auto nl = read_size();
+      raise_if((nl == 0) || (nc == 0), "readBinaryResultFile: invalid block");
+      const auto offset = r.values.size();
+      r.values.resize(offset + nl * nc);
+      for (std::size_t c = 0; c != nc; ++c) {
+        auto e = std::uint8_t{};
+        read(&e, sizeof(e));
+        if (e == CONSTANTCOLUMN) {
+          auto v = double{};
+          read(&v, sizeof(v));
+          for (std::size_t l = 0; l != nl; ++l) {
+            r.values[offset + l * nc + c] = v;
+          }
+        } else {
+          raise_if(e != RAWCOLUMN,
+                   "readBinaryResultFile: invalid column encoding");
+          raise_if((d.size() - pos) / sizeof(double) < nl,
+                   "readBinaryResultFile: unexpected end of data");
+          for (std::size_t l = 0; l != nl; ++l) {
+            std::memcpy(&r.values[offset + l * nc + c],
+                        d.data() + pos + l * sizeof(double), sizeof(double));
+          }
+          pos += nl * sizeof(double);
+        }
+      }
+      r.nlines += nl;
+    }
+    return r;
+  }  // end of readBinaryResultFile
+
+}  // end of namespace tfel::utilities
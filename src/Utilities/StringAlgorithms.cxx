@@ -11,6 +11,8 @@
  * project under specific licensing conditions.
  */
 
+#include <cstdio>
+#include <cstdint>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
@@ -124,6 +126,18 @@ namespace tfel::utilities {
     }
   }
 
+  std::string getStableHash(std::string_view s) {
+    auto h = std::uint64_t{14695981039346656037u};
+    for (const auto c : s) {
+      h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+      h *= std::uint64_t{1099511628211u};
+    }
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx",
+                  static_cast<unsigned long long>(h));
+    return buffer;
+  }  // end of getStableHash
+
   template <>
   double convert<>(const std::string& s) {
     auto throw_if = [&s](const bool b) {
@@ -17,13 +17,66 @@
 #include <fstream>
 #include <algorithm>
 #include <iterator>
+#include <charconv>
+#include <string_view>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryResultFile.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
 namespace tfel::utilities {
 
+  //! \return true if the given character is a white space
+  static bool isSpace(const char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') ||
+           (c == '\f');
+  }  // end of isSpace
+
+  //! \return true if the given character may appear in a number
+  static bool isNumberCharacter(const char c) {
+    return ((c >= '0') && (c <= '9')) || (c == '.') || (c == '-') ||
+           (c == '+') || (c == 'e') || (c == 'E');
+  }  // end of isNumberCharacter
+
+  /*!
+   * \brief try to read a line made of numbers separated by white spaces
+   * \return true on success
+   * \param[out] v: values read
+   * \param[in] l: line
+   */
+  static bool readNumbers(std::vector<double>& v, const std::string_view l) {
+    v.clear();
+    auto p = l.data();
+    const auto pe = p + l.size();
+    while (true) {
+      while ((p != pe) && (isSpace(*p))) {
+        ++p;
+      }
+      if (p == pe) {
+        return true;
+      }
+      auto b = p;
+      while ((p != pe) && (!isSpace(*p))) {
+        if (!isNumberCharacter(*p)) {
+          return false;
+        }
+        ++p;
+      }
+      // std::from_chars does not accept a leading plus sign
+      if ((*b == '+') && (p - b > 1) && (*(b + 1) != '+') &&
+          (*(b + 1) != '-')) {
+        ++b;
+      }
+      auto x = double{};
+      const auto r = std::from_chars(b, p, x);
+      if ((r.ec != std::errc()) || (r.ptr != p)) {
+        return false;
+      }
+      v.push_back(x);
+    }
+  }  // end of readNumbers
+
   TextData::TextData(const std::string& file, const std::string& format) {
     auto get_legends = [](const std::string& l) {
       std::vector<std::string> r;
@@ -40,26 +93,54 @@ namespace tfel::utilities {
       });
       return r;
     };
-    auto add_line = [this](const std::string& l, const Token::size_type n) {
-      Line nl;
-      CxxTokenizer t;
-      t.treatCharAsString(true);
-      t.parseString(l);
-      t.stripComments();
-      std::for_each(t.begin(), t.end(), [&nl, &n](const Token& w) {
-        nl.tokens.push_back(w);
-        nl.tokens.back().line = n;
-      });
-      this->lines.push_back(std::move(nl));
+    auto numbers = std::vector<double>{};
+    this->text_offsets.push_back(0);
+    this->value_offsets.push_back(0);
+    auto add_line = [this, &numbers](const std::string_view l,
+                                     const Token::size_type n) {
+      const auto r = this->line_numbers.size();
+      this->line_numbers.push_back(n);
+      this->text.append(l.data(), l.size());
+      this->text_offsets.push_back(this->text.size());
+      if (readNumbers(numbers, l)) {
+        this->values.insert(this->values.end(), numbers.begin(),
+                            numbers.end());
+      } else {
+        // the values of this line will be converted on demand
+        this->irregular_lines.push_back(r);
+        const auto nv = this->tokenize(r).tokens.size();
+        this->values.resize(this->values.size() + nv, 0);
+      }
+      this->value_offsets.push_back(this->values.size());
     };
+    std::ifstream f{file, std::ios::binary};
+    raise_if(!f, "TextData::TextData: can't open '" + file + '\'');
+    const auto content = std::string(std::istreambuf_iterator<char>(f),
+                                     std::istreambuf_iterator<char>());
+    raise_if(f.bad(), "TextData::TextData: can't read '" + file + '\'');
+    if (isBinaryResultFile(content)) {
+      auto d = readBinaryResultFile(content);
+      const auto nc = d.legends.size();
+      this->legends = std::move(d.legends);
+      this->values = std::move(d.values);
+      for (std::size_t r = 0; r != d.nlines; ++r) {
+        this->line_numbers.push_back(r + 1);
+        this->text_offsets.push_back(0);
+        this->value_offsets.push_back((r + 1) * nc);
+      }
+      return;
+    }
     auto firstLine = true;
     auto firstComments = true;
     auto nbr = size_type{1};
-    std::ifstream f{file};
-    raise_if(!f, "TextData::TextData: can't open '" + file + '\'');
-    while (!f.eof()) {
-      auto line = std::string{};
-      getline(f, line);
+    auto pos = std::string::size_type{};
+    while (pos < content.size()) {
+      auto pos2 = content.find('\n', pos);
+      if (pos2 == std::string::npos) {
+        pos2 = content.size();
+      }
+      const auto line = std::string_view(content).substr(pos, pos2 - pos);
+      pos = pos2 + 1;
       if (line.empty()) {
         continue;
       }
@@ -68,15 +149,15 @@ namespace tfel::utilities {
           continue;
         }
         if (format.empty()) {
-          line.erase(line.begin());
+          const auto comment = std::string(line.substr(1));
           if (firstLine) {
-            this->legends = get_legends(line);
+            this->legends = get_legends(comment);
           }
-          this->preamble.push_back(line);
+          this->preamble.push_back(comment);
         }
       } else {
         if (((format == "gnuplot") || (format == "alcyone")) && (firstLine)) {
-          this->legends = get_legends(line);
+          this->legends = get_legends(std::string(line));
           bool all_numbers = true;
           for (const auto& l : this->legends) {
             try {
@@ -102,6 +183,34 @@ namespace tfel::utilities {
     }
   }  // end of TextData::TextData
 
+  TextData::Line TextData::tokenize(const std::size_t r) const {
+    Line nl;
+    const auto b = this->text_offsets[r];
+    if (b == this->text_offsets[r + 1]) {
+      // lines read from a binary result file have no text
+      const auto n = this->line_numbers[r];
+      char buffer[32];
+      for (auto i = this->value_offsets[r]; i != this->value_offsets[r + 1];
+           ++i) {
+        const auto e = std::to_chars(buffer, buffer + sizeof(buffer),
+                                     this->values[i]);
+        nl.tokens.emplace_back(std::string(buffer, e.ptr), n,
+                               nl.tokens.size(), Token::Number);
+      }
+      return nl;
+    }
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.parseString(this->text.substr(b, this->text_offsets[r + 1] - b));
+    t.stripComments();
+    const auto n = this->line_numbers[r];
+    std::for_each(t.begin(), t.end(), [&nl, &n](const Token& w) {
+      nl.tokens.push_back(w);
+      nl.tokens.back().line = n;
+    });
+    return nl;
+  }  // end of TextData::tokenize
+
   const std::vector<std::string>& TextData::getLegends() const {
     return this->legends;
   }  // end of TextData::getLegends
@@ -138,43 +247,66 @@ namespace tfel::utilities {
     auto throw_if = [](const bool b, const std::string& msg) {
       raise_if(b, "TextData::getColumn: " + msg);
     };
+    const auto nl = this->line_numbers.size();
     tab.clear();
-    tab.reserve(this->lines.size());
+    tab.reserve(nl);
     // sanity check
     throw_if(i == 0u,
              "column '0' requested "
              "(column numbers begins at '1').");
     // treatment
-    for (const auto& l : this->lines) {
-      auto n = l.tokens.empty() ? 0 : l.tokens[0].line;
-      throw_if(l.tokens.size() < i, "line '" + std::to_string(n) +
-                                        "' "
-                                        "does not have '" +
-                                        std::to_string(i) + "' columns.");
-      tab.push_back(convert<double>(l.tokens.at(i - 1u).value));
+    for (std::size_t r = 0; r != nl; ++r) {
+      const auto b = this->value_offsets[r];
+      throw_if(this->value_offsets[r + 1] - b < i,
+               "line '" + std::to_string(this->line_numbers[r]) +
+                   "' "
+                   "does not have '" +
+                   std::to_string(i) + "' columns.");
+      tab.push_back(this->values[b + i - 1u]);
+    }
+    for (const auto r : this->irregular_lines) {
+      const auto l = this->tokenize(r);
+      tab[r] = convert<double>(l.tokens.at(i - 1u).value);
     }
   }  // end of TextData::getColumn
 
   std::vector<TextData::Line>::const_iterator TextData::begin() const {
+    std::call_once(this->lines_flag, [this] {
+      for (std::size_t r = 0; r != this->line_numbers.size(); ++r) {
+        this->lines.push_back(this->tokenize(r));
+      }
+    });
     return this->lines.begin();
   }  // end of TextData::begin()
 
   std::vector<TextData::Line>::const_iterator TextData::end() const {
+    this->begin();
     return this->lines.end();
   }  // end of TextData::end()
 
   void TextData::skipLines(const Token::size_type n) {
-    auto get_line = [](const Line& l) -> Token::size_type {
-      return l.tokens.empty() ? 0 : l.tokens[0].line;
-    };
-    if (this->lines.empty()) {
+    auto p = std::find_if(this->line_numbers.begin(), this->line_numbers.end(),
+                          [n](const size_type l) { return l > n + 1; });
+    const auto k = static_cast<std::size_t>(p - this->line_numbers.begin());
+    if (k == 0) {
       return;
     }
-    auto p = this->lines.begin();
-    while ((get_line(*p) <= n + 1) && (p != this->lines.end())) {
-      ++p;
+    const auto d = static_cast<std::ptrdiff_t>(k);
+    this->line_numbers.erase(this->line_numbers.begin(), p);
+    this->text_offsets.erase(this->text_offsets.begin(),
+                             this->text_offsets.begin() + d);
+    this->value_offsets.erase(this->value_offsets.begin(),
+                              this->value_offsets.begin() + d);
+    auto irregular = std::vector<std::size_t>{};
+    for (const auto r : this->irregular_lines) {
+      if (r >= k) {
+        irregular.push_back(r - k);
+      }
+    }
+    this->irregular_lines.swap(irregular);
+    if (!this->lines.empty()) {
+      this->lines.erase(this->lines.begin(), this->lines.begin() + d);
     }
-    lines.erase(lines.begin(), p);
-  }
+  }  // end of TextData::skipLines
 
 }  // end of namespace tfel::utilities
@@ -0,0 +1,173 @@
+/*!
+ * \file   DualNumberTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/General/DualNumber.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/stensor.hxx"
+
+struct DualNumberTest final : public tfel::tests::TestCase {
+  DualNumberTest()
+      : tfel::tests::TestCase("TFEL/Math", "DualNumberTest") {
+  }  // end of DualNumberTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief arithmetic operations
+  void test1() {
+    using namespace tfel::math;
+    using Dual = DualNumber<double, 2>;
+    constexpr auto eps = 1e-14;
+    const auto x = makeVariable<double, 2>(2, 0);
+    const auto y = makeVariable<double, 2>(3, 1);
+    const auto f = (x * y - x / y + 2 * x) / (1 + y) - (-x);
+    // f = (x*y - x/y + 2*x)/(1+y) + x
+    const auto df_dx = (y.value - 1 / y.value + 2) / (1 + y.value) + 1;
+    const auto df_dy = (x.value + x.value / (y.value * y.value)) /
+                           (1 + y.value) -
+                       (x.value * y.value - x.value / y.value + 2 * x.value) /
+                           ((1 + y.value) * (1 + y.value));
+    TFEL_TESTS_ASSERT(std::abs(f.value - (28 / 3.) / 4 - 2) < eps);
+    TFEL_TESTS_ASSERT(std::abs(f.derivatives[0] - df_dx) < eps);
+    TFEL_TESTS_ASSERT(std::abs(f.derivatives[1] - df_dy) < eps);
+    // comparisons only consider the values
+    TFEL_TESTS_ASSERT(x < y);
+    TFEL_TESTS_ASSERT((x <= Dual(2)) && (x >= Dual(2)));
+    TFEL_TESTS_ASSERT(x > 1.5);
+    TFEL_TESTS_ASSERT(3 >= y);
+    // constants have no derivatives
+    constexpr auto c = Dual(4);
+    TFEL_TESTS_ASSERT(std::abs(getValue(c) - 4) < eps);
+    TFEL_TESTS_ASSERT(std::abs(c.derivatives[0]) < eps);
+    TFEL_TESTS_ASSERT(std::abs(c.derivatives[1]) < eps);
+  }  // end of test1
+  //! \brief mathematical functions
+  void test2() {
+    using namespace tfel::math;
+    constexpr auto eps = 1e-13;
+    const auto v = 0.3;
+    const auto x = makeVariable<double, 1>(v, 0);
+    auto check = [this, eps](const DualNumber<double, 1>& r, const double f,
+                             const double df) {
+      TFEL_TESTS_ASSERT(std::abs(r.value - f) < eps);
+      TFEL_TESTS_ASSERT(std::abs(r.derivatives[0] - df) < eps);
+    };
+    check(sqrt(x), std::sqrt(v), 1 / (2 * std::sqrt(v)));
+    check(cbrt(x), std::cbrt(v), 1 / (3 * std::cbrt(v) * std::cbrt(v)));
+    check(exp(x), std::exp(v), std::exp(v));
+    check(log(x), std::log(v), 1 / v);
+    check(log10(x), std::log10(v), 1 / (v * std::log(10.)));
+    check(sin(x), std::sin(v), std::cos(v));
+    check(cos(x), std::cos(v), -std::sin(v));
+    check(tan(x), std::tan(v), 1 / (std::cos(v) * std::cos(v)));
+    check(asin(x), std::asin(v), 1 / std::sqrt(1 - v * v));
+    check(acos(x), std::acos(v), -1 / std::sqrt(1 - v * v));
+    check(atan(x), std::atan(v), 1 / (1 + v * v));
+    check(sinh(x), std::sinh(v), std::cosh(v));
+    check(cosh(x), std::cosh(v), std::sinh(v));
+    check(tanh(x), std::tanh(v), 1 - std::tanh(v) * std::tanh(v));
+    check(erf(x), std::erf(v), 2 * std::exp(-v * v) / std::sqrt(M_PI));
+    check(abs(-x), v, 1);
+    check(pow(x, 8.2), std::pow(v, 8.2), 8.2 * std::pow(v, 7.2));
+    check(pow(2., x), std::pow(2., v), std::log(2.) * std::pow(2., v));
+    check(pow(x, x), std::pow(v, v), std::pow(v, v) * (std::log(v) + 1));
+    check(power<3>(x), v * v * v, 3 * v * v);
+    check(power<3, 2>(x), std::pow(v, 1.5), 1.5 * std::sqrt(v));
+    check(max(x, 0.5), 0.5, 0);
+    check(max(x, 0.1), v, 1);
+    check(min(x, 0.5), v, 1);
+    check(min(0.1, x), 0.1, 0);
+  }  // end of test2
+  //! \brief operations on tensorial objects
+  void test3() {
+    using namespace tfel::math;
+    using Dual = DualNumber<double, 6>;
+    constexpr auto eps = 1e-12;
+    const auto sv = stensor<3, double>{200, -50, 30, 20, -10, 40};
+    auto s = stensor<3, Dual>{};
+    for (unsigned short i = 0; i != 6; ++i) {
+      s[i] = makeVariable<double, 6>(sv[i], i);
+    }
+    const auto seq = sigmaeq(s);
+    // derivative of the von Mises stress
+    const auto n = eval(3 * deviator(sv) / (2 * sigmaeq(sv)));
+    TFEL_TESTS_ASSERT(std::abs(seq.value - sigmaeq(sv)) < eps * seq.value);
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(seq.derivatives[i] - n[i]) < eps);
+    }
+    // the von Mises stress is not differentiable at zero: a null
+    // sub-gradient is used rather than NaNs.
+    auto z = stensor<3, Dual>{};
+    for (unsigned short i = 0; i != 6; ++i) {
+      z[i] = makeVariable<double, 6>(0, i);
+    }
+    const auto zeq = sigmaeq(z);
+    TFEL_TESTS_ASSERT(std::abs(zeq.value) < eps);
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(zeq.derivatives[i]) < eps);
+    }
+    // conversion from a tensorial object
+    const auto s2 = stensor<3, Dual>(sv);
+    const auto r = eval(s2 + 2 * s);
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i].value - 3 * sv[i]) < eps);
+      for (unsigned short j = 0; j != 6; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(r[i].derivatives[j] - (i == j ? 2 : 0)) <
+                          eps);
+      }
+    }
+  }  // end of test3
+  //! \brief jacobian of a function of a vector
+  void test4() {
+    using namespace tfel::math;
+    using Dual = DualNumber<double, 2>;
+    constexpr auto eps = 1e-14;
+    auto x = tvector<2, Dual>{};
+    x[0] = makeVariable<double, 2>(1.5, 0);
+    x[1] = makeVariable<double, 2>(-0.5, 1);
+    auto f = tvector<2, Dual>{};
+    f[0] = x[0] * x[0] + exp(x[1]);
+    f[1] = x[0] * x[1];
+    TFEL_TESTS_ASSERT(std::abs(f[0].derivatives[0] - 3) < eps);
+    TFEL_TESTS_ASSERT(std::abs(f[0].derivatives[1] - std::exp(-0.5)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(f[1].derivatives[0] + 0.5) < eps);
+    TFEL_TESTS_ASSERT(std::abs(f[1].derivatives[1] - 1.5) < eps);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(DualNumberTest, "DualNumberTest");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("DualNumberTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,200 @@
+/*!
+ * \file   KrigingTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/Kriging.hxx"
+
+//! \return a pseudo-random number in [0:1], independent of rand
+static double next_value(unsigned int& s) {
+  s = 1664525u * s + 1013904223u;
+  return static_cast<double>(s >> 8) / static_cast<double>(1u << 24);
+}  // end of next_value
+
+struct KrigingTest final : public tfel::tests::TestCase {
+  KrigingTest() : tfel::tests::TestCase("TFEL/Math", "KrigingTest") {
+  }  // end of KrigingTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief comparison with a direct resolution of the kriging system
+  void test1() {
+    using namespace tfel::math;
+    using Model = KrigingDefaultModel<1u, double>;
+    auto s = 1u;
+    auto k = Kriging<1u>{};
+    auto xs = std::vector<double>{};
+    auto fs = std::vector<double>{};
+    for (unsigned short i = 0; i != 20; ++i) {
+      xs.push_back(next_value(s));
+      fs.push_back(std::exp(std::cos(xs.back())));
+      k.addValue(xs.back(), fs.back());
+    }
+    k.buildInterpolation();
+    const auto n = xs.size();
+    auto m = matrix<double>(n + 2, n + 2, 0);
+    auto a = vector<double>(n + 2, 0);
+    for (std::size_t i = 0; i != n; ++i) {
+      for (std::size_t j = 0; j != n; ++j) {
+        m(i, j) = k.covariance(xs[i] - xs[j]);
+      }
+      m(i, n) = m(n, i) = Model::drifts[0](xs[i]);
+      m(i, n + 1) = m(n + 1, i) = Model::drifts[1](xs[i]);
+      a[i] = fs[i];
+    }
+    LUSolve::exe(m, a);
+    for (double x = -0.5; x < 1.5; x += 0.05) {
+      auto r = a[n] * Model::drifts[0](x) + a[n + 1] * Model::drifts[1](x);
+      for (std::size_t i = 0; i != n; ++i) {
+        r += a[i] * k.covariance(x - xs[i]);
+      }
+      TFEL_TESTS_ASSERT(std::abs(k(x) - r) < 1e-10);
+    }
+  }  // end of test1
+  //! \brief interpolation and reproduction of the drifts in 2D and 3D
+  void test2() {
+    using namespace tfel::math;
+    auto s = 2u;
+    auto k2 = Kriging<2u>{};
+    auto k3 = Kriging<3u>{};
+    auto p2 = std::vector<tvector<2u, double>>{};
+    auto p3 = std::vector<tvector<3u, double>>{};
+    auto f2 = [](const tvector<2u, double>& p) {
+      return 1 + 2 * p(0) - 3 * p(1);
+    };
+    auto f3 = [](const tvector<3u, double>& p) {
+      return 1 + 2 * p(0) - 3 * p(1) + p(2) / 2;
+    };
+    for (unsigned short i = 0; i != 40; ++i) {
+      const auto x = next_value(s);
+      const auto y = next_value(s);
+      const auto z = next_value(s);
+      p2.push_back(tvector<2u, double>{x, y});
+      p3.push_back(tvector<3u, double>{x, y, z});
+      k2.addValue(p2.back(), f2(p2.back()) + std::sin(5 * x));
+      k3.addValue(p3.back(), f3(p3.back()) + std::sin(5 * x));
+    }
+    k2.buildInterpolation();
+    k3.buildInterpolation();
+    for (std::size_t i = 0; i != p2.size(); ++i) {
+      const auto x = p2[i](0);
+      TFEL_TESTS_ASSERT(std::abs(k2(p2[i]) - f2(p2[i]) - std::sin(5 * x)) <
+                        1e-8);
+      TFEL_TESTS_ASSERT(std::abs(k3(p3[i]) - f3(p3[i]) - std::sin(5 * x)) <
+                        1e-8);
+    }
+    // the kriging of a linear function is exact
+    auto l3 = Kriging<3u>{};
+    for (const auto& p : p3) {
+      l3.addValue(p, f3(p));
+    }
+    l3.buildInterpolation();
+    for (unsigned short i = 0; i != 20; ++i) {
+      const auto p = tvector<3u, double>{2 * next_value(s), next_value(s),
+                                         -next_value(s)};
+      TFEL_TESTS_ASSERT(std::abs(l3(p) - f3(p)) < 1e-8);
+    }
+  }  // end of test2
+  //! \brief batched evaluation
+  void test3() {
+    using namespace tfel::math;
+    auto s = 3u;
+    auto k = Kriging<2u>{};
+    for (unsigned short i = 0; i != 50; ++i) {
+      const auto x = next_value(s);
+      const auto y = next_value(s);
+      k.addValue(tvector<2u, double>{x, y}, std::cos(3 * x) * y);
+    }
+    k.buildInterpolation();
+    auto pts = std::vector<tvector<2u, double>>{};
+    for (unsigned short i = 0; i != 150; ++i) {
+      pts.push_back(tvector<2u, double>{next_value(s), next_value(s)});
+    }
+    const auto r = k.evaluate(pts);
+    TFEL_TESTS_ASSERT(r.size() == pts.size());
+    for (std::size_t i = 0; i != pts.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - k(pts[i])) < 1e-12);
+    }
+  }  // end of test3
+  //! \brief local kriging
+  void test4() {
+    using namespace tfel::math;
+    auto s = 4u;
+    auto g = Kriging<2u>{};
+    auto l = Kriging<2u>{};
+    auto lall = Kriging<2u>{};
+    auto pts = std::vector<tvector<2u, double>>{};
+    auto fv = std::vector<double>{};
+    for (unsigned short i = 0; i != 200; ++i) {
+      const auto x = next_value(s);
+      const auto y = next_value(s);
+      pts.push_back(tvector<2u, double>{x, y});
+      fv.push_back(std::exp(x) * std::sin(3 * y));
+      g.addValue(pts.back(), fv.back());
+      l.addValue(pts.back(), fv.back());
+      lall.addValue(pts.back(), fv.back());
+    }
+    l.setNumberOfNeighbours(16);
+    lall.setNumberOfNeighbours(pts.size());
+    g.buildInterpolation();
+    l.buildInterpolation();
+    lall.buildInterpolation();
+    // the local kriging interpolates the sample points
+    for (std::size_t i = 0; i != pts.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(l(pts[i]) - fv[i]) < 1e-8);
+    }
+    auto qs = std::vector<tvector<2u, double>>{};
+    for (unsigned short i = 0; i != 20; ++i) {
+      qs.push_back(tvector<2u, double>{next_value(s), next_value(s)});
+    }
+    const auto rl = l.evaluate(qs);
+    for (std::size_t i = 0; i != qs.size(); ++i) {
+      const auto ve = std::exp(qs[i](0)) * std::sin(3 * qs[i](1));
+      const auto vg = g(qs[i]);
+      // using all the sample points is equivalent to the global kriging
+      TFEL_TESTS_ASSERT(std::abs(lall(qs[i]) - vg) < 1e-8);
+      TFEL_TESTS_ASSERT(std::abs(rl[i] - l(qs[i])) < 1e-12);
+      TFEL_TESTS_ASSERT(std::abs(rl[i] - ve) < 5e-2);
+    }
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(KrigingTest, "KrigingTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("KrigingTest.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,158 @@
+/*!
+ * \file   SIMDPackTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/General/SIMDPack.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/stensor.hxx"
+
+struct SIMDPackTest final : public tfel::tests::TestCase {
+  SIMDPackTest()
+      : tfel::tests::TestCase("TFEL/Math", "SIMDPackTest") {
+  }  // end of SIMDPackTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief arithmetic operations and mathematical functions
+  void test1() {
+    using namespace tfel::math;
+    using Pack = SIMDPack<double, 4>;
+    constexpr auto eps = 1e-14;
+    const auto x = Pack({0.5, 1, 2, 3});
+    const auto y = Pack({-1, 2, 0.25, 4});
+    const auto f = (x * y - x / y + 2 * x) / (1 + y) - (-x);
+    const auto g = exp(x) + sqrt(x) * pow(x, 1.5) - power<2>(y);
+    const auto m = max(x, y);
+    const auto a = abs(y);
+    for (unsigned short i = 0; i != 4; ++i) {
+      const auto xv = x[i];
+      const auto yv = y[i];
+      if (i != 0) {
+        const auto fv = (xv * yv - xv / yv + 2 * xv) / (1 + yv) + xv;
+        TFEL_TESTS_ASSERT(std::abs(f[i] - fv) < eps * std::abs(fv));
+      }
+      const auto gv =
+          std::exp(xv) + std::sqrt(xv) * std::pow(xv, 1.5) - yv * yv;
+      TFEL_TESTS_ASSERT(std::abs(g[i] - gv) < eps * std::abs(gv));
+      TFEL_TESTS_ASSERT(std::abs(m[i] - std::max(xv, yv)) < eps);
+      TFEL_TESTS_ASSERT(std::abs(a[i] - std::abs(yv)) < eps);
+    }
+    // constants are broadcast in all the lanes
+    constexpr auto c = Pack(4);
+    for (unsigned short i = 0; i != 4; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(c[i] - 4) < eps);
+    }
+  }  // end of test1
+  //! \brief comparisons and divergence
+  void test2() {
+    using namespace tfel::math;
+    using Pack = SIMDPack<double, 4>;
+    const auto x = Pack({0.5, 1, 2, 3});
+    const auto m = x > 1.5;
+    TFEL_TESTS_ASSERT((!m[0]) && (!m[1]) && (m[2]) && (m[3]));
+    TFEL_TESTS_ASSERT(any(m));
+    TFEL_TESTS_ASSERT(!all(m));
+    TFEL_TESTS_ASSERT(all(x > 0));
+    // branches agreeing with the first lane do not lead to divergence
+    resetDivergentSIMDLanes();
+    if (x > 0) {
+      TFEL_TESTS_ASSERT(getDivergentSIMDLanes() == 0);
+    } else {
+      TFEL_TESTS_ASSERT(false);
+    }
+    // branches follow the first lane, the others being flagged
+    if (x > 1.5) {
+      TFEL_TESTS_ASSERT(false);
+    }
+    TFEL_TESTS_ASSERT(getDivergentSIMDLanes() == 0b1100);
+    resetDivergentSIMDLanes();
+    TFEL_TESTS_ASSERT(getDivergentSIMDLanes() == 0);
+    // functions without branches never lead to divergence
+    const auto y = min(x, 1.5) + max(2, x) + abs(x - 1.5);
+    TFEL_TESTS_ASSERT(getDivergentSIMDLanes() == 0);
+    TFEL_TESTS_ASSERT(std::abs(y[3] - 6) < 1e-14);
+  }  // end of test2
+  //! \brief tensorial objects
+  void test3() {
+    using namespace tfel::math;
+    using Pack = SIMDPack<double, 2>;
+    constexpr auto eps = 1e-12;
+    const auto s0 = stensor<3, double>{100, -20, 30, 15, 0, -4};
+    const auto s1 = stensor<3, double>{-10, 20, 0, 0, 40, 0};
+    auto s = stensor<3, Pack>{};
+    gatherLane(s, s0, 0);
+    gatherLane(s, s1, 1);
+    const auto seq = sigmaeq(s);
+    TFEL_TESTS_ASSERT(std::abs(seq[0] - sigmaeq(s0)) < eps * seq[0]);
+    TFEL_TESTS_ASSERT(std::abs(seq[1] - sigmaeq(s1)) < eps * seq[1]);
+    const auto n = eval(3 * deviator(s) / (2 * seq));
+    auto n1 = stensor<3, double>{};
+    scatterLane(n1, n, 1);
+    const auto n1_ref = eval(3 * deviator(s1) / (2 * sigmaeq(s1)));
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(n1[i] - n1_ref[i]) < eps);
+    }
+  }  // end of test3
+  //! \brief lanes of nested objects
+  void test4() {
+    using namespace tfel::math;
+    using Pack = SIMDPack<double, 2>;
+    constexpr auto eps = 1e-14;
+    auto v = tvector<2, stensor<1, Pack>>{};
+    const auto v1 = tvector<2, stensor<1, double>>{
+        stensor<1, double>{1, 2, 3}, stensor<1, double>{4, 5, 6}};
+    gatherLane(v, v1, 1);
+    auto r = tvector<2, stensor<1, double>>{};
+    scatterLane(r, v, 1);
+    for (unsigned short i = 0; i != 2; ++i) {
+      for (unsigned short j = 0; j != 3; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(v[i][j][0]) < eps);
+        TFEL_TESTS_ASSERT(std::abs(r[i][j] - v1[i][j]) < eps);
+      }
+    }
+    // objects which are not based on packs are only copied for the first
+    // lane
+    auto b = false;
+    gatherLane(b, true, 1);
+    TFEL_TESTS_ASSERT(!b);
+    gatherLane(b, true, 0);
+    TFEL_TESTS_ASSERT(b);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(SIMDPackTest, "SIMDPackTest");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("SIMDPackTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
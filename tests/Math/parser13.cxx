@@ -0,0 +1,144 @@
+/*!
+ * \file   parser13.cxx
+ * \brief  This test checks the evaluation of formulas through the
+ * `ExprProgram` class, including evaluations on many points.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest13 final : public tfel::tests::TestCase {
+  ParserTest13()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest13") {
+  }  // end of ParserTest13
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief common sub-expressions and constant folding
+  void test1() {
+    const auto eps = 1e-14;
+    auto check = [this, eps](const std::string& f, const auto& r) {
+      auto ev = tfel::math::Evaluator(std::vector<std::string>{"x"}, f);
+      for (const auto x : {-1.5, -0.2, 0.3, 1., 2.5}) {
+        ev.setVariableValue("x", x);
+        TFEL_TESTS_ASSERT(std::abs(ev.getValue() - r(x)) < eps);
+      }
+    };
+    check("sin(x)*sin(x)+cos(x)*cos(x)", [](const double) { return 1.; });
+    check("2*3+x", [](const double x) { return 6 + x; });
+    check("(x+1)*(x+1)-(x+1)", [](const double x) { return (x + 1) * x; });
+    check("power<3>(x)+x**2", [](const double x) { return x * x * (x + 1); });
+    check("exp(log(2))*x", [](const double x) { return 2 * x; });
+    check("2>1 ? x : 1/0", [](const double x) { return x; });
+    check("x>0 ? x : -x", [](const double x) { return std::abs(x); });
+    check("x>0 ? (x<1 ? 1 : 2) : 3",
+          [](const double x) { return x > 0 ? (x < 1 ? 1. : 2.) : 3.; });
+    check("H(x)+max(x,0)",
+          [](const double x) { return x >= 0 ? 1 + x : 0.; });
+    // derivatives generate many common sub-expressions
+    auto ev = tfel::math::Evaluator(std::vector<std::string>{"x"},
+                                    "exp(x*x)*sin(x*x)");
+    const auto dev = ev.differentiate("x");
+    for (const auto x : {-1.5, -0.2, 0.3, 1., 2.5}) {
+      dev->setVariableValue(0, x);
+      const auto r =
+          2 * x * std::exp(x * x) * (std::sin(x * x) + std::cos(x * x));
+      TFEL_TESTS_ASSERT(std::abs(dev->getValue() - r) < eps * std::abs(r));
+    }
+    // copy
+    auto ev2 = ev;
+    ev.setVariableValue("x", 1);
+    ev2.setVariableValue("x", 2);
+    TFEL_TESTS_ASSERT(std::abs(ev.getValue() - std::exp(1.) * std::sin(1.)) <
+                      eps);
+    TFEL_TESTS_ASSERT(std::abs(ev2.getValue() - std::exp(4.) * std::sin(4.)) <
+                      eps * std::exp(4.));
+  }  // end of test1
+  //! \brief errors are only reported if the faulty expression is evaluated
+  void test2() {
+    using tfel::math::Evaluator;
+    auto ev = Evaluator("x>0 ? 1/x : 0");
+    ev.setVariableValue("x", 0);
+    TFEL_TESTS_ASSERT(std::abs(ev.getValue()) < 1e-14);
+    auto ev2 = Evaluator("1/x");
+    ev2.setVariableValue("x", 0);
+    TFEL_TESTS_CHECK_THROW(ev2.getValue(), std::runtime_error);
+    auto ev3 = Evaluator("log(-1)+x");
+    TFEL_TESTS_CHECK_THROW(ev3.getValue(), std::runtime_error);
+  }  // end of test2
+  //! \brief evaluation on many points
+  void test3() {
+    const auto eps = 1e-14;
+    auto check = [this, eps](const std::string& f) {
+      auto ev = tfel::math::Evaluator(std::vector<std::string>{"x", "y"}, f);
+      const auto n = std::size_t{150};
+      auto x = std::vector<double>(n);
+      auto y = std::vector<double>(n);
+      for (std::size_t i = 0; i != n; ++i) {
+        x[i] = -1 + 2 * static_cast<double>(i) / static_cast<double>(n);
+        y[i] = std::cos(static_cast<double>(i));
+      }
+      auto r = std::vector<double>(n);
+      ev.getValues(r, x, y);
+      for (std::size_t i = 0; i != n; ++i) {
+        ev.setVariableValue("x", x[i]);
+        ev.setVariableValue("y", y[i]);
+        TFEL_TESTS_ASSERT(std::abs(r[i] - ev.getValue()) < eps);
+      }
+    };
+    check("exp(-x)*y+max(x,y)-x*y*(x+y)");
+    check("-x+power<2>(y)+x**3+1");
+    check("x>y ? x-y : 2*y");
+    check("x>y && y > 0 ? x-y : 2*y");
+    check("12");
+  }  // end of test3
+  //! \brief errors reported by the `getValues` method
+  void test4() {
+    auto ev = tfel::math::Evaluator(std::vector<std::string>{"x", "y"},
+                                    "x/y");
+    auto x = std::vector<double>{1, 2, 3};
+    auto y = std::vector<double>{1, 0, 3};
+    auto r = std::vector<double>(3);
+    TFEL_TESTS_CHECK_THROW(ev.getValues(r, x), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(ev.getValues(r, x, std::vector<double>(2)),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(ev.getValues(r, x, y), std::runtime_error);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest13, "ParserTest13");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("Parser13.xml");
+  return manager.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
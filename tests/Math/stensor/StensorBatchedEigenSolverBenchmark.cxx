@@ -0,0 +1,116 @@
+/*!
+ * \file   StensorBatchedEigenSolverBenchmark.cxx
+ * \brief  This file compares the throughput of the
+ * `StensorBatchedEigenSolver` class to the one of the scalar eigen
+ * solvers of the `stensor` class, applied to each tensor of an array.
+ *
+ * Usage: StensorBatchedEigenSolverBenchmark [number of tensors]
+ *
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx"
+
+using size_type = std::size_t;
+using Solver = tfel::math::StensorBatchedEigenSolver<3u, double>;
+using stensor_common = tfel::math::stensor_common;
+
+template <typename F>
+static double measure(F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+//! \return the throughput in millions of tensors per second
+static double throughput(const size_type n, const double t) {
+  return static_cast<double>(n) / (1e6 * t);
+}
+
+template <stensor_common::EigenSolver es>
+static void benchmarkScalarSolver(const std::string& name,
+                                  const std::vector<double>& s,
+                                  const size_type n) {
+  auto vp = std::vector<double>(3 * n);
+  auto m = std::vector<double>(9 * n);
+  const auto t1 = measure([&s, &vp, n] {
+    for (size_type k = 0; k != n; ++k) {
+      auto st = tfel::math::stensor<3u, double>{};
+      for (size_type c = 0; c != 6; ++c) {
+        st[c] = s[c * n + k];
+      }
+      const auto v = st.template computeEigenValues<es>();
+      for (size_type i = 0; i != 3; ++i) {
+        vp[i * n + k] = v[i];
+      }
+    }
+  });
+  const auto t2 = measure([&s, &vp, &m, n] {
+    for (size_type k = 0; k != n; ++k) {
+      auto st = tfel::math::stensor<3u, double>{};
+      for (size_type c = 0; c != 6; ++c) {
+        st[c] = s[c * n + k];
+      }
+      const auto [v, r] = st.template computeEigenVectors<es>();
+      for (size_type i = 0; i != 3; ++i) {
+        vp[i * n + k] = v[i];
+        for (size_type j = 0; j != 3; ++j) {
+          m[(3 * i + j) * n + k] = r(i, j);
+        }
+      }
+    }
+  });
+  std::cout << name << " " << throughput(n, t1) << " "
+            << throughput(n, t2) << '\n';
+}
+
+int main(const int argc, const char* const* const argv) {
+  const auto n = argc > 1 ? static_cast<size_type>(std::stoi(argv[1]))
+                          : size_type{1000000};
+  // pseudo-random tensors
+  auto s = std::vector<double>(6 * n);
+  auto seed = 1u;
+  for (auto& v : s) {
+    seed = 1664525u * seed + 1013904223u;
+    v = 2 * static_cast<double>(seed >> 8) / static_cast<double>(1u << 24) - 1;
+  }
+  std::cout << "# number of tensors: " << n << '\n'
+            << "# solver | eigen values (Mtensors/s) | "
+            << "eigen values and eigen vectors (Mtensors/s)\n";
+  benchmarkScalarSolver<stensor_common::TFELEIGENSOLVER>("TFELEIGENSOLVER", s,
+                                                         n);
+  benchmarkScalarSolver<stensor_common::FSESANALYTICALEIGENSOLVER>(
+      "FSESANALYTICALEIGENSOLVER", s, n);
+  benchmarkScalarSolver<stensor_common::FSESJACOBIEIGENSOLVER>(
+      "FSESJACOBIEIGENSOLVER", s, n);
+  benchmarkScalarSolver<stensor_common::GTESYMMETRICQREIGENSOLVER>(
+      "GTESYMMETRICQREIGENSOLVER", s, n);
+  benchmarkScalarSolver<stensor_common::HARARIEIGENSOLVER>(
+      "HARARIEIGENSOLVER", s, n);
+  auto vp = std::vector<double>(3 * n);
+  auto m = std::vector<double>(9 * n);
+  const auto t1 = measure(
+      [&s, &vp, n] { Solver::computeEigenValues(vp.data(), s.data(), n); });
+  auto nill = size_type{};
+  const auto t2 = measure([&s, &vp, &m, &nill, n] {
+    nill = Solver::computeEigenVectors(vp.data(), m.data(), s.data(), n);
+  });
+  std::cout << "StensorBatchedEigenSolver " << throughput(n, t1) << " "
+            << throughput(n, t2) << '\n'
+            << "# tensors treated by the scalar solver: " << nill << '\n';
+  return EXIT_SUCCESS;
+}
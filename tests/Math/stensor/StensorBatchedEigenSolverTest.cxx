@@ -0,0 +1,182 @@
+/*!
+ * \file   tests/Math/stensor/StensorBatchedEigenSolverTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx"
+
+//! \return a pseudo-random number in [-1:1], independent of rand
+static double next_value(unsigned int& s) {
+  s = 1664525u * s + 1013904223u;
+  return 2 * static_cast<double>(s >> 8) / static_cast<double>(1u << 24) - 1;
+}  // end of next_value
+
+struct StensorBatchedEigenSolverTest final : public tfel::tests::TestCase {
+  StensorBatchedEigenSolverTest()
+      : tfel::tests::TestCase("TFEL/Math", "StensorBatchedEigenSolverTest") {
+  }  // end of StensorBatchedEigenSolverTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  /*!
+   * \brief check the eigen values and the eigen vectors of an array of
+   * symmetric tensors
+   */
+  template <unsigned short N>
+  void check(const std::vector<tfel::math::stensor<N, double>>& tensors,
+             const std::size_t nill) {
+    using namespace tfel::math;
+    using Solver = StensorBatchedEigenSolver<N, double>;
+    const auto n = tensors.size();
+    constexpr auto ssize = StensorDimeToSize<N>::value;
+    auto s = std::vector<double>(ssize * n);
+    for (std::size_t k = 0; k != n; ++k) {
+      for (std::size_t c = 0; c != ssize; ++c) {
+        s[c * n + k] = tensors[k][c];
+      }
+    }
+    auto vp = std::vector<double>(3 * n);
+    auto vp2 = std::vector<double>(3 * n);
+    auto m = std::vector<double>(9 * n);
+    const auto r =
+        Solver::computeEigenVectors(vp.data(), m.data(), s.data(), n);
+    Solver::computeEigenValues(vp2.data(), s.data(), n);
+    TFEL_TESTS_ASSERT(r == nill);
+    for (std::size_t k = 0; k != n; ++k) {
+      const auto& t = tensors[k];
+      auto scale = 1e-300;
+      for (const auto v : t) {
+        scale = std::max(scale, std::abs(v));
+      }
+      const auto eps = 1e-12 * scale;
+      // comparison with the scalar solver
+      auto evs = t.computeEigenValues();
+      if constexpr (N == 2) {
+        std::sort(evs.begin(), evs.begin() + 2);
+      } else if constexpr (N == 3) {
+        // Harari's solver is accurate for multiple eigen values
+        evs = t.template computeEigenValues<
+            stensor_common::HARARIEIGENSOLVER>();
+        std::sort(evs.begin(), evs.end());
+      }
+      auto rm = tmatrix<3u, 3u, double>{};
+      for (unsigned short i = 0; i != 3; ++i) {
+        TFEL_TESTS_ASSERT(std::abs(vp[i * n + k] - evs[i]) < eps);
+        TFEL_TESTS_ASSERT(std::abs(vp2[i * n + k] - evs[i]) < eps);
+        for (unsigned short j = 0; j != 3; ++j) {
+          rm(i, j) = m[(3 * i + j) * n + k];
+        }
+      }
+      // orthogonality of the rotation matrix
+      const auto rmt = tmatrix<3u, 3u, double>{transpose(rm)};
+      const auto id = tmatrix<3u, 3u, double>{rmt * rm};
+      for (unsigned short i = 0; i != 3; ++i) {
+        for (unsigned short j = 0; j != 3; ++j) {
+          TFEL_TESTS_ASSERT(std::abs(id(i, j) - (i == j ? 1 : 0)) < 1e-12);
+        }
+      }
+      // the columns of the rotation matrix are eigen vectors
+      auto d = stensor<N, double>(0.);
+      for (unsigned short i = 0; i != 3; ++i) {
+        d[i] = vp[i * n + k];
+      }
+      d.changeBasis(rmt);
+      for (std::size_t c = 0; c != ssize; ++c) {
+        TFEL_TESTS_ASSERT(std::abs(d[c] - t[c]) < eps);
+      }
+    }
+  }  // end of check
+  //! \brief random tensors in 3D
+  void test1() {
+    auto s = 1u;
+    auto tensors = std::vector<tfel::math::stensor<3u, double>>{};
+    for (unsigned short i = 0; i != 150; ++i) {
+      auto t = tfel::math::stensor<3u, double>{};
+      for (auto& v : t) {
+        v = next_value(s);
+      }
+      tensors.push_back(1e5 * t);
+    }
+    this->check<3u>(tensors, 0);
+  }  // end of test1
+  //! \brief tensors with multiple eigen values in 3D
+  void test2() {
+    using namespace tfel::math;
+    auto s = 2u;
+    const auto sqrt2 = Cste<double>::sqrt2;
+    auto tensors = std::vector<stensor<3u, double>>{};
+    tensors.push_back(stensor<3u, double>(0.));
+    tensors.push_back(stensor<3u, double>::Id());
+    tensors.push_back(stensor<3u, double>{1, 1, 2, 0, 0, 0});
+    tensors.push_back(stensor<3u, double>{-3, 0, 0, 0, 0, 0});
+    // a rotated uniaxial tensor
+    tensors.push_back(stensor<3u, double>{1, 1, 0, sqrt2, 0, 0});
+    // well separated eigen values, treated by the batched kernels
+    for (unsigned short i = 0; i != 70; ++i) {
+      tensors.push_back(stensor<3u, double>{
+          next_value(s) + 3, next_value(s), next_value(s) - 3, 0, 0, 0});
+    }
+    this->check<3u>(tensors, 5);
+  }  // end of test2
+  //! \brief tensors in 2D
+  void test3() {
+    auto s = 3u;
+    auto tensors = std::vector<tfel::math::stensor<2u, double>>{};
+    tensors.push_back(tfel::math::stensor<2u, double>{2, 2, -1, 0});
+    for (unsigned short i = 0; i != 80; ++i) {
+      auto t = tfel::math::stensor<2u, double>{};
+      for (auto& v : t) {
+        v = next_value(s);
+      }
+      tensors.push_back(t);
+    }
+    this->check<2u>(tensors, 1);
+  }  // end of test3
+  //! \brief tensors in 1D
+  void test4() {
+    auto tensors = std::vector<tfel::math::stensor<1u, double>>{};
+    tensors.push_back(tfel::math::stensor<1u, double>{3, -1, 2});
+    tensors.push_back(tfel::math::stensor<1u, double>{0, 1, 1});
+    this->check<1u>(tensors, 0);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(StensorBatchedEigenSolverTest,
+                          "StensorBatchedEigenSolverTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("StensorBatchedEigenSolverTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
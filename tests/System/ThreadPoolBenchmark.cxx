@@ -0,0 +1,157 @@
+/*!
+ * \file   ThreadPoolBenchmark.cxx
+ * \brief  This file compares the `ThreadPool` class to a thread pool
+ * using a single task queue protected by a global mutex (which was the
+ * implementation of the `ThreadPool` class up to `TFEL-4.2`).
+ *
+ * Usage: ThreadPoolBenchmark [maximum number of threads] [number of tasks]
+ *
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <queue>
+#include <cmath>
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+#include <functional>
+#include <condition_variable>
+#include "TFEL/System/ThreadPool.hxx"
+
+/*!
+ * \brief a thread pool using a single task queue protected by a global
+ * mutex.
+ */
+struct SingleQueueThreadPool {
+  SingleQueueThreadPool(const std::size_t n) {
+    this->statuses.resize(n, IDLE);
+    for (std::size_t i = 0; i != n; ++i) {
+      this->workers.emplace_back([this, i] {
+        for (;;) {
+          std::function<void()> task;
+          {
+            std::unique_lock<std::mutex> lock(this->m);
+            this->c.wait(
+                lock, [this] { return this->stop || !this->tasks.empty(); });
+            if (this->stop && this->tasks.empty()) {
+              return;
+            }
+            task = std::move(this->tasks.front());
+            this->tasks.pop();
+            this->statuses[i] = WORKING;
+            this->c.notify_all();
+          }
+          task();
+          {
+            std::unique_lock<std::mutex> lock(this->m);
+            this->statuses[i] = IDLE;
+            this->c.notify_all();
+          }
+        }
+      });
+    }
+  }
+  void addTask(std::function<void()> f) {
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      this->tasks.emplace(std::move(f));
+    }
+    this->c.notify_one();
+  }
+  void wait() {
+    std::unique_lock<std::mutex> lock(this->m);
+    this->c.wait(lock, [this] {
+      if (!this->tasks.empty()) {
+        return false;
+      }
+      for (const auto s : this->statuses) {
+        if (s != IDLE) {
+          return false;
+        }
+      }
+      return true;
+    });
+  }
+  ~SingleQueueThreadPool() {
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      this->stop = true;
+    }
+    this->c.notify_all();
+    for (auto& w : this->workers) {
+      w.join();
+    }
+  }
+
+ private:
+  enum Status { WORKING, IDLE };
+  std::vector<Status> statuses;
+  std::vector<std::thread> workers;
+  std::queue<std::function<void()>> tasks;
+  std::mutex m;
+  std::condition_variable c;
+  bool stop = false;
+};
+
+//! \brief a small amount of work
+static void work(std::vector<double>& v, const std::size_t i) {
+  auto x = static_cast<double>(i);
+  for (int k = 0; k != 16; ++k) {
+    x = std::sqrt(x + 1);
+  }
+  v[i] = x;
+}
+
+template <typename F>
+static double measure(F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(const int argc, const char* const* const argv) {
+  using size_type = tfel::system::ThreadPool::size_type;
+  const auto nmax =
+      argc > 1 ? static_cast<size_type>(std::stoi(argv[1])) : size_type{64};
+  const auto ntasks =
+      argc > 2 ? static_cast<size_type>(std::stoi(argv[2])) : size_type{100000};
+  auto v = std::vector<double>(ntasks);
+  std::cout << "# number of tasks: " << ntasks << '\n'
+            << "# threads | single queue (ms) | ThreadPool::addTask (ms) | "
+            << "ThreadPool::parallel_for (ms)\n";
+  for (size_type n = 1; n <= nmax; n *= 2) {
+    const auto t1 = measure([&v, n, ntasks] {
+      SingleQueueThreadPool p(n);
+      for (size_type i = 0; i != ntasks; ++i) {
+        p.addTask([&v, i] { work(v, i); });
+      }
+      p.wait();
+    });
+    const auto t2 = measure([&v, n, ntasks] {
+      tfel::system::ThreadPool p(n);
+      for (size_type i = 0; i != ntasks; ++i) {
+        p.addTask([&v, i] { work(v, i); });
+      }
+      p.wait();
+    });
+    const auto t3 = measure([&v, n, ntasks] {
+      tfel::system::ThreadPool p(n);
+      p.parallel_for(0, ntasks, 64, [&v](const size_type i) { work(v, i); });
+    });
+    std::cout << n << " " << t1 << " " << t2 << " " << t3 << std::endl;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+/*!
+ * \file   ThreadPoolTest3.cxx
+ * \brief  This file tests the `parallel_for` method of the `ThreadPool` class
+ * \author Thomas Helfer
+ * \date   18 oct. 2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <vector>
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+
+struct ThreadPoolTest3 final : public tfel::tests::TestCase {
+  ThreadPoolTest3()
+      : tfel::tests::TestCase("TFEL/System", "ThreadPoolTest3") {
+  }  // end of ThreadPoolTest3
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief check that each index is treated exactly once
+  void test1() {
+    using size_type = tfel::system::ThreadPool::size_type;
+    tfel::system::ThreadPool p(4);
+    for (const auto g : {size_type{0}, size_type{1}, size_type{7},
+                         size_type{1000}, size_type{5000}}) {
+      auto v = std::vector<int>(1000, 0);
+      p.parallel_for(0, v.size(), g, [&v](const size_type i) { v[i] += 1; });
+      auto ok = true;
+      for (const auto& value : v) {
+        ok = ok && (value == 1);
+      }
+      TFEL_TESTS_ASSERT(ok);
+    }
+    // empty range
+    auto n = std::atomic<int>{0};
+    p.parallel_for(10, 10, 1, [&n](const size_type) { ++n; });
+    TFEL_TESTS_ASSERT(n == 0);
+  }
+  //! \brief check that exceptions are propagated to the caller
+  void test2() {
+    using size_type = tfel::system::ThreadPool::size_type;
+    tfel::system::ThreadPool p(2);
+    auto n = std::atomic<int>{0};
+    auto f = [&n](const size_type i) {
+      ++n;
+      if (i == 50) {
+        throw(std::runtime_error("invalid index"));
+      }
+    };
+    TFEL_TESTS_CHECK_THROW(p.parallel_for(0, 100, 10, f), std::runtime_error);
+    TFEL_TESTS_ASSERT(n <= 100);
+    // the pool is still usable
+    n = 0;
+    p.parallel_for(0, 100, 10, [&n](const size_type) { ++n; });
+    TFEL_TESTS_ASSERT(n == 100);
+  }
+  //! \brief check that tasks and `parallel_for` can be mixed
+  void test3() {
+    using size_type = tfel::system::ThreadPool::size_type;
+    tfel::system::ThreadPool p(3);
+    auto res = std::atomic<int>{0};
+    for (int i = 0; i != 10; ++i) {
+      p.addTask([&res, i] { res += i; });
+    }
+    p.parallel_for(0, 10, 2, [&res](const size_type i) {
+      res += static_cast<int>(i);
+    });
+    p.wait();
+    TFEL_TESTS_ASSERT(res == 90);
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(ThreadPoolTest3, "ThreadPoolTest3");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ThreadPoolTest3.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -28,6 +28,7 @@ struct StringAlgorithmsTest final : public tfel::tests::TestCase {
   tfel::tests::TestResult execute() override {
     this->test1();
     this->test2();
+    this->test3();
     return this->result;
   }  // end of execute
  private:
@@ -62,6 +63,13 @@ struct StringAlgorithmsTest final : public tfel::tests::TestCase {
       TFEL_TESTS_ASSERT(tokens2[2] == "d");
     }
   }  // end of test2
+  void test3() {
+    using namespace tfel::utilities;
+    // reference values of the 64 bits FNV-1a algorithm
+    TFEL_TESTS_CHECK_EQUAL(getStableHash(""), "cbf29ce484222325");
+    TFEL_TESTS_CHECK_EQUAL(getStableHash("a"), "af63dc4c8601ec8c");
+    TFEL_TESTS_CHECK_EQUAL(getStableHash("foobar"), "85944171f73967e8");
+  }  // end of test3
 };
 
 TFEL_TESTS_GENERATE_PROXY(StringAlgorithmsTest, "StringAlgorithms");
@@ -0,0 +1,186 @@
+/*!
+ * \file   TextDataTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryResultFile.hxx"
+
+struct TextDataTest final : public tfel::tests::TestCase {
+  TextDataTest()
+      : tfel::tests::TestCase("TFEL/Utilities", "TextDataTest") {
+  }  // end of TextDataTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief write a file
+  static void write(const std::string& f, const std::string& c) {
+    std::ofstream out(f);
+    out << c;
+  }  // end of write
+  //! \brief check that the given column has the expected values
+  void check(const std::vector<double>& c, const std::vector<double>& e) {
+    TFEL_TESTS_ASSERT(c.size() == e.size());
+    if (c.size() != e.size()) {
+      return;
+    }
+    for (std::size_t i = 0; i != c.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(c[i] - e[i]) < 1e-14 * (1 + std::abs(e[i])));
+    }
+  }  // end of check
+  //! \brief legends, preamble and numbers
+  void test1() {
+    using tfel::utilities::TextData;
+    write("TextDataTest1.txt",
+          "# time 'stress' \"strain\"\n"
+          "# a comment\n"
+          "0 1.5 -2e-3\n"
+          "\n"
+          "1.e1\t+2 .5\r\n"
+          "# ignored comment\n"
+          "2 -0.25 3E+2 4\n");
+    const auto d = TextData("TextDataTest1.txt");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 3u);
+    TFEL_TESTS_ASSERT(d.getLegend(2) == "stress");
+    TFEL_TESTS_ASSERT(d.getLegend(3) == "strain");
+    TFEL_TESTS_ASSERT(d.getLegend(4).empty());
+    TFEL_TESTS_ASSERT(d.findColumn("strain") == 3u);
+    TFEL_TESTS_CHECK_THROW(d.findColumn("temperature"), std::runtime_error);
+    TFEL_TESTS_ASSERT(d.getPreamble().size() == 2u);
+    TFEL_TESTS_ASSERT(d.getPreamble()[1] == " a comment");
+    this->check(d.getColumn(1), {0, 10, 2});
+    this->check(d.getColumn(2), {1.5, 2, -0.25});
+    this->check(d.getColumn(3), {-2e-3, 0.5, 300});
+    TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    // tokens
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 3);
+    TFEL_TESTS_ASSERT(d.begin()->tokens.size() == 3u);
+    TFEL_TESTS_ASSERT(d.begin()->tokens[2].value == "-2e-3");
+    TFEL_TESTS_ASSERT(d.begin()->tokens[0].line == 3u);
+    TFEL_TESTS_ASSERT((d.end() - 1)->tokens.size() == 4u);
+    std::remove("TextDataTest1.txt");
+  }  // end of test1
+  //! \brief lines which are not only made of numbers
+  void test2() {
+    using tfel::utilities::TextData;
+    write("TextDataTest2.txt",
+          "1 2 3\n"
+          "4 5 6 // comment\n"
+          "7 8 nine\n"
+          "10 11 12\n");
+    const auto d = TextData("TextDataTest2.txt");
+    TFEL_TESTS_ASSERT(d.getLegends().empty());
+    this->check(d.getColumn(1), {1, 4, 7, 10});
+    this->check(d.getColumn(2), {2, 5, 8, 11});
+    TFEL_TESTS_CHECK_THROW(d.getColumn(3), std::invalid_argument);
+    TFEL_TESTS_ASSERT((d.begin() + 1)->tokens.size() == 3u);
+    std::remove("TextDataTest2.txt");
+  }  // end of test2
+  //! \brief gnuplot format and skipped lines
+  void test3() {
+    using tfel::utilities::TextData;
+    write("TextDataTest3.txt",
+          "t x\n"
+          "0 1\n"
+          "1 2\n"
+          "2 4\n"
+          "3 8\n");
+    auto d = TextData("TextDataTest3.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d.findColumn("x") == 2u);
+    this->check(d.getColumn(2), {1, 2, 4, 8});
+    d.skipLines(1);
+    this->check(d.getColumn(1), {1, 2, 3});
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 3);
+    d.skipLines(2);
+    this->check(d.getColumn(2), {4, 8});
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 2);
+    TFEL_TESTS_ASSERT(d.begin()->tokens[1].value == "4");
+    write("TextDataTest3.txt",
+          "0 1\n"
+          "1 2\n");
+    const auto d2 = TextData("TextDataTest3.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d2.getLegends().empty());
+    this->check(d2.getColumn(2), {1, 2});
+    std::remove("TextDataTest3.txt");
+  }  // end of test3
+  //! \brief binary result files
+  void test4() {
+    using tfel::utilities::TextData;
+    using tfel::utilities::BinaryResultFileWriter;
+    {
+      // blocks of two lines, the last block being incomplete
+      auto w = BinaryResultFileWriter("TextDataTest4.res",
+                                      {"time", "SXX", "T"}, 2);
+      TFEL_TESTS_CHECK_THROW(w.addLine({0, 1}), std::runtime_error);
+      for (int i = 0; i != 5; ++i) {
+        const auto t = static_cast<double>(i) / 3;
+        w.addLine({t, -2e8 * t, 293.15});
+      }
+    }
+    const auto d = TextData("TextDataTest4.res");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 3u);
+    TFEL_TESTS_ASSERT(d.getLegend(3) == "T");
+    TFEL_TESTS_ASSERT(d.findColumn("SXX") == 2u);
+    const auto t = d.getColumn(1);
+    const auto sxx = d.getColumn(2);
+    const auto T = d.getColumn(3);
+    TFEL_TESTS_ASSERT(t.size() == 5u);
+    TFEL_TESTS_ASSERT(sxx.size() == 5u);
+    TFEL_TESTS_ASSERT(T.size() == 5u);
+    if ((t.size() != 5u) || (sxx.size() != 5u) || (T.size() != 5u)) {
+      return;
+    }
+    for (int i = 0; i != 5; ++i) {
+      // values are stored exactly
+      const auto ti = static_cast<double>(i) / 3;
+      TFEL_TESTS_ASSERT(!(t[i] < ti) && !(t[i] > ti));
+      TFEL_TESTS_ASSERT(!(sxx[i] < -2e8 * ti) && !(sxx[i] > -2e8 * ti));
+      TFEL_TESTS_ASSERT(!(T[i] < 293.15) && !(T[i] > 293.15));
+    }
+    // tokens are built on demand
+    TFEL_TESTS_ASSERT(d.end() - d.begin() == 5);
+    TFEL_TESTS_ASSERT(d.begin()->tokens.size() == 3u);
+    TFEL_TESTS_ASSERT(d.begin()->tokens[2].value == "293.15");
+    std::remove("TextDataTest4.res");
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(TextDataTest, "TextDataTest");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& manager = tfel::tests::TestManager::getTestManager();
+  manager.addTestOutput(std::cout);
+  manager.addXMLTestOutput("TextDataTest.xml");
+  return manager.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
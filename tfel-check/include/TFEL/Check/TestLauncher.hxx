@@ -89,6 +89,11 @@ namespace tfel::check {
           output_check;
       //! \brief shall_fail
       bool shall_fail = false;
+      /*!
+       * \brief if true, the command can be executed at the same time as
+       * the adjacent concurrent commands
+       */
+      bool concurrent = false;
     };  // end of struct Command
     /*!
      * \brief execute the given comment
@@ -97,6 +102,32 @@ namespace tfel::check {
      * \param[in] step:
      */
     bool execute(const Command&, const std::string&, const std::string&);
+    /*!
+     * \brief execute simultaneously the commands in the given range
+     * \return the results of the commands
+     * \param[in] b: index of the first command
+     * \param[in] e: index past the last command
+     */
+    std::vector<bool> executeConcurrently(
+        const std::vector<Command>::size_type,
+        const std::vector<Command>::size_type);
+    /*!
+     * \brief check the output of a command and report the result
+     * \return the result of the command
+     * \param[in] c: command
+     * \param[in] output_file: output file name
+     * \param[in] step: step
+     * \param[in] t: execution time
+     */
+    bool checkOutput(const Command&,
+                     const std::string&,
+                     const std::string&,
+                     const double);
+    /*!
+     * \return the name of the output file of the given step
+     * \param[in] step: step
+     */
+    std::string getOutputFileName(const std::string&) const;
     /*!
      * \brief register a new callback
      */
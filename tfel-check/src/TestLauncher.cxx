@@ -378,6 +378,8 @@ namespace tfel::check {
      *   compares the command output to the expected value.
      * - `shall_fail`: if specified and set to true, the command shall return an
      *   invalid exit status.
+     * - `concurrent`: if specified and set to true, the command is executed
+     *   at the same time as the adjacent concurrent commands.
      */
     auto parseCommandOptions = [&c](const tfel::utilities::DataMap& options) {
       auto is_output_check_defined = [&c] {
@@ -407,6 +409,13 @@ namespace tfel::check {
                 "for option 'shall_fail'");
           }
           c.shall_fail = o.second.get<bool>();
+        } else if (o.first == "concurrent") {
+          if (!o.second.is<bool>()) {
+            tfel::raise(
+                "TestLaucher::treatCommand: invalid type "
+                "for option 'concurrent'");
+          }
+          c.concurrent = o.second.get<bool>();
         } else {
           tfel::raise(
               "TestLaucher::treatCommand: "
@@ -686,6 +695,29 @@ namespace tfel::check {
     tfel::raise("TestLauncher::ClockAction: invalid clockevent");
   }
 
+  std::string TestLauncher::getOutputFileName(const std::string& step) const {
+    return this->testname + "-" + step + ".out";
+  }  // end of getOutputFileName
+
+  bool TestLauncher::checkOutput(const Command& c,
+                                 const std::string& output_file,
+                                 const std::string& step,
+                                 const double t) {
+    if (c.output_check) {
+      const auto output = getFileContent(output_file);
+      const auto [success, msg] = c.output_check(output);
+      if (success) {
+        this->log.addTestResult(this->testname, step, c.command, t, true);
+      } else {
+        this->log.addTestResult(this->testname, step, c.command, t, false,
+                                msg);
+      }
+      return success;
+    }
+    this->log.addTestResult(this->testname, step, c.command, t, true);
+    return true;
+  }  // end of checkOutput
+
   bool TestLauncher::execute(const Command& c,
                              const std::string& output_file,
                              const std::string& step) {
@@ -694,21 +726,7 @@ namespace tfel::check {
       this->ClockAction(START);
       manager.execute(c.command, "", output_file, this->environments);
       this->ClockAction(STOP);
-      if (c.output_check) {
-        const auto output = getFileContent(output_file);
-        const auto [success, msg] = c.output_check(output);
-        if (success) {
-          this->log.addTestResult(this->testname, step, c.command,
-                                  this->ClockAction(GET), true);
-        } else {
-          this->log.addTestResult(this->testname, step, c.command,
-                                  this->ClockAction(GET), false, msg);
-        }
-        return success;
-      } else {
-        this->log.addTestResult(this->testname, step, c.command,
-                                this->ClockAction(GET), true);
-      }
+      return this->checkOutput(c, output_file, step, this->ClockAction(GET));
     } catch (std::exception& e) {
       this->log.addTestResult(this->testname, step, c.command, 0.0,
                               c.shall_fail, e.what());
@@ -718,9 +736,64 @@ namespace tfel::check {
                               c.shall_fail, "unhandled exception thrown");
       return c.shall_fail;
     }
-    return true;
   }  // end of execute
 
+  std::vector<bool> TestLauncher::executeConcurrently(
+      const std::vector<Command>::size_type b,
+      const std::vector<Command>::size_type e) {
+    tfel::system::ProcessManager manager;
+    const auto n = e - b;
+    auto pids = std::vector<tfel::system::ProcessManager::ProcessId>(n);
+    auto errors = std::vector<std::optional<std::string>>(n);
+    // launching all the commands
+    this->ClockAction(START);
+    for (std::vector<Command>::size_type i = 0; i != n; ++i) {
+      const auto& c = this->commands[b + i];
+      const auto step = "Exec-" + std::to_string(b + i + 1);
+      try {
+        pids[i] = manager.createProcess(
+            c.command, "", this->getOutputFileName(step), this->environments);
+      } catch (std::exception& ex) {
+        errors[i] = ex.what();
+      }
+    }
+    for (std::vector<Command>::size_type i = 0; i != n; ++i) {
+      if (errors[i].has_value()) {
+        continue;
+      }
+      try {
+        manager.join(pids[i]);
+      } catch (std::exception& ex) {
+        errors[i] = "'" + this->commands[b + i].command + "': " + ex.what();
+      }
+    }
+    this->ClockAction(STOP);
+    // the execution time of the group of commands is reported for each
+    // command
+    const auto t = this->ClockAction(GET);
+    // reporting the results in the order of declaration
+    auto results = std::vector<bool>(n);
+    for (std::vector<Command>::size_type i = 0; i != n; ++i) {
+      const auto& c = this->commands[b + i];
+      const auto step = "Exec-" + std::to_string(b + i + 1);
+      if (errors[i].has_value()) {
+        this->log.addTestResult(this->testname, step, c.command, 0.0,
+                                c.shall_fail, *(errors[i]));
+        results[i] = c.shall_fail;
+        continue;
+      }
+      try {
+        results[i] =
+            this->checkOutput(c, this->getOutputFileName(step), step, t);
+      } catch (std::exception& ex) {
+        this->log.addTestResult(this->testname, step, c.command, 0.0,
+                                c.shall_fail, ex.what());
+        results[i] = c.shall_fail;
+      }
+    }
+    return results;
+  }  // end of executeConcurrently
+
   bool TestLauncher::execute(const Configuration& configuration) {
     using namespace tfel::utilities;
     bool gsuccess = true; /* global success indicator : false only
@@ -740,19 +813,36 @@ namespace tfel::check {
         return gsuccess;
       }
     }
-    // Execute
-    unsigned short i = 1;
-    for (const auto& c : this->commands) {
-      const auto step = "Exec-" + std::to_string(i);
-      const auto output_file = this->testname + "-" + step + ".out";
-      const auto success = this->execute(c, output_file, step);
-      this->glog.addSimpleTestResult("** " + step + " " + c.command, success);
-      if ((!success) && (this->comparisons.empty())) {
-        gsuccess = false;
+    // Execute. Adjacent concurrent commands are executed simultaneously.
+    auto ic = std::vector<Command>::size_type{};
+    while (ic != this->commands.size()) {
+      auto ie = ic + 1;
+      if (this->commands[ic].concurrent) {
+        while ((ie != this->commands.size()) &&
+               (this->commands[ie].concurrent)) {
+          ++ie;
+        }
       }
-      ++i;
+      auto results = std::vector<bool>{};
+      if (ie - ic == 1) {
+        const auto step = "Exec-" + std::to_string(ic + 1);
+        results.push_back(this->execute(this->commands[ic],
+                                        this->getOutputFileName(step), step));
+      } else {
+        results = this->executeConcurrently(ic, ie);
+      }
+      for (auto j = ic; j != ie; ++j) {
+        const auto step = "Exec-" + std::to_string(j + 1);
+        const auto success = results[j - ic];
+        this->glog.addSimpleTestResult(
+            "** " + step + " " + this->commands[j].command, success);
+        if ((!success) && (this->comparisons.empty())) {
+          gsuccess = false;
+        }
+      }
+      ic = ie;
     }
-    i = 1;
+    unsigned short i = 1;
     // Compare
     for (auto& c : this->comparisons) {
       const auto step = "Compare-" + std::to_string(i);
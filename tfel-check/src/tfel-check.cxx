@@ -22,8 +22,14 @@
 #include <algorithm>
 #include <iostream>
 #include <climits>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
 #include <unistd.h>
 #include <libgen.h>
+#if !(defined _WIN32 || defined _WIN64)
+#include <sys/wait.h>
+#endif
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
@@ -133,6 +139,8 @@ namespace tfel::check {
     std::vector<std::string> configFiles;
     //! list of input files
     std::vector<std::string> inputs;
+    //! \brief number of tests executed simultaneously
+    unsigned int jobs = 1;
   };  // end of struct TFELCheck
 
   bool TFELCheck::treatSubstitution() {
@@ -191,6 +199,23 @@ namespace tfel::check {
                    parse(this->configurations, f);
                  },
                  true));
+    declare2("--jobs", "-j",
+             CallBack(
+                 "set the number of test files executed simultaneously",
+                 [this] {
+                   const auto& o = this->currentArgument->getOption();
+                   try {
+                     const auto n = std::stoi(o);
+                     tfel::raise_if(n <= 0, "invalid number of jobs");
+                     this->jobs = static_cast<unsigned int>(n);
+                   } catch (std::exception&) {
+                     tfel::raise(
+                         "TFELCheck::registerArgumentCallBacks: "
+                         "invalid number of jobs '" +
+                         o + "'");
+                   }
+                 },
+                 true));
     this->registerCallBack(
         "--list-default-components",
         CallBack(
@@ -223,62 +248,175 @@ namespace tfel::check {
     declareTFELExecutables(this->configurations);
   }  // end of TFELCheck::TFELCheck
 
+  /*!
+   * \brief run a test file
+   * \return true on success
+   * \param[in] c: configuration manager
+   * \param[in] log: logger
+   * \param[in] d: directory
+   * \param[in] f: test file
+   */
+  static bool runTestFile(ConfigurationManager& c,
+                          PCLogger& log,
+                          const std::string& d,
+                          const std::string& f) {
+    using namespace tfel::system;
+    const auto path = systemCall::getAbsolutePath(d);
+    log.addMessage("entering directory '" + path + "'");
+    try {
+      systemCall::changeCurrentWorkingDirectory(d);
+    } catch (std::exception& e) {
+      log.addMessage("can't move to directory '" + d + "' (" +
+                     std::string(e.what()) + ")");
+      log.addSimpleTestResult("* result of test '" + d + '/' + f + "'",
+                              false);
+      return false;
+    }
+    log.addMessage("* beginning of test '" + d + '/' + f + "'");
+    auto success = true;
+    try {
+      // if(this->file_version==TestLauncher::V1){
+      // 	TestLauncherV1 c(f,log);
+      // 	success = c.execute();
+      // } else {
+      auto configuration = c.getConfiguration(d);
+      configuration.log = log;
+      TestLauncher t(configuration, f);
+      success = t.execute(configuration);
+      //      }
+    } catch (std::exception& e) {
+      log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
+      success = false;
+    }
+    log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
+    log.addMessage("======");
+    return success;
+  }  // end of runTestFile
+
+#if !(defined _WIN32 || defined _WIN64)
+
+  /*!
+   * \brief run the given test files, using at most `n` processes.
+   *
+   * Each test file is executed in a child process, so that changing
+   * the current working directory in one test does not affect the
+   * others. The output of each child process is written in a temporary
+   * file which is appended to the log once all the previous tests are
+   * finished, so that the output does not depend on the number of
+   * processes.
+   *
+   * \return true if all tests succeeded
+   * \param[in] c: configuration manager
+   * \param[in] log: logger
+   * \param[in] tests: list of directories and test files
+   * \param[in] n: maximum number of processes
+   */
+  static bool runTestFiles(
+      ConfigurationManager& c,
+      PCLogger& log,
+      const std::vector<std::pair<std::string, std::string>>& tests,
+      const unsigned int n) {
+    using namespace tfel::system;
+    struct Job {
+      //! \brief temporary output file
+      std::string output;
+      //! \brief process id
+      pid_t pid = -1;
+      //! \brief flag stating if the job is finished
+      bool finished = false;
+      //! \brief result
+      bool success = false;
+    };
+    const auto top = systemCall::getCurrentWorkingDirectory();
+    const auto prefix = top + "/.tfel-check-" + std::to_string(::getpid());
+    auto jobs = std::vector<Job>(tests.size());
+    auto status = true;
+    auto next = std::vector<Job>::size_type{};
+    auto reported = std::vector<Job>::size_type{};
+    auto running = 0u;
+    while (reported != jobs.size()) {
+      // launching new jobs
+      while ((running < n) && (next != jobs.size())) {
+        auto& j = jobs[next];
+        j.output = prefix + "-" + std::to_string(next) + ".log";
+        // pending outputs must not be written twice
+        std::cout.flush();
+        j.pid = ::fork();
+        if (j.pid == 0) {
+          auto success = false;
+          {
+            auto clog = PCLogger(std::make_shared<PCTextDriver>(j.output));
+            success = runTestFile(c, clog, tests[next].first,
+                                  tests[next].second);
+            clog.terminate();
+          }
+          ::_exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        if (j.pid == -1) {
+          log.addMessage("can't launch test '" + tests[next].first + '/' +
+                         tests[next].second + "'");
+          j.finished = true;
+        } else {
+          ++running;
+        }
+        ++next;
+      }
+      // waiting for the end of a job
+      if (running != 0) {
+        auto s = int{};
+        const auto pid = ::waitpid(-1, &s, 0);
+        if (pid == -1) {
+          if (errno == EINTR) {
+            continue;
+          }
+          systemCall::throwSystemError("runTestFiles: waitpid failed", errno);
+        }
+        for (auto& j : jobs) {
+          if ((j.pid == pid) && (!j.finished)) {
+            j.finished = true;
+            j.success = WIFEXITED(s) && (WEXITSTATUS(s) == EXIT_SUCCESS);
+            --running;
+          }
+        }
+      }
+      // reporting the finished jobs in order
+      while ((reported != jobs.size()) && (jobs[reported].finished)) {
+        auto& j = jobs[reported];
+        if (!j.output.empty()) {
+          std::ifstream in(j.output);
+          if (in) {
+            std::ostringstream out;
+            out << in.rdbuf();
+            auto msg = out.str();
+            if ((!msg.empty()) && (msg.back() == '\n')) {
+              msg.pop_back();
+            }
+            log.addMessage(msg);
+          }
+          std::remove(j.output.c_str());
+        }
+        if (!j.success) {
+          status = false;
+        }
+        ++reported;
+      }
+    }
+    return status;
+  }  // end of runTestFiles
+
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
   int TFELCheck::execute() {
     using namespace std;
     auto log = PCLogger(std::make_shared<PCTextDriver>("tfel-check.log"));
     log.addDriver(std::make_shared<PCTextDriver>());
-    auto exe = [this, &log](const std::string& d, const std::string& f) {
-      using namespace tfel::system;
-      const auto cpath = systemCall::getCurrentWorkingDirectory();
-      const auto path = systemCall::getAbsolutePath(d);
-      log.addMessage("entering directory '" + path + "'");
-      try {
-        systemCall::changeCurrentWorkingDirectory(d);
-      } catch (std::exception& e) {
-        log.addMessage("can't move to directory '" + d + "' (" +
-                       std::string(e.what()) + ")");
-        log.addSimpleTestResult("* result of test '" + d + '/' + f + "'",
-                                false);
-        return false;
-      }
-      log.addMessage("* beginning of test '" + d + '/' + f + "'");
-      const auto name = d + '/' + f;
-      auto success = true;
-      try {
-        // if(this->file_version==TestLauncher::V1){
-        // 	TestLauncherV1 c(f,log);
-        // 	success = c.execute();
-        // } else {
-        auto c = this->configurations.getConfiguration(d);
-        c.log = log;
-        TestLauncher t(c, f);
-        success = t.execute(c);
-        //      }
-      } catch (std::exception& e) {
-        log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
-        success = false;
-      }
-      log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
-      log.addMessage("======");
-      try {
-        systemCall::changeCurrentWorkingDirectory(cpath);
-      } catch (std::exception& e) {
-        log.addMessage("can't move back to top directory '" + cpath + "' (" +
-                       std::string(e.what()) + ")");
-        log.addMessage("Aborting");
-        exit(EXIT_FAILURE);
-      }
-      return success;
-    };
-    int status = EXIT_SUCCESS;
+    auto tests = std::vector<std::pair<std::string, std::string>>{};
     if (this->inputs.empty()) {
       std::regex re(".+\\.check", std::regex_constants::extended);
       const auto& files = tfel::system::recursiveFind(re, ".", 0);
       for (const auto& d : files) {
         for (const auto& f : d.second) {
-          if (!exe(d.first, f)) {
-            status = EXIT_FAILURE;
-          }
+          tests.push_back({d.first, f});
         }
       }
     } else {
@@ -289,10 +427,32 @@ namespace tfel::check {
         const auto f = std::string(::basename(path2));
         ::free(path);
         ::free(path2);
-        // basename
-        if (!exe(d, f)) {
-          status = EXIT_FAILURE;
-        }
+        tests.push_back({d, f});
+      }
+    }
+    int status = EXIT_SUCCESS;
+#if !(defined _WIN32 || defined _WIN64)
+    if ((this->jobs > 1) && (tests.size() > 1)) {
+      if (!runTestFiles(this->configurations, log, tests, this->jobs)) {
+        status = EXIT_FAILURE;
+      }
+      log.terminate();
+      return status;
+    }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    for (const auto& [d, f] : tests) {
+      using namespace tfel::system;
+      const auto cpath = systemCall::getCurrentWorkingDirectory();
+      if (!runTestFile(this->configurations, log, d, f)) {
+        status = EXIT_FAILURE;
+      }
+      try {
+        systemCall::changeCurrentWorkingDirectory(cpath);
+      } catch (std::exception& e) {
+        log.addMessage("can't move back to top directory '" + cpath + "' (" +
+                       std::string(e.what()) + ")");
+        log.addMessage("Aborting");
+        exit(EXIT_FAILURE);
       }
     }
     log.terminate();
@@ -0,0 +1,79 @@
+# This script checks the parallel execution of `tfel-check`:
+#
+# - test files are executed concurrently using the `--jobs` option.
+# - in each test file, many short commands are executed concurrently.
+#   Those commands are likely to end before `tfel-check` waits for
+#   them, which used to block `tfel-check` forever.
+# - the results are reported in the order of the test files.
+# - failures are reported.
+
+# arguments checking
+foreach(v TEST_PROGRAM TEST_DIRECTORY)
+  if(NOT ${v})
+    message(FATAL_ERROR "Require ${v} to be defined")
+  endif(NOT ${v})
+endforeach(v)
+
+file(REMOVE_RECURSE ${TEST_DIRECTORY})
+file(MAKE_DIRECTORY ${TEST_DIRECTORY})
+
+set(ntests 8)
+set(test_files )
+foreach(i RANGE 1 ${ntests})
+  set(commands "")
+  foreach(c RANGE 1 8)
+    string(APPEND commands
+      "@Command \"${CMAKE_COMMAND} -E true\"{concurrent : true};\n")
+  endforeach(c)
+  file(WRITE ${TEST_DIRECTORY}/test-${i}.check "${commands}")
+  list(APPEND test_files test-${i}.check)
+endforeach(i)
+file(WRITE ${TEST_DIRECTORY}/failure.check
+"@Command \"${CMAKE_COMMAND} -E true\"{concurrent : true};
+@Command \"${CMAKE_COMMAND} -E false\"{concurrent : true};
+")
+
+# run tfel-check on the given files
+# \param[in] expected_result: expected result
+function(run_tfel_check expected_result)
+  execute_process(
+    COMMAND ${TEST_PROGRAM} --jobs=4 ${ARGN}
+    WORKING_DIRECTORY ${TEST_DIRECTORY}
+    OUTPUT_VARIABLE TEST_OUTPUT
+    ERROR_VARIABLE TEST_ERROR
+    RESULT_VARIABLE TEST_RESULT
+    TIMEOUT 60)
+  if(expected_result AND TEST_RESULT)
+    message(FATAL_ERROR "Failed: Test program ${TEST_PROGRAM} exited != 0.\n${TEST_OUTPUT}\n${TEST_ERROR}")
+  endif(expected_result AND TEST_RESULT)
+  if((NOT expected_result) AND (NOT TEST_RESULT))
+    message(FATAL_ERROR "Failed: Test program ${TEST_PROGRAM} unexpectedly succeeded.\n${TEST_OUTPUT}")
+  endif((NOT expected_result) AND (NOT TEST_RESULT))
+  set(TEST_OUTPUT "${TEST_OUTPUT}" PARENT_SCOPE)
+endfunction(run_tfel_check)
+
+# the execution is repeated to increase the chance of triggering races
+foreach(r RANGE 1 10)
+  run_tfel_check(ON ${test_files})
+endforeach(r)
+
+# the results are reported in the order of the test files
+set(previous -1)
+foreach(f ${test_files})
+  string(FIND "${TEST_OUTPUT}" "end of test './${f}'" pos)
+  if(pos LESS 0)
+    message(FATAL_ERROR "Failed: no result reported for '${f}'.\n${TEST_OUTPUT}")
+  endif(pos LESS 0)
+  if(NOT pos GREATER previous)
+    message(FATAL_ERROR "Failed: results not reported in order.\n${TEST_OUTPUT}")
+  endif(NOT pos GREATER previous)
+  set(previous ${pos})
+endforeach(f)
+
+# a failing command is reported as such
+run_tfel_check(OFF test-1.check failure.check test-2.check)
+string(REGEX MATCH "end of test './failure.check'[^\n]*FAILED" failed
+  "${TEST_OUTPUT}")
+if(NOT failed)
+  message(FATAL_ERROR "Failed: failure not reported.\n${TEST_OUTPUT}")
+endif(NOT failed)